@@ -4,9 +4,11 @@
 #include <time.h>
 #include <math.h>
 
+// Matrices come from the matrix module of assignment06_FFT (one aligned block per matrix):
+// gcc -O2 -I../assignment06_FFT -o 3b_matmul 3b_matmul.c ../assignment06_FFT/matrix.c -lm
+#include "matrix.h"
+
 void compute_product(double **A, double **B, double **C, int N);
-void free_matrix(double **matrix, int N);
-double **allocate_matrix(int N);
 bool test_result(double **C, int N, double expected_value);
 
 int main() {
@@ -17,9 +19,9 @@ int main() {
         printf("\nTesting NxN = %d x %d\n", N, N);
         
         // Memory allocation
-        double **A = allocate_matrix(N);
-        double **B = allocate_matrix(N);
-        double **C = allocate_matrix(N);
+        double **A = matrix_create(N, N);
+        double **B = matrix_create(N, N);
+        double **C = matrix_create(N, N);
         
         // Initialize matrices
         for (int i = 0; i < N; i++) {
@@ -45,9 +47,9 @@ int main() {
         printf("Execution time for N = %d: %.8f seconds\n", N, (double)(end - start) / CLOCKS_PER_SEC);
         
         // Free memory
-        free_matrix(A, N);
-        free_matrix(B, N);
-        free_matrix(C, N);
+        matrix_destroy(A);
+        matrix_destroy(B);
+        matrix_destroy(C);
     }
     
     return 0;
@@ -61,30 +63,6 @@ void compute_product(double **A, double **B, double **C, int N) {
     }
 }
 
-void free_matrix(double **matrix, int N) {
-    for (int i = 0; i < N; i++) {
-        free(matrix[i]);
-    }
-    free(matrix);
-}
-
-double **allocate_matrix(int N) {
-    double **matrix = (double**) malloc(N * sizeof(double*));
-    if (!matrix) {
-        printf("Memory allocation failed!\n");
-        exit(1);
-    }
-
-    for (int i = 0; i < N; i++) {
-        matrix[i] = (double*) malloc(N * sizeof(double));
-        if (!matrix[i]) {
-            printf("Memory allocation failed!\n");
-            exit(1);
-        }
-    }
-    return matrix;
-}
-
 bool test_result(double **C, int N, double expected_value) {
     const double epsilon = 1e-5;  // Tolerance for floating point comparison
     for (int i = 0; i < N; i++) {
@@ -5,25 +5,32 @@
 #include <string.h>
 #include <float.h>
 
+#include "fft_engine.h"
+#include "fft_simd.h"
+#include "fft_precision.h"
+#include "fft_errors.h"
+#include "fft_sdft.h"
+#include "fft_writer.h"
+#include "matrix.h"
+#include "fft_internal.h"
+
 #define DIM 1000
 #define PI acos(-1.0)
 #define DUPPRINT(fp, fmt...) do {printf(fmt);fprintf(fp,fmt);} while(0)
 
-typedef struct {
-    double real;
-    double imag;
-} Complex;
-
-double **allocate_matrix(int N);
-void free_matrix(double **matrix, int N);
 void fill_gaussian_matrix(double **matrix, int N);
 void print_errors(double **original, double **reconstructed, int N, FILE *file);
-void fft2d(Complex *data, int N, int is_inverse);
-void fft(Complex *data, int N, int is_inverse);
-void fft_real(double *input, Complex *output, int N);
-void ifft_real(Complex *input, double *output, int N);
-void save_matrix(const char *filename, double **matrix, int N);
-void save_complex_matrix(const char *filename, Complex *matrix, int N);
+void fft_recursive(Complex *data, int N, int is_inverse);
+void compare_fft_engines(int N, int count, FILE *file);
+void compare_sliding_dft(int N, int samples, FILE *file);
+void compare_precisions(double **A, int N, FILE *file);
+void compare_writers(Complex *C, int N, FILE *file);
+void save_matrix(const char *name, double **matrix, int N, FILE *file);
+void save_complex_matrix(const char *name, Complex *matrix, int rows, int cols, FILE *file);
+
+// Writer used by save_matrix and save_complex_matrix, from the FFT_OUTPUT_FORMAT environment
+// variable (text, binary or hdf5; default binary)
+static const fft_writer *output_writer;
 
 void reconstruct_C_from_R(Complex *R, Complex *C, int N) {
     // Copy first half + 1 columns
@@ -33,11 +40,12 @@ void reconstruct_C_from_R(Complex *R, Complex *C, int N) {
         }
     }
     
-    // Reconstruct remaining columns using conjugate symmetry
+    // Reconstruct remaining columns using the 2D conjugate symmetry C[i,j] = conj(C[-i,-j])
     for(int i = 0; i < N; i++) {
+        int mirrored_row = (N - i) % N;
         for(int j = N/2 + 1; j < N; j++) {
-            C[i*N + j].real = C[i*N + (N-j)].real;
-            C[i*N + j].imag = -C[i*N + (N-j)].imag;
+            C[i*N + j].real = C[mirrored_row*N + (N-j)].real;
+            C[i*N + j].imag = -C[mirrored_row*N + (N-j)].imag;
         }
     }
 }
@@ -50,14 +58,21 @@ int main() {
         return 1;
     }
 
+    const char *format_env = getenv("FFT_OUTPUT_FORMAT");
+    output_writer = fft_writer_find(format_env ? format_env : "binary");
+    if (!output_writer) {
+        printf("Unknown or unavailable output format %s (use text, binary or hdf5)\n", format_env);
+        return 1;
+    }
+
     clock_t start, end;
     double cpu_time_used;
     
     // Allocate matrices
     DUPPRINT(results_file, "Allocating matrices...\n");
-    double **A = allocate_matrix(DIM);
-    double **A_reconstructed_c2c = allocate_matrix(DIM);
-    double **A_reconstructed_r2c = allocate_matrix(DIM);
+    double **A = matrix_create(DIM, DIM);
+    double **A_reconstructed_c2c = matrix_create(DIM, DIM);
+    double **A_reconstructed_r2c = matrix_create(DIM, DIM);
     
     // Fill matrix A with Gaussian random numbers
     DUPPRINT(results_file, "Generating Gaussian random numbers...\n");
@@ -67,13 +82,29 @@ int main() {
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "Matrix generation time: %f seconds\n", cpu_time_used);
     
-    save_matrix("A.txt", A, DIM);
-    DUPPRINT(results_file, "Matrix A generated and saved to A.txt\n");
+    save_matrix("A", A, DIM, results_file);
+    DUPPRINT(results_file, "Matrix A generated and saved to A%s\n", output_writer->extension);
     
     // Allocate complex arrays
     Complex *C = (Complex*)malloc(DIM * DIM * sizeof(Complex));
     Complex *R = (Complex*)malloc(DIM * (DIM/2 + 1) * sizeof(Complex));
     
+    // Threads used by the 2D plans, from the FFT_NUM_THREADS environment variable (default 1)
+    const char *threads_env = getenv("FFT_NUM_THREADS");
+    fft_plan_with_nthreads(threads_env ? atoi(threads_env) : 1);
+
+    // Create FFT plans: tables and scratch memory are set up once and reused by every execution
+    DUPPRINT(results_file, "Creating FFT plans (butterflies: %s, threads: %d)...\n",
+             fft_simd_level_name(fft_simd_level_detect()), fft_planner_nthreads());
+    start = clock();
+    fft_plan plan_c2c_forward = fft_plan_create_2d(DIM, DIM, FFT_FORWARD, FFT_DEFAULT);
+    fft_plan plan_c2c_backward = fft_plan_create_2d(DIM, DIM, FFT_BACKWARD, FFT_DEFAULT);
+    fft_plan plan_r2c = fft_plan_create_r2c_2d(DIM, DIM, FFT_DEFAULT);
+    fft_plan plan_c2r = fft_plan_create_c2r_2d(DIM, DIM, FFT_DEFAULT);
+    end = clock();
+    cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
+    DUPPRINT(results_file, "Plan creation time: %f seconds\n", cpu_time_used);
+    
     // 1) Perform c2c FFT
     DUPPRINT(results_file, "\n1) Performing complex-to-complex FFT...\n");
     start = clock();
@@ -83,18 +114,18 @@ int main() {
             C[i*DIM + j].imag = 0.0;
         }
     }
-    fft2d(C, DIM, 0);
+    fft_execute(plan_c2c_forward, C, C);
     end = clock();
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "c2c FFT time: %f seconds\n", cpu_time_used);
     
-    save_complex_matrix("C.txt", C, DIM);
-    DUPPRINT(results_file, "Complex-to-complex FFT completed. Matrix C saved to C.txt\n");
+    save_complex_matrix("C", C, DIM, DIM, results_file);
+    DUPPRINT(results_file, "Complex-to-complex FFT completed. Matrix C saved to C%s\n", output_writer->extension);
     
     // 2) Reconstruct A using inverse c2c FFT
     DUPPRINT(results_file, "\n2) Reconstructing A using inverse complex-to-complex FFT...\n");
     start = clock();
-    fft2d(C, DIM, 1);
+    fft_execute(plan_c2c_backward, C, C);
     for(int i = 0; i < DIM; i++) {
         for(int j = 0; j < DIM; j++) {
             A_reconstructed_c2c[i][j] = C[i*DIM + j].real / (DIM * DIM);
@@ -104,7 +135,7 @@ int main() {
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "Inverse c2c FFT time: %f seconds\n", cpu_time_used);
     
-    save_matrix("A_reconstructed_c2c.txt", A_reconstructed_c2c, DIM);
+    save_matrix("A_reconstructed_c2c", A_reconstructed_c2c, DIM, results_file);
     
     printf("Errors for complex-to-complex FFT:\n");
     DUPPRINT(results_file, "Errors for complex-to-complex FFT:\n");
@@ -113,23 +144,28 @@ int main() {
     // 3) Perform r2c FFT
     DUPPRINT(results_file, "\n3) Performing real-to-complex FFT...\n");
     start = clock();
-    fft_real(A[0], R, DIM);
+    fft_execute_r2c(plan_r2c, matrix_data(A), R); // A is one contiguous row-major array
     end = clock();
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "r2c FFT time: %f seconds\n", cpu_time_used);
     
-    save_complex_matrix("R.txt", R, DIM/2 + 1);
-    DUPPRINT(results_file, "Real-to-complex FFT completed. Matrix R saved to R.txt\n");
+    save_complex_matrix("R", R, DIM, DIM/2 + 1, results_file);
+    DUPPRINT(results_file, "Real-to-complex FFT completed. Matrix R saved to R%s\n", output_writer->extension);
+    Complex R00 = R[0]; // the c2r transform below overwrites R
     
     // 4) Reconstruct A using inverse c2r FFT
     DUPPRINT(results_file, "\n4) Reconstructing A using inverse complex-to-real FFT...\n");
     start = clock();
-    ifft_real(R, A_reconstructed_r2c[0], DIM);
+    double *a_r2c = matrix_data(A_reconstructed_r2c);
+    fft_execute_c2r(plan_c2r, R, a_r2c);
+    for(int i = 0; i < DIM * DIM; i++) {
+        a_r2c[i] /= DIM * DIM;
+    }
     end = clock();
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "Inverse c2r FFT time: %f seconds\n", cpu_time_used);
     
-    save_matrix("A_reconstructed_r2c.txt", A_reconstructed_r2c, DIM);
+    save_matrix("A_reconstructed_r2c", A_reconstructed_r2c, DIM, results_file);
     
     DUPPRINT(results_file, "Errors for real-to-complex FFT:\n");
     print_errors(A, A_reconstructed_r2c, DIM, results_file);
@@ -140,16 +176,18 @@ int main() {
     
     // 6) Print C[0,0] and R[0,0]
     DUPPRINT(results_file, "\n6) C[0,0] = %e + %e i\n", C[0].real, C[0].imag);
-    DUPPRINT(results_file, "R[0,0] = %e + %e i\n", R[0].real, R[0].imag);
+    DUPPRINT(results_file, "R[0,0] = %e + %e i\n", R00.real, R00.imag);
     
     // 7) Bonus: 6x6 case
     DUPPRINT(results_file, "\n7) Bonus: 6x6 case\n");
     DUPPRINT(results_file, "Initializing 6x6 matrices...\n");
     
-    double **A6 = allocate_matrix(6);
+    double **A6 = matrix_create(6, 6);
     Complex *C6 = (Complex*)malloc(6 * 6 * sizeof(Complex));
     Complex *R6 = (Complex*)malloc(6 * (6/2 + 1) * sizeof(Complex));
     Complex *C6_from_R = (Complex*)malloc(6 * 6 * sizeof(Complex));
+    fft_plan plan_c2c_forward_6 = fft_plan_create_2d(6, 6, FFT_FORWARD, FFT_DEFAULT);
+    fft_plan plan_r2c_6 = fft_plan_create_r2c_2d(6, 6, FFT_DEFAULT);
     
     DUPPRINT(results_file, "Generating Gaussian random numbers for 6x6 matrix...\n");
     start = clock();
@@ -158,8 +196,8 @@ int main() {
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "6x6 matrix generation time: %f seconds\n", cpu_time_used);
     
-    save_matrix("A6.txt", A6, 6);
-    DUPPRINT(results_file, "Matrix A6 generated and saved to A6.txt\n");
+    save_matrix("A6", A6, 6, results_file);
+    DUPPRINT(results_file, "Matrix A6 generated and saved to A6%s\n", output_writer->extension);
     
     // Perform c2c FFT
     DUPPRINT(results_file, "\nPerforming complex-to-complex FFT for 6x6 case...\n");
@@ -170,24 +208,26 @@ int main() {
             C6[i*6 + j].imag = 0.0;
         }
     }
-    fft2d(C6, 6, 0);
+    fft_execute(plan_c2c_forward_6, C6, C6);
     end = clock();
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "6x6 c2c FFT time: %f seconds\n", cpu_time_used);
     
-    save_complex_matrix("C6.txt", C6, 6);
-    DUPPRINT(results_file, "Complex-to-complex FFT completed for 6x6 case. Matrix C6 saved to C6.txt\n");
+    save_complex_matrix("C6", C6, 6, 6, results_file);
+    DUPPRINT(results_file, "Complex-to-complex FFT completed for 6x6 case. Matrix C6 saved to C6%s\n",
+             output_writer->extension);
     
     // Perform r2c FFT
     DUPPRINT(results_file, "\nPerforming real-to-complex FFT for 6x6 case...\n");
     start = clock();
-    fft_real(A6[0], R6, 6);
+    fft_execute_r2c(plan_r2c_6, matrix_data(A6), R6);
     end = clock();
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "6x6 r2c FFT time: %f seconds\n", cpu_time_used);
     
-    save_complex_matrix("R6.txt", R6, 6/2 + 1);
-    DUPPRINT(results_file, "Real-to-complex FFT completed for 6x6 case. Matrix R6 saved to R6.txt\n");
+    save_complex_matrix("R6", R6, 6, 6/2 + 1, results_file);
+    DUPPRINT(results_file, "Real-to-complex FFT completed for 6x6 case. Matrix R6 saved to R6%s\n",
+             output_writer->extension);
     
     // Reconstruct C from R
     DUPPRINT(results_file, "\nReconstructing C from R for 6x6 case...\n");
@@ -197,39 +237,18 @@ int main() {
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "6x6 C reconstruction time: %f seconds\n", cpu_time_used);
     
-    save_complex_matrix("C6_from_R.txt", C6_from_R, 6);
-    DUPPRINT(results_file, "C reconstruction completed for 6x6 case. Matrix C6_from_R saved to C6_from_R.txt\n");
+    save_complex_matrix("C6_from_R", C6_from_R, 6, 6, results_file);
+    DUPPRINT(results_file, "C reconstruction completed for 6x6 case. Matrix C6_from_R saved to C6_from_R%s\n",
+             output_writer->extension);
     
     // Calculate errors
     DUPPRINT(results_file, "\nErrors for C reconstruction from R (6x6):\n");
-    double sum_abs_error = 0.0;
-    double sum_rel_error = 0.0;
-    int count_rel = 0;
-    const double threshold = 1e-10;
-    
-    for(int i = 0; i < 6; i++) {
-        for(int j = 0; j < 6; j++) {
-            double abs_error_real = fabs(C6[i*6 + j].real - C6_from_R[i*6 + j].real);
-            double abs_error_imag = fabs(C6[i*6 + j].imag - C6_from_R[i*6 + j].imag);
-            double abs_error = sqrt(abs_error_real * abs_error_real + abs_error_imag * abs_error_imag);
-            
-            sum_abs_error += abs_error * abs_error;
-            
-            double magnitude = sqrt(C6[i*6 + j].real * C6[i*6 + j].real + 
-                                  C6[i*6 + j].imag * C6[i*6 + j].imag);
-            if(magnitude > threshold) {
-                double rel_error = abs_error / magnitude;
-                sum_rel_error += rel_error * rel_error;
-                count_rel++;
-            }
-        }
-    }
-    
-    double mean_abs_error = sqrt(sum_abs_error / (6 * 6));
-    double mean_rel_error = count_rel > 0 ? sqrt(sum_rel_error / count_rel) : 0.0;
-    
-    DUPPRINT(results_file, "Mean absolute error: %e\n", mean_abs_error);
-    DUPPRINT(results_file, "Mean relative error: %e (calculated over %d non-zero values)\n", mean_rel_error, count_rel);
+    fft_error_source source6 = fft_error_source_complex(C6, C6_from_R, 6 * 6);
+    fft_error_stats stats6;
+    fft_error_stats_compute(&source6, 1e-10, &stats6);
+    DUPPRINT(results_file, "RMS absolute error: %e\n", stats6.rms_abs);
+    DUPPRINT(results_file, "RMS relative error: %e (calculated over %ld non-zero values)\n", stats6.rms_rel,
+             stats6.count_rel);
     
     // Print some values for comparison  
     DUPPRINT(results_file, "\nComparison of some values:\n");
@@ -238,78 +257,84 @@ int main() {
     DUPPRINT(results_file, "C6[1,1]: %e + i%e\n", C6[7].real, C6[7].imag);
     DUPPRINT(results_file, "C6_from_R[1,1]: %e + i%e\n", C6_from_R[7].real, C6_from_R[7].imag);
     
+    // 8) Iterative vs recursive 1D FFT engine (power-of-two size, one row pass of a 1024x1024 grid)
+    DUPPRINT(results_file, "\n8) Iterative vs recursive FFT engine\n");
+    compare_fft_engines(1024, 1024, results_file);
+
+    // 9) Same c2c roundtrip in float, double and long double (precision-generic engine)
+    DUPPRINT(results_file, "\n9) Precision comparison (2D c2c forward + backward of A)\n");
+    compare_precisions(A, DIM, results_file);
+    
+    // 10) Write bandwidth of the output formats
+    DUPPRINT(results_file, "\n10) Output formats (C, %dx%d complex)\n", DIM, DIM);
+    compare_writers(C, DIM, results_file);
+
+    // 11) Spectrum of a stream after every sample: sliding DFT updates against fft() of the window
+    DUPPRINT(results_file, "\n11) Sliding DFT update latency\n");
+    compare_sliding_dft(1024, 200000, results_file);
+    
     // Clean up
     DUPPRINT(results_file, "\nCleaning up memory...\n");
     
+    fft_plan_destroy(plan_c2c_forward);
+    fft_plan_destroy(plan_c2c_backward);
+    fft_plan_destroy(plan_r2c);
+    fft_plan_destroy(plan_c2r);
+    fft_plan_destroy(plan_c2c_forward_6);
+    fft_plan_destroy(plan_r2c_6);
+    fft_cleanup();
+    fft_cleanup_threads();
+    
     free(C);
     free(R);
     free(C6);
     free(R6);
     free(C6_from_R);
-    free_matrix(A, DIM);
-    free_matrix(A_reconstructed_c2c, DIM);
-    free_matrix(A_reconstructed_r2c, DIM);
-    free_matrix(A6, 6);
+    matrix_destroy(A);
+    matrix_destroy(A_reconstructed_c2c);
+    matrix_destroy(A_reconstructed_r2c);
+    matrix_destroy(A6);
     
     fclose(results_file);
     printf("Program completed successfully!\n");
     return 0;
 }
 
-void save_matrix(const char *filename, double **matrix, int N) {
-    FILE *fp = fopen(filename, "w");
-    if (!fp) {
-        printf("Error opening file %s\n", filename);
-        return;
+void save_matrix(const char *name, double **matrix, int N, FILE *file) {
+    char filename[256];
+    snprintf(filename, sizeof(filename), "%s%s", name, output_writer->extension);
+    fft_write_stats stats;
+    if(fft_write_rows(output_writer, filename, matrix, N, N, &stats) == 0) {
+        DUPPRINT(file, "Saved %s: %.2f MB in %.4f seconds (%.0f MB/s)\n", filename, stats.bytes / 1e6, stats.seconds,
+                 stats.bytes / 1e6 / stats.seconds);
     }
-    
-    for(int i = 0; i < N; i++) {
-        for(int j = 0; j < N; j++) {
-            fprintf(fp, "%e ", matrix[i][j]);
-        }
-        fprintf(fp, "\n");
-    }
-    
-    fclose(fp);
 }
 
-void save_complex_matrix(const char *filename, Complex *matrix, int N) {
-    FILE *fp = fopen(filename, "w");
-    if (!fp) {
-        printf("Error opening file %s\n", filename);
-        return;
+void save_complex_matrix(const char *name, Complex *matrix, int rows, int cols, FILE *file) {
+    char filename[256];
+    snprintf(filename, sizeof(filename), "%s%s", name, output_writer->extension);
+    fft_write_stats stats;
+    if(fft_write_matrix(output_writer, filename, (const double*)matrix, rows, cols, FFT_WRITER_COMPLEX, &stats) == 0) {
+        DUPPRINT(file, "Saved %s: %.2f MB in %.4f seconds (%.0f MB/s)\n", filename, stats.bytes / 1e6, stats.seconds,
+                 stats.bytes / 1e6 / stats.seconds);
     }
-    
-    for(int i = 0; i < N; i++) {
-        fprintf(fp, "%e + i%e \n", matrix[i].real, matrix[i].imag);
-    }
-    
-    fclose(fp);
 }
 
-// data is a 2D NxN array of complex numbers reshaped into a 1D array
-void fft2d(Complex *data, int N, int is_inverse) {
-    // FFT along rows
-    for(int i = 0; i < N; i++) {
-        fft(&data[i*N], N, is_inverse);
+// Writes C with every compiled-in writer to C_bench.* and prints the size and write bandwidth
+void compare_writers(Complex *C, int N, FILE *file) {
+    DUPPRINT(file, "%-8s %-14s %10s %10s %10s\n", "Format", "File", "Size (MB)", "Time (s)", "MB/s");
+    for(int i = 0; fft_writers[i]; i++) {
+        char filename[64];
+        snprintf(filename, sizeof(filename), "C_bench%s", fft_writers[i]->extension);
+        fft_write_stats stats;
+        if(fft_write_matrix(fft_writers[i], filename, (const double*)C, N, N, FFT_WRITER_COMPLEX, &stats) != 0) continue;
+        DUPPRINT(file, "%-8s %-14s %10.2f %10.4f %10.0f\n", fft_writers[i]->name, filename, stats.bytes / 1e6,
+                 stats.seconds, stats.bytes / 1e6 / stats.seconds);
     }
-    
-    // FFT along columns
-    Complex *column = (Complex*)malloc(N * sizeof(Complex));
-    for(int j = 0; j < N; j++) {
-        for(int i = 0; i < N; i++) {
-            column[i] = data[i*N + j]; // here we are copying the j-th column of data into column
-        }
-        fft(column, N, is_inverse);
-        for(int i = 0; i < N; i++) {
-            data[i*N + j] = column[i];
-        }
-    }
-    free(column);
 }
 
-// Cooley-Tukey (divide et impera) FFT algorithm
-void fft(Complex *data, int N, int is_inverse) {
+// Recursive Cooley-Tukey (divide et impera) FFT algorithm, kept as reference for compare_fft_engines
+void fft_recursive(Complex *data, int N, int is_inverse) {
     if(N <= 1) return;
     
     // Divide
@@ -322,12 +347,12 @@ void fft(Complex *data, int N, int is_inverse) {
     }
     
     // Conquer
-    fft(even, N/2, is_inverse);
-    fft(odd, N/2, is_inverse);
+    fft_recursive(even, N/2, is_inverse);
+    fft_recursive(odd, N/2, is_inverse);
     
     // Combine
     for(int k = 0; k < N/2; k++) {
-        double angle = 2 * PI * k / N * (is_inverse ? -1 : 1);
+        double angle = 2 * PI * k / N * (is_inverse ? 1 : -1);
         Complex twiddle = {
             cos(angle),
             sin(angle)
@@ -348,69 +373,222 @@ void fft(Complex *data, int N, int is_inverse) {
     free(odd);
 }
 
-// optimized FFT for real data (only the first half + 1 of the complex output is needed)
-void fft_real(double *input, Complex *output, int N) {
-    Complex *temp = (Complex*)malloc(N * sizeof(Complex));
-    
+// Time `count` transforms of size N with the iterative and the recursive engine
+void compare_fft_engines(int N, int count, FILE *file) {
+    Complex *input = (Complex*)malloc(N * sizeof(Complex));
+    Complex *iterative = (Complex*)malloc(N * sizeof(Complex));
+    Complex *recursive = (Complex*)malloc(N * sizeof(Complex));
+    if (!input || !iterative || !recursive) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
     for(int i = 0; i < N; i++) {
-        temp[i].real = input[i];
-        temp[i].imag = 0.0;
+        input[i].real = (double)rand() / RAND_MAX - 0.5;
+        input[i].imag = (double)rand() / RAND_MAX - 0.5;
     }
-    
-    fft(temp, N, 0);
-    
-    // Only store first half + 1 for real FFT
-    for(int i = 0; i < N/2 + 1; i++) {
-        output[i] = temp[i];
+
+    clock_t start = clock();
+    for(int r = 0; r < count; r++) {
+        memcpy(recursive, input, N * sizeof(Complex));
+        fft_recursive(recursive, N, 0);
     }
-    
-    free(temp);
+    double time_recursive = ((double) (clock() - start)) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for(int r = 0; r < count; r++) {
+        memcpy(iterative, input, N * sizeof(Complex));
+        fft(iterative, N, 0);
+    }
+    double time_iterative = ((double) (clock() - start)) / CLOCKS_PER_SEC;
+
+    double max_diff = 0.0;
+    for(int i = 0; i < N; i++) {
+        double diff = hypot(iterative[i].real - recursive[i].real, iterative[i].imag - recursive[i].imag);
+        if(diff > max_diff) max_diff = diff;
+    }
+
+    DUPPRINT(file, "%d transforms of size %d\n", count, N);
+    DUPPRINT(file, "Recursive fft time: %f seconds\n", time_recursive);
+    DUPPRINT(file, "Iterative fft time: %f seconds\n", time_iterative);
+    DUPPRINT(file, "Speedup: %.2fx\n", time_iterative > 0 ? time_recursive / time_iterative : 0.0);
+    DUPPRINT(file, "Max difference between engines: %e\n", max_diff);
+
+    free(input);
+    free(iterative);
+    free(recursive);
 }
 
-// Here we reconstruct the full spectrum from the half spectrum before applying the inverse FFT
-void ifft_real(Complex *input, double *output, int N) {
-    Complex *temp = (Complex*)malloc(N * sizeof(Complex));
-    
-    // Reconstruct full spectrum from half spectrum
-    for(int i = 0; i < N/2 + 1; i++) {
-        temp[i] = input[i];
+static int compare_doubles(const void *a, const void *b) {
+    double da = *(const double*)a;
+    double db = *(const double*)b;
+    return (da > db) - (da < db);
+}
+
+// Sorts the latencies of count updates and prints their median, 99th percentile and maximum in
+// microseconds, and the largest difference of the final bins from the FFT of the window relative
+// to its largest magnitude
+static void print_latency(FILE *file, const char *name, double *latency, int count, double error) {
+    qsort(latency, count, sizeof(double), compare_doubles);
+    DUPPRINT(file, "%-30s %12.3f %12.3f %12.3f %12.3e\n", name, 1e6 * latency[count/2],
+             1e6 * latency[(int)(0.99 * (count - 1))], 1e6 * latency[count - 1], error);
+}
+
+// Error of the tracked bins against the FFT of the window
+static double sliding_dft_error(fft_sdft sdft, const int *bins, const Complex *reference, int N) {
+    int count = fft_sdft_count(sdft);
+    Complex *out = (Complex*)malloc(count * sizeof(Complex));
+    if (!out) {
+        printf("Memory allocation failed!\n");
+        exit(1);
     }
-    for(int i = N/2 + 1; i < N; i++) {
-        temp[i].real = temp[N-i].real;
-        temp[i].imag = -temp[N-i].imag;
+    fft_sdft_spectrum(sdft, out);
+    double error = 0.0, scale = 0.0;
+    for(int k = 0; k < N; k++) {
+        scale = fmax(scale, hypot(reference[k].real, reference[k].imag));
     }
-    
-    fft(temp, N, 1);
-    
-    for(int i = 0; i < N; i++) {
-        output[i] = temp[i].real / N;
+    for(int b = 0; b < count; b++) {
+        int k = bins ? bins[b] : b;
+        error = fmax(error, hypot(out[b].real - reference[k].real, out[b].imag - reference[k].imag));
     }
-    
-    free(temp);
+    free(out);
+    return error / scale;
 }
 
-double **allocate_matrix(int N) {
-    double **matrix = (double **)malloc(N * sizeof(double *));
-    if (!matrix) {
+// Spectrum of the last N samples of a stream after every new sample: sliding DFT of all N/2+1
+// bins (never resynchronized, and resynchronized by an FFT every N samples) and of 8 bins, against
+// fft() of the window for every sample, which is timed on the first 20000 samples only
+void compare_sliding_dft(int N, int samples, FILE *file) {
+    double *stream = (double*)malloc(samples * sizeof(double));
+    double *latency = (double*)malloc(samples * sizeof(double));
+    Complex *window = (Complex*)malloc(N * sizeof(Complex));
+    Complex *reference = (Complex*)malloc(N * sizeof(Complex));
+    if (!stream || !latency || !window || !reference) {
         printf("Memory allocation failed!\n");
         exit(1);
     }
+    for(int i = 0; i < samples; i++) {
+        stream[i] = sin(0.05 * i) + (double)rand() / RAND_MAX - 0.5;
+    }
+    for(int m = 0; m < N; m++) {
+        window[m].real = samples - N + m >= 0 ? stream[samples - N + m] : 0.0;
+        window[m].imag = 0.0;
+    }
+    memcpy(reference, window, N * sizeof(Complex));
+    fft(reference, N, 0);
 
-    for (int i = 0; i < N; i++) {
-        matrix[i] = (double *)malloc(N * sizeof(double));
-        if (!matrix[i]) {
-            printf("Memory allocation failed!\n");
-            exit(1);
+    DUPPRINT(file, "Window N = %d, %d samples; latency of one update [us]\n", N, samples);
+    DUPPRINT(file, "%-30s %12s %12s %12s %12s\n", "Method", "Median", "99th", "Max", "Final error");
+
+    int bins[8];
+    for(int b = 0; b < 8; b++) bins[b] = (b + 1) * N / 32; // low-frequency bins of a monitor
+    const char *names[] = {"SDFT, all bins, no resync", "SDFT, all bins, resync every N", "SDFT, 8 bins, resync every N"};
+    for(int variant = 0; variant < 3; variant++) {
+        fft_sdft sdft = variant < 2 ? fft_sdft_create(N, NULL, 0, variant == 0 ? 0 : N, FFT_DEFAULT)
+                                    : fft_sdft_create(N, bins, 8, N, FFT_DEFAULT);
+        for(int i = 0; i < samples; i++) {
+            double start = wall_time();
+            fft_sdft_push(sdft, stream + i, 1);
+            latency[i] = wall_time() - start;
         }
+        print_latency(file, names[variant], latency, samples, sliding_dft_error(sdft, variant < 2 ? NULL : bins, reference, N));
+        fft_sdft_destroy(sdft);
     }
-    return matrix;
+
+    // The window is copied out of the stream, as a ring buffer would have to be unrolled
+    int timed = samples < 20000 ? samples : 20000;
+    for(int i = 0; i < timed; i++) {
+        double start = wall_time();
+        for(int m = 0; m < N; m++) {
+            int j = i + 1 - N + m;
+            window[m].real = j >= 0 ? stream[j] : 0.0;
+            window[m].imag = 0.0;
+        }
+        fft(window, N, 0);
+        latency[i] = wall_time() - start;
+    }
+    print_latency(file, "fft() of the window", latency, timed, 0.0);
+
+    free(stream);
+    free(latency);
+    free(window);
+    free(reference);
+}
+
+// 2D forward and backward transform of A with one family of plans (fft_ of fft_engine.h, fftf_ and
+// fftl_ of fft_precision.h): the normalized real part goes to reconstructed, the times (clock) to
+// times[0] (forward) and times[1] (backward)
+#define DEFINE_PRECISION_ROUNDTRIP(prefix, complex_type)                                        \
+static void prefix##_roundtrip(double **A, double **reconstructed, int N, double *times) {    \
+    complex_type *data = (complex_type*)malloc((size_t)N * N * sizeof(complex_type));         \
+    if (!data) {                                                                              \
+        printf("Memory allocation failed!\n");                                                \
+        exit(1);                                                                              \
+    }                                                                                         \
+    prefix##_plan forward = prefix##_plan_create_2d(N, N, FFT_FORWARD, FFT_DEFAULT);          \
+    prefix##_plan backward = prefix##_plan_create_2d(N, N, FFT_BACKWARD, FFT_DEFAULT);        \
+    for(int i = 0; i < N; i++) {                                                              \
+        for(int j = 0; j < N; j++) {                                                          \
+            data[i*N + j].real = A[i][j];                                                     \
+            data[i*N + j].imag = 0;                                                           \
+        }                                                                                     \
+    }                                                                                         \
+    clock_t start = clock();                                                                  \
+    prefix##_execute(forward, data, data);                                                    \
+    times[0] = ((double) (clock() - start)) / CLOCKS_PER_SEC;                                 \
+    start = clock();                                                                          \
+    prefix##_execute(backward, data, data);                                                   \
+    times[1] = ((double) (clock() - start)) / CLOCKS_PER_SEC;                                 \
+    for(int i = 0; i < N; i++) {                                                              \
+        for(int j = 0; j < N; j++) {                                                          \
+            reconstructed[i][j] = (double)(data[i*N + j].real / (N * N));                     \
+        }                                                                                     \
+    }                                                                                         \
+    prefix##_plan_destroy(forward);                                                           \
+    prefix##_plan_destroy(backward);                                                          \
+    free(data);                                                                               \
 }
 
-void free_matrix(double **matrix, int N) {
-    for (int i = 0; i < N; i++) {
-        free(matrix[i]);
+DEFINE_PRECISION_ROUNDTRIP(fftf, ComplexF)
+DEFINE_PRECISION_ROUNDTRIP(fft, Complex)
+DEFINE_PRECISION_ROUNDTRIP(fftl, ComplexL)
+
+// Reconstruction errors of the roundtrip in each precision, reported by print_errors, then one
+// table with the machine epsilon, the times and the speedup over double
+void compare_precisions(double **A, int N, FILE *file) {
+    const char *names[3] = {"float", "double", "long double"};
+    const double epsilons[3] = {FLT_EPSILON, DBL_EPSILON, (double)LDBL_EPSILON};
+    double times[3][2];
+    double rms_errors[3];
+    double **reconstructed = matrix_create(N, N);
+
+    for(int p = 0; p < 3; p++) {
+        if(p == 0) fftf_roundtrip(A, reconstructed, N, times[p]);
+        if(p == 1) fft_roundtrip(A, reconstructed, N, times[p]);
+        if(p == 2) fftl_roundtrip(A, reconstructed, N, times[p]);
+
+        double sum = 0.0;
+        for(int i = 0; i < N; i++) {
+            for(int j = 0; j < N; j++) {
+                double e = A[i][j] - reconstructed[i][j];
+                sum += e * e;
+            }
+        }
+        rms_errors[p] = sqrt(sum / ((double)N * N));
+
+        DUPPRINT(file, "Errors for %s:\n", names[p]);
+        print_errors(A, reconstructed, N, file);
+    }
+
+    DUPPRINT(file, "%-12s %12s %12s %12s %12s %9s\n", "Precision", "Epsilon", "Forward [s]", "Backward [s]",
+             "RMS error", "Speedup");
+    for(int p = 0; p < 3; p++) {
+        double total = times[p][0] + times[p][1];
+        DUPPRINT(file, "%-12s %12e %12f %12f %12e %8.2fx\n", names[p], epsilons[p], times[p][0], times[p][1],
+                 rms_errors[p], total > 0 ? (times[1][0] + times[1][1]) / total : 0.0);
     }
-    free(matrix);
+
+    matrix_destroy(reconstructed);
 }
 
 // Fill matrix with Gaussian random numbers (Box-Muller)
@@ -427,42 +605,16 @@ void fill_gaussian_matrix(double **matrix, int N) {
 }
 
 void print_errors(double **original, double **reconstructed, int N, FILE *file) {
-    double sum_abs_error = 0.0;
-    double sum_rel_error = 0.0;
-    double *abs_errors = (double*)malloc(N * N * sizeof(double));
-    double *rel_errors = (double*)malloc(N * N * sizeof(double));
-    
-    for(int i = 0; i < N; i++) {
-        for(int j = 0; j < N; j++) {
-            double abs_error = fabs(original[i][j] - reconstructed[i][j]);
-            double rel_error = abs_error / fabs(original[i][j]);
-            
-            sum_abs_error += abs_error * abs_error;
-            sum_rel_error += rel_error * rel_error;
-            
-            abs_errors[i*N + j] = abs_error;
-            rel_errors[i*N + j] = rel_error;
-        }
-    }
-    
-    // Calculate mean square errors
-    double mean_abs_error = sqrt(sum_abs_error / (N * N));
-    double mean_rel_error = sqrt(sum_rel_error / (N * N));
-    
-    // Sort arrays for median calculation
-    qsort(abs_errors, N*N, sizeof(double), (int (*)(const void*, const void*))strcmp);
-    qsort(rel_errors, N*N, sizeof(double), (int (*)(const void*, const void*))strcmp);
-    
-    // Calculate median square errors
-    double median_abs_error = sqrt(abs_errors[(N*N)/2]);
-    double median_rel_error = sqrt(rel_errors[(N*N)/2]);
-    
-    DUPPRINT(file, "Mean absolute error: %e\n", mean_abs_error);
-    DUPPRINT(file, "Mean relative error: %e\n", mean_rel_error);
-    DUPPRINT(file, "Median absolute error: %e\n", median_abs_error);
-    DUPPRINT(file, "Median relative error: %e\n", median_rel_error);
-    
-    free(abs_errors);
-    free(rel_errors);
+    // Relative errors only where |original| > 1e-10, to avoid dividing by values close to zero
+    fft_error_source source = fft_error_source_rows(original, reconstructed, N, N);
+    fft_error_stats stats;
+    fft_error_stats_compute(&source, 1e-10, &stats);
+    
+    DUPPRINT(file, "RMS absolute error: %e\n", stats.rms_abs);
+    DUPPRINT(file, "RMS relative error: %e (calculated over %ld non-zero values)\n", stats.rms_rel, stats.count_rel);
+    DUPPRINT(file, "Median absolute error: %e\n", stats.median_abs);
+    DUPPRINT(file, "Median relative error: %e\n", stats.median_rel);
+    DUPPRINT(file, "Max absolute error: %e\n", stats.max_abs);
+    DUPPRINT(file, "Max relative error: %e\n", stats.max_rel);
 }
 
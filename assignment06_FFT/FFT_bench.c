@@ -0,0 +1,322 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "fft_engine.h"
+#include "fft_simd.h"
+#include "fft_internal.h"
+#ifdef HAVE_FFTW
+#include <fftw3.h>
+#include "fftw_planner.h"
+#endif
+
+#define DUPPRINT(fp, fmt...) do {printf(fmt);fprintf(fp,fmt);} while(0)
+
+// Benchmark of the custom engine (and FFTW when built with HAVE_FFTW) over sizes and transform
+// kinds. Every case is planned once, run for warm-up, then timed on repeated samples; the median
+// time, the normalized GFLOP/s and the roundtrip error go to results_bench.csv and
+// results_bench.json, one record per backend, kind and size.
+// Usage: ./FFT_bench [max_points] [estimate|measure|patient|exhaustive]
+// (the planner effort is FFTW's; cases with more than max_points points are skipped)
+
+// Minimum time of one timed sample, total timed time per case, and number of samples
+#define SAMPLE_SECONDS 1e-3
+#define CASE_SECONDS 0.2
+#define MIN_SAMPLES 5
+#define MAX_SAMPLES 100
+
+enum kind { KIND_C2C, KIND_R2C, KIND_C2R };
+static const char *kind_names[] = {"c2c", "r2c", "c2r"};
+
+// Arrays shared by the plans of one case: c2c is x -> X, the backward c2c X -> y; r2c is r -> R,
+// c2r copies R to R_work (the multidimensional c2r overwrites its input) then R_work -> r_out
+typedef struct {
+    Complex *x, *X, *y;
+    double *r, *r_out;
+    Complex *R, *R_work;
+    size_t points, half;
+} buffers;
+
+// A backend plans the four transforms of a case and runs them by number
+enum transform { FORWARD, BACKWARD, R2C, C2R };
+
+typedef struct {
+    const char *name;
+    void *(*plan)(enum transform t, int rank, int n0, int n1, buffers *b);
+    void (*execute)(void *plan, enum transform t, buffers *b);
+    void (*destroy)(void *plan);
+} backend;
+
+static void *custom_plan(enum transform t, int rank, int n0, int n1, buffers *b) {
+    (void)b;
+    switch(t) {
+        case FORWARD:
+            return rank == 1 ? fft_plan_create(n1, FFT_FORWARD, FFT_DEFAULT) : fft_plan_create_2d(n0, n1, FFT_FORWARD, FFT_DEFAULT);
+        case BACKWARD:
+            return rank == 1 ? fft_plan_create(n1, FFT_BACKWARD, FFT_DEFAULT) : fft_plan_create_2d(n0, n1, FFT_BACKWARD, FFT_DEFAULT);
+        case R2C:
+            return rank == 1 ? fft_plan_create_r2c(n1, FFT_DEFAULT) : fft_plan_create_r2c_2d(n0, n1, FFT_DEFAULT);
+        case C2R:
+            return rank == 1 ? fft_plan_create_c2r(n1, FFT_DEFAULT) : fft_plan_create_c2r_2d(n0, n1, FFT_DEFAULT);
+    }
+    return NULL;
+}
+
+static void custom_execute(void *plan, enum transform t, buffers *b) {
+    switch(t) {
+        case FORWARD:
+            fft_execute((fft_plan)plan, b->x, b->X);
+            break;
+        case BACKWARD:
+            fft_execute((fft_plan)plan, b->X, b->y);
+            break;
+        case R2C:
+            fft_execute_r2c((fft_plan)plan, b->r, b->R);
+            break;
+        case C2R:
+            memcpy(b->R_work, b->R, b->half * sizeof(Complex));
+            fft_execute_c2r((fft_plan)plan, b->R_work, b->r_out);
+            break;
+    }
+}
+
+static void custom_destroy(void *plan) {
+    fft_plan_destroy((fft_plan)plan);
+}
+
+#ifdef HAVE_FFTW
+static unsigned fftw_effort = FFTW_MEASURE;
+
+// Complex and fftw_complex have the same layout
+static void *fftw_backend_plan(enum transform t, int rank, int n0, int n1, buffers *b) {
+    fftw_complex *x = (fftw_complex*)b->x, *X = (fftw_complex*)b->X, *y = (fftw_complex*)b->y;
+    fftw_complex *R = (fftw_complex*)b->R, *R_work = (fftw_complex*)b->R_work;
+    switch(t) {
+        case FORWARD:
+            return rank == 1 ? fftw_plan_dft_1d(n1, x, X, FFTW_FORWARD, fftw_effort) : fftw_plan_dft_2d(n0, n1, x, X, FFTW_FORWARD, fftw_effort);
+        case BACKWARD:
+            return rank == 1 ? fftw_plan_dft_1d(n1, X, y, FFTW_BACKWARD, fftw_effort) : fftw_plan_dft_2d(n0, n1, X, y, FFTW_BACKWARD, fftw_effort);
+        case R2C:
+            return rank == 1 ? fftw_plan_dft_r2c_1d(n1, b->r, R, fftw_effort) : fftw_plan_dft_r2c_2d(n0, n1, b->r, R, fftw_effort);
+        case C2R:
+            return rank == 1 ? fftw_plan_dft_c2r_1d(n1, R_work, b->r_out, fftw_effort) : fftw_plan_dft_c2r_2d(n0, n1, R_work, b->r_out, fftw_effort);
+    }
+    return NULL;
+}
+
+static void fftw_backend_execute(void *plan, enum transform t, buffers *b) {
+    if(t == C2R) memcpy(b->R_work, b->R, b->half * sizeof(Complex));
+    fftw_execute((fftw_plan)plan);
+}
+
+static void fftw_backend_destroy(void *plan) {
+    fftw_destroy_plan((fftw_plan)plan);
+}
+#endif
+
+static const backend backends[] = {
+    {"custom", custom_plan, custom_execute, custom_destroy},
+#ifdef HAVE_FFTW
+    {"fftw", fftw_backend_plan, fftw_backend_execute, fftw_backend_destroy},
+#endif
+};
+
+static int is_smooth(int n) {
+    static const int radices[] = {2, 3, 5, 7};
+    for(int r = 0; r < 4; r++) {
+        while(n % radices[r] == 0) n /= radices[r];
+    }
+    return n == 1;
+}
+
+static int is_prime(int n) {
+    if(n < 2) return 0;
+    for(int d = 2; (long)d * d <= n; d++) {
+        if(n % d == 0) return 0;
+    }
+    return 1;
+}
+
+static const char *size_class(int n) {
+    if((n & (n - 1)) == 0) return "pow2";
+    if(is_smooth(n)) return "smooth";
+    return is_prime(n) ? "prime" : "other";
+}
+
+static int compare_doubles(const void *a, const void *b) {
+    double da = *(const double*)a;
+    double db = *(const double*)b;
+    return (da > db) - (da < db);
+}
+
+// Median time of one execution: samples of batch executions, each sample lasting at least
+// SAMPLE_SECONDS, as many samples as fit in CASE_SECONDS (between MIN_SAMPLES and MAX_SAMPLES)
+static double median_time(const backend *be, void *plan, enum transform t, buffers *b, int *repetitions) {
+    be->execute(plan, t, b); // warm-up
+    double start = wall_time();
+    be->execute(plan, t, b);
+    double single = wall_time() - start;
+
+    int batch = single > 0 ? (int)(SAMPLE_SECONDS / single) + 1 : 1000;
+    int samples = (int)(CASE_SECONDS / (single * batch));
+    if(samples < MIN_SAMPLES) samples = MIN_SAMPLES;
+    if(samples > MAX_SAMPLES) samples = MAX_SAMPLES;
+
+    double times[MAX_SAMPLES];
+    for(int s = 0; s < samples; s++) {
+        start = wall_time();
+        for(int r = 0; r < batch; r++) {
+            be->execute(plan, t, b);
+        }
+        times[s] = (wall_time() - start) / batch;
+    }
+    qsort(times, samples, sizeof(double), compare_doubles);
+    *repetitions = samples * batch;
+    return samples % 2 ? times[samples/2] : 0.5 * (times[samples/2 - 1] + times[samples/2]);
+}
+
+// Relative RMS error of the normalized roundtrip
+static double roundtrip_error(const double *original, const double *result, size_t count, double scale) {
+    double error = 0.0, norm = 0.0;
+    for(size_t i = 0; i < count; i++) {
+        double e = result[i] / scale - original[i];
+        error += e * e;
+        norm += original[i] * original[i];
+    }
+    return norm > 0 ? sqrt(error / norm) : 0.0;
+}
+
+static void write_record(FILE *csv, FILE *json, FILE *file, int *first_record, const char *backend_name, int kind,
+                         int rank, int n0, int n1, double seconds, double error, int repetitions) {
+    double points = (double)n0 * n1;
+    // 5 N log2 N for complex transforms, half of it for real ones (FFTW's convention)
+    double flops = (kind == KIND_C2C ? 5.0 : 2.5) * points * log2(points);
+    double gflops = points > 1 && seconds > 0 ? flops / seconds * 1e-9 : 0.0;
+    const char *cls = size_class(n1);
+
+    fprintf(csv, "%s,%s,%d,%d,%d,%.0f,%s,%.9e,%.4f,%.3e,%d\n", backend_name, kind_names[kind], rank, n0, n1, points,
+            cls, seconds, gflops, error, repetitions);
+    fprintf(json, "%s    {\"backend\": \"%s\", \"kind\": \"%s\", \"rank\": %d, \"n0\": %d, \"n1\": %d, \"points\": %.0f, "
+            "\"class\": \"%s\", \"median_seconds\": %.9e, \"gflops\": %.4f, \"roundtrip_error\": %.3e, "
+            "\"repetitions\": %d}", *first_record ? "" : ",\n", backend_name, kind_names[kind], rank, n0, n1, points,
+            cls, seconds, gflops, error, repetitions);
+    *first_record = 0;
+
+    char shape[64];
+    if(rank == 1) snprintf(shape, sizeof(shape), "%d", n1);
+    else snprintf(shape, sizeof(shape), "%dx%d", n0, n1);
+    DUPPRINT(file, "%-7s %-4s %-11s %-7s %12.3e %9.3f %10.2e\n", backend_name, kind_names[kind], shape, cls, seconds,
+             gflops, error);
+}
+
+static void run_case(const backend *be, int rank, int n0, int n1, FILE *csv, FILE *json, FILE *file, int *first_record) {
+    buffers b;
+    b.points = (size_t)n0 * n1;
+    b.half = (size_t)n0 * (n1/2 + 1);
+    b.x = (Complex*)checked_malloc(b.points * sizeof(Complex));
+    b.X = (Complex*)checked_malloc(b.points * sizeof(Complex));
+    b.y = (Complex*)checked_malloc(b.points * sizeof(Complex));
+    b.r = (double*)checked_malloc(b.points * sizeof(double));
+    b.r_out = (double*)checked_malloc(b.points * sizeof(double));
+    b.R = (Complex*)checked_malloc(b.half * sizeof(Complex));
+    b.R_work = (Complex*)checked_malloc(b.half * sizeof(Complex));
+
+    // Measuring planners overwrite their arrays: plan first, then fill the inputs
+    void *plans[4];
+    for(int t = 0; t < 4; t++) {
+        plans[t] = be->plan((enum transform)t, rank, n0, n1, &b);
+    }
+    srand(42);
+    for(size_t i = 0; i < b.points; i++) {
+        b.x[i].real = (double)rand() / RAND_MAX - 0.5;
+        b.x[i].imag = (double)rand() / RAND_MAX - 0.5;
+        b.r[i] = b.x[i].real;
+    }
+
+    be->execute(plans[FORWARD], FORWARD, &b);
+    be->execute(plans[BACKWARD], BACKWARD, &b);
+    double c2c_error = roundtrip_error((double*)b.x, (double*)b.y, 2 * b.points, (double)b.points);
+    be->execute(plans[R2C], R2C, &b);
+    be->execute(plans[C2R], C2R, &b);
+    double real_error = roundtrip_error(b.r, b.r_out, b.points, (double)b.points);
+
+    int repetitions;
+    double seconds = median_time(be, plans[FORWARD], FORWARD, &b, &repetitions);
+    write_record(csv, json, file, first_record, be->name, KIND_C2C, rank, n0, n1, seconds, c2c_error, repetitions);
+    seconds = median_time(be, plans[R2C], R2C, &b, &repetitions);
+    write_record(csv, json, file, first_record, be->name, KIND_R2C, rank, n0, n1, seconds, real_error, repetitions);
+    // c2r runs on the spectrum of the last r2c; its time includes restoring its input
+    seconds = median_time(be, plans[C2R], C2R, &b, &repetitions);
+    write_record(csv, json, file, first_record, be->name, KIND_C2R, rank, n0, n1, seconds, real_error, repetitions);
+
+    for(int t = 0; t < 4; t++) {
+        be->destroy(plans[t]);
+    }
+    free(b.x);
+    free(b.X);
+    free(b.y);
+    free(b.r);
+    free(b.r_out);
+    free(b.R);
+    free(b.R_work);
+}
+
+int main(int argc, char **argv) {
+    double max_points = argc > 1 ? atof(argv[1]) : 1e7;
+#ifdef HAVE_FFTW
+    if(argc > 2 && parse_effort(argv[2], &fftw_effort) != 0) {
+        printf("Unknown planner effort %s (use estimate, measure, patient or exhaustive)\n", argv[2]);
+        return 1;
+    }
+#endif
+
+    // Powers of two, 7-smooth composites and primes (Bluestein in the custom engine)
+    int sizes_1d[] = {64, 1024, 16384, 262144, 1048576,
+                      1000, 10000, 44100, 100000, 1000000,
+                      1009, 10007, 65537, 1000003};
+    int sizes_2d[] = {64, 256, 1024, 2048,
+                      100, 1000, 2000,
+                      101, 1009};
+    int n_1d = sizeof(sizes_1d) / sizeof(sizes_1d[0]);
+    int n_2d = sizeof(sizes_2d) / sizeof(sizes_2d[0]);
+    int n_backends = sizeof(backends) / sizeof(backends[0]);
+
+    FILE *results_file = fopen("results_bench.txt", "w");
+    FILE *csv = fopen("results_bench.csv", "w");
+    FILE *json = fopen("results_bench.json", "w");
+    if (!results_file || !csv || !json) {
+        printf("Error opening results file\n");
+        return 1;
+    }
+
+    fprintf(csv, "backend,kind,rank,n0,n1,points,class,median_seconds,gflops,roundtrip_error,repetitions\n");
+    fprintf(json, "{\n  \"simd\": \"%s\",\n", fft_simd_level_name(fft_simd_level_detect()));
+#ifdef HAVE_FFTW
+    fprintf(json, "  \"fftw_effort\": \"%s\",\n", effort_name(fftw_effort));
+#endif
+    fprintf(json, "  \"results\": [\n");
+
+    DUPPRINT(results_file, "%-7s %-4s %-11s %-7s %12s %9s %10s\n", "Backend", "Kind", "Size", "Class", "Median [s]",
+             "GFLOP/s", "Roundtrip");
+    int first_record = 1;
+    for(int rank = 1; rank <= 2; rank++) {
+        int *sizes = rank == 1 ? sizes_1d : sizes_2d;
+        int count = rank == 1 ? n_1d : n_2d;
+        for(int s = 0; s < count; s++) {
+            int n0 = rank == 1 ? 1 : sizes[s], n1 = sizes[s];
+            if((double)n0 * n1 > max_points) continue;
+            for(int be = 0; be < n_backends; be++) {
+                run_case(&backends[be], rank, n0, n1, csv, json, results_file, &first_record);
+            }
+        }
+    }
+
+    fprintf(json, "\n  ]\n}\n");
+    fclose(json);
+    fclose(csv);
+    fclose(results_file);
+    fft_cleanup();
+    return 0;
+}
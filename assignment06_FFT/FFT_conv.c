@@ -0,0 +1,167 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "fft_engine.h"
+#include "fft_conv.h"
+#include "fft_internal.h"
+
+#define DUPPRINT(fp, fmt...) do {printf(fmt);fprintf(fp,fmt);} while(0)
+
+// Direct sum against FFT path for growing kernels (1D and 2D linear convolution), the choice
+// made by the planner, and the streaming overlap-save convolution of a long signal checked
+// against the one-shot plan. Usage: ./FFT_conv
+
+static double *random_array(long count) {
+    double *data = (double*)malloc(count * sizeof(double));
+    if (!data) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    for(long i = 0; i < count; i++) {
+        data[i] = (double)rand() / RAND_MAX - 0.5;
+    }
+    return data;
+}
+
+static double max_difference(const double *a, const double *b, long count) {
+    double max_error = 0.0;
+    for(long i = 0; i < count; i++) {
+        double e = fabs(a[i] - b[i]);
+        if(e > max_error) max_error = e;
+    }
+    return max_error;
+}
+
+// Average time of one execution, repeated for about 0.2 s
+static double time_plan(fft_conv plan, const double *in, double *out) {
+    int repeats = 0;
+    double start = wall_time(), elapsed;
+    do {
+        fft_conv_execute(plan, in, out);
+        repeats++;
+        elapsed = wall_time() - start;
+    } while(elapsed < 0.2);
+    return elapsed / repeats;
+}
+
+// Times both paths for one kernel size and reports which one the planner picks
+static void compare_paths(FILE *file, int n0, int n1, int k0, int k1) {
+    double *x = random_array((long)n0 * n1);
+    double *kernel = random_array((long)k0 * k1);
+    fft_conv direct, fft, chosen;
+    if(n0 == 1) {
+        direct = fft_conv_create(n1, kernel, k1, FFT_CONV_CONVOLUTION, FFT_CONV_LINEAR, FFT_CONV_DIRECT);
+        fft = fft_conv_create(n1, kernel, k1, FFT_CONV_CONVOLUTION, FFT_CONV_LINEAR, FFT_CONV_FFT);
+        chosen = fft_conv_create(n1, kernel, k1, FFT_CONV_CONVOLUTION, FFT_CONV_LINEAR, FFT_DEFAULT);
+    } else {
+        direct = fft_conv_create_2d(n0, n1, kernel, k0, k1, FFT_CONV_CONVOLUTION, FFT_CONV_LINEAR, FFT_CONV_DIRECT);
+        fft = fft_conv_create_2d(n0, n1, kernel, k0, k1, FFT_CONV_CONVOLUTION, FFT_CONV_LINEAR, FFT_CONV_FFT);
+        chosen = fft_conv_create_2d(n0, n1, kernel, k0, k1, FFT_CONV_CONVOLUTION, FFT_CONV_LINEAR, FFT_DEFAULT);
+    }
+    int m = fft_conv_output_size(direct);
+    double *y_direct = (double*)malloc(m * sizeof(double));
+    double *y_fft = (double*)malloc(m * sizeof(double));
+    if (!y_direct || !y_fft) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    double t_direct = time_plan(direct, x, y_direct);
+    double t_fft = time_plan(fft, x, y_fft);
+    char shape[64], kshape[64];
+    if(n0 == 1) {
+        snprintf(shape, sizeof(shape), "%d", n1);
+        snprintf(kshape, sizeof(kshape), "%d", k1);
+    } else {
+        snprintf(shape, sizeof(shape), "%dx%d", n0, n1);
+        snprintf(kshape, sizeof(kshape), "%dx%d", k0, k1);
+    }
+    const char *faster = t_direct < t_fft ? "direct" : "fft";
+    const char *picked = fft_conv_is_direct(chosen) ? "direct" : "fft";
+    DUPPRINT(file, "%-10s %-8s %12.6f %12.6f %8s %8s%s %11.3e\n", shape, kshape, t_direct, t_fft, faster, picked,
+             strcmp(faster, picked) == 0 ? "" : "*", max_difference(y_direct, y_fft, m));
+
+    fft_conv_destroy(direct);
+    fft_conv_destroy(fft);
+    fft_conv_destroy(chosen);
+    free(x);
+    free(kernel);
+    free(y_direct);
+    free(y_fft);
+}
+
+// Convolves a signal of N samples given in pieces of random length and compares with the plan
+static void run_stream(FILE *file, long N, int k) {
+    double *x = random_array(N);
+    double *kernel = random_array(k);
+    fft_conv_stream stream = fft_conv_stream_create(kernel, k, FFT_CONV_CONVOLUTION, 0, FFT_DEFAULT);
+    int block = fft_conv_stream_block(stream);
+    double *y = (double*)malloc((N + k - 1 + block) * sizeof(double));
+    double *reference = (double*)malloc((N + k - 1) * sizeof(double));
+    if (!y || !reference) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    double start = wall_time();
+    long written = 0;
+    for(long pos = 0; pos < N; ) {
+        int count = 1 + rand() % 10000;
+        if(count > N - pos) count = (int)(N - pos);
+        written += fft_conv_stream_push(stream, x + pos, count, y + written);
+        pos += count;
+    }
+    written += fft_conv_stream_flush(stream, y + written);
+    double elapsed = wall_time() - start;
+
+    fft_conv plan = fft_conv_create((int)N, kernel, k, FFT_CONV_CONVOLUTION, FFT_CONV_LINEAR, FFT_DEFAULT);
+    double plan_start = wall_time();
+    fft_conv_execute(plan, x, reference);
+    double plan_time = wall_time() - plan_start;
+
+    DUPPRINT(file, "%10ld %6d %8d %8s %10.4f %10.1f %10.4f %11.3e\n", N, k, block,
+             fft_conv_is_direct(plan) ? "direct" : "fft", elapsed, N / elapsed * 1e-6, plan_time,
+             written == N + k - 1 ? max_difference(y, reference, written) : INFINITY);
+
+    fft_conv_destroy(plan);
+    fft_conv_stream_destroy(stream);
+    free(x);
+    free(kernel);
+    free(y);
+    free(reference);
+}
+
+int main(void) {
+    FILE *results_file = fopen("results_conv.txt", "w");
+    if (!results_file) {
+        printf("Error opening results file\n");
+        return 1;
+    }
+    srand(42);
+
+    DUPPRINT(results_file, "Linear convolution: direct sum vs FFT (* = the planner picked the slower path)\n");
+    DUPPRINT(results_file, "%-10s %-8s %12s %12s %8s %8s  %11s\n", "Signal", "Kernel", "Direct [s]", "FFT [s]",
+             "Faster", "Picked", "Difference");
+    int kernels_1d[] = {1, 4, 8, 16, 32, 64, 128, 512};
+    for(int i = 0; i < 8; i++) {
+        compare_paths(results_file, 1, 1 << 16, 1, kernels_1d[i]);
+    }
+    int kernels_2d[] = {1, 3, 5, 7, 9, 15, 31};
+    for(int i = 0; i < 7; i++) {
+        compare_paths(results_file, 500, 500, kernels_2d[i], kernels_2d[i]);
+    }
+
+    DUPPRINT(results_file, "\nStreaming (overlap-save) convolution against the one-shot plan\n");
+    DUPPRINT(results_file, "%10s %6s %8s %8s %10s %10s %10s %11s\n", "Samples", "Kernel", "Block", "Plan",
+             "Stream [s]", "MSamples/s", "Plan [s]", "Difference");
+    int kernels_stream[] = {8, 101, 1024, 8191};
+    for(int i = 0; i < 4; i++) {
+        run_stream(results_file, 1L << 22, kernels_stream[i]);
+    }
+
+    fclose(results_file);
+    return 0;
+}
@@ -6,18 +6,37 @@
 #include <string.h>
 #include <float.h>
 
+#include "fftw_planner.h"
+#include "fft_errors.h"
+#include "fft_writer.h"
+#include "matrix.h"
+
 #define DIM 1000
 #define PI acos(-1.0)
 #define DUPPRINT(fp, fmt...) do {printf(fmt);fprintf(fp,fmt);} while(0)
 
 // Function declarations
-int compare_doubles(const void *a, const void *b);
 void fill_gaussian_matrix(double **matrix, int N);
 void print_errors(double **original, double **reconstructed, int N, FILE *file);
-void save_matrix(const char *filename, double **matrix, int N);
-void save_complex_matrix(const char *filename, fftw_complex *matrix, int N, int is_real);
+void save_matrix(const char *name, double **matrix, int N, FILE *file);
+void save_complex_matrix(const char *name, fftw_complex *matrix, int rows, int cols, FILE *file);
+
+// Writer used by save_matrix and save_complex_matrix, from the FFT_OUTPUT_FORMAT environment
+// variable (text, binary or hdf5; default binary)
+static const fft_writer *output_writer;
+
+// Usage: ./FFT_fftw [estimate|measure|patient|exhaustive] [wisdom_directory] [threads]
+// The environment variables FFTW_PLANNER_EFFORT, FFTW_WISDOM_DIR and FFTW_NUM_THREADS give the
+// defaults; a wisdom directory "none" disables the store. FFT_OUTPUT_FORMAT selects the format of
+// the saved matrices, as for FFT.
+int main(int argc, char **argv) {
+    planner_options planner;
+    if (planner_options_from_args(&planner, argc > 1 ? argv[1] : NULL, argc > 2 ? argv[2] : NULL,
+                                  argc > 3 ? argv[3] : NULL) != 0) {
+        return 1;
+    }
+    fftw_init_threads();
 
-int main() {
     // Open results file
     FILE *results_file = fopen("results_FFTW.txt", "w");
     if (!results_file) {
@@ -25,31 +44,23 @@ int main() {
         return 1;
     }
 
+    const char *format_env = getenv("FFT_OUTPUT_FORMAT");
+    output_writer = fft_writer_find(format_env ? format_env : "binary");
+    if (!output_writer) {
+        printf("Unknown or unavailable output format %s (use text, binary or hdf5)\n", format_env);
+        return 1;
+    }
+
     clock_t start, end;
     double cpu_time_used;
     
     DUPPRINT(results_file, "Initializing matrices...\n");
     
     // Allocate matrices
-    double **A = (double**)malloc(DIM * sizeof(double*));
-    double **A_reconstructed_c2c = (double**)malloc(DIM * sizeof(double*));
-    double **A_reconstructed_r2c = (double**)malloc(DIM * sizeof(double*));
-    
-    if (!A || !A_reconstructed_c2c || !A_reconstructed_r2c) {
-        DUPPRINT(results_file, "Error allocating memory for matrices\n");
-        return 1;
-    }
-    
-    for(int i = 0; i < DIM; i++) {
-        A[i] = (double*)malloc(DIM * sizeof(double));
-        A_reconstructed_c2c[i] = (double*)malloc(DIM * sizeof(double));
-        A_reconstructed_r2c[i] = (double*)malloc(DIM * sizeof(double));
-        
-        if (!A[i] || !A_reconstructed_c2c[i] || !A_reconstructed_r2c[i]) {
-            DUPPRINT(results_file, "Error allocating memory for matrix rows\n");
-            return 1;
-        }
-    }
+    // One contiguous, 64-byte-aligned block each, so that the real transforms use them directly
+    double **A = matrix_create(DIM, DIM);
+    double **A_reconstructed_c2c = matrix_create(DIM, DIM);
+    double **A_reconstructed_r2c = matrix_create(DIM, DIM);
     
     DUPPRINT(results_file, "Matrices allocated successfully\n");
     
@@ -61,8 +72,8 @@ int main() {
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "Matrix generation time: %f seconds\n", cpu_time_used);
     
-    save_matrix("A_fftw.txt", A, DIM);
-    DUPPRINT(results_file, "Matrix A generated and saved to A_fftw.txt\n");
+    save_matrix("A_fftw", A, DIM, results_file);
+    DUPPRINT(results_file, "Matrix A generated and saved to A_fftw%s\n", output_writer->extension);
     
     // Allocate FFTW arrays
     DUPPRINT(results_file, "Allocating FFTW arrays...\n");
@@ -74,12 +85,26 @@ int main() {
         return 1;
     }
     
-    // Create FFTW plans
-    DUPPRINT(results_file, "Creating FFTW plans...\n");
-    fftw_plan plan_c2c_forward = fftw_plan_dft_2d(DIM, DIM, C, C, FFTW_FORWARD, FFTW_ESTIMATE);
-    fftw_plan plan_c2c_backward = fftw_plan_dft_2d(DIM, DIM, C, C, FFTW_BACKWARD, FFTW_ESTIMATE);
-    fftw_plan plan_r2c = fftw_plan_dft_r2c_2d(DIM, DIM, A[0], R, FFTW_ESTIMATE);
-    fftw_plan plan_c2r = fftw_plan_dft_c2r_2d(DIM, DIM, R, A_reconstructed_r2c[0], FFTW_ESTIMATE);
+    // Create FFTW plans. Except with FFTW_ESTIMATE the planner runs the transforms on the arrays,
+    // so the plans are made before the arrays are filled. The real plans are made on the still
+    // unused A_reconstructed_r2c; r2c is then executed on A, which has the same alignment, through
+    // the new-array interface (an out-of-place r2c leaves its input alone).
+    DUPPRINT(results_file, "Creating FFTW plans (effort: %s, wisdom: %s, threads: %d)...\n",
+             effort_name(planner.effort), planner.wisdom_dir ? planner.wisdom_dir : "none", planner.threads);
+    start = clock();
+    fftw_plan plan_c2c_forward = plan_with_wisdom(PLAN_C2C_FORWARD, DIM, DIM, C, C, &planner, results_file);
+    fftw_plan plan_c2c_backward = plan_with_wisdom(PLAN_C2C_BACKWARD, DIM, DIM, C, C, &planner, results_file);
+    double *a_r2c = matrix_data(A_reconstructed_r2c);
+    fftw_plan plan_r2c = plan_with_wisdom(PLAN_R2C, DIM, DIM, a_r2c, R, &planner, results_file);
+    fftw_plan plan_c2r = plan_with_wisdom(PLAN_C2R, DIM, DIM, R, a_r2c, &planner, results_file);
+    end = clock();
+    cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
+    DUPPRINT(results_file, "Plan creation time: %f seconds\n", cpu_time_used);
+    
+    if (!plan_c2c_forward || !plan_c2c_backward || !plan_r2c || !plan_c2r) {
+        DUPPRINT(results_file, "Error creating FFTW plans\n");
+        return 1;
+    }
     
     // 1) Perform c2c FFT
     DUPPRINT(results_file, "\n1) Performing complex-to-complex FFT...\n");
@@ -95,8 +120,8 @@ int main() {
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "c2c FFT time: %f seconds\n", cpu_time_used);
     
-    save_complex_matrix("C_fftw.txt", C, DIM, 0);
-    DUPPRINT(results_file, "Complex-to-complex FFT completed. Matrix C saved to C_fftw.txt\n");
+    save_complex_matrix("C_fftw", C, DIM, DIM, results_file);
+    DUPPRINT(results_file, "Complex-to-complex FFT completed. Matrix C saved to C_fftw%s\n", output_writer->extension);
     
     // 2) Reconstruct A using inverse c2c FFT
     DUPPRINT(results_file, "\n2) Reconstructing A using inverse complex-to-complex FFT...\n");
@@ -111,7 +136,7 @@ int main() {
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "Inverse c2c FFT time: %f seconds\n", cpu_time_used);
     
-    save_matrix("A_reconstructed_c2c_fftw.txt", A_reconstructed_c2c, DIM);
+    save_matrix("A_reconstructed_c2c_fftw", A_reconstructed_c2c, DIM, results_file);
     
     DUPPRINT(results_file, "Errors for complex-to-complex FFT:\n");
     print_errors(A, A_reconstructed_c2c, DIM, results_file);
@@ -119,28 +144,26 @@ int main() {
     // 3) Perform r2c FFT
     DUPPRINT(results_file, "\n3) Performing real-to-complex FFT...\n");
     start = clock();
-    fftw_execute(plan_r2c);
+    fftw_execute_dft_r2c(plan_r2c, matrix_data(A), R);
     end = clock();
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "r2c FFT time: %f seconds\n", cpu_time_used);
     
-    save_complex_matrix("R_fftw.txt", R, DIM, 1);
-    DUPPRINT(results_file, "Real-to-complex FFT completed. Matrix R saved to R_fftw.txt\n");
+    save_complex_matrix("R_fftw", R, DIM, DIM/2 + 1, results_file);
+    DUPPRINT(results_file, "Real-to-complex FFT completed. Matrix R saved to R_fftw%s\n", output_writer->extension);
     
     // 4) Reconstruct A using inverse c2r FFT
     DUPPRINT(results_file, "\n4) Reconstructing A using inverse complex-to-real FFT...\n");
     start = clock();
     fftw_execute(plan_c2r);
-    for(int i = 0; i < DIM; i++) {
-        for(int j = 0; j < DIM; j++) {
-            A_reconstructed_r2c[i][j] /= (DIM * DIM);
-        }
+    for(int i = 0; i < DIM * DIM; i++) {
+        a_r2c[i] /= DIM * DIM;
     }
     end = clock();
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "Inverse c2r FFT time: %f seconds\n", cpu_time_used);
     
-    save_matrix("A_reconstructed_r2c_fftw.txt", A_reconstructed_r2c, DIM);
+    save_matrix("A_reconstructed_r2c_fftw", A_reconstructed_r2c, DIM, results_file);
     
     DUPPRINT(results_file, "Errors for real-to-complex FFT:\n");
     print_errors(A, A_reconstructed_r2c, DIM, results_file);
@@ -158,25 +181,9 @@ int main() {
     DUPPRINT(results_file, "Initializing 6x6 matrices...\n");
     
     // Allocate 6x6 matrices
-    double **A6 = (double**)malloc(6 * sizeof(double*));
-    double **A6_reconstructed_c2c = (double**)malloc(6 * sizeof(double*));
-    double **A6_reconstructed_r2c = (double**)malloc(6 * sizeof(double*));
-    
-    if (!A6 || !A6_reconstructed_c2c || !A6_reconstructed_r2c) {
-        DUPPRINT(results_file, "Error allocating memory for 6x6 matrices\n");
-        return 1;
-    }
-    
-    for(int i = 0; i < 6; i++) {
-        A6[i] = (double*)malloc(6 * sizeof(double));
-        A6_reconstructed_c2c[i] = (double*)malloc(6 * sizeof(double));
-        A6_reconstructed_r2c[i] = (double*)malloc(6 * sizeof(double));
-        
-        if (!A6[i] || !A6_reconstructed_c2c[i] || !A6_reconstructed_r2c[i]) {
-            DUPPRINT(results_file, "Error allocating memory for 6x6 matrix rows\n");
-            return 1;
-        }
-    }
+    double **A6 = matrix_create(6, 6);
+    double **A6_reconstructed_c2c = matrix_create(6, 6);
+    double **A6_reconstructed_r2c = matrix_create(6, 6);
     
     DUPPRINT(results_file, "6x6 matrices allocated successfully\n");
     
@@ -190,19 +197,13 @@ int main() {
     }
     
     // Create FFTW plans for 6x6 case
-    fftw_plan plan_c2c_forward_6 = fftw_plan_dft_2d(6, 6, C6, C6, FFTW_FORWARD, FFTW_ESTIMATE);
-    fftw_plan plan_c2c_backward_6 = fftw_plan_dft_2d(6, 6, C6, C6, FFTW_BACKWARD, FFTW_ESTIMATE);
+    fftw_plan plan_c2c_forward_6 = plan_with_wisdom(PLAN_C2C_FORWARD, 6, 6, C6, C6, &planner, results_file);
+    fftw_plan plan_c2c_backward_6 = plan_with_wisdom(PLAN_C2C_BACKWARD, 6, 6, C6, C6, &planner, results_file);
     
-    // Create a temporary array for the real-to-complex transform
-    double *temp_real = (double*)fftw_malloc(sizeof(double) * 6 * 6);
-    if (!temp_real) {
-        DUPPRINT(results_file, "Error allocating temporary array for r2c transform\n");
-        return 1;
-    }
-    
-    // Create plans for real-to-complex transform
-    fftw_plan plan_r2c_6 = fftw_plan_dft_r2c_2d(6, 6, temp_real, R6, FFTW_ESTIMATE);
-    fftw_plan plan_c2r_6 = fftw_plan_dft_c2r_2d(6, 6, R6, temp_real, FFTW_ESTIMATE);
+    // Create plans for real-to-complex transform, on A6_reconstructed_r2c as above
+    double *a6_r2c = matrix_data(A6_reconstructed_r2c);
+    fftw_plan plan_r2c_6 = plan_with_wisdom(PLAN_R2C, 6, 6, a6_r2c, R6, &planner, results_file);
+    fftw_plan plan_c2r_6 = plan_with_wisdom(PLAN_C2R, 6, 6, R6, a6_r2c, &planner, results_file);
     
     if (!plan_c2c_forward_6 || !plan_c2c_backward_6 || !plan_r2c_6 || !plan_c2r_6) {
         DUPPRINT(results_file, "Error creating FFTW plans for 6x6 case\n");
@@ -216,8 +217,8 @@ int main() {
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "6x6 matrix generation time: %f seconds\n", cpu_time_used);
     
-    save_matrix("A6_fftw.txt", A6, 6);
-    DUPPRINT(results_file, "Matrix A6 generated and saved to A6_fftw.txt\n");
+    save_matrix("A6_fftw", A6, 6, results_file);
+    DUPPRINT(results_file, "Matrix A6 generated and saved to A6_fftw%s\n", output_writer->extension);
     
     // Perform c2c FFT
     DUPPRINT(results_file, "\nPerforming complex-to-complex FFT for 6x6 case...\n");
@@ -233,8 +234,9 @@ int main() {
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "6x6 c2c FFT time: %f seconds\n", cpu_time_used);
     
-    save_complex_matrix("C6_fftw.txt", C6, 6, 0);
-    DUPPRINT(results_file, "Complex-to-complex FFT completed for 6x6 case. Matrix C6 saved to C6_fftw.txt\n");
+    save_complex_matrix("C6_fftw", C6, 6, 6, results_file);
+    DUPPRINT(results_file, "Complex-to-complex FFT completed for 6x6 case. Matrix C6 saved to C6_fftw%s\n",
+             output_writer->extension);
     
     // Reconstruct A6 using inverse c2c FFT
     DUPPRINT(results_file, "\nReconstructing A6 using inverse complex-to-complex FFT...\n");
@@ -249,7 +251,7 @@ int main() {
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "6x6 inverse c2c FFT time: %f seconds\n", cpu_time_used);
     
-    save_matrix("A6_reconstructed_c2c_fftw.txt", A6_reconstructed_c2c, 6);
+    save_matrix("A6_reconstructed_c2c_fftw", A6_reconstructed_c2c, 6, results_file);
     
     DUPPRINT(results_file, "Errors for complex-to-complex FFT (6x6):\n");
     print_errors(A6, A6_reconstructed_c2c, 6, results_file);
@@ -257,35 +259,27 @@ int main() {
     // Perform r2c FFT
     DUPPRINT(results_file, "\nPerforming real-to-complex FFT for 6x6 case...\n");
     start = clock();
-    // Copy A6 to temp_real
-    for(int i = 0; i < 6; i++) {
-        for(int j = 0; j < 6; j++) {
-            temp_real[i*6 + j] = A6[i][j];
-        }
-    }
-    fftw_execute(plan_r2c_6);
+    fftw_execute_dft_r2c(plan_r2c_6, matrix_data(A6), R6);
     end = clock();
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "6x6 r2c FFT time: %f seconds\n", cpu_time_used);
     
-    save_complex_matrix("R6_fftw.txt", R6, 6, 1);
-    DUPPRINT(results_file, "Real-to-complex FFT completed for 6x6 case. Matrix R6 saved to R6_fftw.txt\n");
+    save_complex_matrix("R6_fftw", R6, 6, 6/2 + 1, results_file);
+    DUPPRINT(results_file, "Real-to-complex FFT completed for 6x6 case. Matrix R6 saved to R6_fftw%s\n",
+             output_writer->extension);
     
     // Reconstruct A6 using inverse c2r FFT
     DUPPRINT(results_file, "\nReconstructing A6 using inverse complex-to-real FFT...\n");
     start = clock();
     fftw_execute(plan_c2r_6);
-    // Copy from temp_real to A6_reconstructed_r2c
-    for(int i = 0; i < 6; i++) {
-        for(int j = 0; j < 6; j++) {
-            A6_reconstructed_r2c[i][j] = temp_real[i*6 + j] / (6 * 6);
-        }
+    for(int i = 0; i < 6 * 6; i++) {
+        a6_r2c[i] /= 6 * 6;
     }
     end = clock();
     cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
     DUPPRINT(results_file, "6x6 inverse c2r FFT time: %f seconds\n", cpu_time_used);
     
-    save_matrix("A6_reconstructed_r2c_fftw.txt", A6_reconstructed_r2c, 6);
+    save_matrix("A6_reconstructed_r2c_fftw", A6_reconstructed_r2c, 6, results_file);
     
     DUPPRINT(results_file, "Errors for real-to-complex FFT (6x6):\n");
     print_errors(A6, A6_reconstructed_r2c, 6, results_file);
@@ -307,39 +301,22 @@ int main() {
     fftw_free(R);
     fftw_free(C6);
     fftw_free(R6);
-    fftw_free(temp_real);
-    
-    for(int i = 0; i < DIM; i++) {
-        free(A[i]);
-        free(A_reconstructed_c2c[i]);
-        free(A_reconstructed_r2c[i]);
-    }
-    free(A);
-    free(A_reconstructed_c2c);
-    free(A_reconstructed_r2c);
     
-    for(int i = 0; i < 6; i++) {
-        free(A6[i]);
-        free(A6_reconstructed_c2c[i]);
-        free(A6_reconstructed_r2c[i]);
-    }
-    free(A6);
-    free(A6_reconstructed_c2c);
-    free(A6_reconstructed_r2c);
+    matrix_destroy(A);
+    matrix_destroy(A_reconstructed_c2c);
+    matrix_destroy(A_reconstructed_r2c);
+    matrix_destroy(A6);
+    matrix_destroy(A6_reconstructed_c2c);
+    matrix_destroy(A6_reconstructed_r2c);
     */
     
+    fftw_cleanup_threads();
     fclose(results_file);
     DUPPRINT(results_file, "Program completed successfully!\n");
     return 0;
 }
 
 // Function definitions
-int compare_doubles(const void *a, const void *b) {
-    double da = *(const double*)a;
-    double db = *(const double*)b;
-    return (da > db) - (da < db);
-}
-
 void fill_gaussian_matrix(double **matrix, int N) {
     srand(time(NULL));
     for(int i = 0; i < N; i++) {
@@ -353,49 +330,17 @@ void fill_gaussian_matrix(double **matrix, int N) {
 }
 
 void print_errors(double **original, double **reconstructed, int N, FILE *file) {
-    double sum_abs_error = 0.0;
-    double sum_rel_error = 0.0;
-    double *abs_errors = (double*)malloc(N * N * sizeof(double));
-    double *rel_errors = (double*)malloc(N * N * sizeof(double));
-    int count_rel = 0; // count non-zero values for relative error
-    const double threshold = 1e-10; // threshold to avoid division by very small numbers
-    
-    for(int i = 0; i < N; i++) {
-        for(int j = 0; j < N; j++) {
-            double abs_error = fabs(original[i][j] - reconstructed[i][j]);
-            sum_abs_error += abs_error * abs_error;
-            abs_errors[i*N + j] = abs_error;
-            
-            // Only calculate relative error for values above threshold
-            if(fabs(original[i][j]) > threshold) {
-                double rel_error = abs_error / fabs(original[i][j]);
-                sum_rel_error += rel_error * rel_error;
-                rel_errors[count_rel++] = rel_error;
-            }
-        }
-    }
-    
-    // Calculate mean square errors
-    double mean_abs_error = sqrt(sum_abs_error / (N * N));
-    double mean_rel_error = count_rel > 0 ? sqrt(sum_rel_error / count_rel) : 0.0;
-    
-    // Sort arrays for median calculation
-    qsort(abs_errors, N*N, sizeof(double), compare_doubles);
-    qsort(rel_errors, count_rel, sizeof(double), compare_doubles);
-    
-    // Calculate median square errors
-    double median_abs_error = sqrt(abs_errors[(N*N)/2]);
-    double median_rel_error = count_rel > 0 ? sqrt(rel_errors[count_rel/2]) : 0.0;
-    
-    printf("Mean absolute error: %e\n", mean_abs_error);
-    printf("Mean relative error: %e (calculated over %d non-zero values)\n", mean_rel_error, count_rel);
-    printf("Median absolute error: %e\n", median_abs_error);
-    printf("Median relative error: %e\n", median_rel_error);
-    
-    fprintf(file, "Mean absolute error: %e\n", mean_abs_error);
-    fprintf(file, "Mean relative error: %e (calculated over %d non-zero values)\n", mean_rel_error, count_rel);
-    fprintf(file, "Median absolute error: %e\n", median_abs_error);
-    fprintf(file, "Median relative error: %e\n", median_rel_error);
+    // Relative errors only where |original| > 1e-10, to avoid dividing by values close to zero
+    fft_error_source source = fft_error_source_rows(original, reconstructed, N, N);
+    fft_error_stats stats;
+    fft_error_stats_compute(&source, 1e-10, &stats);
+    
+    DUPPRINT(file, "RMS absolute error: %e\n", stats.rms_abs);
+    DUPPRINT(file, "RMS relative error: %e (calculated over %ld non-zero values)\n", stats.rms_rel, stats.count_rel);
+    DUPPRINT(file, "Median absolute error: %e\n", stats.median_abs);
+    DUPPRINT(file, "Median relative error: %e\n", stats.median_rel);
+    DUPPRINT(file, "Max absolute error: %e\n", stats.max_abs);
+    DUPPRINT(file, "Max relative error: %e\n", stats.max_rel);
     
     // Print some values for comparison
     printf("\nComparison of some values:\n");
@@ -409,52 +354,24 @@ void print_errors(double **original, double **reconstructed, int N, FILE *file)
     fprintf(file, "Reconstructed[0,0]: %e\n", reconstructed[0][0]);
     fprintf(file, "Original[1,1]: %e\n", original[1][1]);
     fprintf(file, "Reconstructed[1,1]: %e\n", reconstructed[1][1]);
-    
-    free(abs_errors);
-    free(rel_errors);
 }
 
-void save_matrix(const char *filename, double **matrix, int N) {
-    FILE *fp = fopen(filename, "w");
-    if (!fp) {
-        printf("Error opening file %s\n", filename);
-        return;
+void save_matrix(const char *name, double **matrix, int N, FILE *file) {
+    char filename[256];
+    snprintf(filename, sizeof(filename), "%s%s", name, output_writer->extension);
+    fft_write_stats stats;
+    if(fft_write_rows(output_writer, filename, matrix, N, N, &stats) == 0) {
+        DUPPRINT(file, "Saved %s: %.2f MB in %.4f seconds (%.0f MB/s)\n", filename, stats.bytes / 1e6, stats.seconds,
+                 stats.bytes / 1e6 / stats.seconds);
     }
-    
-    for(int i = 0; i < N; i++) {
-        for(int j = 0; j < N; j++) {
-            fprintf(fp, "%e ", matrix[i][j]);
-        }
-        fprintf(fp, "\n");
-    }
-    
-    fclose(fp);
 }
 
-void save_complex_matrix(const char *filename, fftw_complex *matrix, int N, int is_real) {
-    FILE *fp = fopen(filename, "w");
-    if (!fp) {
-        printf("Error opening file %s\n", filename);
-        return;
-    }
-    
-    if (is_real) {
-        // For real-to-complex transform, only save first half + 1 columns
-        for(int i = 0; i < N; i++) {
-            for(int j = 0; j < N/2 + 1; j++) {
-                fprintf(fp, "%e + i%e ", matrix[i*(N/2 + 1) + j][0], matrix[i*(N/2 + 1) + j][1]);
-            }
-            fprintf(fp, "\n");
-        }
-    } else {
-        // For complex-to-complex transform, save all columns
-        for(int i = 0; i < N; i++) {
-            for(int j = 0; j < N; j++) {
-                fprintf(fp, "%e + i%e ", matrix[i*N + j][0], matrix[i*N + j][1]);
-            }
-            fprintf(fp, "\n");
-        }
+void save_complex_matrix(const char *name, fftw_complex *matrix, int rows, int cols, FILE *file) {
+    char filename[256];
+    snprintf(filename, sizeof(filename), "%s%s", name, output_writer->extension);
+    fft_write_stats stats;
+    if(fft_write_matrix(output_writer, filename, (const double*)matrix, rows, cols, FFT_WRITER_COMPLEX, &stats) == 0) {
+        DUPPRINT(file, "Saved %s: %.2f MB in %.4f seconds (%.0f MB/s)\n", filename, stats.bytes / 1e6, stats.seconds,
+                 stats.bytes / 1e6 / stats.seconds);
     }
-    
-    fclose(fp);
 } 
\ No newline at end of file
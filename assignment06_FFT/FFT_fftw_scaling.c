@@ -0,0 +1,149 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <fftw3.h>
+
+#include "fftw_planner.h"
+#include "fft_internal.h"
+
+#define DUPPRINT(fp, fmt...) do {printf(fmt);fprintf(fp,fmt);} while(0)
+
+// Strong scaling of the threaded FFTW 2D plans: fixed N x N problem, increasing thread count, for
+// the c2c forward plan and the r2c + c2r pair.
+// Usage: ./FFT_fftw_scaling [max_threads] [estimate|measure|patient|exhaustive] [wisdom_directory]
+
+// 1, 2, 4, ... and max_threads itself
+static int next_thread_count(int threads, int max_threads) {
+    return threads < max_threads && 2*threads > max_threads ? max_threads : 2*threads;
+}
+
+static double max_difference(const double *a, const double *b, size_t count) {
+    double max_error = 0.0;
+    for(size_t i = 0; i < count; i++) {
+        double e = fabs(a[i] - b[i]);
+        if(e > max_error) max_error = e;
+    }
+    return max_error;
+}
+
+static void report(FILE *file, int N, const char *kind, int threads, double elapsed, double serial_time,
+                   double difference) {
+    double speedup = serial_time / elapsed;
+    DUPPRINT(file, "%6d %-8s %8d %12.6f %9.2f %10.1f%% %12.3e\n", N, kind, threads, elapsed, speedup,
+             100.0 * speedup / threads, difference);
+}
+
+int main(int argc, char **argv) {
+    int sizes[] = {1000, 1024, 2000, 2048, 4096, 8192};
+    int n_sizes = sizeof(sizes) / sizeof(sizes[0]);
+    int max_threads = argc > 1 ? atoi(argv[1]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if(max_threads < 1) max_threads = 1;
+
+    planner_options planner;
+    if(planner_options_from_args(&planner, argc > 2 ? argv[2] : NULL, argc > 3 ? argv[3] : NULL, "1") != 0) {
+        return 1;
+    }
+    fftw_init_threads();
+
+    FILE *results_file = fopen("results_fftw_scaling.txt", "w");
+    if (!results_file) {
+        printf("Error opening results file\n");
+        return 1;
+    }
+
+    DUPPRINT(results_file, "Strong scaling of the FFTW 2D plans, up to %d threads (effort: %s)\n", max_threads,
+             effort_name(planner.effort));
+    DUPPRINT(results_file, "%6s %-8s %8s %12s %9s %11s %12s\n", "N", "kind", "threads", "time [s]", "speedup",
+             "efficiency", "vs 1 thread");
+
+    for(int s = 0; s < n_sizes; s++) {
+        int N = sizes[s];
+        size_t n = (size_t)N * N;
+        size_t n_half = (size_t)N * (N/2 + 1);
+        fftw_complex *input = (fftw_complex*)fftw_malloc(n * sizeof(fftw_complex));
+        fftw_complex *data = (fftw_complex*)fftw_malloc(n * sizeof(fftw_complex));
+        fftw_complex *serial_data = (fftw_complex*)fftw_malloc(n * sizeof(fftw_complex));
+        fftw_complex *half = (fftw_complex*)fftw_malloc(n_half * sizeof(fftw_complex));
+        double *real_input = (double*)fftw_malloc(n * sizeof(double));
+        double *real_data = (double*)fftw_malloc(n * sizeof(double));
+        double *serial_real = (double*)fftw_malloc(n * sizeof(double));
+        if (!input || !data || !serial_data || !half || !real_input || !real_data || !serial_real) {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+
+        // About 2^26 points per measurement, at least one transform
+        int repeats = (int)((1 << 26) / n);
+        if(repeats < 1) repeats = 1;
+
+        double serial_c2c = 0.0, serial_real_pair = 0.0;
+        for(int threads = 1; threads <= max_threads; threads = next_thread_count(threads, max_threads)) {
+            planner.threads = threads;
+
+            // Measuring planners overwrite their arrays: plan first, then fill the inputs
+            fftw_plan c2c = plan_with_wisdom(PLAN_C2C_FORWARD, N, N, input, data, &planner, NULL);
+            fftw_plan r2c = plan_with_wisdom(PLAN_R2C, N, N, real_input, half, &planner, NULL);
+            fftw_plan c2r = plan_with_wisdom(PLAN_C2R, N, N, half, real_data, &planner, NULL);
+            if(!c2c || !r2c || !c2r) {
+                printf("Error creating FFTW plans\n");
+                exit(1);
+            }
+            srand(42);
+            for(size_t i = 0; i < n; i++) {
+                input[i][0] = (double)rand() / RAND_MAX - 0.5;
+                input[i][1] = (double)rand() / RAND_MAX - 0.5;
+                real_input[i] = input[i][0];
+            }
+
+            // Warm-up run, also starts the worker threads
+            fftw_execute(c2c);
+            double start = wall_time();
+            for(int r = 0; r < repeats; r++) {
+                fftw_execute(c2c);
+            }
+            double c2c_time = (wall_time() - start) / repeats;
+
+            // c2r destroys its input, so r2c runs before each c2r to give it a fresh spectrum
+            fftw_execute(r2c);
+            fftw_execute(c2r);
+            start = wall_time();
+            for(int r = 0; r < repeats; r++) {
+                fftw_execute(r2c);
+                fftw_execute(c2r);
+            }
+            double pair_time = (wall_time() - start) / repeats;
+
+            // Threaded plans may split the work differently, so the output is compared with a
+            // tolerance rather than bit by bit
+            if(threads == 1) {
+                serial_c2c = c2c_time;
+                serial_real_pair = pair_time;
+                memcpy(serial_data, data, n * sizeof(fftw_complex));
+                memcpy(serial_real, real_data, n * sizeof(double));
+            }
+            report(results_file, N, "c2c", threads, c2c_time, serial_c2c,
+                   max_difference((double*)data, (double*)serial_data, 2*n));
+            report(results_file, N, "r2c+c2r", threads, pair_time, serial_real_pair,
+                   max_difference(real_data, serial_real, n));
+
+            fftw_destroy_plan(c2c);
+            fftw_destroy_plan(r2c);
+            fftw_destroy_plan(c2r);
+        }
+
+        fftw_free(input);
+        fftw_free(data);
+        fftw_free(serial_data);
+        fftw_free(half);
+        fftw_free(real_input);
+        fftw_free(real_data);
+        fftw_free(serial_real);
+    }
+
+    fftw_cleanup_threads();
+    fclose(results_file);
+    return 0;
+}
@@ -0,0 +1,280 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <mpi.h>
+
+#include "fft_engine.h"
+#include "fft_mpi.h"
+
+#ifdef HAVE_FFTW_MPI
+#include <fftw3-mpi.h>
+#endif
+
+// Only rank 0 has a results file, the other ranks print nothing
+#define DUPPRINT(fp, fmt...) do {if(fp) {printf(fmt);fprintf(fp,fmt);}} while(0)
+
+// Largest grid that every rank also transforms serially to check its block
+#define MAX_CHECKED_SIZE (1L << 21)
+
+// Usage: mpirun -np K ./FFT_mpi
+
+// Deterministic input, the same on every rank for a given global index
+static double input_value(long g, int part) {
+    unsigned long long h = (unsigned long long)g * 2654435761ULL + (unsigned long long)part * 40503ULL + 12345ULL;
+    h ^= h >> 13;
+    h *= 0x5bd1e995ULL;
+    h ^= h >> 15;
+    return (double)(h % 1000003ULL) / 1000003.0 - 0.5;
+}
+
+// Row-major global index of element l of a local block
+static long global_index(const fft_mpi_block *b, const int *n, long l) {
+    int coord[3] = {0, 0, 0};
+    for(int d = b->rank - 1; d >= 0; d--) {
+        coord[b->axis[d]] = b->start[d] + (int)(l % b->count[d]);
+        l /= b->count[d];
+    }
+    long g = 0;
+    for(int a = 0; a < b->rank; a++) {
+        g = g * n[a] + coord[a];
+    }
+    return g;
+}
+
+static Complex *allocate_complex(long count) {
+    Complex *data = (Complex*)malloc((count > 0 ? count : 1) * sizeof(Complex));
+    if (!data) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return data;
+}
+
+static void fill_block(Complex *data, const fft_mpi_block *b, const int *n) {
+    long size = fft_mpi_block_size(b);
+    for(long l = 0; l < size; l++) {
+        long g = global_index(b, n, l);
+        data[l].real = input_value(g, 0);
+        data[l].imag = input_value(g, 1);
+    }
+}
+
+static double max_over_ranks(double value) {
+    double result;
+    MPI_Allreduce(&value, &result, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    return result;
+}
+
+static int repeats_for(long total) {
+    int repeats = (int)((1L << 23) / total);
+    return repeats > 0 ? repeats : 1;
+}
+
+static void run_case(int rank, const int *n, fft_mpi_decomposition decomposition, FILE *file) {
+    int nprocs;
+    MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+    long total = 1;
+    for(int d = 0; d < rank; d++) total *= n[d];
+
+    fft_mpi_plan forward, backward;
+    if(rank == 2) {
+        forward = fft_mpi_plan_create_2d(n[0], n[1], FFT_FORWARD, MPI_COMM_WORLD, FFT_DEFAULT);
+        backward = fft_mpi_plan_create_2d(n[0], n[1], FFT_BACKWARD, MPI_COMM_WORLD, FFT_DEFAULT);
+    } else {
+        forward = fft_mpi_plan_create_3d(n[0], n[1], n[2], FFT_FORWARD, decomposition, MPI_COMM_WORLD, FFT_DEFAULT);
+        backward = fft_mpi_plan_create_3d(n[0], n[1], n[2], FFT_BACKWARD, decomposition, MPI_COMM_WORLD, FFT_DEFAULT);
+    }
+
+    fft_mpi_block in_block, out_block;
+    fft_mpi_local_blocks(forward, &in_block, &out_block);
+    long in_size = fft_mpi_block_size(&in_block), out_size = fft_mpi_block_size(&out_block);
+    Complex *input = allocate_complex(in_size);
+    Complex *spectrum = allocate_complex(out_size);
+    Complex *reconstructed = allocate_complex(in_size);
+    fill_block(input, &in_block, n);
+
+    // Warm-up, then the mean over the repeats of the slowest rank
+    fft_mpi_execute(forward, input, spectrum);
+    int repeats = repeats_for(total);
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    double start = MPI_Wtime();
+    for(int r = 0; r < repeats; r++) {
+        fft_mpi_execute(forward, input, spectrum);
+    }
+    double forward_time = max_over_ranks((MPI_Wtime() - start) / repeats);
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    start = MPI_Wtime();
+    for(int r = 0; r < repeats; r++) {
+        fft_mpi_execute(backward, spectrum, reconstructed);
+    }
+    double backward_time = max_over_ranks((MPI_Wtime() - start) / repeats);
+
+    double roundtrip_error = 0.0;
+    for(long l = 0; l < in_size; l++) {
+        double e = hypot(reconstructed[l].real / total - input[l].real, reconstructed[l].imag / total - input[l].imag);
+        if(e > roundtrip_error) roundtrip_error = e;
+    }
+    roundtrip_error = max_over_ranks(roundtrip_error);
+
+    // Compare the local block of the spectrum with the serial transform of the whole grid
+    double serial_error = -1.0;
+    if(total <= MAX_CHECKED_SIZE) {
+        Complex *full = allocate_complex(total);
+        for(long g = 0; g < total; g++) {
+            full[g].real = input_value(g, 0);
+            full[g].imag = input_value(g, 1);
+        }
+        fft_plan serial = fft_plan_create_nd(rank, n, FFT_FORWARD, FFT_DEFAULT);
+        fft_execute(serial, full, full);
+        fft_plan_destroy(serial);
+
+        serial_error = 0.0;
+        for(long l = 0; l < out_size; l++) {
+            Complex x = full[global_index(&out_block, n, l)];
+            double e = hypot(spectrum[l].real - x.real, spectrum[l].imag - x.imag);
+            if(e > serial_error) serial_error = e;
+        }
+        serial_error = max_over_ranks(serial_error);
+        free(full);
+    }
+
+    double flops = 5.0 * total * log2((double)total);
+    char shape[64];
+    if(rank == 2) {
+        snprintf(shape, sizeof(shape), "%dx%d", n[0], n[1]);
+    } else {
+        snprintf(shape, sizeof(shape), "%dx%dx%d", n[0], n[1], n[2]);
+    }
+    DUPPRINT(file, "%-14s %-7s %5d %12.6f %12.6f %8.2f %12.3e", shape, decomposition == FFT_MPI_SLAB ? "slab" : "pencil",
+             nprocs, forward_time, backward_time, flops / forward_time * 1e-9, roundtrip_error);
+    if(serial_error >= 0.0) {
+        DUPPRINT(file, " %12.3e\n", serial_error);
+    } else {
+        DUPPRINT(file, " %12s\n", "-");
+    }
+
+    free(input);
+    free(spectrum);
+    free(reconstructed);
+    fft_mpi_plan_destroy(forward);
+    fft_mpi_plan_destroy(backward);
+}
+
+#ifdef HAVE_FFTW_MPI
+// Same measurement with FFTW's MPI interface (slab decomposition only), transposed output as above
+static void run_fftw_case(int rank, const int *n, FILE *file) {
+    int nprocs;
+    MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+    long total = 1;
+    for(int d = 0; d < rank; d++) total *= n[d];
+
+    ptrdiff_t local_n0, local_0_start, local_n1, local_1_start, alloc;
+    ptrdiff_t nn[3] = {n[0], n[1], rank == 3 ? n[2] : 1};
+    alloc = fftw_mpi_local_size_many_transposed(rank, nn, 1, FFTW_MPI_DEFAULT_BLOCK, FFTW_MPI_DEFAULT_BLOCK,
+                                                MPI_COMM_WORLD, &local_n0, &local_0_start, &local_n1, &local_1_start);
+    fftw_complex *data = fftw_alloc_complex(alloc);
+    fftw_complex *input = fftw_alloc_complex(alloc);
+
+    fftw_plan forward = fftw_mpi_plan_dft(rank, nn, data, data, MPI_COMM_WORLD, FFTW_FORWARD,
+                                          FFTW_ESTIMATE | FFTW_MPI_TRANSPOSED_OUT);
+    fftw_plan backward = fftw_mpi_plan_dft(rank, nn, data, data, MPI_COMM_WORLD, FFTW_BACKWARD,
+                                           FFTW_ESTIMATE | FFTW_MPI_TRANSPOSED_IN);
+
+    long plane = total / n[0];
+    for(long l = 0; l < local_n0 * plane; l++) {
+        long g = local_0_start * plane + l;
+        input[l][0] = input_value(g, 0);
+        input[l][1] = input_value(g, 1);
+    }
+
+    int repeats = repeats_for(total);
+    double forward_time = 0.0, backward_time = 0.0;
+    for(int r = 0; r < repeats; r++) {
+        for(long l = 0; l < local_n0 * plane; l++) {
+            data[l][0] = input[l][0];
+            data[l][1] = input[l][1];
+        }
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+        fftw_execute(forward);
+        forward_time += MPI_Wtime() - start;
+        start = MPI_Wtime();
+        fftw_execute(backward);
+        backward_time += MPI_Wtime() - start;
+    }
+    forward_time = max_over_ranks(forward_time / repeats);
+    backward_time = max_over_ranks(backward_time / repeats);
+
+    double roundtrip_error = 0.0;
+    for(long l = 0; l < local_n0 * plane; l++) {
+        double e = hypot(data[l][0] / total - input[l][0], data[l][1] / total - input[l][1]);
+        if(e > roundtrip_error) roundtrip_error = e;
+    }
+    roundtrip_error = max_over_ranks(roundtrip_error);
+
+    char shape[64];
+    if(rank == 2) {
+        snprintf(shape, sizeof(shape), "%dx%d", n[0], n[1]);
+    } else {
+        snprintf(shape, sizeof(shape), "%dx%dx%d", n[0], n[1], n[2]);
+    }
+    DUPPRINT(file, "%-14s %-7s %5d %12.6f %12.6f %8.2f %12.3e %12s\n", shape, "fftw", nprocs, forward_time, backward_time,
+             5.0 * total * log2((double)total) / forward_time * 1e-9, roundtrip_error, "-");
+
+    fftw_destroy_plan(forward);
+    fftw_destroy_plan(backward);
+    fftw_free(data);
+    fftw_free(input);
+}
+#endif
+
+int main(int argc, char **argv) {
+    MPI_Init(&argc, &argv);
+#ifdef HAVE_FFTW_MPI
+    fftw_mpi_init();
+#endif
+
+    int me, nprocs;
+    MPI_Comm_rank(MPI_COMM_WORLD, &me);
+    MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+
+    FILE *results_file = NULL;
+    if(me == 0) {
+        results_file = fopen("results_MPI.txt", "w");
+        if (!results_file) {
+            printf("Error opening results file\n");
+            MPI_Abort(MPI_COMM_WORLD, 1);
+        }
+    }
+
+    DUPPRINT(results_file, "Distributed FFT on %d MPI ranks (forward: transposed output, times of the slowest rank)\n", nprocs);
+    DUPPRINT(results_file, "%-14s %-7s %5s %12s %12s %8s %12s %12s\n", "Grid", "Decomp", "Ranks",
+             "Forward [s]", "Backward [s]", "GFLOP/s", "Roundtrip", "vs serial");
+
+    // Uneven sizes first: blocks of different lengths go through MPI_Alltoallv
+    int grids_2d[][2] = {{37, 53}, {1000, 1000}, {1024, 1024}, {2048, 2048}};
+    int grids_3d[][3] = {{12, 10, 9}, {64, 64, 64}, {100, 100, 100}, {128, 128, 128}};
+
+    for(int g = 0; g < 4; g++) {
+        run_case(2, grids_2d[g], FFT_MPI_SLAB, results_file);
+    }
+    for(int g = 0; g < 4; g++) {
+        run_case(3, grids_3d[g], FFT_MPI_SLAB, results_file);
+        run_case(3, grids_3d[g], FFT_MPI_PENCIL, results_file);
+    }
+
+#ifdef HAVE_FFTW_MPI
+    for(int g = 1; g < 4; g++) {
+        run_fftw_case(2, grids_2d[g], results_file);
+        run_fftw_case(3, grids_3d[g], results_file);
+    }
+    fftw_mpi_cleanup();
+#endif
+
+    fft_cleanup_threads();
+    if(results_file) fclose(results_file);
+    MPI_Finalize();
+    return 0;
+}
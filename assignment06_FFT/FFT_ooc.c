@@ -0,0 +1,242 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "fft_engine.h"
+#include "fft_ooc.h"
+
+#define DUPPRINT(fp, fmt...) do {printf(fmt);fprintf(fp,fmt);} while(0)
+
+// Largest array also transformed in memory to check the out-of-core result
+#define MAX_CHECKED_SIZE (1L << 22)
+
+// Values written or compared per chunk when streaming a file
+#define CHUNK (1L << 16)
+
+// Out-of-core 2D and 1D FFTs on files in the given directory, within a memory budget. The peak
+// memory is the growth of the resident memory of the process during the forward transform.
+// Usage: ./FFT_ooc [budget_MB] [directory]
+
+// Deterministic input, regenerated from the index when checking the roundtrip
+static double input_value(long g, int part) {
+    unsigned long long h = (unsigned long long)g * 2654435761ULL + (unsigned long long)part * 40503ULL + 12345ULL;
+    h ^= h >> 13;
+    h *= 0x5bd1e995ULL;
+    h ^= h >> 15;
+    return (double)(h % 1000003ULL) / 1000003.0 - 0.5;
+}
+
+static Complex *allocate_complex(long count) {
+    Complex *data = (Complex*)malloc(count * sizeof(Complex));
+    if (!data) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return data;
+}
+
+static int write_input(const char *path, long total) {
+    FILE *fp = fopen(path, "wb");
+    if (!fp) {
+        printf("Error opening %s\n", path);
+        return -1;
+    }
+    Complex *chunk = allocate_complex(CHUNK);
+    for(long g0 = 0; g0 < total; g0 += CHUNK) {
+        long count = total - g0 < CHUNK ? total - g0 : CHUNK;
+        for(long l = 0; l < count; l++) {
+            chunk[l].real = input_value(g0 + l, 0);
+            chunk[l].imag = input_value(g0 + l, 1);
+        }
+        fwrite(chunk, sizeof(Complex), count, fp);
+    }
+    free(chunk);
+    fclose(fp);
+    return 0;
+}
+
+static Complex *read_file(const char *path, long total) {
+    Complex *data = allocate_complex(total);
+    FILE *fp = fopen(path, "rb");
+    if (!fp || fread(data, sizeof(Complex), total, fp) != (size_t)total) {
+        printf("Error reading %s\n", path);
+        exit(1);
+    }
+    fclose(fp);
+    return data;
+}
+
+// Largest difference between the file divided by total and the input, read chunk by chunk
+static double roundtrip_error(const char *path, long total) {
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        printf("Error reading %s\n", path);
+        exit(1);
+    }
+    Complex *chunk = allocate_complex(CHUNK);
+    double max_error = 0.0;
+    for(long g0 = 0; g0 < total; g0 += CHUNK) {
+        long count = total - g0 < CHUNK ? total - g0 : CHUNK;
+        if(fread(chunk, sizeof(Complex), count, fp) != (size_t)count) {
+            printf("Error reading %s\n", path);
+            exit(1);
+        }
+        for(long l = 0; l < count; l++) {
+            double e = hypot(chunk[l].real / total - input_value(g0 + l, 0), chunk[l].imag / total - input_value(g0 + l, 1));
+            if(e > max_error) max_error = e;
+        }
+    }
+    free(chunk);
+    fclose(fp);
+    return max_error;
+}
+
+// Field of /proc/self/status in MB (Linux): VmRSS is the resident memory, VmHWM its peak
+static double status_mb(const char *field) {
+    FILE *fp = fopen("/proc/self/status", "r");
+    char line[256];
+    long kb = -1;
+    if(!fp) return -1.0;
+    while(fgets(line, sizeof(line), fp)) {
+        if(strncmp(line, field, strlen(field)) == 0 && line[strlen(field)] == ':') {
+            kb = atol(line + strlen(field) + 1);
+            break;
+        }
+    }
+    fclose(fp);
+    return kb / 1024.0;
+}
+
+// Resets VmHWM to the current resident memory and returns it
+static double reset_peak_memory(void) {
+    FILE *fp = fopen("/proc/self/clear_refs", "w");
+    if(fp) {
+        fputs("5", fp);
+        fclose(fp);
+    }
+    return status_mb("VmRSS");
+}
+
+static double max_difference(const Complex *a, const Complex *b, long total) {
+    double max_error = 0.0;
+    for(long l = 0; l < total; l++) {
+        double e = hypot(a[l].real - b[l].real, a[l].imag - b[l].imag);
+        if(e > max_error) max_error = e;
+    }
+    return max_error;
+}
+
+static void report(FILE *file, const char *shape, long total, const fft_ooc_stats *stats, double peak_mb,
+                   double roundtrip, double in_core) {
+    DUPPRINT(file, "%-12s %9.1f %6d %10.3f %10.1f %8.2f %9.1f %9.1f %11.3e", shape, total * sizeof(Complex) / 1048576.0,
+             stats->passes, stats->seconds, stats->bytes_moved / 1048576.0 / stats->seconds,
+             5.0 * total * log2((double)total) / stats->seconds * 1e-9, stats->tile_bytes / 1048576.0, peak_mb, roundtrip);
+    if(in_core >= 0.0) {
+        DUPPRINT(file, " %11.3e\n", in_core);
+    } else {
+        DUPPRINT(file, " %11s\n", "-");
+    }
+}
+
+static void run_2d(int N, size_t budget, const char *path, FILE *file) {
+    long total = (long)N * N;
+    if(write_input(path, total) != 0) return;
+
+    fft_ooc_stats stats;
+    double base_mb = reset_peak_memory();
+    if(fft_ooc_2d(path, N, N, FFT_FORWARD, budget, &stats) != 0) return;
+    double peak_mb = status_mb("VmHWM") - base_mb;
+
+    double in_core = -1.0;
+    if(total <= MAX_CHECKED_SIZE) {
+        Complex *spectrum = read_file(path, total);
+        Complex *data = allocate_complex(total);
+        for(long g = 0; g < total; g++) {
+            data[g].real = input_value(g, 0);
+            data[g].imag = input_value(g, 1);
+        }
+        fft_plan plan = fft_plan_create_2d(N, N, FFT_FORWARD, FFT_DEFAULT);
+        fft_execute(plan, data, data);
+        fft_plan_destroy(plan);
+        in_core = max_difference(spectrum, data, total);
+        free(spectrum);
+        free(data);
+    }
+
+    fft_ooc_stats backward_stats;
+    if(fft_ooc_2d(path, N, N, FFT_BACKWARD, budget, &backward_stats) != 0) return;
+
+    char shape[64];
+    snprintf(shape, sizeof(shape), "%dx%d", N, N);
+    report(file, shape, total, &stats, peak_mb, roundtrip_error(path, total), in_core);
+}
+
+static void run_1d(long N, size_t budget, const char *in_path, const char *out_path, FILE *file) {
+    if(write_input(in_path, N) != 0) return;
+
+    fft_ooc_stats stats;
+    double base_mb = reset_peak_memory();
+    if(fft_ooc_1d(in_path, out_path, N, FFT_FORWARD, budget, &stats) != 0) return;
+    double peak_mb = status_mb("VmHWM") - base_mb;
+
+    double in_core = -1.0;
+    if(N <= MAX_CHECKED_SIZE) {
+        Complex *spectrum = read_file(out_path, N);
+        Complex *data = allocate_complex(N);
+        for(long g = 0; g < N; g++) {
+            data[g].real = input_value(g, 0);
+            data[g].imag = input_value(g, 1);
+        }
+        fft_plan plan = fft_plan_create((int)N, FFT_FORWARD, FFT_DEFAULT);
+        fft_execute(plan, data, data);
+        fft_plan_destroy(plan);
+        in_core = max_difference(spectrum, data, N);
+        free(spectrum);
+        free(data);
+    }
+
+    // Backward from the spectrum (the forward input file is scratch by now)
+    fft_ooc_stats backward_stats;
+    if(fft_ooc_1d(out_path, in_path, N, FFT_BACKWARD, budget, &backward_stats) != 0) return;
+
+    char shape[64];
+    snprintf(shape, sizeof(shape), "%ld", N);
+    report(file, shape, N, &stats, peak_mb, roundtrip_error(in_path, N), in_core);
+}
+
+int main(int argc, char **argv) {
+    double budget_mb = argc > 1 ? atof(argv[1]) : 64.0;
+    const char *directory = argc > 2 ? argv[2] : ".";
+    size_t budget = (size_t)(budget_mb * 1048576.0);
+
+    char in_path[1024], out_path[1024];
+    snprintf(in_path, sizeof(in_path), "%s/ooc_input.bin", directory);
+    snprintf(out_path, sizeof(out_path), "%s/ooc_output.bin", directory);
+
+    FILE *results_file = fopen("results_ooc.txt", "w");
+    if (!results_file) {
+        printf("Error opening results file\n");
+        return 1;
+    }
+
+    DUPPRINT(results_file, "Out-of-core FFT, memory budget %.1f MB, files in %s\n", budget_mb, directory);
+    DUPPRINT(results_file, "%-12s %9s %6s %10s %10s %8s %9s %9s %11s %11s\n", "Size", "File [MB]", "Passes",
+             "Time [s]", "I/O [MB/s]", "GFLOP/s", "Tile [MB]", "Peak [MB]", "Roundtrip", "vs in-core");
+
+    int sizes_2d[] = {1000, 2048, 4096, 8192};
+    long sizes_1d[] = {1000000, 1L << 22, 1L << 24, 1L << 26};
+
+    for(int s = 0; s < 4; s++) {
+        run_2d(sizes_2d[s], budget, in_path, results_file);
+    }
+    for(int s = 0; s < 4; s++) {
+        run_1d(sizes_1d[s], budget, in_path, out_path, results_file);
+    }
+
+    remove(in_path);
+    remove(out_path);
+    fft_cleanup_threads();
+    fclose(results_file);
+    return 0;
+}
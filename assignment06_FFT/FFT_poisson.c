@@ -0,0 +1,227 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "fft_engine.h"
+#include "fft_poisson.h"
+#include "fft_internal.h"
+
+#define DUPPRINT(fp, fmt...) do {printf(fmt);fprintf(fp,fmt);} while(0)
+
+// Spectral Poisson and diffusion solvers on periodic grids: the Poisson solution of a smooth
+// field against its exact value on growing grids, the diffusion of a sum of modes against
+// its exact decay after many steps, then the time per solve and per step, in grid cells per
+// second, against the same step done with complex transforms of the full spectrum.
+// Usage: ./FFT_poisson [threads]
+
+#define PI 3.14159265358979323846
+
+// phi = exp(sin(a x) + cos(b y)) with a = 2 pi/l0, b = 4 pi/l1, and rho = lap(phi); returns the
+// maximum error of the solution of lap(phi) = rho once the means are removed
+static double poisson_error(int n0, int n1, double l0, double l1) {
+    long count = (long)n0 * n1;
+    double *rho = (double*)checked_malloc(count * sizeof(double));
+    double *phi = (double*)checked_malloc(count * sizeof(double));
+    double a = 2.0 * PI / l0, b = 4.0 * PI / l1;
+    double mean = 0.0;
+    for(int i = 0; i < n0; i++) {
+        double x = i * l0 / n0;
+        for(int j = 0; j < n1; j++) {
+            double y = j * l1 / n1;
+            double sa = sin(a * x), ca = cos(a * x), sb = sin(b * y), cb = cos(b * y);
+            double value = exp(sa + cb);
+            phi[(long)i * n1 + j] = value;
+            rho[(long)i * n1 + j] = value * (a * a * (ca * ca - sa) + b * b * (sb * sb - cb));
+            mean += value;
+        }
+    }
+    mean /= count;
+
+    fft_poisson solver = fft_poisson_create(n0, n1, l0, l1, FFT_DEFAULT);
+    fft_poisson_solve(solver, rho, rho); // in place: rho becomes the solution
+    double error = 0.0;
+    for(long i = 0; i < count; i++) {
+        double e = fabs(rho[i] - (phi[i] - mean));
+        if(e > error) error = e;
+    }
+    fft_poisson_destroy(solver);
+    free(rho);
+    free(phi);
+    return error;
+}
+
+// u0 = sin(a x) cos(b y) + cos(2 a x) / 2 decays mode by mode: u(t) = exp(-D (a^2+b^2) t) sin(a x)
+// cos(b y) + exp(-4 D a^2 t) cos(2 a x) / 2. Returns the maximum error after steps steps of dt.
+static double diffusion_error(int n, double diffusivity, double dt, int steps) {
+    long count = (long)n * n;
+    double *u = (double*)checked_malloc(count * sizeof(double));
+    double a = 2.0 * PI, b = 6.0 * PI;
+    for(int i = 0; i < n; i++) {
+        for(int j = 0; j < n; j++) {
+            double x = (double)i / n, y = (double)j / n;
+            u[(long)i * n + j] = sin(a * x) * cos(b * y) + 0.5 * cos(2 * a * x);
+        }
+    }
+
+    fft_poisson solver = fft_poisson_create(n, n, 1.0, 1.0, FFT_DEFAULT);
+    fft_poisson_set_diffusion(solver, diffusivity, dt);
+    for(int s = 0; s < steps; s++) {
+        fft_poisson_step(solver, u);
+    }
+
+    double t = steps * dt, error = 0.0;
+    double decay1 = exp(-diffusivity * (a * a + b * b) * t), decay2 = exp(-4.0 * diffusivity * a * a * t);
+    for(int i = 0; i < n; i++) {
+        for(int j = 0; j < n; j++) {
+            double x = (double)i / n, y = (double)j / n;
+            double exact = decay1 * sin(a * x) * cos(b * y) + decay2 * 0.5 * cos(2 * a * x);
+            double e = fabs(u[(long)i * n + j] - exact);
+            if(e > error) error = e;
+        }
+    }
+    fft_poisson_destroy(solver);
+    free(u);
+    return error;
+}
+
+// The same diffusion step with complex transforms: the full n x n spectrum, imaginary parts included
+typedef struct {
+    int n;
+    fft_plan forward, backward;
+    double *multiplier;    // n x n
+    Complex *data, *spectrum;
+} c2c_step;
+
+static void c2c_step_init(c2c_step *s, int n, double diffusivity, double dt) {
+    s->n = n;
+    s->forward = fft_plan_create_2d(n, n, FFT_FORWARD, FFT_DEFAULT);
+    s->backward = fft_plan_create_2d(n, n, FFT_BACKWARD, FFT_DEFAULT);
+    s->multiplier = (double*)checked_malloc((long)n * n * sizeof(double));
+    s->data = (Complex*)checked_malloc((long)n * n * sizeof(Complex));
+    s->spectrum = (Complex*)checked_malloc((long)n * n * sizeof(Complex));
+    for(int i = 0; i < n; i++) {
+        double k0 = 2.0 * PI * (i <= n/2 ? i : i - n);
+        for(int j = 0; j < n; j++) {
+            double k1 = 2.0 * PI * (j <= n/2 ? j : j - n);
+            s->multiplier[(long)i * n + j] = exp(-diffusivity * (k0 * k0 + k1 * k1) * dt) / ((double)n * n);
+        }
+    }
+}
+
+static void c2c_step_run(c2c_step *s, double *u) {
+    long count = (long)s->n * s->n;
+    for(long i = 0; i < count; i++) {
+        s->data[i].real = u[i];
+        s->data[i].imag = 0.0;
+    }
+    fft_execute(s->forward, s->data, s->spectrum);
+    for(long i = 0; i < count; i++) {
+        s->spectrum[i].real *= s->multiplier[i];
+        s->spectrum[i].imag *= s->multiplier[i];
+    }
+    fft_execute(s->backward, s->spectrum, s->data);
+    for(long i = 0; i < count; i++) {
+        u[i] = s->data[i].real;
+    }
+}
+
+static void c2c_step_free(c2c_step *s) {
+    fft_plan_destroy(s->forward);
+    fft_plan_destroy(s->backward);
+    free(s->multiplier);
+    free(s->data);
+    free(s->spectrum);
+}
+
+// Average time of one call, repeated for about 0.3 s and at least 3 times
+#define TIME_LOOP(call) do { \
+        int repeats = 0; \
+        double start = wall_time(), elapsed; \
+        do { \
+            call; \
+            repeats++; \
+            elapsed = wall_time() - start; \
+        } while(elapsed < 0.3 || repeats < 3); \
+        seconds = elapsed / repeats; \
+    } while(0)
+
+static void time_grid(FILE *file, int n) {
+    long count = (long)n * n;
+    double *u = (double*)checked_malloc(count * sizeof(double));
+    double *phi = (double*)checked_malloc(count * sizeof(double));
+    for(long i = 0; i < count; i++) {
+        u[i] = (double)rand() / RAND_MAX - 0.5;
+    }
+    double seconds;
+
+    double setup_start = wall_time();
+    fft_poisson solver = fft_poisson_create(n, n, 1.0, 1.0, FFT_DEFAULT);
+    fft_poisson_set_diffusion(solver, 1e-3, 1e-2);
+    double t_setup = wall_time() - setup_start;
+    TIME_LOOP(fft_poisson_solve(solver, u, phi));
+    double t_solve = seconds;
+    TIME_LOOP(fft_poisson_step(solver, u));
+    double t_step = seconds;
+
+    c2c_step reference;
+    c2c_step_init(&reference, n, 1e-3, 1e-2);
+    TIME_LOOP(c2c_step_run(&reference, u));
+    double t_c2c = seconds;
+
+    DUPPRINT(file, "%-10d %10.4f %12.3e %12.3e %10.1f %12.3e %8.2f\n", n, t_setup, t_solve, t_step,
+             count / t_step * 1e-6, t_c2c, t_c2c / t_step);
+
+    fft_poisson_destroy(solver);
+    c2c_step_free(&reference);
+    free(u);
+    free(phi);
+}
+
+int main(int argc, char **argv) {
+    int threads = argc > 1 ? atoi(argv[1]) : 1;
+    if(threads < 1) {
+        printf("Invalid thread count %s\n", argv[1]);
+        return 1;
+    }
+    fft_plan_with_nthreads(threads);
+
+    FILE *results_file = fopen("results_poisson.txt", "w");
+    if (!results_file) {
+        printf("Error opening results file\n");
+        return 1;
+    }
+    srand(42);
+
+    DUPPRINT(results_file, "Poisson: phi = exp(sin(2 pi x) + cos(2 pi y)) on [0,1) x [0,2), maximum error\n");
+    DUPPRINT(results_file, "%-10s %12s\n", "Grid", "Error");
+    int grids[] = {8, 16, 24, 32, 48, 64, 128};
+    for(int g = 0; g < 7; g++) {
+        char shape[64];
+        snprintf(shape, sizeof(shape), "%dx%d", grids[g], grids[g]);
+        DUPPRINT(results_file, "%-10s %12.3e\n", shape, poisson_error(grids[g], grids[g], 1.0, 2.0));
+    }
+
+    DUPPRINT(results_file, "\nDiffusion (D = 1e-3) of sin(2 pi x) cos(6 pi y) + cos(4 pi x)/2 on a 256x256 grid, maximum error\n");
+    DUPPRINT(results_file, "%-10s %10s %12s\n", "dt", "Steps", "Error");
+    double dts[] = {1e-3, 1e-2, 1.0};
+    int steps[] = {10000, 1000, 10};
+    for(int d = 0; d < 3; d++) {
+        DUPPRINT(results_file, "%-10g %10d %12.3e\n", dts[d], steps[d], diffusion_error(256, 1e-3, dts[d], steps[d]));
+    }
+
+    DUPPRINT(results_file, "\nTime per solve and per diffusion step, %d thread(s) (c2c: the step on the full complex spectrum)\n",
+             threads);
+    DUPPRINT(results_file, "%-10s %10s %12s %12s %10s %12s %8s\n", "N", "Setup [s]", "Solve [s]", "Step [s]",
+             "Mcells/s", "c2c step [s]", "Speedup");
+    int sizes[] = {256, 512, 1000, 1024, 2048};
+    for(int s = 0; s < 5; s++) {
+        time_grid(results_file, sizes[s]);
+    }
+
+    fclose(results_file);
+    fft_cleanup();
+    fft_cleanup_threads();
+    return 0;
+}
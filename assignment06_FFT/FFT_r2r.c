@@ -0,0 +1,359 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "fft_engine.h"
+#include "fft_r2r.h"
+#include "fft_precision.h"
+#include "fft_internal.h"
+#ifdef HAVE_FFTW
+#include <fftw3.h>
+#include "fftw_planner.h"
+#endif
+
+#define DUPPRINT(fp, fmt...) do {printf(fmt);fprintf(fp,fmt);} while(0)
+
+// Cosine and sine transforms of types I to IV: every kind checked against its definition summed
+// in long double (1D and all kind pairs in 2D), the roundtrip through the inverse kind, and, when
+// built with HAVE_FFTW, the difference with fftw_plan_r2r_*; DCT-I and DST-I also up to
+// n = 2^20 + 1. Then the time of each kind against the complex FFT of the mirrored sequence of the
+// same logical size (and FFTW's r2r).
+// Usage: ./FFT_r2r [estimate|measure|patient|exhaustive] (the planner effort is FFTW's)
+
+static double *random_array(long count) {
+    double *data = (double*)checked_malloc(count * sizeof(double));
+    for(long i = 0; i < count; i++) {
+        data[i] = (double)rand() / RAND_MAX - 0.5;
+    }
+    return data;
+}
+
+// Relative RMS difference of a against the reference b
+static double relative_error(const double *a, const double *b, long count) {
+    double error = 0.0, norm = 0.0;
+    for(long i = 0; i < count; i++) {
+        error += (a[i] - b[i]) * (a[i] - b[i]);
+        norm += b[i] * b[i];
+    }
+    return norm > 0 ? sqrt(error / norm) : sqrt(error);
+}
+
+// The definitions of fft_r2r.h, O(n^2) in long double, on n values spaced by stride
+static void reference_1d(enum fft_r2r_kind kind, int n, const double *x, double *y, long stride) {
+    const long double pi = 3.141592653589793238462643383279502884L;
+    for(int k = 0; k < n; k++) {
+        long double sum = 0.0L;
+        for(int j = 0; j < n; j++) {
+            long double v = x[j * stride];
+            switch(kind) {
+                case FFT_REDFT00:
+                    if(j == 0) sum += v;
+                    else if(j == n - 1) sum += k % 2 ? -v : v;
+                    else sum += 2 * v * cosl(pi * j * k / (n - 1));
+                    break;
+                case FFT_REDFT10: sum += 2 * v * cosl(pi * (j + 0.5L) * k / n); break;
+                case FFT_REDFT01: sum += j == 0 ? v : 2 * v * cosl(pi * j * (k + 0.5L) / n); break;
+                case FFT_REDFT11: sum += 2 * v * cosl(pi * (j + 0.5L) * (k + 0.5L) / n); break;
+                case FFT_RODFT00: sum += 2 * v * sinl(pi * (j + 1) * (k + 1) / (n + 1)); break;
+                case FFT_RODFT10: sum += 2 * v * sinl(pi * (j + 0.5L) * (k + 1) / n); break;
+                case FFT_RODFT01:
+                    if(j == n - 1) sum += k % 2 ? -v : v;
+                    else sum += 2 * v * sinl(pi * (j + 1) * (k + 0.5L) / n);
+                    break;
+                case FFT_RODFT11: sum += 2 * v * sinl(pi * (j + 0.5L) * (k + 0.5L) / n); break;
+            }
+        }
+        y[k * stride] = (double)sum;
+    }
+}
+
+// Rows with kind1, then columns with kind0
+static void reference_2d(enum fft_r2r_kind kind0, enum fft_r2r_kind kind1, int n0, int n1, const double *x, double *y) {
+    double *rows = (double*)checked_malloc((long)n0 * n1 * sizeof(double));
+    for(int i = 0; i < n0; i++) {
+        reference_1d(kind1, n1, x + (long)i * n1, rows + (long)i * n1, 1);
+    }
+    for(int j = 0; j < n1; j++) {
+        reference_1d(kind0, n0, rows + j, y + j, n1);
+    }
+    free(rows);
+}
+
+#ifdef HAVE_FFTW
+static unsigned fftw_effort = FFTW_MEASURE;
+
+static fftw_r2r_kind fftw_kind(enum fft_r2r_kind kind) {
+    static const fftw_r2r_kind kinds[] = {FFTW_REDFT00, FFTW_REDFT10, FFTW_REDFT01, FFTW_REDFT11,
+                                          FFTW_RODFT00, FFTW_RODFT10, FFTW_RODFT01, FFTW_RODFT11};
+    return kinds[kind];
+}
+
+// FFTW's result for the same input (planned with FFTW_ESTIMATE so that x is not overwritten)
+static double fftw_difference(enum fft_r2r_kind kind0, enum fft_r2r_kind kind1, int n0, int n1, const double *x,
+                              const double *y) {
+    long count = (long)n0 * n1;
+    double *in = (double*)checked_malloc(count * sizeof(double));
+    double *out = (double*)checked_malloc(count * sizeof(double));
+    memcpy(in, x, count * sizeof(double));
+    fftw_plan plan = n0 == 1 ? fftw_plan_r2r_1d(n1, in, out, fftw_kind(kind1), FFTW_ESTIMATE)
+                             : fftw_plan_r2r_2d(n0, n1, in, out, fftw_kind(kind0), fftw_kind(kind1), FFTW_ESTIMATE);
+    fftw_execute(plan);
+    double error = relative_error(y, out, count);
+    fftw_destroy_plan(plan);
+    free(in);
+    free(out);
+    return error;
+}
+#endif
+
+// Error against the definition, roundtrip error and (with FFTW) difference with FFTW for one case
+static void check_case(enum fft_r2r_kind kind0, enum fft_r2r_kind kind1, int n0, int n1, double errors[3]) {
+    fft_r2r plan = n0 == 1 ? fft_r2r_create(n1, kind1, FFT_DEFAULT) : fft_r2r_create_2d(n0, n1, kind0, kind1, FFT_DEFAULT);
+    fft_r2r inverse = n0 == 1 ? fft_r2r_create(n1, fft_r2r_inverse_kind(kind1), FFT_DEFAULT)
+                              : fft_r2r_create_2d(n0, n1, fft_r2r_inverse_kind(kind0), fft_r2r_inverse_kind(kind1), FFT_DEFAULT);
+    long count = (long)n0 * n1;
+    double *x = random_array(count);
+    double *y = (double*)checked_malloc(count * sizeof(double));
+    double *reference = (double*)checked_malloc(count * sizeof(double));
+    double *back = (double*)checked_malloc(count * sizeof(double));
+
+    fft_r2r_execute(plan, x, y);
+    if(n0 == 1) reference_1d(kind1, n1, x, reference, 1);
+    else reference_2d(kind0, kind1, n0, n1, x, reference);
+    errors[0] = relative_error(y, reference, count);
+
+    // In place, normalized by the logical size
+    memcpy(back, y, count * sizeof(double));
+    fft_r2r_execute(inverse, back, back);
+    double scale = fft_r2r_normalization(plan);
+    for(long i = 0; i < count; i++) back[i] /= scale;
+    errors[1] = relative_error(back, x, count);
+
+#ifdef HAVE_FFTW
+    errors[2] = fftw_difference(kind0, kind1, n0, n1, x, y);
+#else
+    errors[2] = NAN;
+#endif
+
+    fft_r2r_destroy(plan);
+    fft_r2r_destroy(inverse);
+    free(x);
+    free(y);
+    free(reference);
+    free(back);
+}
+
+static void check_accuracy(FILE *file) {
+    int sizes[] = {2, 3, 4, 5, 8, 15, 16, 17, 31, 64, 100, 127, 128, 1000, 1001};
+    int n_sizes = sizeof(sizes) / sizeof(sizes[0]);
+
+    DUPPRINT(file, "Worst relative RMS error over n = 2 ... 1001 (FFTW: difference with fftw_plan_r2r_1d)\n");
+    DUPPRINT(file, "%-8s %-9s %11s %11s %11s\n", "Kind", "FFTW kind", "Definition", "Roundtrip", "FFTW");
+    for(int kind = 0; kind < FFT_R2R_KINDS; kind++) {
+        double worst[3] = {0.0, 0.0, 0.0};
+        for(int s = 0; s < n_sizes; s++) {
+            double errors[3];
+            check_case(kind, kind, 1, sizes[s], errors);
+            for(int e = 0; e < 3; e++) {
+                if(!(errors[e] <= worst[e])) worst[e] = errors[e];
+            }
+        }
+        DUPPRINT(file, "%-8s %-9s %11.2e %11.2e %11.2e\n", fft_r2r_kind_name(kind), fft_r2r_fftw_name(kind),
+                 worst[0], worst[1], worst[2]);
+    }
+
+    int shapes[][2] = {{2, 2}, {4, 6}, {7, 5}, {16, 16}, {33, 20}, {64, 48}};
+    int n_shapes = sizeof(shapes) / sizeof(shapes[0]);
+    DUPPRINT(file, "\n2D: worst relative RMS error over the %d kind pairs\n", FFT_R2R_KINDS * FFT_R2R_KINDS);
+    DUPPRINT(file, "%-8s %11s %11s %11s\n", "Shape", "Definition", "Roundtrip", "FFTW");
+    for(int s = 0; s < n_shapes; s++) {
+        double worst[3] = {0.0, 0.0, 0.0};
+        for(int kind0 = 0; kind0 < FFT_R2R_KINDS; kind0++) {
+            for(int kind1 = 0; kind1 < FFT_R2R_KINDS; kind1++) {
+                double errors[3];
+                check_case(kind0, kind1, shapes[s][0], shapes[s][1], errors);
+                for(int e = 0; e < 3; e++) {
+                    if(!(errors[e] <= worst[e])) worst[e] = errors[e];
+                }
+            }
+        }
+        char shape[64];
+        snprintf(shape, sizeof(shape), "%dx%d", shapes[s][0], shapes[s][1]);
+        DUPPRINT(file, "%-8s %11.2e %11.2e %11.2e\n", shape, worst[0], worst[1], worst[2]);
+    }
+}
+
+// DCT-I and DST-I at large n, where an O(n^2) definition is too slow: the reference is the real FFT
+// in long double of the even or odd extension of logical size N, as in fft_r2r.c
+static void check_large(FILE *file) {
+    int sizes[] = {1025, 262145, 1048577};
+    enum fft_r2r_kind kinds[] = {FFT_REDFT00, FFT_RODFT00};
+
+    DUPPRINT(file, "\nDCT-I and DST-I at large n: relative RMS error against the long double FFT of the extension\n");
+    DUPPRINT(file, "%-8s %-9s %11s %11s\n", "Kind", "Size", "Reference", "Roundtrip");
+    for(int t = 0; t < 2; t++) {
+        enum fft_r2r_kind kind = kinds[t];
+        for(int s = 0; s < 3; s++) {
+            int n = sizes[s];
+            int m = kind == FFT_REDFT00 ? n - 1 : n + 1;
+            double *x = random_array(n);
+            double *y = (double*)checked_malloc(n * sizeof(double));
+            double *reference = (double*)checked_malloc(n * sizeof(double));
+            long double *e = (long double*)checked_malloc(2L * m * sizeof(long double));
+            ComplexL *E = (ComplexL*)checked_malloc((m + 1L) * sizeof(ComplexL));
+
+            if(kind == FFT_REDFT00) {
+                for(int j = 0; j <= m; j++) e[j] = x[j];
+                for(int j = 1; j < m; j++) e[2*m - j] = x[j];
+            } else {
+                e[0] = e[m] = 0.0L;
+                for(int j = 1; j < m; j++) {
+                    e[j] = x[j - 1];
+                    e[2*m - j] = -x[j - 1];
+                }
+            }
+            fftl_plan extension = fftl_plan_create_r2c(2*m, FFT_DEFAULT);
+            fftl_execute_r2c(extension, e, E);
+            for(int k = 0; k < n; k++) {
+                reference[k] = kind == FFT_REDFT00 ? (double)E[k].real : (double)-E[k + 1].imag;
+            }
+
+            fft_r2r plan = fft_r2r_create(n, kind, FFT_DEFAULT);
+            fft_r2r_execute(plan, x, y);
+            double error = relative_error(y, reference, n);
+            fft_r2r_execute(plan, y, y);
+            double scale = fft_r2r_normalization(plan);
+            for(int j = 0; j < n; j++) y[j] /= scale;
+            double roundtrip = relative_error(y, x, n);
+
+            char size[32];
+            snprintf(size, sizeof(size), "%d", n);
+            DUPPRINT(file, "%-8s %-9s %11.2e %11.2e\n", fft_r2r_kind_name(kind), size, error, roundtrip);
+
+            fft_r2r_destroy(plan);
+            fftl_plan_destroy(extension);
+            free(x);
+            free(y);
+            free(reference);
+            free(e);
+            free(E);
+        }
+    }
+}
+
+// Average time of one execution, repeated for about 0.1 s
+#define TIME_LOOP(call) do { \
+        int repeats = 0; \
+        double start = wall_time(), elapsed; \
+        do { \
+            call; \
+            repeats++; \
+            elapsed = wall_time() - start; \
+        } while(elapsed < 0.1); \
+        seconds = elapsed / repeats; \
+    } while(0)
+
+// FFTW's logical size N: the period of the even or odd extension of n points
+static long logical_size_of(enum fft_r2r_kind kind, int n) {
+    if(kind == FFT_REDFT00) return 2L * (n - 1);
+    if(kind == FFT_RODFT00) return 2L * (n + 1);
+    return 2L * n;
+}
+
+// One kind on n0 x n1 points: the r2r plan, the complex FFT of the logical size (the mirrored
+// sequence the transform is defined on) and FFTW's r2r plan
+static void time_case(FILE *file, enum fft_r2r_kind kind, int n0, int n1) {
+    long count = (long)n0 * n1;
+    double *x = random_array(count);
+    double *y = (double*)checked_malloc(count * sizeof(double));
+    double seconds;
+
+    fft_r2r plan = n0 == 1 ? fft_r2r_create(n1, kind, FFT_DEFAULT) : fft_r2r_create_2d(n0, n1, kind, kind, FFT_DEFAULT);
+    TIME_LOOP(fft_r2r_execute(plan, x, y));
+    double t_r2r = seconds;
+
+    int m0 = n0 == 1 ? 1 : (int)logical_size_of(kind, n0), m1 = (int)logical_size_of(kind, n1);
+    long mirrored = (long)m0 * m1;
+    Complex *z = (Complex*)checked_malloc(mirrored * sizeof(Complex));
+    Complex *Z = (Complex*)checked_malloc(mirrored * sizeof(Complex));
+    for(long i = 0; i < mirrored; i++) {
+        z[i].real = (double)rand() / RAND_MAX - 0.5;
+        z[i].imag = 0.0;
+    }
+    fft_plan c2c = n0 == 1 ? fft_plan_create(m1, FFT_FORWARD, FFT_DEFAULT) : fft_plan_create_2d(m0, m1, FFT_FORWARD, FFT_DEFAULT);
+    TIME_LOOP(fft_execute(c2c, z, Z));
+    double t_c2c = seconds;
+
+    double t_fftw = NAN;
+#ifdef HAVE_FFTW
+    double *in = (double*)checked_malloc(count * sizeof(double));
+    double *out = (double*)checked_malloc(count * sizeof(double));
+    fftw_plan fplan = n0 == 1 ? fftw_plan_r2r_1d(n1, in, out, fftw_kind(kind), fftw_effort)
+                              : fftw_plan_r2r_2d(n0, n1, in, out, fftw_kind(kind), fftw_kind(kind), fftw_effort);
+    memcpy(in, x, count * sizeof(double));
+    TIME_LOOP(fftw_execute(fplan));
+    t_fftw = seconds;
+    fftw_destroy_plan(fplan);
+    free(in);
+    free(out);
+#endif
+
+    char shape[64], mshape[64];
+    if(n0 == 1) {
+        snprintf(shape, sizeof(shape), "%d", n1);
+        snprintf(mshape, sizeof(mshape), "%d", m1);
+    } else {
+        snprintf(shape, sizeof(shape), "%dx%d", n0, n1);
+        snprintf(mshape, sizeof(mshape), "%dx%d", m0, m1);
+    }
+    DUPPRINT(file, "%-8s %-10s %12.3e %-10s %12.3e %8.2f %12.3e\n", fft_r2r_kind_name(kind), shape, t_r2r, mshape, t_c2c,
+             t_c2c / t_r2r, t_fftw);
+
+    fft_r2r_destroy(plan);
+    fft_plan_destroy(c2c);
+    free(x);
+    free(y);
+    free(z);
+    free(Z);
+}
+
+int main(int argc, char **argv) {
+#ifdef HAVE_FFTW
+    if(argc > 1 && parse_effort(argv[1], &fftw_effort) != 0) {
+        printf("Unknown planner effort %s (use estimate, measure, patient or exhaustive)\n", argv[1]);
+        return 1;
+    }
+#else
+    (void)argc;
+    (void)argv;
+#endif
+    FILE *results_file = fopen("results_r2r.txt", "w");
+    if (!results_file) {
+        printf("Error opening results file\n");
+        return 1;
+    }
+    srand(42);
+
+    check_accuracy(results_file);
+    check_large(results_file);
+
+    int sizes_1d[] = {1000, 1024, 4096, 65536};
+    int sizes_2d[] = {256, 1000, 1024};
+    DUPPRINT(results_file, "\nTime of one transform [s]: r2r plan, complex FFT of the mirrored sequence, FFTW r2r\n");
+    DUPPRINT(results_file, "%-8s %-10s %12s %-10s %12s %8s %12s\n", "Kind", "Size", "r2r", "Mirrored", "c2c",
+             "Speedup", "FFTW");
+    for(int kind = 0; kind < FFT_R2R_KINDS; kind++) {
+        for(int s = 0; s < 4; s++) {
+            time_case(results_file, kind, 1, sizes_1d[s]);
+        }
+        for(int s = 0; s < 3; s++) {
+            time_case(results_file, kind, sizes_2d[s], sizes_2d[s]);
+        }
+    }
+
+    fclose(results_file);
+    fft_cleanup();
+    return 0;
+}
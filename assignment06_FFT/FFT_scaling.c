@@ -0,0 +1,98 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "fft_engine.h"
+#include "fft_internal.h"
+
+#define DUPPRINT(fp, fmt...) do {printf(fmt);fprintf(fp,fmt);} while(0)
+
+// Strong scaling of the threaded 2D complex-to-complex FFT: fixed N x N problem,
+// increasing thread count. Usage: ./FFT_scaling [max_threads]
+
+// FNV-1a hash of the output, used to check that every thread count gives the same bits
+static unsigned long long hash_bytes(const void *data, size_t size) {
+    const unsigned char *bytes = (const unsigned char*)data;
+    unsigned long long h = 14695981039346656037ULL;
+    for(size_t i = 0; i < size; i++) {
+        h ^= bytes[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+// 1, 2, 4, ... and max_threads itself
+static int next_thread_count(int threads, int max_threads) {
+    return threads < max_threads && 2*threads > max_threads ? max_threads : 2*threads;
+}
+
+int main(int argc, char **argv) {
+    int sizes[] = {1000, 1024, 2000, 2048, 4096, 8192};
+    int n_sizes = sizeof(sizes) / sizeof(sizes[0]);
+    int max_threads = argc > 1 ? atoi(argv[1]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if(max_threads < 1) max_threads = 1;
+
+    FILE *results_file = fopen("results_scaling.txt", "w");
+    if (!results_file) {
+        printf("Error opening results file\n");
+        return 1;
+    }
+
+    DUPPRINT(results_file, "Strong scaling of the 2D FFT, up to %d threads\n", max_threads);
+    DUPPRINT(results_file, "%6s %8s %12s %9s %11s %s\n", "N", "threads", "time [s]", "speedup", "efficiency", "bitwise");
+
+    for(int s = 0; s < n_sizes; s++) {
+        int N = sizes[s];
+        size_t n = (size_t)N * N;
+        Complex *input = (Complex*)malloc(n * sizeof(Complex));
+        Complex *data = (Complex*)malloc(n * sizeof(Complex));
+        if (!input || !data) {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+        srand(42);
+        for(size_t i = 0; i < n; i++) {
+            input[i].real = (double)rand() / RAND_MAX - 0.5;
+            input[i].imag = (double)rand() / RAND_MAX - 0.5;
+        }
+
+        // About 2^26 points per measurement, at least one transform
+        int repeats = (int)((1 << 26) / n);
+        if(repeats < 1) repeats = 1;
+
+        double serial_time = 0.0;
+        unsigned long long serial_hash = 0;
+        for(int threads = 1; threads <= max_threads; threads = next_thread_count(threads, max_threads)) {
+            fft_plan_with_nthreads(threads);
+            fft_plan plan = fft_plan_create_2d(N, N, FFT_FORWARD, FFT_DEFAULT);
+
+            // Warm-up run, also starts the worker threads
+            fft_execute(plan, input, data);
+
+            double start = wall_time();
+            for(int r = 0; r < repeats; r++) {
+                fft_execute(plan, input, data);
+            }
+            double elapsed = (wall_time() - start) / repeats;
+
+            unsigned long long h = hash_bytes(data, n * sizeof(Complex));
+            if(threads == 1) {
+                serial_time = elapsed;
+                serial_hash = h;
+            }
+            double speedup = serial_time / elapsed;
+            DUPPRINT(results_file, "%6d %8d %12.6f %9.2f %10.1f%% %s\n", N, threads, elapsed, speedup,
+                     100.0 * speedup / threads, h == serial_hash ? "yes" : "NO");
+            fft_plan_destroy(plan);
+        }
+
+        free(input);
+        free(data);
+    }
+
+    fft_cleanup_threads();
+    fclose(results_file);
+    return 0;
+}
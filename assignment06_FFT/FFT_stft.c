@@ -0,0 +1,185 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "fft_engine.h"
+#include "fft_stft.h"
+#include "fft_internal.h"
+
+#define DUPPRINT(fp, fmt...) do {printf(fmt);fprintf(fp,fmt);} while(0)
+
+// Samples read or generated at a time
+#define CHUNK 65536
+
+// Streaming STFT. Without arguments, a benchmark on a generated chirp: the frequency of the peak
+// of every frame is checked against the chirp and the frames per second are measured for a few
+// frame sizes. With arguments, the STFT of a file of native doubles ("-" reads standard input):
+// ./FFT_stft [input|-] [frame_size] [hop] [rectangular|hann|hamming|blackman] [spectrogram.txt]
+// The spectrogram file gets one line per frame with the magnitudes of the frame_size/2+1 bins.
+
+static const char *window_names[] = {"rectangular", "hann", "hamming", "blackman"};
+
+// Linear chirp from 0.05 to 0.45 cycles per sample over the whole signal, plus a little noise
+static double chirp_frequency(double t, long total) {
+    return 0.05 + 0.4 * t / total;
+}
+
+static double chirp_sample(long i, long total) {
+    const double pi = acos(-1.0);
+    double phase = 2.0 * pi * (0.05 * i + 0.2 * (double)i * i / total);
+    return sin(phase) + 0.01 * ((double)rand() / RAND_MAX - 0.5);
+}
+
+struct chirp_check {
+    int frame_size, hop;
+    long total;
+    double max_bin_error;
+};
+
+// Largest distance, in bins, between the peak of a frame and the chirp frequency at its center
+static void check_peak(const Complex *spectrum, long frame, void *user_data) {
+    struct chirp_check *check = (struct chirp_check*)user_data;
+    int N = check->frame_size;
+    int peak = 0;
+    double peak_power = -1.0;
+    for(int k = 0; k <= N/2; k++) {
+        double power = spectrum[k].real * spectrum[k].real + spectrum[k].imag * spectrum[k].imag;
+        if(power > peak_power) {
+            peak_power = power;
+            peak = k;
+        }
+    }
+    double center = (double)frame * check->hop + 0.5 * N;
+    if(center >= check->total) return; // zero-padded last frame
+    double error = fabs(peak - chirp_frequency(center, check->total) * N);
+    if(error > check->max_bin_error) check->max_bin_error = error;
+}
+
+static void benchmark(FILE *file, int frame_size, int hop, long total) {
+    double *chunk = (double*)malloc(CHUNK * sizeof(double));
+    if (!chunk) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    struct chirp_check check = {frame_size, hop, total, 0.0};
+    fft_stft stft = fft_stft_create(frame_size, hop, FFT_WINDOW_HANN, FFT_DEFAULT);
+
+    // Only the STFT is timed, not the generation of the samples
+    double elapsed = 0.0;
+    long frames = 0;
+    srand(42);
+    for(long start = 0; start < total; start += CHUNK) {
+        int count = total - start < CHUNK ? (int)(total - start) : CHUNK;
+        for(int i = 0; i < count; i++) {
+            chunk[i] = chirp_sample(start + i, total);
+        }
+        double t0 = wall_time();
+        frames += fft_stft_push(stft, chunk, count, check_peak, &check);
+        elapsed += wall_time() - t0;
+    }
+    frames += fft_stft_flush(stft, check_peak, &check);
+
+    DUPPRINT(file, "%8d %6d %10ld %10.4f %12.0f %12.1f %10.2f\n", frame_size, hop, frames, elapsed, frames / elapsed,
+             total / elapsed * 1e-6, check.max_bin_error);
+    fft_stft_destroy(stft);
+    free(chunk);
+}
+
+struct spectrogram_output {
+    FILE *fp;
+    int bins;
+};
+
+static void write_frame(const Complex *spectrum, long frame, void *user_data) {
+    struct spectrogram_output *output = (struct spectrogram_output*)user_data;
+    (void)frame;
+    if(!output->fp) return;
+    for(int k = 0; k < output->bins; k++) {
+        fprintf(output->fp, "%e ", hypot(spectrum[k].real, spectrum[k].imag));
+    }
+    fprintf(output->fp, "\n");
+}
+
+static int process_input(FILE *file, const char *path, int frame_size, int hop, int window, const char *output_path) {
+    FILE *in = strcmp(path, "-") == 0 ? stdin : fopen(path, "rb");
+    if (!in) {
+        printf("Error opening %s\n", path);
+        return 1;
+    }
+    struct spectrogram_output output = {NULL, frame_size/2 + 1};
+    if (output_path) {
+        output.fp = fopen(output_path, "w");
+        if (!output.fp) {
+            printf("Error opening %s\n", output_path);
+            return 1;
+        }
+    }
+    double *chunk = (double*)malloc(CHUNK * sizeof(double));
+    if (!chunk) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    fft_stft stft = fft_stft_create(frame_size, hop, window, FFT_DEFAULT);
+    if (!stft) {
+        printf("Invalid frame size %d or hop %d\n", frame_size, hop);
+        return 1;
+    }
+
+    double start = wall_time();
+    long samples = 0, frames = 0;
+    size_t count;
+    while((count = fread(chunk, sizeof(double), CHUNK, in)) > 0) {
+        frames += fft_stft_push(stft, chunk, (int)count, write_frame, &output);
+        samples += count;
+    }
+    frames += fft_stft_flush(stft, write_frame, &output);
+    double elapsed = wall_time() - start;
+
+    DUPPRINT(file, "STFT of %s: %ld samples, frame %d, hop %d, %s window\n", path, samples, frame_size, hop,
+             window_names[window]);
+    DUPPRINT(file, "%ld frames in %.4f seconds (%.0f frames/s, including input and output)\n", frames, elapsed,
+             elapsed > 0 ? frames / elapsed : 0.0);
+
+    fft_stft_destroy(stft);
+    free(chunk);
+    if (output.fp) fclose(output.fp);
+    if (in != stdin) fclose(in);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    FILE *results_file = fopen("results_stft.txt", "w");
+    if (!results_file) {
+        printf("Error opening results file\n");
+        return 1;
+    }
+
+    int status = 0;
+    if (argc > 1) {
+        int frame_size = argc > 2 ? atoi(argv[2]) : 1024;
+        int hop = argc > 3 ? atoi(argv[3]) : frame_size / 4;
+        int window = FFT_WINDOW_HANN;
+        if (argc > 4) {
+            for(window = 0; window < 4 && strcmp(argv[4], window_names[window]) != 0; window++);
+            if (window == 4) {
+                printf("Unknown window %s (use rectangular, hann, hamming or blackman)\n", argv[4]);
+                return 1;
+            }
+        }
+        status = process_input(results_file, argv[1], frame_size, hop, window, argc > 5 ? argv[5] : NULL);
+    } else {
+        long total = 1L << 24;
+        DUPPRINT(results_file, "Streaming STFT of a %ld-sample chirp, Hann window, hop = frame/4\n", total);
+        DUPPRINT(results_file, "%8s %6s %10s %10s %12s %12s %10s\n", "Frame", "Hop", "Frames", "Time [s]",
+                 "Frames/s", "MSamples/s", "Peak err");
+        int frame_sizes[] = {256, 1024, 4096, 16384};
+        for(int i = 0; i < 4; i++) {
+            benchmark(results_file, frame_sizes[i], frame_sizes[i] / 4, total);
+        }
+    }
+
+    fclose(results_file);
+    return status;
+}
@@ -0,0 +1,7722 @@
+// Generated by gen_codelets.c, do not edit.
+
+#include "fft_codelets.h"
+
+// 2 points: 4 additions, 0 multiplications
+void fft_codelet_2(const double *ri, const double *ii, double *ro, double *io, long is, long os) {
+    const double x0r = ri[0], x0i = ii[0];
+    const double x1r = ri[is], x1i = ii[is];
+    const double t0 = x0r + x1r;
+    const double t1 = x0i + x1i;
+    const double t2 = x0r - x1r;
+    const double t3 = x0i - x1i;
+    ro[0] = t0;
+    io[0] = t1;
+    ro[os] = t2;
+    io[os] = t3;
+}
+
+// 3 points: 12 additions, 4 multiplications
+void fft_codelet_3(const double *ri, const double *ii, double *ro, double *io, long is, long os) {
+    const double x0r = ri[0], x0i = ii[0];
+    const double x1r = ri[is], x1i = ii[is];
+    const double x2r = ri[2 * is], x2i = ii[2 * is];
+    const double t0 = x1r + x2r;
+    const double t1 = x1i + x2i;
+    const double t2 = x1r - x2r;
+    const double t3 = x1i - x2i;
+    const double t4 = x0r + t0;
+    const double t5 = x0i + t1;
+    const double t6 = 0.5 * t0;
+    const double t7 = 0.5 * t1;
+    const double t8 = 0.8660254037844386 * t2;
+    const double t9 = 0.8660254037844386 * t3;
+    const double t10 = x0r - t6;
+    const double t11 = x0i - t7;
+    const double t12 = t9 + t10;
+    const double t13 = t11 - t8;
+    const double t14 = t10 - t9;
+    const double t15 = t8 + t11;
+    ro[0] = t4;
+    io[0] = t5;
+    ro[os] = t12;
+    io[os] = t13;
+    ro[2 * os] = t14;
+    io[2 * os] = t15;
+}
+
+// 4 points: 16 additions, 0 multiplications
+void fft_codelet_4(const double *ri, const double *ii, double *ro, double *io, long is, long os) {
+    const double x0r = ri[0], x0i = ii[0];
+    const double x1r = ri[is], x1i = ii[is];
+    const double x2r = ri[2 * is], x2i = ii[2 * is];
+    const double x3r = ri[3 * is], x3i = ii[3 * is];
+    const double t0 = x0r + x2r;
+    const double t1 = x0i + x2i;
+    const double t2 = x0r - x2r;
+    const double t3 = x0i - x2i;
+    const double t4 = x1r + x3r;
+    const double t5 = x1i + x3i;
+    const double t6 = x1i - x3i;
+    const double t7 = x3r - x1r;
+    const double t8 = t0 + t4;
+    const double t9 = t1 + t5;
+    const double t10 = t0 - t4;
+    const double t11 = t1 - t5;
+    const double t12 = t2 + t6;
+    const double t13 = t3 + t7;
+    const double t14 = t2 - t6;
+    const double t15 = t3 - t7;
+    ro[0] = t8;
+    io[0] = t9;
+    ro[os] = t12;
+    io[os] = t13;
+    ro[2 * os] = t10;
+    io[2 * os] = t11;
+    ro[3 * os] = t14;
+    io[3 * os] = t15;
+}
+
+// 5 points: 32 additions, 16 multiplications
+void fft_codelet_5(const double *ri, const double *ii, double *ro, double *io, long is, long os) {
+    const double x0r = ri[0], x0i = ii[0];
+    const double x1r = ri[is], x1i = ii[is];
+    const double x2r = ri[2 * is], x2i = ii[2 * is];
+    const double x3r = ri[3 * is], x3i = ii[3 * is];
+    const double x4r = ri[4 * is], x4i = ii[4 * is];
+    const double t0 = x1r + x4r;
+    const double t1 = x1i + x4i;
+    const double t2 = x1r - x4r;
+    const double t3 = x1i - x4i;
+    const double t4 = x2r + x3r;
+    const double t5 = x2i + x3i;
+    const double t6 = x2r - x3r;
+    const double t7 = x2i - x3i;
+    const double t8 = x0r + t0;
+    const double t9 = x0i + t1;
+    const double t10 = t4 + t8;
+    const double t11 = t5 + t9;
+    const double t12 = 0.30901699437494745 * t0;
+    const double t13 = 0.30901699437494745 * t1;
+    const double t14 = 0.95105651629515353 * t2;
+    const double t15 = 0.95105651629515353 * t3;
+    const double t16 = x0r + t12;
+    const double t17 = x0i + t13;
+    const double t18 = 0.80901699437494745 * t4;
+    const double t19 = 0.80901699437494745 * t5;
+    const double t20 = 0.58778525229247314 * t6;
+    const double t21 = 0.58778525229247314 * t7;
+    const double t22 = t16 - t18;
+    const double t23 = t17 - t19;
+    const double t24 = t14 + t20;
+    const double t25 = t15 + t21;
+    const double t26 = t22 + t25;
+    const double t27 = t23 - t24;
+    const double t28 = t22 - t25;
+    const double t29 = t23 + t24;
+    const double t30 = 0.80901699437494745 * t0;
+    const double t31 = 0.80901699437494745 * t1;
+    const double t32 = 0.58778525229247314 * t2;
+    const double t33 = 0.58778525229247314 * t3;
+    const double t34 = x0r - t30;
+    const double t35 = x0i - t31;
+    const double t36 = 0.30901699437494745 * t4;
+    const double t37 = 0.30901699437494745 * t5;
+    const double t38 = 0.95105651629515353 * t6;
+    const double t39 = 0.95105651629515353 * t7;
+    const double t40 = t34 + t36;
+    const double t41 = t35 + t37;
+    const double t42 = t33 - t39;
+    const double t43 = t38 - t32;
+    const double t44 = t40 + t42;
+    const double t45 = t41 + t43;
+    const double t46 = t40 - t42;
+    const double t47 = t41 - t43;
+    ro[0] = t10;
+    io[0] = t11;
+    ro[os] = t26;
+    io[os] = t27;
+    ro[2 * os] = t44;
+    io[2 * os] = t45;
+    ro[3 * os] = t46;
+    io[3 * os] = t47;
+    ro[4 * os] = t28;
+    io[4 * os] = t29;
+}
+
+// 6 points: 40 additions, 16 multiplications
+void fft_codelet_6(const double *ri, const double *ii, double *ro, double *io, long is, long os) {
+    const double x0r = ri[0], x0i = ii[0];
+    const double x1r = ri[is], x1i = ii[is];
+    const double x2r = ri[2 * is], x2i = ii[2 * is];
+    const double x3r = ri[3 * is], x3i = ii[3 * is];
+    const double x4r = ri[4 * is], x4i = ii[4 * is];
+    const double x5r = ri[5 * is], x5i = ii[5 * is];
+    const double t0 = x2r + x4r;
+    const double t1 = x2i + x4i;
+    const double t2 = x2r - x4r;
+    const double t3 = x2i - x4i;
+    const double t4 = x0r + t0;
+    const double t5 = x0i + t1;
+    const double t6 = 0.5 * t0;
+    const double t7 = 0.5 * t1;
+    const double t8 = 0.8660254037844386 * t2;
+    const double t9 = 0.8660254037844386 * t3;
+    const double t10 = x0r - t6;
+    const double t11 = x0i - t7;
+    const double t12 = t9 + t10;
+    const double t13 = t11 - t8;
+    const double t14 = t10 - t9;
+    const double t15 = t8 + t11;
+    const double t16 = x3r + x5r;
+    const double t17 = x3i + x5i;
+    const double t18 = x3r - x5r;
+    const double t19 = x3i - x5i;
+    const double t20 = x1r + t16;
+    const double t21 = x1i + t17;
+    const double t22 = 0.5 * t16;
+    const double t23 = 0.5 * t17;
+    const double t24 = 0.8660254037844386 * t18;
+    const double t25 = 0.8660254037844386 * t19;
+    const double t26 = x1r - t22;
+    const double t27 = x1i - t23;
+    const double t28 = t25 + t26;
+    const double t29 = t27 - t24;
+    const double t30 = t26 - t25;
+    const double t31 = t24 + t27;
+    const double t32 = t4 + t20;
+    const double t33 = t5 + t21;
+    const double t34 = t4 - t20;
+    const double t35 = t5 - t21;
+    const double t36 = 0.8660254037844386 * t29;
+    const double t37 = 0.5 * t28;
+    const double t38 = t36 + t37;
+    const double t39 = 0.8660254037844386 * t28;
+    const double t40 = 0.5 * t29;
+    const double t41 = t40 - t39;
+    const double t42 = t12 + t38;
+    const double t43 = t13 + t41;
+    const double t44 = t12 - t38;
+    const double t45 = t13 - t41;
+    const double t46 = 0.8660254037844386 * t31;
+    const double t47 = 0.5 * t30;
+    const double t48 = t46 - t47;
+    const double t49 = 0.8660254037844386 * t30;
+    const double t50 = 0.5 * t31;
+    const double t51 = t49 + t50;
+    const double t52 = t14 + t48;
+    const double t53 = t15 - t51;
+    const double t54 = t14 - t48;
+    const double t55 = t15 + t51;
+    ro[0] = t32;
+    io[0] = t33;
+    ro[os] = t42;
+    io[os] = t43;
+    ro[2 * os] = t52;
+    io[2 * os] = t53;
+    ro[3 * os] = t34;
+    io[3 * os] = t35;
+    ro[4 * os] = t44;
+    io[4 * os] = t45;
+    ro[5 * os] = t54;
+    io[5 * os] = t55;
+}
+
+// 7 points: 60 additions, 36 multiplications
+void fft_codelet_7(const double *ri, const double *ii, double *ro, double *io, long is, long os) {
+    const double x0r = ri[0], x0i = ii[0];
+    const double x1r = ri[is], x1i = ii[is];
+    const double x2r = ri[2 * is], x2i = ii[2 * is];
+    const double x3r = ri[3 * is], x3i = ii[3 * is];
+    const double x4r = ri[4 * is], x4i = ii[4 * is];
+    const double x5r = ri[5 * is], x5i = ii[5 * is];
+    const double x6r = ri[6 * is], x6i = ii[6 * is];
+    const double t0 = x1r + x6r;
+    const double t1 = x1i + x6i;
+    const double t2 = x1r - x6r;
+    const double t3 = x1i - x6i;
+    const double t4 = x2r + x5r;
+    const double t5 = x2i + x5i;
+    const double t6 = x2r - x5r;
+    const double t7 = x2i - x5i;
+    const double t8 = x3r + x4r;
+    const double t9 = x3i + x4i;
+    const double t10 = x3r - x4r;
+    const double t11 = x3i - x4i;
+    const double t12 = x0r + t0;
+    const double t13 = x0i + t1;
+    const double t14 = t4 + t12;
+    const double t15 = t5 + t13;
+    const double t16 = t8 + t14;
+    const double t17 = t9 + t15;
+    const double t18 = 0.62348980185873348 * t0;
+    const double t19 = 0.62348980185873348 * t1;
+    const double t20 = 0.7818314824680298 * t2;
+    const double t21 = 0.7818314824680298 * t3;
+    const double t22 = x0r + t18;
+    const double t23 = x0i + t19;
+    const double t24 = 0.22252093395631439 * t4;
+    const double t25 = 0.22252093395631439 * t5;
+    const double t26 = 0.97492791218182362 * t6;
+    const double t27 = 0.97492791218182362 * t7;
+    const double t28 = t22 - t24;
+    const double t29 = t23 - t25;
+    const double t30 = t20 + t26;
+    const double t31 = t21 + t27;
+    const double t32 = 0.90096886790241915 * t8;
+    const double t33 = 0.90096886790241915 * t9;
+    const double t34 = 0.43388373911755812 * t10;
+    const double t35 = 0.43388373911755812 * t11;
+    const double t36 = t28 - t32;
+    const double t37 = t29 - t33;
+    const double t38 = t30 + t34;
+    const double t39 = t31 + t35;
+    const double t40 = t36 + t39;
+    const double t41 = t37 - t38;
+    const double t42 = t36 - t39;
+    const double t43 = t37 + t38;
+    const double t44 = 0.22252093395631439 * t0;
+    const double t45 = 0.22252093395631439 * t1;
+    const double t46 = 0.97492791218182362 * t2;
+    const double t47 = 0.97492791218182362 * t3;
+    const double t48 = x0r - t44;
+    const double t49 = x0i - t45;
+    const double t50 = 0.90096886790241915 * t4;
+    const double t51 = 0.90096886790241915 * t5;
+    const double t52 = 0.43388373911755812 * t6;
+    const double t53 = 0.43388373911755812 * t7;
+    const double t54 = t48 - t50;
+    const double t55 = t49 - t51;
+    const double t56 = t46 - t52;
+    const double t57 = t47 - t53;
+    const double t58 = 0.62348980185873348 * t8;
+    const double t59 = 0.62348980185873348 * t9;
+    const double t60 = 0.7818314824680298 * t10;
+    const double t61 = 0.7818314824680298 * t11;
+    const double t62 = t54 + t58;
+    const double t63 = t55 + t59;
+    const double t64 = t57 - t61;
+    const double t65 = t60 - t56;
+    const double t66 = t62 + t64;
+    const double t67 = t63 + t65;
+    const double t68 = t62 - t64;
+    const double t69 = t63 - t65;
+    const double t70 = 0.90096886790241915 * t0;
+    const double t71 = 0.90096886790241915 * t1;
+    const double t72 = 0.43388373911755812 * t2;
+    const double t73 = 0.43388373911755812 * t3;
+    const double t74 = x0r - t70;
+    const double t75 = x0i - t71;
+    const double t76 = 0.62348980185873348 * t4;
+    const double t77 = 0.62348980185873348 * t5;
+    const double t78 = 0.7818314824680298 * t6;
+    const double t79 = 0.7818314824680298 * t7;
+    const double t80 = t74 + t76;
+    const double t81 = t75 + t77;
+    const double t82 = t72 - t78;
+    const double t83 = t73 - t79;
+    const double t84 = 0.22252093395631439 * t8;
+    const double t85 = 0.22252093395631439 * t9;
+    const double t86 = 0.97492791218182362 * t10;
+    const double t87 = 0.97492791218182362 * t11;
+    const double t88 = t80 - t84;
+    const double t89 = t81 - t85;
+    const double t90 = t82 + t86;
+    const double t91 = t83 + t87;
+    const double t92 = t88 + t91;
+    const double t93 = t89 - t90;
+    const double t94 = t88 - t91;
+    const double t95 = t89 + t90;
+    ro[0] = t16;
+    io[0] = t17;
+    ro[os] = t40;
+    io[os] = t41;
+    ro[2 * os] = t66;
+    io[2 * os] = t67;
+    ro[3 * os] = t92;
+    io[3 * os] = t93;
+    ro[4 * os] = t94;
+    io[4 * os] = t95;
+    ro[5 * os] = t68;
+    io[5 * os] = t69;
+    ro[6 * os] = t42;
+    io[6 * os] = t43;
+}
+
+// 8 points: 52 additions, 4 multiplications
+void fft_codelet_8(const double *ri, const double *ii, double *ro, double *io, long is, long os) {
+    const double x0r = ri[0], x0i = ii[0];
+    const double x1r = ri[is], x1i = ii[is];
+    const double x2r = ri[2 * is], x2i = ii[2 * is];
+    const double x3r = ri[3 * is], x3i = ii[3 * is];
+    const double x4r = ri[4 * is], x4i = ii[4 * is];
+    const double x5r = ri[5 * is], x5i = ii[5 * is];
+    const double x6r = ri[6 * is], x6i = ii[6 * is];
+    const double x7r = ri[7 * is], x7i = ii[7 * is];
+    const double t0 = x0r + x4r;
+    const double t1 = x0i + x4i;
+    const double t2 = x0r - x4r;
+    const double t3 = x0i - x4i;
+    const double t4 = x2r + x6r;
+    const double t5 = x2i + x6i;
+    const double t6 = x2i - x6i;
+    const double t7 = x6r - x2r;
+    const double t8 = t0 + t4;
+    const double t9 = t1 + t5;
+    const double t10 = t0 - t4;
+    const double t11 = t1 - t5;
+    const double t12 = t2 + t6;
+    const double t13 = t3 + t7;
+    const double t14 = t2 - t6;
+    const double t15 = t3 - t7;
+    const double t16 = x1r + x5r;
+    const double t17 = x1i + x5i;
+    const double t18 = x1r - x5r;
+    const double t19 = x1i - x5i;
+    const double t20 = x3r + x7r;
+    const double t21 = x3i + x7i;
+    const double t22 = x3r - x7r;
+    const double t23 = x3i - x7i;
+    const double t24 = t16 + t20;
+    const double t25 = t17 + t21;
+    const double t26 = t17 - t21;
+    const double t27 = t20 - t16;
+    const double t28 = t8 + t24;
+    const double t29 = t9 + t25;
+    const double t30 = t8 - t24;
+    const double t31 = t9 - t25;
+    const double t32 = t10 + t26;
+    const double t33 = t11 + t27;
+    const double t34 = t10 - t26;
+    const double t35 = t11 - t27;
+    const double t36 = t18 + t19;
+    const double t37 = 0.70710678118654757 * t36;
+    const double t38 = t19 - t18;
+    const double t39 = 0.70710678118654757 * t38;
+    const double t40 = t22 - t23;
+    const double t41 = 0.70710678118654757 * t40;
+    const double t42 = t22 + t23;
+    const double t43 = 0.70710678118654757 * t42;
+    const double t44 = t37 - t41;
+    const double t45 = t39 - t43;
+    const double t46 = t37 + t41;
+    const double t47 = t39 + t43;
+    const double t48 = t12 + t44;
+    const double t49 = t13 + t45;
+    const double t50 = t12 - t44;
+    const double t51 = t13 - t45;
+    const double t52 = t14 + t47;
+    const double t53 = t15 - t46;
+    const double t54 = t14 - t47;
+    const double t55 = t15 + t46;
+    ro[0] = t28;
+    io[0] = t29;
+    ro[os] = t48;
+    io[os] = t49;
+    ro[2 * os] = t32;
+    io[2 * os] = t33;
+    ro[3 * os] = t52;
+    io[3 * os] = t53;
+    ro[4 * os] = t30;
+    io[4 * os] = t31;
+    ro[5 * os] = t50;
+    io[5 * os] = t51;
+    ro[6 * os] = t34;
+    io[6 * os] = t35;
+    ro[7 * os] = t54;
+    io[7 * os] = t55;
+}
+
+// 16 points: 144 additions, 24 multiplications
+void fft_codelet_16(const double *ri, const double *ii, double *ro, double *io, long is, long os) {
+    const double x0r = ri[0], x0i = ii[0];
+    const double x1r = ri[is], x1i = ii[is];
+    const double x2r = ri[2 * is], x2i = ii[2 * is];
+    const double x3r = ri[3 * is], x3i = ii[3 * is];
+    const double x4r = ri[4 * is], x4i = ii[4 * is];
+    const double x5r = ri[5 * is], x5i = ii[5 * is];
+    const double x6r = ri[6 * is], x6i = ii[6 * is];
+    const double x7r = ri[7 * is], x7i = ii[7 * is];
+    const double x8r = ri[8 * is], x8i = ii[8 * is];
+    const double x9r = ri[9 * is], x9i = ii[9 * is];
+    const double x10r = ri[10 * is], x10i = ii[10 * is];
+    const double x11r = ri[11 * is], x11i = ii[11 * is];
+    const double x12r = ri[12 * is], x12i = ii[12 * is];
+    const double x13r = ri[13 * is], x13i = ii[13 * is];
+    const double x14r = ri[14 * is], x14i = ii[14 * is];
+    const double x15r = ri[15 * is], x15i = ii[15 * is];
+    const double t0 = x0r + x8r;
+    const double t1 = x0i + x8i;
+    const double t2 = x0r - x8r;
+    const double t3 = x0i - x8i;
+    const double t4 = x4r + x12r;
+    const double t5 = x4i + x12i;
+    const double t6 = x4i - x12i;
+    const double t7 = x12r - x4r;
+    const double t8 = t0 + t4;
+    const double t9 = t1 + t5;
+    const double t10 = t0 - t4;
+    const double t11 = t1 - t5;
+    const double t12 = t2 + t6;
+    const double t13 = t3 + t7;
+    const double t14 = t2 - t6;
+    const double t15 = t3 - t7;
+    const double t16 = x2r + x10r;
+    const double t17 = x2i + x10i;
+    const double t18 = x2r - x10r;
+    const double t19 = x2i - x10i;
+    const double t20 = x6r + x14r;
+    const double t21 = x6i + x14i;
+    const double t22 = x6r - x14r;
+    const double t23 = x6i - x14i;
+    const double t24 = t16 + t20;
+    const double t25 = t17 + t21;
+    const double t26 = t17 - t21;
+    const double t27 = t20 - t16;
+    const double t28 = t8 + t24;
+    const double t29 = t9 + t25;
+    const double t30 = t8 - t24;
+    const double t31 = t9 - t25;
+    const double t32 = t10 + t26;
+    const double t33 = t11 + t27;
+    const double t34 = t10 - t26;
+    const double t35 = t11 - t27;
+    const double t36 = t18 + t19;
+    const double t37 = 0.70710678118654757 * t36;
+    const double t38 = t19 - t18;
+    const double t39 = 0.70710678118654757 * t38;
+    const double t40 = t22 - t23;
+    const double t41 = 0.70710678118654757 * t40;
+    const double t42 = t22 + t23;
+    const double t43 = 0.70710678118654757 * t42;
+    const double t44 = t37 - t41;
+    const double t45 = t39 - t43;
+    const double t46 = t37 + t41;
+    const double t47 = t39 + t43;
+    const double t48 = t12 + t44;
+    const double t49 = t13 + t45;
+    const double t50 = t12 - t44;
+    const double t51 = t13 - t45;
+    const double t52 = t14 + t47;
+    const double t53 = t15 - t46;
+    const double t54 = t14 - t47;
+    const double t55 = t15 + t46;
+    const double t56 = x1r + x9r;
+    const double t57 = x1i + x9i;
+    const double t58 = x1r - x9r;
+    const double t59 = x1i - x9i;
+    const double t60 = x5r + x13r;
+    const double t61 = x5i + x13i;
+    const double t62 = x5i - x13i;
+    const double t63 = x13r - x5r;
+    const double t64 = t56 + t60;
+    const double t65 = t57 + t61;
+    const double t66 = t56 - t60;
+    const double t67 = t57 - t61;
+    const double t68 = t58 + t62;
+    const double t69 = t59 + t63;
+    const double t70 = t58 - t62;
+    const double t71 = t59 - t63;
+    const double t72 = x3r + x11r;
+    const double t73 = x3i + x11i;
+    const double t74 = x3r - x11r;
+    const double t75 = x3i - x11i;
+    const double t76 = x7r + x15r;
+    const double t77 = x7i + x15i;
+    const double t78 = x7i - x15i;
+    const double t79 = x15r - x7r;
+    const double t80 = t72 + t76;
+    const double t81 = t73 + t77;
+    const double t82 = t72 - t76;
+    const double t83 = t73 - t77;
+    const double t84 = t74 + t78;
+    const double t85 = t75 + t79;
+    const double t86 = t74 - t78;
+    const double t87 = t75 - t79;
+    const double t88 = t64 + t80;
+    const double t89 = t65 + t81;
+    const double t90 = t65 - t81;
+    const double t91 = t80 - t64;
+    const double t92 = t28 + t88;
+    const double t93 = t29 + t89;
+    const double t94 = t28 - t88;
+    const double t95 = t29 - t89;
+    const double t96 = t30 + t90;
+    const double t97 = t31 + t91;
+    const double t98 = t30 - t90;
+    const double t99 = t31 - t91;
+    const double t100 = 0.38268343236508978 * t69;
+    const double t101 = 0.92387953251128674 * t68;
+    const double t102 = t100 + t101;
+    const double t103 = 0.38268343236508978 * t68;
+    const double t104 = 0.92387953251128674 * t69;
+    const double t105 = t104 - t103;
+    const double t106 = 0.92387953251128674 * t85;
+    const double t107 = 0.38268343236508978 * t84;
+    const double t108 = t106 + t107;
+    const double t109 = 0.92387953251128674 * t84;
+    const double t110 = 0.38268343236508978 * t85;
+    const double t111 = t110 - t109;
+    const double t112 = t102 + t108;
+    const double t113 = t105 + t111;
+    const double t114 = t105 - t111;
+    const double t115 = t108 - t102;
+    const double t116 = t48 + t112;
+    const double t117 = t49 + t113;
+    const double t118 = t48 - t112;
+    const double t119 = t49 - t113;
+    const double t120 = t50 + t114;
+    const double t121 = t51 + t115;
+    const double t122 = t50 - t114;
+    const double t123 = t51 - t115;
+    const double t124 = t66 + t67;
+    const double t125 = 0.70710678118654757 * t124;
+    const double t126 = t67 - t66;
+    const double t127 = 0.70710678118654757 * t126;
+    const double t128 = t82 - t83;
+    const double t129 = 0.70710678118654757 * t128;
+    const double t130 = t82 + t83;
+    const double t131 = 0.70710678118654757 * t130;
+    const double t132 = t125 - t129;
+    const double t133 = t127 - t131;
+    const double t134 = t125 + t129;
+    const double t135 = t127 + t131;
+    const double t136 = t32 + t132;
+    const double t137 = t33 + t133;
+    const double t138 = t32 - t132;
+    const double t139 = t33 - t133;
+    const double t140 = t34 + t135;
+    const double t141 = t35 - t134;
+    const double t142 = t34 - t135;
+    const double t143 = t35 + t134;
+    const double t144 = 0.92387953251128674 * t71;
+    const double t145 = 0.38268343236508978 * t70;
+    const double t146 = t144 + t145;
+    const double t147 = 0.92387953251128674 * t70;
+    const double t148 = 0.38268343236508978 * t71;
+    const double t149 = t148 - t147;
+    const double t150 = 0.38268343236508978 * t87;
+    const double t151 = 0.92387953251128674 * t86;
+    const double t152 = t150 + t151;
+    const double t153 = 0.38268343236508978 * t86;
+    const double t154 = 0.92387953251128674 * t87;
+    const double t155 = t153 - t154;
+    const double t156 = t146 - t152;
+    const double t157 = t149 + t155;
+    const double t158 = t146 + t152;
+    const double t159 = t149 - t155;
+    const double t160 = t52 + t156;
+    const double t161 = t53 + t157;
+    const double t162 = t52 - t156;
+    const double t163 = t53 - t157;
+    const double t164 = t54 + t159;
+    const double t165 = t55 - t158;
+    const double t166 = t54 - t159;
+    const double t167 = t55 + t158;
+    ro[0] = t92;
+    io[0] = t93;
+    ro[os] = t116;
+    io[os] = t117;
+    ro[2 * os] = t136;
+    io[2 * os] = t137;
+    ro[3 * os] = t160;
+    io[3 * os] = t161;
+    ro[4 * os] = t96;
+    io[4 * os] = t97;
+    ro[5 * os] = t120;
+    io[5 * os] = t121;
+    ro[6 * os] = t140;
+    io[6 * os] = t141;
+    ro[7 * os] = t164;
+    io[7 * os] = t165;
+    ro[8 * os] = t94;
+    io[8 * os] = t95;
+    ro[9 * os] = t118;
+    io[9 * os] = t119;
+    ro[10 * os] = t138;
+    io[10 * os] = t139;
+    ro[11 * os] = t162;
+    io[11 * os] = t163;
+    ro[12 * os] = t98;
+    io[12 * os] = t99;
+    ro[13 * os] = t122;
+    io[13 * os] = t123;
+    ro[14 * os] = t142;
+    io[14 * os] = t143;
+    ro[15 * os] = t166;
+    io[15 * os] = t167;
+}
+
+// 32 points: 372 additions, 84 multiplications
+void fft_codelet_32(const double *ri, const double *ii, double *ro, double *io, long is, long os) {
+    const double x0r = ri[0], x0i = ii[0];
+    const double x1r = ri[is], x1i = ii[is];
+    const double x2r = ri[2 * is], x2i = ii[2 * is];
+    const double x3r = ri[3 * is], x3i = ii[3 * is];
+    const double x4r = ri[4 * is], x4i = ii[4 * is];
+    const double x5r = ri[5 * is], x5i = ii[5 * is];
+    const double x6r = ri[6 * is], x6i = ii[6 * is];
+    const double x7r = ri[7 * is], x7i = ii[7 * is];
+    const double x8r = ri[8 * is], x8i = ii[8 * is];
+    const double x9r = ri[9 * is], x9i = ii[9 * is];
+    const double x10r = ri[10 * is], x10i = ii[10 * is];
+    const double x11r = ri[11 * is], x11i = ii[11 * is];
+    const double x12r = ri[12 * is], x12i = ii[12 * is];
+    const double x13r = ri[13 * is], x13i = ii[13 * is];
+    const double x14r = ri[14 * is], x14i = ii[14 * is];
+    const double x15r = ri[15 * is], x15i = ii[15 * is];
+    const double x16r = ri[16 * is], x16i = ii[16 * is];
+    const double x17r = ri[17 * is], x17i = ii[17 * is];
+    const double x18r = ri[18 * is], x18i = ii[18 * is];
+    const double x19r = ri[19 * is], x19i = ii[19 * is];
+    const double x20r = ri[20 * is], x20i = ii[20 * is];
+    const double x21r = ri[21 * is], x21i = ii[21 * is];
+    const double x22r = ri[22 * is], x22i = ii[22 * is];
+    const double x23r = ri[23 * is], x23i = ii[23 * is];
+    const double x24r = ri[24 * is], x24i = ii[24 * is];
+    const double x25r = ri[25 * is], x25i = ii[25 * is];
+    const double x26r = ri[26 * is], x26i = ii[26 * is];
+    const double x27r = ri[27 * is], x27i = ii[27 * is];
+    const double x28r = ri[28 * is], x28i = ii[28 * is];
+    const double x29r = ri[29 * is], x29i = ii[29 * is];
+    const double x30r = ri[30 * is], x30i = ii[30 * is];
+    const double x31r = ri[31 * is], x31i = ii[31 * is];
+    const double t0 = x0r + x16r;
+    const double t1 = x0i + x16i;
+    const double t2 = x0r - x16r;
+    const double t3 = x0i - x16i;
+    const double t4 = x8r + x24r;
+    const double t5 = x8i + x24i;
+    const double t6 = x8i - x24i;
+    const double t7 = x24r - x8r;
+    const double t8 = t0 + t4;
+    const double t9 = t1 + t5;
+    const double t10 = t0 - t4;
+    const double t11 = t1 - t5;
+    const double t12 = t2 + t6;
+    const double t13 = t3 + t7;
+    const double t14 = t2 - t6;
+    const double t15 = t3 - t7;
+    const double t16 = x4r + x20r;
+    const double t17 = x4i + x20i;
+    const double t18 = x4r - x20r;
+    const double t19 = x4i - x20i;
+    const double t20 = x12r + x28r;
+    const double t21 = x12i + x28i;
+    const double t22 = x12r - x28r;
+    const double t23 = x12i - x28i;
+    const double t24 = t16 + t20;
+    const double t25 = t17 + t21;
+    const double t26 = t17 - t21;
+    const double t27 = t20 - t16;
+    const double t28 = t8 + t24;
+    const double t29 = t9 + t25;
+    const double t30 = t8 - t24;
+    const double t31 = t9 - t25;
+    const double t32 = t10 + t26;
+    const double t33 = t11 + t27;
+    const double t34 = t10 - t26;
+    const double t35 = t11 - t27;
+    const double t36 = t18 + t19;
+    const double t37 = 0.70710678118654757 * t36;
+    const double t38 = t19 - t18;
+    const double t39 = 0.70710678118654757 * t38;
+    const double t40 = t22 - t23;
+    const double t41 = 0.70710678118654757 * t40;
+    const double t42 = t22 + t23;
+    const double t43 = 0.70710678118654757 * t42;
+    const double t44 = t37 - t41;
+    const double t45 = t39 - t43;
+    const double t46 = t37 + t41;
+    const double t47 = t39 + t43;
+    const double t48 = t12 + t44;
+    const double t49 = t13 + t45;
+    const double t50 = t12 - t44;
+    const double t51 = t13 - t45;
+    const double t52 = t14 + t47;
+    const double t53 = t15 - t46;
+    const double t54 = t14 - t47;
+    const double t55 = t15 + t46;
+    const double t56 = x2r + x18r;
+    const double t57 = x2i + x18i;
+    const double t58 = x2r - x18r;
+    const double t59 = x2i - x18i;
+    const double t60 = x10r + x26r;
+    const double t61 = x10i + x26i;
+    const double t62 = x10i - x26i;
+    const double t63 = x26r - x10r;
+    const double t64 = t56 + t60;
+    const double t65 = t57 + t61;
+    const double t66 = t56 - t60;
+    const double t67 = t57 - t61;
+    const double t68 = t58 + t62;
+    const double t69 = t59 + t63;
+    const double t70 = t58 - t62;
+    const double t71 = t59 - t63;
+    const double t72 = x6r + x22r;
+    const double t73 = x6i + x22i;
+    const double t74 = x6r - x22r;
+    const double t75 = x6i - x22i;
+    const double t76 = x14r + x30r;
+    const double t77 = x14i + x30i;
+    const double t78 = x14i - x30i;
+    const double t79 = x30r - x14r;
+    const double t80 = t72 + t76;
+    const double t81 = t73 + t77;
+    const double t82 = t72 - t76;
+    const double t83 = t73 - t77;
+    const double t84 = t74 + t78;
+    const double t85 = t75 + t79;
+    const double t86 = t74 - t78;
+    const double t87 = t75 - t79;
+    const double t88 = t64 + t80;
+    const double t89 = t65 + t81;
+    const double t90 = t65 - t81;
+    const double t91 = t80 - t64;
+    const double t92 = t28 + t88;
+    const double t93 = t29 + t89;
+    const double t94 = t28 - t88;
+    const double t95 = t29 - t89;
+    const double t96 = t30 + t90;
+    const double t97 = t31 + t91;
+    const double t98 = t30 - t90;
+    const double t99 = t31 - t91;
+    const double t100 = 0.38268343236508978 * t69;
+    const double t101 = 0.92387953251128674 * t68;
+    const double t102 = t100 + t101;
+    const double t103 = 0.38268343236508978 * t68;
+    const double t104 = 0.92387953251128674 * t69;
+    const double t105 = t104 - t103;
+    const double t106 = 0.92387953251128674 * t85;
+    const double t107 = 0.38268343236508978 * t84;
+    const double t108 = t106 + t107;
+    const double t109 = 0.92387953251128674 * t84;
+    const double t110 = 0.38268343236508978 * t85;
+    const double t111 = t110 - t109;
+    const double t112 = t102 + t108;
+    const double t113 = t105 + t111;
+    const double t114 = t105 - t111;
+    const double t115 = t108 - t102;
+    const double t116 = t48 + t112;
+    const double t117 = t49 + t113;
+    const double t118 = t48 - t112;
+    const double t119 = t49 - t113;
+    const double t120 = t50 + t114;
+    const double t121 = t51 + t115;
+    const double t122 = t50 - t114;
+    const double t123 = t51 - t115;
+    const double t124 = t66 + t67;
+    const double t125 = 0.70710678118654757 * t124;
+    const double t126 = t67 - t66;
+    const double t127 = 0.70710678118654757 * t126;
+    const double t128 = t82 - t83;
+    const double t129 = 0.70710678118654757 * t128;
+    const double t130 = t82 + t83;
+    const double t131 = 0.70710678118654757 * t130;
+    const double t132 = t125 - t129;
+    const double t133 = t127 - t131;
+    const double t134 = t125 + t129;
+    const double t135 = t127 + t131;
+    const double t136 = t32 + t132;
+    const double t137 = t33 + t133;
+    const double t138 = t32 - t132;
+    const double t139 = t33 - t133;
+    const double t140 = t34 + t135;
+    const double t141 = t35 - t134;
+    const double t142 = t34 - t135;
+    const double t143 = t35 + t134;
+    const double t144 = 0.92387953251128674 * t71;
+    const double t145 = 0.38268343236508978 * t70;
+    const double t146 = t144 + t145;
+    const double t147 = 0.92387953251128674 * t70;
+    const double t148 = 0.38268343236508978 * t71;
+    const double t149 = t148 - t147;
+    const double t150 = 0.38268343236508978 * t87;
+    const double t151 = 0.92387953251128674 * t86;
+    const double t152 = t150 + t151;
+    const double t153 = 0.38268343236508978 * t86;
+    const double t154 = 0.92387953251128674 * t87;
+    const double t155 = t153 - t154;
+    const double t156 = t146 - t152;
+    const double t157 = t149 + t155;
+    const double t158 = t146 + t152;
+    const double t159 = t149 - t155;
+    const double t160 = t52 + t156;
+    const double t161 = t53 + t157;
+    const double t162 = t52 - t156;
+    const double t163 = t53 - t157;
+    const double t164 = t54 + t159;
+    const double t165 = t55 - t158;
+    const double t166 = t54 - t159;
+    const double t167 = t55 + t158;
+    const double t168 = x1r + x17r;
+    const double t169 = x1i + x17i;
+    const double t170 = x1r - x17r;
+    const double t171 = x1i - x17i;
+    const double t172 = x9r + x25r;
+    const double t173 = x9i + x25i;
+    const double t174 = x9i - x25i;
+    const double t175 = x25r - x9r;
+    const double t176 = t168 + t172;
+    const double t177 = t169 + t173;
+    const double t178 = t168 - t172;
+    const double t179 = t169 - t173;
+    const double t180 = t170 + t174;
+    const double t181 = t171 + t175;
+    const double t182 = t170 - t174;
+    const double t183 = t171 - t175;
+    const double t184 = x5r + x21r;
+    const double t185 = x5i + x21i;
+    const double t186 = x5r - x21r;
+    const double t187 = x5i - x21i;
+    const double t188 = x13r + x29r;
+    const double t189 = x13i + x29i;
+    const double t190 = x13r - x29r;
+    const double t191 = x13i - x29i;
+    const double t192 = t184 + t188;
+    const double t193 = t185 + t189;
+    const double t194 = t185 - t189;
+    const double t195 = t188 - t184;
+    const double t196 = t176 + t192;
+    const double t197 = t177 + t193;
+    const double t198 = t176 - t192;
+    const double t199 = t177 - t193;
+    const double t200 = t178 + t194;
+    const double t201 = t179 + t195;
+    const double t202 = t178 - t194;
+    const double t203 = t179 - t195;
+    const double t204 = t186 + t187;
+    const double t205 = 0.70710678118654757 * t204;
+    const double t206 = t187 - t186;
+    const double t207 = 0.70710678118654757 * t206;
+    const double t208 = t190 - t191;
+    const double t209 = 0.70710678118654757 * t208;
+    const double t210 = t190 + t191;
+    const double t211 = 0.70710678118654757 * t210;
+    const double t212 = t205 - t209;
+    const double t213 = t207 - t211;
+    const double t214 = t205 + t209;
+    const double t215 = t207 + t211;
+    const double t216 = t180 + t212;
+    const double t217 = t181 + t213;
+    const double t218 = t180 - t212;
+    const double t219 = t181 - t213;
+    const double t220 = t182 + t215;
+    const double t221 = t183 - t214;
+    const double t222 = t182 - t215;
+    const double t223 = t183 + t214;
+    const double t224 = x3r + x19r;
+    const double t225 = x3i + x19i;
+    const double t226 = x3r - x19r;
+    const double t227 = x3i - x19i;
+    const double t228 = x11r + x27r;
+    const double t229 = x11i + x27i;
+    const double t230 = x11i - x27i;
+    const double t231 = x27r - x11r;
+    const double t232 = t224 + t228;
+    const double t233 = t225 + t229;
+    const double t234 = t224 - t228;
+    const double t235 = t225 - t229;
+    const double t236 = t226 + t230;
+    const double t237 = t227 + t231;
+    const double t238 = t226 - t230;
+    const double t239 = t227 - t231;
+    const double t240 = x7r + x23r;
+    const double t241 = x7i + x23i;
+    const double t242 = x7r - x23r;
+    const double t243 = x7i - x23i;
+    const double t244 = x15r + x31r;
+    const double t245 = x15i + x31i;
+    const double t246 = x15r - x31r;
+    const double t247 = x15i - x31i;
+    const double t248 = t240 + t244;
+    const double t249 = t241 + t245;
+    const double t250 = t241 - t245;
+    const double t251 = t244 - t240;
+    const double t252 = t232 + t248;
+    const double t253 = t233 + t249;
+    const double t254 = t232 - t248;
+    const double t255 = t233 - t249;
+    const double t256 = t234 + t250;
+    const double t257 = t235 + t251;
+    const double t258 = t234 - t250;
+    const double t259 = t235 - t251;
+    const double t260 = t242 + t243;
+    const double t261 = 0.70710678118654757 * t260;
+    const double t262 = t243 - t242;
+    const double t263 = 0.70710678118654757 * t262;
+    const double t264 = t246 - t247;
+    const double t265 = 0.70710678118654757 * t264;
+    const double t266 = t246 + t247;
+    const double t267 = 0.70710678118654757 * t266;
+    const double t268 = t261 - t265;
+    const double t269 = t263 - t267;
+    const double t270 = t261 + t265;
+    const double t271 = t263 + t267;
+    const double t272 = t236 + t268;
+    const double t273 = t237 + t269;
+    const double t274 = t236 - t268;
+    const double t275 = t237 - t269;
+    const double t276 = t238 + t271;
+    const double t277 = t239 - t270;
+    const double t278 = t238 - t271;
+    const double t279 = t239 + t270;
+    const double t280 = t196 + t252;
+    const double t281 = t197 + t253;
+    const double t282 = t197 - t253;
+    const double t283 = t252 - t196;
+    const double t284 = t92 + t280;
+    const double t285 = t93 + t281;
+    const double t286 = t92 - t280;
+    const double t287 = t93 - t281;
+    const double t288 = t94 + t282;
+    const double t289 = t95 + t283;
+    const double t290 = t94 - t282;
+    const double t291 = t95 - t283;
+    const double t292 = 0.19509032201612828 * t217;
+    const double t293 = 0.98078528040323043 * t216;
+    const double t294 = t292 + t293;
+    const double t295 = 0.19509032201612828 * t216;
+    const double t296 = 0.98078528040323043 * t217;
+    const double t297 = t296 - t295;
+    const double t298 = 0.55557023301960218 * t273;
+    const double t299 = 0.83146961230254524 * t272;
+    const double t300 = t298 + t299;
+    const double t301 = 0.55557023301960218 * t272;
+    const double t302 = 0.83146961230254524 * t273;
+    const double t303 = t302 - t301;
+    const double t304 = t294 + t300;
+    const double t305 = t297 + t303;
+    const double t306 = t297 - t303;
+    const double t307 = t300 - t294;
+    const double t308 = t116 + t304;
+    const double t309 = t117 + t305;
+    const double t310 = t116 - t304;
+    const double t311 = t117 - t305;
+    const double t312 = t118 + t306;
+    const double t313 = t119 + t307;
+    const double t314 = t118 - t306;
+    const double t315 = t119 - t307;
+    const double t316 = 0.38268343236508978 * t201;
+    const double t317 = 0.92387953251128674 * t200;
+    const double t318 = t316 + t317;
+    const double t319 = 0.38268343236508978 * t200;
+    const double t320 = 0.92387953251128674 * t201;
+    const double t321 = t320 - t319;
+    const double t322 = 0.92387953251128674 * t257;
+    const double t323 = 0.38268343236508978 * t256;
+    const double t324 = t322 + t323;
+    const double t325 = 0.92387953251128674 * t256;
+    const double t326 = 0.38268343236508978 * t257;
+    const double t327 = t326 - t325;
+    const double t328 = t318 + t324;
+    const double t329 = t321 + t327;
+    const double t330 = t321 - t327;
+    const double t331 = t324 - t318;
+    const double t332 = t136 + t328;
+    const double t333 = t137 + t329;
+    const double t334 = t136 - t328;
+    const double t335 = t137 - t329;
+    const double t336 = t138 + t330;
+    const double t337 = t139 + t331;
+    const double t338 = t138 - t330;
+    const double t339 = t139 - t331;
+    const double t340 = 0.55557023301960218 * t221;
+    const double t341 = 0.83146961230254524 * t220;
+    const double t342 = t340 + t341;
+    const double t343 = 0.55557023301960218 * t220;
+    const double t344 = 0.83146961230254524 * t221;
+    const double t345 = t344 - t343;
+    const double t346 = 0.98078528040323043 * t277;
+    const double t347 = 0.19509032201612828 * t276;
+    const double t348 = t346 - t347;
+    const double t349 = 0.98078528040323043 * t276;
+    const double t350 = 0.19509032201612828 * t277;
+    const double t351 = t349 + t350;
+    const double t352 = t342 + t348;
+    const double t353 = t345 - t351;
+    const double t354 = t345 + t351;
+    const double t355 = t348 - t342;
+    const double t356 = t160 + t352;
+    const double t357 = t161 + t353;
+    const double t358 = t160 - t352;
+    const double t359 = t161 - t353;
+    const double t360 = t162 + t354;
+    const double t361 = t163 + t355;
+    const double t362 = t162 - t354;
+    const double t363 = t163 - t355;
+    const double t364 = t198 + t199;
+    const double t365 = 0.70710678118654757 * t364;
+    const double t366 = t199 - t198;
+    const double t367 = 0.70710678118654757 * t366;
+    const double t368 = t254 - t255;
+    const double t369 = 0.70710678118654757 * t368;
+    const double t370 = t254 + t255;
+    const double t371 = 0.70710678118654757 * t370;
+    const double t372 = t365 - t369;
+    const double t373 = t367 - t371;
+    const double t374 = t365 + t369;
+    const double t375 = t367 + t371;
+    const double t376 = t96 + t372;
+    const double t377 = t97 + t373;
+    const double t378 = t96 - t372;
+    const double t379 = t97 - t373;
+    const double t380 = t98 + t375;
+    const double t381 = t99 - t374;
+    const double t382 = t98 - t375;
+    const double t383 = t99 + t374;
+    const double t384 = 0.83146961230254524 * t219;
+    const double t385 = 0.55557023301960218 * t218;
+    const double t386 = t384 + t385;
+    const double t387 = 0.83146961230254524 * t218;
+    const double t388 = 0.55557023301960218 * t219;
+    const double t389 = t388 - t387;
+    const double t390 = 0.19509032201612828 * t275;
+    const double t391 = 0.98078528040323043 * t274;
+    const double t392 = t390 - t391;
+    const double t393 = 0.19509032201612828 * t274;
+    const double t394 = 0.98078528040323043 * t275;
+    const double t395 = t393 + t394;
+    const double t396 = t386 + t392;
+    const double t397 = t389 - t395;
+    const double t398 = t389 + t395;
+    const double t399 = t392 - t386;
+    const double t400 = t120 + t396;
+    const double t401 = t121 + t397;
+    const double t402 = t120 - t396;
+    const double t403 = t121 - t397;
+    const double t404 = t122 + t398;
+    const double t405 = t123 + t399;
+    const double t406 = t122 - t398;
+    const double t407 = t123 - t399;
+    const double t408 = 0.92387953251128674 * t203;
+    const double t409 = 0.38268343236508978 * t202;
+    const double t410 = t408 + t409;
+    const double t411 = 0.92387953251128674 * t202;
+    const double t412 = 0.38268343236508978 * t203;
+    const double t413 = t412 - t411;
+    const double t414 = 0.38268343236508978 * t259;
+    const double t415 = 0.92387953251128674 * t258;
+    const double t416 = t414 + t415;
+    const double t417 = 0.38268343236508978 * t258;
+    const double t418 = 0.92387953251128674 * t259;
+    const double t419 = t417 - t418;
+    const double t420 = t410 - t416;
+    const double t421 = t413 + t419;
+    const double t422 = t410 + t416;
+    const double t423 = t413 - t419;
+    const double t424 = t140 + t420;
+    const double t425 = t141 + t421;
+    const double t426 = t140 - t420;
+    const double t427 = t141 - t421;
+    const double t428 = t142 + t423;
+    const double t429 = t143 - t422;
+    const double t430 = t142 - t423;
+    const double t431 = t143 + t422;
+    const double t432 = 0.98078528040323043 * t223;
+    const double t433 = 0.19509032201612828 * t222;
+    const double t434 = t432 + t433;
+    const double t435 = 0.98078528040323043 * t222;
+    const double t436 = 0.19509032201612828 * t223;
+    const double t437 = t436 - t435;
+    const double t438 = 0.83146961230254524 * t279;
+    const double t439 = 0.55557023301960218 * t278;
+    const double t440 = t438 + t439;
+    const double t441 = 0.83146961230254524 * t278;
+    const double t442 = 0.55557023301960218 * t279;
+    const double t443 = t441 - t442;
+    const double t444 = t434 - t440;
+    const double t445 = t437 + t443;
+    const double t446 = t434 + t440;
+    const double t447 = t437 - t443;
+    const double t448 = t164 + t444;
+    const double t449 = t165 + t445;
+    const double t450 = t164 - t444;
+    const double t451 = t165 - t445;
+    const double t452 = t166 + t447;
+    const double t453 = t167 - t446;
+    const double t454 = t166 - t447;
+    const double t455 = t167 + t446;
+    ro[0] = t284;
+    io[0] = t285;
+    ro[os] = t308;
+    io[os] = t309;
+    ro[2 * os] = t332;
+    io[2 * os] = t333;
+    ro[3 * os] = t356;
+    io[3 * os] = t357;
+    ro[4 * os] = t376;
+    io[4 * os] = t377;
+    ro[5 * os] = t400;
+    io[5 * os] = t401;
+    ro[6 * os] = t424;
+    io[6 * os] = t425;
+    ro[7 * os] = t448;
+    io[7 * os] = t449;
+    ro[8 * os] = t288;
+    io[8 * os] = t289;
+    ro[9 * os] = t312;
+    io[9 * os] = t313;
+    ro[10 * os] = t336;
+    io[10 * os] = t337;
+    ro[11 * os] = t360;
+    io[11 * os] = t361;
+    ro[12 * os] = t380;
+    io[12 * os] = t381;
+    ro[13 * os] = t404;
+    io[13 * os] = t405;
+    ro[14 * os] = t428;
+    io[14 * os] = t429;
+    ro[15 * os] = t452;
+    io[15 * os] = t453;
+    ro[16 * os] = t286;
+    io[16 * os] = t287;
+    ro[17 * os] = t310;
+    io[17 * os] = t311;
+    ro[18 * os] = t334;
+    io[18 * os] = t335;
+    ro[19 * os] = t358;
+    io[19 * os] = t359;
+    ro[20 * os] = t378;
+    io[20 * os] = t379;
+    ro[21 * os] = t402;
+    io[21 * os] = t403;
+    ro[22 * os] = t426;
+    io[22 * os] = t427;
+    ro[23 * os] = t450;
+    io[23 * os] = t451;
+    ro[24 * os] = t290;
+    io[24 * os] = t291;
+    ro[25 * os] = t314;
+    io[25 * os] = t315;
+    ro[26 * os] = t338;
+    io[26 * os] = t339;
+    ro[27 * os] = t362;
+    io[27 * os] = t363;
+    ro[28 * os] = t382;
+    io[28 * os] = t383;
+    ro[29 * os] = t406;
+    io[29 * os] = t407;
+    ro[30 * os] = t430;
+    io[30 * os] = t431;
+    ro[31 * os] = t454;
+    io[31 * os] = t455;
+}
+
+// 64 points: 912 additions, 248 multiplications
+void fft_codelet_64(const double *ri, const double *ii, double *ro, double *io, long is, long os) {
+    const double x0r = ri[0], x0i = ii[0];
+    const double x1r = ri[is], x1i = ii[is];
+    const double x2r = ri[2 * is], x2i = ii[2 * is];
+    const double x3r = ri[3 * is], x3i = ii[3 * is];
+    const double x4r = ri[4 * is], x4i = ii[4 * is];
+    const double x5r = ri[5 * is], x5i = ii[5 * is];
+    const double x6r = ri[6 * is], x6i = ii[6 * is];
+    const double x7r = ri[7 * is], x7i = ii[7 * is];
+    const double x8r = ri[8 * is], x8i = ii[8 * is];
+    const double x9r = ri[9 * is], x9i = ii[9 * is];
+    const double x10r = ri[10 * is], x10i = ii[10 * is];
+    const double x11r = ri[11 * is], x11i = ii[11 * is];
+    const double x12r = ri[12 * is], x12i = ii[12 * is];
+    const double x13r = ri[13 * is], x13i = ii[13 * is];
+    const double x14r = ri[14 * is], x14i = ii[14 * is];
+    const double x15r = ri[15 * is], x15i = ii[15 * is];
+    const double x16r = ri[16 * is], x16i = ii[16 * is];
+    const double x17r = ri[17 * is], x17i = ii[17 * is];
+    const double x18r = ri[18 * is], x18i = ii[18 * is];
+    const double x19r = ri[19 * is], x19i = ii[19 * is];
+    const double x20r = ri[20 * is], x20i = ii[20 * is];
+    const double x21r = ri[21 * is], x21i = ii[21 * is];
+    const double x22r = ri[22 * is], x22i = ii[22 * is];
+    const double x23r = ri[23 * is], x23i = ii[23 * is];
+    const double x24r = ri[24 * is], x24i = ii[24 * is];
+    const double x25r = ri[25 * is], x25i = ii[25 * is];
+    const double x26r = ri[26 * is], x26i = ii[26 * is];
+    const double x27r = ri[27 * is], x27i = ii[27 * is];
+    const double x28r = ri[28 * is], x28i = ii[28 * is];
+    const double x29r = ri[29 * is], x29i = ii[29 * is];
+    const double x30r = ri[30 * is], x30i = ii[30 * is];
+    const double x31r = ri[31 * is], x31i = ii[31 * is];
+    const double x32r = ri[32 * is], x32i = ii[32 * is];
+    const double x33r = ri[33 * is], x33i = ii[33 * is];
+    const double x34r = ri[34 * is], x34i = ii[34 * is];
+    const double x35r = ri[35 * is], x35i = ii[35 * is];
+    const double x36r = ri[36 * is], x36i = ii[36 * is];
+    const double x37r = ri[37 * is], x37i = ii[37 * is];
+    const double x38r = ri[38 * is], x38i = ii[38 * is];
+    const double x39r = ri[39 * is], x39i = ii[39 * is];
+    const double x40r = ri[40 * is], x40i = ii[40 * is];
+    const double x41r = ri[41 * is], x41i = ii[41 * is];
+    const double x42r = ri[42 * is], x42i = ii[42 * is];
+    const double x43r = ri[43 * is], x43i = ii[43 * is];
+    const double x44r = ri[44 * is], x44i = ii[44 * is];
+    const double x45r = ri[45 * is], x45i = ii[45 * is];
+    const double x46r = ri[46 * is], x46i = ii[46 * is];
+    const double x47r = ri[47 * is], x47i = ii[47 * is];
+    const double x48r = ri[48 * is], x48i = ii[48 * is];
+    const double x49r = ri[49 * is], x49i = ii[49 * is];
+    const double x50r = ri[50 * is], x50i = ii[50 * is];
+    const double x51r = ri[51 * is], x51i = ii[51 * is];
+    const double x52r = ri[52 * is], x52i = ii[52 * is];
+    const double x53r = ri[53 * is], x53i = ii[53 * is];
+    const double x54r = ri[54 * is], x54i = ii[54 * is];
+    const double x55r = ri[55 * is], x55i = ii[55 * is];
+    const double x56r = ri[56 * is], x56i = ii[56 * is];
+    const double x57r = ri[57 * is], x57i = ii[57 * is];
+    const double x58r = ri[58 * is], x58i = ii[58 * is];
+    const double x59r = ri[59 * is], x59i = ii[59 * is];
+    const double x60r = ri[60 * is], x60i = ii[60 * is];
+    const double x61r = ri[61 * is], x61i = ii[61 * is];
+    const double x62r = ri[62 * is], x62i = ii[62 * is];
+    const double x63r = ri[63 * is], x63i = ii[63 * is];
+    const double t0 = x0r + x32r;
+    const double t1 = x0i + x32i;
+    const double t2 = x0r - x32r;
+    const double t3 = x0i - x32i;
+    const double t4 = x16r + x48r;
+    const double t5 = x16i + x48i;
+    const double t6 = x16i - x48i;
+    const double t7 = x48r - x16r;
+    const double t8 = t0 + t4;
+    const double t9 = t1 + t5;
+    const double t10 = t0 - t4;
+    const double t11 = t1 - t5;
+    const double t12 = t2 + t6;
+    const double t13 = t3 + t7;
+    const double t14 = t2 - t6;
+    const double t15 = t3 - t7;
+    const double t16 = x8r + x40r;
+    const double t17 = x8i + x40i;
+    const double t18 = x8r - x40r;
+    const double t19 = x8i - x40i;
+    const double t20 = x24r + x56r;
+    const double t21 = x24i + x56i;
+    const double t22 = x24r - x56r;
+    const double t23 = x24i - x56i;
+    const double t24 = t16 + t20;
+    const double t25 = t17 + t21;
+    const double t26 = t17 - t21;
+    const double t27 = t20 - t16;
+    const double t28 = t8 + t24;
+    const double t29 = t9 + t25;
+    const double t30 = t8 - t24;
+    const double t31 = t9 - t25;
+    const double t32 = t10 + t26;
+    const double t33 = t11 + t27;
+    const double t34 = t10 - t26;
+    const double t35 = t11 - t27;
+    const double t36 = t18 + t19;
+    const double t37 = 0.70710678118654757 * t36;
+    const double t38 = t19 - t18;
+    const double t39 = 0.70710678118654757 * t38;
+    const double t40 = t22 - t23;
+    const double t41 = 0.70710678118654757 * t40;
+    const double t42 = t22 + t23;
+    const double t43 = 0.70710678118654757 * t42;
+    const double t44 = t37 - t41;
+    const double t45 = t39 - t43;
+    const double t46 = t37 + t41;
+    const double t47 = t39 + t43;
+    const double t48 = t12 + t44;
+    const double t49 = t13 + t45;
+    const double t50 = t12 - t44;
+    const double t51 = t13 - t45;
+    const double t52 = t14 + t47;
+    const double t53 = t15 - t46;
+    const double t54 = t14 - t47;
+    const double t55 = t15 + t46;
+    const double t56 = x4r + x36r;
+    const double t57 = x4i + x36i;
+    const double t58 = x4r - x36r;
+    const double t59 = x4i - x36i;
+    const double t60 = x20r + x52r;
+    const double t61 = x20i + x52i;
+    const double t62 = x20i - x52i;
+    const double t63 = x52r - x20r;
+    const double t64 = t56 + t60;
+    const double t65 = t57 + t61;
+    const double t66 = t56 - t60;
+    const double t67 = t57 - t61;
+    const double t68 = t58 + t62;
+    const double t69 = t59 + t63;
+    const double t70 = t58 - t62;
+    const double t71 = t59 - t63;
+    const double t72 = x12r + x44r;
+    const double t73 = x12i + x44i;
+    const double t74 = x12r - x44r;
+    const double t75 = x12i - x44i;
+    const double t76 = x28r + x60r;
+    const double t77 = x28i + x60i;
+    const double t78 = x28i - x60i;
+    const double t79 = x60r - x28r;
+    const double t80 = t72 + t76;
+    const double t81 = t73 + t77;
+    const double t82 = t72 - t76;
+    const double t83 = t73 - t77;
+    const double t84 = t74 + t78;
+    const double t85 = t75 + t79;
+    const double t86 = t74 - t78;
+    const double t87 = t75 - t79;
+    const double t88 = t64 + t80;
+    const double t89 = t65 + t81;
+    const double t90 = t65 - t81;
+    const double t91 = t80 - t64;
+    const double t92 = t28 + t88;
+    const double t93 = t29 + t89;
+    const double t94 = t28 - t88;
+    const double t95 = t29 - t89;
+    const double t96 = t30 + t90;
+    const double t97 = t31 + t91;
+    const double t98 = t30 - t90;
+    const double t99 = t31 - t91;
+    const double t100 = 0.38268343236508978 * t69;
+    const double t101 = 0.92387953251128674 * t68;
+    const double t102 = t100 + t101;
+    const double t103 = 0.38268343236508978 * t68;
+    const double t104 = 0.92387953251128674 * t69;
+    const double t105 = t104 - t103;
+    const double t106 = 0.92387953251128674 * t85;
+    const double t107 = 0.38268343236508978 * t84;
+    const double t108 = t106 + t107;
+    const double t109 = 0.92387953251128674 * t84;
+    const double t110 = 0.38268343236508978 * t85;
+    const double t111 = t110 - t109;
+    const double t112 = t102 + t108;
+    const double t113 = t105 + t111;
+    const double t114 = t105 - t111;
+    const double t115 = t108 - t102;
+    const double t116 = t48 + t112;
+    const double t117 = t49 + t113;
+    const double t118 = t48 - t112;
+    const double t119 = t49 - t113;
+    const double t120 = t50 + t114;
+    const double t121 = t51 + t115;
+    const double t122 = t50 - t114;
+    const double t123 = t51 - t115;
+    const double t124 = t66 + t67;
+    const double t125 = 0.70710678118654757 * t124;
+    const double t126 = t67 - t66;
+    const double t127 = 0.70710678118654757 * t126;
+    const double t128 = t82 - t83;
+    const double t129 = 0.70710678118654757 * t128;
+    const double t130 = t82 + t83;
+    const double t131 = 0.70710678118654757 * t130;
+    const double t132 = t125 - t129;
+    const double t133 = t127 - t131;
+    const double t134 = t125 + t129;
+    const double t135 = t127 + t131;
+    const double t136 = t32 + t132;
+    const double t137 = t33 + t133;
+    const double t138 = t32 - t132;
+    const double t139 = t33 - t133;
+    const double t140 = t34 + t135;
+    const double t141 = t35 - t134;
+    const double t142 = t34 - t135;
+    const double t143 = t35 + t134;
+    const double t144 = 0.92387953251128674 * t71;
+    const double t145 = 0.38268343236508978 * t70;
+    const double t146 = t144 + t145;
+    const double t147 = 0.92387953251128674 * t70;
+    const double t148 = 0.38268343236508978 * t71;
+    const double t149 = t148 - t147;
+    const double t150 = 0.38268343236508978 * t87;
+    const double t151 = 0.92387953251128674 * t86;
+    const double t152 = t150 + t151;
+    const double t153 = 0.38268343236508978 * t86;
+    const double t154 = 0.92387953251128674 * t87;
+    const double t155 = t153 - t154;
+    const double t156 = t146 - t152;
+    const double t157 = t149 + t155;
+    const double t158 = t146 + t152;
+    const double t159 = t149 - t155;
+    const double t160 = t52 + t156;
+    const double t161 = t53 + t157;
+    const double t162 = t52 - t156;
+    const double t163 = t53 - t157;
+    const double t164 = t54 + t159;
+    const double t165 = t55 - t158;
+    const double t166 = t54 - t159;
+    const double t167 = t55 + t158;
+    const double t168 = x2r + x34r;
+    const double t169 = x2i + x34i;
+    const double t170 = x2r - x34r;
+    const double t171 = x2i - x34i;
+    const double t172 = x18r + x50r;
+    const double t173 = x18i + x50i;
+    const double t174 = x18i - x50i;
+    const double t175 = x50r - x18r;
+    const double t176 = t168 + t172;
+    const double t177 = t169 + t173;
+    const double t178 = t168 - t172;
+    const double t179 = t169 - t173;
+    const double t180 = t170 + t174;
+    const double t181 = t171 + t175;
+    const double t182 = t170 - t174;
+    const double t183 = t171 - t175;
+    const double t184 = x10r + x42r;
+    const double t185 = x10i + x42i;
+    const double t186 = x10r - x42r;
+    const double t187 = x10i - x42i;
+    const double t188 = x26r + x58r;
+    const double t189 = x26i + x58i;
+    const double t190 = x26r - x58r;
+    const double t191 = x26i - x58i;
+    const double t192 = t184 + t188;
+    const double t193 = t185 + t189;
+    const double t194 = t185 - t189;
+    const double t195 = t188 - t184;
+    const double t196 = t176 + t192;
+    const double t197 = t177 + t193;
+    const double t198 = t176 - t192;
+    const double t199 = t177 - t193;
+    const double t200 = t178 + t194;
+    const double t201 = t179 + t195;
+    const double t202 = t178 - t194;
+    const double t203 = t179 - t195;
+    const double t204 = t186 + t187;
+    const double t205 = 0.70710678118654757 * t204;
+    const double t206 = t187 - t186;
+    const double t207 = 0.70710678118654757 * t206;
+    const double t208 = t190 - t191;
+    const double t209 = 0.70710678118654757 * t208;
+    const double t210 = t190 + t191;
+    const double t211 = 0.70710678118654757 * t210;
+    const double t212 = t205 - t209;
+    const double t213 = t207 - t211;
+    const double t214 = t205 + t209;
+    const double t215 = t207 + t211;
+    const double t216 = t180 + t212;
+    const double t217 = t181 + t213;
+    const double t218 = t180 - t212;
+    const double t219 = t181 - t213;
+    const double t220 = t182 + t215;
+    const double t221 = t183 - t214;
+    const double t222 = t182 - t215;
+    const double t223 = t183 + t214;
+    const double t224 = x6r + x38r;
+    const double t225 = x6i + x38i;
+    const double t226 = x6r - x38r;
+    const double t227 = x6i - x38i;
+    const double t228 = x22r + x54r;
+    const double t229 = x22i + x54i;
+    const double t230 = x22i - x54i;
+    const double t231 = x54r - x22r;
+    const double t232 = t224 + t228;
+    const double t233 = t225 + t229;
+    const double t234 = t224 - t228;
+    const double t235 = t225 - t229;
+    const double t236 = t226 + t230;
+    const double t237 = t227 + t231;
+    const double t238 = t226 - t230;
+    const double t239 = t227 - t231;
+    const double t240 = x14r + x46r;
+    const double t241 = x14i + x46i;
+    const double t242 = x14r - x46r;
+    const double t243 = x14i - x46i;
+    const double t244 = x30r + x62r;
+    const double t245 = x30i + x62i;
+    const double t246 = x30r - x62r;
+    const double t247 = x30i - x62i;
+    const double t248 = t240 + t244;
+    const double t249 = t241 + t245;
+    const double t250 = t241 - t245;
+    const double t251 = t244 - t240;
+    const double t252 = t232 + t248;
+    const double t253 = t233 + t249;
+    const double t254 = t232 - t248;
+    const double t255 = t233 - t249;
+    const double t256 = t234 + t250;
+    const double t257 = t235 + t251;
+    const double t258 = t234 - t250;
+    const double t259 = t235 - t251;
+    const double t260 = t242 + t243;
+    const double t261 = 0.70710678118654757 * t260;
+    const double t262 = t243 - t242;
+    const double t263 = 0.70710678118654757 * t262;
+    const double t264 = t246 - t247;
+    const double t265 = 0.70710678118654757 * t264;
+    const double t266 = t246 + t247;
+    const double t267 = 0.70710678118654757 * t266;
+    const double t268 = t261 - t265;
+    const double t269 = t263 - t267;
+    const double t270 = t261 + t265;
+    const double t271 = t263 + t267;
+    const double t272 = t236 + t268;
+    const double t273 = t237 + t269;
+    const double t274 = t236 - t268;
+    const double t275 = t237 - t269;
+    const double t276 = t238 + t271;
+    const double t277 = t239 - t270;
+    const double t278 = t238 - t271;
+    const double t279 = t239 + t270;
+    const double t280 = t196 + t252;
+    const double t281 = t197 + t253;
+    const double t282 = t197 - t253;
+    const double t283 = t252 - t196;
+    const double t284 = t92 + t280;
+    const double t285 = t93 + t281;
+    const double t286 = t92 - t280;
+    const double t287 = t93 - t281;
+    const double t288 = t94 + t282;
+    const double t289 = t95 + t283;
+    const double t290 = t94 - t282;
+    const double t291 = t95 - t283;
+    const double t292 = 0.19509032201612828 * t217;
+    const double t293 = 0.98078528040323043 * t216;
+    const double t294 = t292 + t293;
+    const double t295 = 0.19509032201612828 * t216;
+    const double t296 = 0.98078528040323043 * t217;
+    const double t297 = t296 - t295;
+    const double t298 = 0.55557023301960218 * t273;
+    const double t299 = 0.83146961230254524 * t272;
+    const double t300 = t298 + t299;
+    const double t301 = 0.55557023301960218 * t272;
+    const double t302 = 0.83146961230254524 * t273;
+    const double t303 = t302 - t301;
+    const double t304 = t294 + t300;
+    const double t305 = t297 + t303;
+    const double t306 = t297 - t303;
+    const double t307 = t300 - t294;
+    const double t308 = t116 + t304;
+    const double t309 = t117 + t305;
+    const double t310 = t116 - t304;
+    const double t311 = t117 - t305;
+    const double t312 = t118 + t306;
+    const double t313 = t119 + t307;
+    const double t314 = t118 - t306;
+    const double t315 = t119 - t307;
+    const double t316 = 0.38268343236508978 * t201;
+    const double t317 = 0.92387953251128674 * t200;
+    const double t318 = t316 + t317;
+    const double t319 = 0.38268343236508978 * t200;
+    const double t320 = 0.92387953251128674 * t201;
+    const double t321 = t320 - t319;
+    const double t322 = 0.92387953251128674 * t257;
+    const double t323 = 0.38268343236508978 * t256;
+    const double t324 = t322 + t323;
+    const double t325 = 0.92387953251128674 * t256;
+    const double t326 = 0.38268343236508978 * t257;
+    const double t327 = t326 - t325;
+    const double t328 = t318 + t324;
+    const double t329 = t321 + t327;
+    const double t330 = t321 - t327;
+    const double t331 = t324 - t318;
+    const double t332 = t136 + t328;
+    const double t333 = t137 + t329;
+    const double t334 = t136 - t328;
+    const double t335 = t137 - t329;
+    const double t336 = t138 + t330;
+    const double t337 = t139 + t331;
+    const double t338 = t138 - t330;
+    const double t339 = t139 - t331;
+    const double t340 = 0.55557023301960218 * t221;
+    const double t341 = 0.83146961230254524 * t220;
+    const double t342 = t340 + t341;
+    const double t343 = 0.55557023301960218 * t220;
+    const double t344 = 0.83146961230254524 * t221;
+    const double t345 = t344 - t343;
+    const double t346 = 0.98078528040323043 * t277;
+    const double t347 = 0.19509032201612828 * t276;
+    const double t348 = t346 - t347;
+    const double t349 = 0.98078528040323043 * t276;
+    const double t350 = 0.19509032201612828 * t277;
+    const double t351 = t349 + t350;
+    const double t352 = t342 + t348;
+    const double t353 = t345 - t351;
+    const double t354 = t345 + t351;
+    const double t355 = t348 - t342;
+    const double t356 = t160 + t352;
+    const double t357 = t161 + t353;
+    const double t358 = t160 - t352;
+    const double t359 = t161 - t353;
+    const double t360 = t162 + t354;
+    const double t361 = t163 + t355;
+    const double t362 = t162 - t354;
+    const double t363 = t163 - t355;
+    const double t364 = t198 + t199;
+    const double t365 = 0.70710678118654757 * t364;
+    const double t366 = t199 - t198;
+    const double t367 = 0.70710678118654757 * t366;
+    const double t368 = t254 - t255;
+    const double t369 = 0.70710678118654757 * t368;
+    const double t370 = t254 + t255;
+    const double t371 = 0.70710678118654757 * t370;
+    const double t372 = t365 - t369;
+    const double t373 = t367 - t371;
+    const double t374 = t365 + t369;
+    const double t375 = t367 + t371;
+    const double t376 = t96 + t372;
+    const double t377 = t97 + t373;
+    const double t378 = t96 - t372;
+    const double t379 = t97 - t373;
+    const double t380 = t98 + t375;
+    const double t381 = t99 - t374;
+    const double t382 = t98 - t375;
+    const double t383 = t99 + t374;
+    const double t384 = 0.83146961230254524 * t219;
+    const double t385 = 0.55557023301960218 * t218;
+    const double t386 = t384 + t385;
+    const double t387 = 0.83146961230254524 * t218;
+    const double t388 = 0.55557023301960218 * t219;
+    const double t389 = t388 - t387;
+    const double t390 = 0.19509032201612828 * t275;
+    const double t391 = 0.98078528040323043 * t274;
+    const double t392 = t390 - t391;
+    const double t393 = 0.19509032201612828 * t274;
+    const double t394 = 0.98078528040323043 * t275;
+    const double t395 = t393 + t394;
+    const double t396 = t386 + t392;
+    const double t397 = t389 - t395;
+    const double t398 = t389 + t395;
+    const double t399 = t392 - t386;
+    const double t400 = t120 + t396;
+    const double t401 = t121 + t397;
+    const double t402 = t120 - t396;
+    const double t403 = t121 - t397;
+    const double t404 = t122 + t398;
+    const double t405 = t123 + t399;
+    const double t406 = t122 - t398;
+    const double t407 = t123 - t399;
+    const double t408 = 0.92387953251128674 * t203;
+    const double t409 = 0.38268343236508978 * t202;
+    const double t410 = t408 + t409;
+    const double t411 = 0.92387953251128674 * t202;
+    const double t412 = 0.38268343236508978 * t203;
+    const double t413 = t412 - t411;
+    const double t414 = 0.38268343236508978 * t259;
+    const double t415 = 0.92387953251128674 * t258;
+    const double t416 = t414 + t415;
+    const double t417 = 0.38268343236508978 * t258;
+    const double t418 = 0.92387953251128674 * t259;
+    const double t419 = t417 - t418;
+    const double t420 = t410 - t416;
+    const double t421 = t413 + t419;
+    const double t422 = t410 + t416;
+    const double t423 = t413 - t419;
+    const double t424 = t140 + t420;
+    const double t425 = t141 + t421;
+    const double t426 = t140 - t420;
+    const double t427 = t141 - t421;
+    const double t428 = t142 + t423;
+    const double t429 = t143 - t422;
+    const double t430 = t142 - t423;
+    const double t431 = t143 + t422;
+    const double t432 = 0.98078528040323043 * t223;
+    const double t433 = 0.19509032201612828 * t222;
+    const double t434 = t432 + t433;
+    const double t435 = 0.98078528040323043 * t222;
+    const double t436 = 0.19509032201612828 * t223;
+    const double t437 = t436 - t435;
+    const double t438 = 0.83146961230254524 * t279;
+    const double t439 = 0.55557023301960218 * t278;
+    const double t440 = t438 + t439;
+    const double t441 = 0.83146961230254524 * t278;
+    const double t442 = 0.55557023301960218 * t279;
+    const double t443 = t441 - t442;
+    const double t444 = t434 - t440;
+    const double t445 = t437 + t443;
+    const double t446 = t434 + t440;
+    const double t447 = t437 - t443;
+    const double t448 = t164 + t444;
+    const double t449 = t165 + t445;
+    const double t450 = t164 - t444;
+    const double t451 = t165 - t445;
+    const double t452 = t166 + t447;
+    const double t453 = t167 - t446;
+    const double t454 = t166 - t447;
+    const double t455 = t167 + t446;
+    const double t456 = x1r + x33r;
+    const double t457 = x1i + x33i;
+    const double t458 = x1r - x33r;
+    const double t459 = x1i - x33i;
+    const double t460 = x17r + x49r;
+    const double t461 = x17i + x49i;
+    const double t462 = x17i - x49i;
+    const double t463 = x49r - x17r;
+    const double t464 = t456 + t460;
+    const double t465 = t457 + t461;
+    const double t466 = t456 - t460;
+    const double t467 = t457 - t461;
+    const double t468 = t458 + t462;
+    const double t469 = t459 + t463;
+    const double t470 = t458 - t462;
+    const double t471 = t459 - t463;
+    const double t472 = x9r + x41r;
+    const double t473 = x9i + x41i;
+    const double t474 = x9r - x41r;
+    const double t475 = x9i - x41i;
+    const double t476 = x25r + x57r;
+    const double t477 = x25i + x57i;
+    const double t478 = x25r - x57r;
+    const double t479 = x25i - x57i;
+    const double t480 = t472 + t476;
+    const double t481 = t473 + t477;
+    const double t482 = t473 - t477;
+    const double t483 = t476 - t472;
+    const double t484 = t464 + t480;
+    const double t485 = t465 + t481;
+    const double t486 = t464 - t480;
+    const double t487 = t465 - t481;
+    const double t488 = t466 + t482;
+    const double t489 = t467 + t483;
+    const double t490 = t466 - t482;
+    const double t491 = t467 - t483;
+    const double t492 = t474 + t475;
+    const double t493 = 0.70710678118654757 * t492;
+    const double t494 = t475 - t474;
+    const double t495 = 0.70710678118654757 * t494;
+    const double t496 = t478 - t479;
+    const double t497 = 0.70710678118654757 * t496;
+    const double t498 = t478 + t479;
+    const double t499 = 0.70710678118654757 * t498;
+    const double t500 = t493 - t497;
+    const double t501 = t495 - t499;
+    const double t502 = t493 + t497;
+    const double t503 = t495 + t499;
+    const double t504 = t468 + t500;
+    const double t505 = t469 + t501;
+    const double t506 = t468 - t500;
+    const double t507 = t469 - t501;
+    const double t508 = t470 + t503;
+    const double t509 = t471 - t502;
+    const double t510 = t470 - t503;
+    const double t511 = t471 + t502;
+    const double t512 = x5r + x37r;
+    const double t513 = x5i + x37i;
+    const double t514 = x5r - x37r;
+    const double t515 = x5i - x37i;
+    const double t516 = x21r + x53r;
+    const double t517 = x21i + x53i;
+    const double t518 = x21i - x53i;
+    const double t519 = x53r - x21r;
+    const double t520 = t512 + t516;
+    const double t521 = t513 + t517;
+    const double t522 = t512 - t516;
+    const double t523 = t513 - t517;
+    const double t524 = t514 + t518;
+    const double t525 = t515 + t519;
+    const double t526 = t514 - t518;
+    const double t527 = t515 - t519;
+    const double t528 = x13r + x45r;
+    const double t529 = x13i + x45i;
+    const double t530 = x13r - x45r;
+    const double t531 = x13i - x45i;
+    const double t532 = x29r + x61r;
+    const double t533 = x29i + x61i;
+    const double t534 = x29i - x61i;
+    const double t535 = x61r - x29r;
+    const double t536 = t528 + t532;
+    const double t537 = t529 + t533;
+    const double t538 = t528 - t532;
+    const double t539 = t529 - t533;
+    const double t540 = t530 + t534;
+    const double t541 = t531 + t535;
+    const double t542 = t530 - t534;
+    const double t543 = t531 - t535;
+    const double t544 = t520 + t536;
+    const double t545 = t521 + t537;
+    const double t546 = t521 - t537;
+    const double t547 = t536 - t520;
+    const double t548 = t484 + t544;
+    const double t549 = t485 + t545;
+    const double t550 = t484 - t544;
+    const double t551 = t485 - t545;
+    const double t552 = t486 + t546;
+    const double t553 = t487 + t547;
+    const double t554 = t486 - t546;
+    const double t555 = t487 - t547;
+    const double t556 = 0.38268343236508978 * t525;
+    const double t557 = 0.92387953251128674 * t524;
+    const double t558 = t556 + t557;
+    const double t559 = 0.38268343236508978 * t524;
+    const double t560 = 0.92387953251128674 * t525;
+    const double t561 = t560 - t559;
+    const double t562 = 0.92387953251128674 * t541;
+    const double t563 = 0.38268343236508978 * t540;
+    const double t564 = t562 + t563;
+    const double t565 = 0.92387953251128674 * t540;
+    const double t566 = 0.38268343236508978 * t541;
+    const double t567 = t566 - t565;
+    const double t568 = t558 + t564;
+    const double t569 = t561 + t567;
+    const double t570 = t561 - t567;
+    const double t571 = t564 - t558;
+    const double t572 = t504 + t568;
+    const double t573 = t505 + t569;
+    const double t574 = t504 - t568;
+    const double t575 = t505 - t569;
+    const double t576 = t506 + t570;
+    const double t577 = t507 + t571;
+    const double t578 = t506 - t570;
+    const double t579 = t507 - t571;
+    const double t580 = t522 + t523;
+    const double t581 = 0.70710678118654757 * t580;
+    const double t582 = t523 - t522;
+    const double t583 = 0.70710678118654757 * t582;
+    const double t584 = t538 - t539;
+    const double t585 = 0.70710678118654757 * t584;
+    const double t586 = t538 + t539;
+    const double t587 = 0.70710678118654757 * t586;
+    const double t588 = t581 - t585;
+    const double t589 = t583 - t587;
+    const double t590 = t581 + t585;
+    const double t591 = t583 + t587;
+    const double t592 = t488 + t588;
+    const double t593 = t489 + t589;
+    const double t594 = t488 - t588;
+    const double t595 = t489 - t589;
+    const double t596 = t490 + t591;
+    const double t597 = t491 - t590;
+    const double t598 = t490 - t591;
+    const double t599 = t491 + t590;
+    const double t600 = 0.92387953251128674 * t527;
+    const double t601 = 0.38268343236508978 * t526;
+    const double t602 = t600 + t601;
+    const double t603 = 0.92387953251128674 * t526;
+    const double t604 = 0.38268343236508978 * t527;
+    const double t605 = t604 - t603;
+    const double t606 = 0.38268343236508978 * t543;
+    const double t607 = 0.92387953251128674 * t542;
+    const double t608 = t606 + t607;
+    const double t609 = 0.38268343236508978 * t542;
+    const double t610 = 0.92387953251128674 * t543;
+    const double t611 = t609 - t610;
+    const double t612 = t602 - t608;
+    const double t613 = t605 + t611;
+    const double t614 = t602 + t608;
+    const double t615 = t605 - t611;
+    const double t616 = t508 + t612;
+    const double t617 = t509 + t613;
+    const double t618 = t508 - t612;
+    const double t619 = t509 - t613;
+    const double t620 = t510 + t615;
+    const double t621 = t511 - t614;
+    const double t622 = t510 - t615;
+    const double t623 = t511 + t614;
+    const double t624 = x3r + x35r;
+    const double t625 = x3i + x35i;
+    const double t626 = x3r - x35r;
+    const double t627 = x3i - x35i;
+    const double t628 = x19r + x51r;
+    const double t629 = x19i + x51i;
+    const double t630 = x19i - x51i;
+    const double t631 = x51r - x19r;
+    const double t632 = t624 + t628;
+    const double t633 = t625 + t629;
+    const double t634 = t624 - t628;
+    const double t635 = t625 - t629;
+    const double t636 = t626 + t630;
+    const double t637 = t627 + t631;
+    const double t638 = t626 - t630;
+    const double t639 = t627 - t631;
+    const double t640 = x11r + x43r;
+    const double t641 = x11i + x43i;
+    const double t642 = x11r - x43r;
+    const double t643 = x11i - x43i;
+    const double t644 = x27r + x59r;
+    const double t645 = x27i + x59i;
+    const double t646 = x27r - x59r;
+    const double t647 = x27i - x59i;
+    const double t648 = t640 + t644;
+    const double t649 = t641 + t645;
+    const double t650 = t641 - t645;
+    const double t651 = t644 - t640;
+    const double t652 = t632 + t648;
+    const double t653 = t633 + t649;
+    const double t654 = t632 - t648;
+    const double t655 = t633 - t649;
+    const double t656 = t634 + t650;
+    const double t657 = t635 + t651;
+    const double t658 = t634 - t650;
+    const double t659 = t635 - t651;
+    const double t660 = t642 + t643;
+    const double t661 = 0.70710678118654757 * t660;
+    const double t662 = t643 - t642;
+    const double t663 = 0.70710678118654757 * t662;
+    const double t664 = t646 - t647;
+    const double t665 = 0.70710678118654757 * t664;
+    const double t666 = t646 + t647;
+    const double t667 = 0.70710678118654757 * t666;
+    const double t668 = t661 - t665;
+    const double t669 = t663 - t667;
+    const double t670 = t661 + t665;
+    const double t671 = t663 + t667;
+    const double t672 = t636 + t668;
+    const double t673 = t637 + t669;
+    const double t674 = t636 - t668;
+    const double t675 = t637 - t669;
+    const double t676 = t638 + t671;
+    const double t677 = t639 - t670;
+    const double t678 = t638 - t671;
+    const double t679 = t639 + t670;
+    const double t680 = x7r + x39r;
+    const double t681 = x7i + x39i;
+    const double t682 = x7r - x39r;
+    const double t683 = x7i - x39i;
+    const double t684 = x23r + x55r;
+    const double t685 = x23i + x55i;
+    const double t686 = x23i - x55i;
+    const double t687 = x55r - x23r;
+    const double t688 = t680 + t684;
+    const double t689 = t681 + t685;
+    const double t690 = t680 - t684;
+    const double t691 = t681 - t685;
+    const double t692 = t682 + t686;
+    const double t693 = t683 + t687;
+    const double t694 = t682 - t686;
+    const double t695 = t683 - t687;
+    const double t696 = x15r + x47r;
+    const double t697 = x15i + x47i;
+    const double t698 = x15r - x47r;
+    const double t699 = x15i - x47i;
+    const double t700 = x31r + x63r;
+    const double t701 = x31i + x63i;
+    const double t702 = x31i - x63i;
+    const double t703 = x63r - x31r;
+    const double t704 = t696 + t700;
+    const double t705 = t697 + t701;
+    const double t706 = t696 - t700;
+    const double t707 = t697 - t701;
+    const double t708 = t698 + t702;
+    const double t709 = t699 + t703;
+    const double t710 = t698 - t702;
+    const double t711 = t699 - t703;
+    const double t712 = t688 + t704;
+    const double t713 = t689 + t705;
+    const double t714 = t689 - t705;
+    const double t715 = t704 - t688;
+    const double t716 = t652 + t712;
+    const double t717 = t653 + t713;
+    const double t718 = t652 - t712;
+    const double t719 = t653 - t713;
+    const double t720 = t654 + t714;
+    const double t721 = t655 + t715;
+    const double t722 = t654 - t714;
+    const double t723 = t655 - t715;
+    const double t724 = 0.38268343236508978 * t693;
+    const double t725 = 0.92387953251128674 * t692;
+    const double t726 = t724 + t725;
+    const double t727 = 0.38268343236508978 * t692;
+    const double t728 = 0.92387953251128674 * t693;
+    const double t729 = t728 - t727;
+    const double t730 = 0.92387953251128674 * t709;
+    const double t731 = 0.38268343236508978 * t708;
+    const double t732 = t730 + t731;
+    const double t733 = 0.92387953251128674 * t708;
+    const double t734 = 0.38268343236508978 * t709;
+    const double t735 = t734 - t733;
+    const double t736 = t726 + t732;
+    const double t737 = t729 + t735;
+    const double t738 = t729 - t735;
+    const double t739 = t732 - t726;
+    const double t740 = t672 + t736;
+    const double t741 = t673 + t737;
+    const double t742 = t672 - t736;
+    const double t743 = t673 - t737;
+    const double t744 = t674 + t738;
+    const double t745 = t675 + t739;
+    const double t746 = t674 - t738;
+    const double t747 = t675 - t739;
+    const double t748 = t690 + t691;
+    const double t749 = 0.70710678118654757 * t748;
+    const double t750 = t691 - t690;
+    const double t751 = 0.70710678118654757 * t750;
+    const double t752 = t706 - t707;
+    const double t753 = 0.70710678118654757 * t752;
+    const double t754 = t706 + t707;
+    const double t755 = 0.70710678118654757 * t754;
+    const double t756 = t749 - t753;
+    const double t757 = t751 - t755;
+    const double t758 = t749 + t753;
+    const double t759 = t751 + t755;
+    const double t760 = t656 + t756;
+    const double t761 = t657 + t757;
+    const double t762 = t656 - t756;
+    const double t763 = t657 - t757;
+    const double t764 = t658 + t759;
+    const double t765 = t659 - t758;
+    const double t766 = t658 - t759;
+    const double t767 = t659 + t758;
+    const double t768 = 0.92387953251128674 * t695;
+    const double t769 = 0.38268343236508978 * t694;
+    const double t770 = t768 + t769;
+    const double t771 = 0.92387953251128674 * t694;
+    const double t772 = 0.38268343236508978 * t695;
+    const double t773 = t772 - t771;
+    const double t774 = 0.38268343236508978 * t711;
+    const double t775 = 0.92387953251128674 * t710;
+    const double t776 = t774 + t775;
+    const double t777 = 0.38268343236508978 * t710;
+    const double t778 = 0.92387953251128674 * t711;
+    const double t779 = t777 - t778;
+    const double t780 = t770 - t776;
+    const double t781 = t773 + t779;
+    const double t782 = t770 + t776;
+    const double t783 = t773 - t779;
+    const double t784 = t676 + t780;
+    const double t785 = t677 + t781;
+    const double t786 = t676 - t780;
+    const double t787 = t677 - t781;
+    const double t788 = t678 + t783;
+    const double t789 = t679 - t782;
+    const double t790 = t678 - t783;
+    const double t791 = t679 + t782;
+    const double t792 = t548 + t716;
+    const double t793 = t549 + t717;
+    const double t794 = t549 - t717;
+    const double t795 = t716 - t548;
+    const double t796 = t284 + t792;
+    const double t797 = t285 + t793;
+    const double t798 = t284 - t792;
+    const double t799 = t285 - t793;
+    const double t800 = t286 + t794;
+    const double t801 = t287 + t795;
+    const double t802 = t286 - t794;
+    const double t803 = t287 - t795;
+    const double t804 = 0.098017140329560604 * t573;
+    const double t805 = 0.99518472667219693 * t572;
+    const double t806 = t804 + t805;
+    const double t807 = 0.098017140329560604 * t572;
+    const double t808 = 0.99518472667219693 * t573;
+    const double t809 = t808 - t807;
+    const double t810 = 0.29028467725446239 * t741;
+    const double t811 = 0.95694033573220882 * t740;
+    const double t812 = t810 + t811;
+    const double t813 = 0.29028467725446239 * t740;
+    const double t814 = 0.95694033573220882 * t741;
+    const double t815 = t814 - t813;
+    const double t816 = t806 + t812;
+    const double t817 = t809 + t815;
+    const double t818 = t809 - t815;
+    const double t819 = t812 - t806;
+    const double t820 = t308 + t816;
+    const double t821 = t309 + t817;
+    const double t822 = t308 - t816;
+    const double t823 = t309 - t817;
+    const double t824 = t310 + t818;
+    const double t825 = t311 + t819;
+    const double t826 = t310 - t818;
+    const double t827 = t311 - t819;
+    const double t828 = 0.19509032201612828 * t593;
+    const double t829 = 0.98078528040323043 * t592;
+    const double t830 = t828 + t829;
+    const double t831 = 0.19509032201612828 * t592;
+    const double t832 = 0.98078528040323043 * t593;
+    const double t833 = t832 - t831;
+    const double t834 = 0.55557023301960218 * t761;
+    const double t835 = 0.83146961230254524 * t760;
+    const double t836 = t834 + t835;
+    const double t837 = 0.55557023301960218 * t760;
+    const double t838 = 0.83146961230254524 * t761;
+    const double t839 = t838 - t837;
+    const double t840 = t830 + t836;
+    const double t841 = t833 + t839;
+    const double t842 = t833 - t839;
+    const double t843 = t836 - t830;
+    const double t844 = t332 + t840;
+    const double t845 = t333 + t841;
+    const double t846 = t332 - t840;
+    const double t847 = t333 - t841;
+    const double t848 = t334 + t842;
+    const double t849 = t335 + t843;
+    const double t850 = t334 - t842;
+    const double t851 = t335 - t843;
+    const double t852 = 0.29028467725446239 * t617;
+    const double t853 = 0.95694033573220882 * t616;
+    const double t854 = t852 + t853;
+    const double t855 = 0.29028467725446239 * t616;
+    const double t856 = 0.95694033573220882 * t617;
+    const double t857 = t856 - t855;
+    const double t858 = 0.77301045336273699 * t785;
+    const double t859 = 0.63439328416364549 * t784;
+    const double t860 = t858 + t859;
+    const double t861 = 0.77301045336273699 * t784;
+    const double t862 = 0.63439328416364549 * t785;
+    const double t863 = t862 - t861;
+    const double t864 = t854 + t860;
+    const double t865 = t857 + t863;
+    const double t866 = t857 - t863;
+    const double t867 = t860 - t854;
+    const double t868 = t356 + t864;
+    const double t869 = t357 + t865;
+    const double t870 = t356 - t864;
+    const double t871 = t357 - t865;
+    const double t872 = t358 + t866;
+    const double t873 = t359 + t867;
+    const double t874 = t358 - t866;
+    const double t875 = t359 - t867;
+    const double t876 = 0.38268343236508978 * t553;
+    const double t877 = 0.92387953251128674 * t552;
+    const double t878 = t876 + t877;
+    const double t879 = 0.38268343236508978 * t552;
+    const double t880 = 0.92387953251128674 * t553;
+    const double t881 = t880 - t879;
+    const double t882 = 0.92387953251128674 * t721;
+    const double t883 = 0.38268343236508978 * t720;
+    const double t884 = t882 + t883;
+    const double t885 = 0.92387953251128674 * t720;
+    const double t886 = 0.38268343236508978 * t721;
+    const double t887 = t886 - t885;
+    const double t888 = t878 + t884;
+    const double t889 = t881 + t887;
+    const double t890 = t881 - t887;
+    const double t891 = t884 - t878;
+    const double t892 = t376 + t888;
+    const double t893 = t377 + t889;
+    const double t894 = t376 - t888;
+    const double t895 = t377 - t889;
+    const double t896 = t378 + t890;
+    const double t897 = t379 + t891;
+    const double t898 = t378 - t890;
+    const double t899 = t379 - t891;
+    const double t900 = 0.47139673682599764 * t577;
+    const double t901 = 0.88192126434835505 * t576;
+    const double t902 = t900 + t901;
+    const double t903 = 0.47139673682599764 * t576;
+    const double t904 = 0.88192126434835505 * t577;
+    const double t905 = t904 - t903;
+    const double t906 = 0.99518472667219693 * t745;
+    const double t907 = 0.098017140329560604 * t744;
+    const double t908 = t906 + t907;
+    const double t909 = 0.99518472667219693 * t744;
+    const double t910 = 0.098017140329560604 * t745;
+    const double t911 = t910 - t909;
+    const double t912 = t902 + t908;
+    const double t913 = t905 + t911;
+    const double t914 = t905 - t911;
+    const double t915 = t908 - t902;
+    const double t916 = t400 + t912;
+    const double t917 = t401 + t913;
+    const double t918 = t400 - t912;
+    const double t919 = t401 - t913;
+    const double t920 = t402 + t914;
+    const double t921 = t403 + t915;
+    const double t922 = t402 - t914;
+    const double t923 = t403 - t915;
+    const double t924 = 0.55557023301960218 * t597;
+    const double t925 = 0.83146961230254524 * t596;
+    const double t926 = t924 + t925;
+    const double t927 = 0.55557023301960218 * t596;
+    const double t928 = 0.83146961230254524 * t597;
+    const double t929 = t928 - t927;
+    const double t930 = 0.98078528040323043 * t765;
+    const double t931 = 0.19509032201612828 * t764;
+    const double t932 = t930 - t931;
+    const double t933 = 0.98078528040323043 * t764;
+    const double t934 = 0.19509032201612828 * t765;
+    const double t935 = t933 + t934;
+    const double t936 = t926 + t932;
+    const double t937 = t929 - t935;
+    const double t938 = t929 + t935;
+    const double t939 = t932 - t926;
+    const double t940 = t424 + t936;
+    const double t941 = t425 + t937;
+    const double t942 = t424 - t936;
+    const double t943 = t425 - t937;
+    const double t944 = t426 + t938;
+    const double t945 = t427 + t939;
+    const double t946 = t426 - t938;
+    const double t947 = t427 - t939;
+    const double t948 = 0.63439328416364549 * t621;
+    const double t949 = 0.77301045336273699 * t620;
+    const double t950 = t948 + t949;
+    const double t951 = 0.63439328416364549 * t620;
+    const double t952 = 0.77301045336273699 * t621;
+    const double t953 = t952 - t951;
+    const double t954 = 0.88192126434835505 * t789;
+    const double t955 = 0.47139673682599764 * t788;
+    const double t956 = t954 - t955;
+    const double t957 = 0.88192126434835505 * t788;
+    const double t958 = 0.47139673682599764 * t789;
+    const double t959 = t957 + t958;
+    const double t960 = t950 + t956;
+    const double t961 = t953 - t959;
+    const double t962 = t953 + t959;
+    const double t963 = t956 - t950;
+    const double t964 = t448 + t960;
+    const double t965 = t449 + t961;
+    const double t966 = t448 - t960;
+    const double t967 = t449 - t961;
+    const double t968 = t450 + t962;
+    const double t969 = t451 + t963;
+    const double t970 = t450 - t962;
+    const double t971 = t451 - t963;
+    const double t972 = t550 + t551;
+    const double t973 = 0.70710678118654757 * t972;
+    const double t974 = t551 - t550;
+    const double t975 = 0.70710678118654757 * t974;
+    const double t976 = t718 - t719;
+    const double t977 = 0.70710678118654757 * t976;
+    const double t978 = t718 + t719;
+    const double t979 = 0.70710678118654757 * t978;
+    const double t980 = t973 - t977;
+    const double t981 = t975 - t979;
+    const double t982 = t973 + t977;
+    const double t983 = t975 + t979;
+    const double t984 = t288 + t980;
+    const double t985 = t289 + t981;
+    const double t986 = t288 - t980;
+    const double t987 = t289 - t981;
+    const double t988 = t290 + t983;
+    const double t989 = t291 - t982;
+    const double t990 = t290 - t983;
+    const double t991 = t291 + t982;
+    const double t992 = 0.77301045336273699 * t575;
+    const double t993 = 0.63439328416364549 * t574;
+    const double t994 = t992 + t993;
+    const double t995 = 0.77301045336273699 * t574;
+    const double t996 = 0.63439328416364549 * t575;
+    const double t997 = t996 - t995;
+    const double t998 = 0.47139673682599764 * t743;
+    const double t999 = 0.88192126434835505 * t742;
+    const double t1000 = t998 - t999;
+    const double t1001 = 0.47139673682599764 * t742;
+    const double t1002 = 0.88192126434835505 * t743;
+    const double t1003 = t1001 + t1002;
+    const double t1004 = t994 + t1000;
+    const double t1005 = t997 - t1003;
+    const double t1006 = t997 + t1003;
+    const double t1007 = t1000 - t994;
+    const double t1008 = t312 + t1004;
+    const double t1009 = t313 + t1005;
+    const double t1010 = t312 - t1004;
+    const double t1011 = t313 - t1005;
+    const double t1012 = t314 + t1006;
+    const double t1013 = t315 + t1007;
+    const double t1014 = t314 - t1006;
+    const double t1015 = t315 - t1007;
+    const double t1016 = 0.83146961230254524 * t595;
+    const double t1017 = 0.55557023301960218 * t594;
+    const double t1018 = t1016 + t1017;
+    const double t1019 = 0.83146961230254524 * t594;
+    const double t1020 = 0.55557023301960218 * t595;
+    const double t1021 = t1020 - t1019;
+    const double t1022 = 0.19509032201612828 * t763;
+    const double t1023 = 0.98078528040323043 * t762;
+    const double t1024 = t1022 - t1023;
+    const double t1025 = 0.19509032201612828 * t762;
+    const double t1026 = 0.98078528040323043 * t763;
+    const double t1027 = t1025 + t1026;
+    const double t1028 = t1018 + t1024;
+    const double t1029 = t1021 - t1027;
+    const double t1030 = t1021 + t1027;
+    const double t1031 = t1024 - t1018;
+    const double t1032 = t336 + t1028;
+    const double t1033 = t337 + t1029;
+    const double t1034 = t336 - t1028;
+    const double t1035 = t337 - t1029;
+    const double t1036 = t338 + t1030;
+    const double t1037 = t339 + t1031;
+    const double t1038 = t338 - t1030;
+    const double t1039 = t339 - t1031;
+    const double t1040 = 0.88192126434835505 * t619;
+    const double t1041 = 0.47139673682599764 * t618;
+    const double t1042 = t1040 + t1041;
+    const double t1043 = 0.88192126434835505 * t618;
+    const double t1044 = 0.47139673682599764 * t619;
+    const double t1045 = t1044 - t1043;
+    const double t1046 = 0.098017140329560604 * t787;
+    const double t1047 = 0.99518472667219693 * t786;
+    const double t1048 = t1046 + t1047;
+    const double t1049 = 0.098017140329560604 * t786;
+    const double t1050 = 0.99518472667219693 * t787;
+    const double t1051 = t1049 - t1050;
+    const double t1052 = t1042 - t1048;
+    const double t1053 = t1045 + t1051;
+    const double t1054 = t1042 + t1048;
+    const double t1055 = t1045 - t1051;
+    const double t1056 = t360 + t1052;
+    const double t1057 = t361 + t1053;
+    const double t1058 = t360 - t1052;
+    const double t1059 = t361 - t1053;
+    const double t1060 = t362 + t1055;
+    const double t1061 = t363 - t1054;
+    const double t1062 = t362 - t1055;
+    const double t1063 = t363 + t1054;
+    const double t1064 = 0.92387953251128674 * t555;
+    const double t1065 = 0.38268343236508978 * t554;
+    const double t1066 = t1064 + t1065;
+    const double t1067 = 0.92387953251128674 * t554;
+    const double t1068 = 0.38268343236508978 * t555;
+    const double t1069 = t1068 - t1067;
+    const double t1070 = 0.38268343236508978 * t723;
+    const double t1071 = 0.92387953251128674 * t722;
+    const double t1072 = t1070 + t1071;
+    const double t1073 = 0.38268343236508978 * t722;
+    const double t1074 = 0.92387953251128674 * t723;
+    const double t1075 = t1073 - t1074;
+    const double t1076 = t1066 - t1072;
+    const double t1077 = t1069 + t1075;
+    const double t1078 = t1066 + t1072;
+    const double t1079 = t1069 - t1075;
+    const double t1080 = t380 + t1076;
+    const double t1081 = t381 + t1077;
+    const double t1082 = t380 - t1076;
+    const double t1083 = t381 - t1077;
+    const double t1084 = t382 + t1079;
+    const double t1085 = t383 - t1078;
+    const double t1086 = t382 - t1079;
+    const double t1087 = t383 + t1078;
+    const double t1088 = 0.95694033573220882 * t579;
+    const double t1089 = 0.29028467725446239 * t578;
+    const double t1090 = t1088 + t1089;
+    const double t1091 = 0.95694033573220882 * t578;
+    const double t1092 = 0.29028467725446239 * t579;
+    const double t1093 = t1092 - t1091;
+    const double t1094 = 0.63439328416364549 * t747;
+    const double t1095 = 0.77301045336273699 * t746;
+    const double t1096 = t1094 + t1095;
+    const double t1097 = 0.63439328416364549 * t746;
+    const double t1098 = 0.77301045336273699 * t747;
+    const double t1099 = t1097 - t1098;
+    const double t1100 = t1090 - t1096;
+    const double t1101 = t1093 + t1099;
+    const double t1102 = t1090 + t1096;
+    const double t1103 = t1093 - t1099;
+    const double t1104 = t404 + t1100;
+    const double t1105 = t405 + t1101;
+    const double t1106 = t404 - t1100;
+    const double t1107 = t405 - t1101;
+    const double t1108 = t406 + t1103;
+    const double t1109 = t407 - t1102;
+    const double t1110 = t406 - t1103;
+    const double t1111 = t407 + t1102;
+    const double t1112 = 0.98078528040323043 * t599;
+    const double t1113 = 0.19509032201612828 * t598;
+    const double t1114 = t1112 + t1113;
+    const double t1115 = 0.98078528040323043 * t598;
+    const double t1116 = 0.19509032201612828 * t599;
+    const double t1117 = t1116 - t1115;
+    const double t1118 = 0.83146961230254524 * t767;
+    const double t1119 = 0.55557023301960218 * t766;
+    const double t1120 = t1118 + t1119;
+    const double t1121 = 0.83146961230254524 * t766;
+    const double t1122 = 0.55557023301960218 * t767;
+    const double t1123 = t1121 - t1122;
+    const double t1124 = t1114 - t1120;
+    const double t1125 = t1117 + t1123;
+    const double t1126 = t1114 + t1120;
+    const double t1127 = t1117 - t1123;
+    const double t1128 = t428 + t1124;
+    const double t1129 = t429 + t1125;
+    const double t1130 = t428 - t1124;
+    const double t1131 = t429 - t1125;
+    const double t1132 = t430 + t1127;
+    const double t1133 = t431 - t1126;
+    const double t1134 = t430 - t1127;
+    const double t1135 = t431 + t1126;
+    const double t1136 = 0.99518472667219693 * t623;
+    const double t1137 = 0.098017140329560604 * t622;
+    const double t1138 = t1136 + t1137;
+    const double t1139 = 0.99518472667219693 * t622;
+    const double t1140 = 0.098017140329560604 * t623;
+    const double t1141 = t1140 - t1139;
+    const double t1142 = 0.95694033573220882 * t791;
+    const double t1143 = 0.29028467725446239 * t790;
+    const double t1144 = t1142 + t1143;
+    const double t1145 = 0.95694033573220882 * t790;
+    const double t1146 = 0.29028467725446239 * t791;
+    const double t1147 = t1145 - t1146;
+    const double t1148 = t1138 - t1144;
+    const double t1149 = t1141 + t1147;
+    const double t1150 = t1138 + t1144;
+    const double t1151 = t1141 - t1147;
+    const double t1152 = t452 + t1148;
+    const double t1153 = t453 + t1149;
+    const double t1154 = t452 - t1148;
+    const double t1155 = t453 - t1149;
+    const double t1156 = t454 + t1151;
+    const double t1157 = t455 - t1150;
+    const double t1158 = t454 - t1151;
+    const double t1159 = t455 + t1150;
+    ro[0] = t796;
+    io[0] = t797;
+    ro[os] = t820;
+    io[os] = t821;
+    ro[2 * os] = t844;
+    io[2 * os] = t845;
+    ro[3 * os] = t868;
+    io[3 * os] = t869;
+    ro[4 * os] = t892;
+    io[4 * os] = t893;
+    ro[5 * os] = t916;
+    io[5 * os] = t917;
+    ro[6 * os] = t940;
+    io[6 * os] = t941;
+    ro[7 * os] = t964;
+    io[7 * os] = t965;
+    ro[8 * os] = t984;
+    io[8 * os] = t985;
+    ro[9 * os] = t1008;
+    io[9 * os] = t1009;
+    ro[10 * os] = t1032;
+    io[10 * os] = t1033;
+    ro[11 * os] = t1056;
+    io[11 * os] = t1057;
+    ro[12 * os] = t1080;
+    io[12 * os] = t1081;
+    ro[13 * os] = t1104;
+    io[13 * os] = t1105;
+    ro[14 * os] = t1128;
+    io[14 * os] = t1129;
+    ro[15 * os] = t1152;
+    io[15 * os] = t1153;
+    ro[16 * os] = t800;
+    io[16 * os] = t801;
+    ro[17 * os] = t824;
+    io[17 * os] = t825;
+    ro[18 * os] = t848;
+    io[18 * os] = t849;
+    ro[19 * os] = t872;
+    io[19 * os] = t873;
+    ro[20 * os] = t896;
+    io[20 * os] = t897;
+    ro[21 * os] = t920;
+    io[21 * os] = t921;
+    ro[22 * os] = t944;
+    io[22 * os] = t945;
+    ro[23 * os] = t968;
+    io[23 * os] = t969;
+    ro[24 * os] = t988;
+    io[24 * os] = t989;
+    ro[25 * os] = t1012;
+    io[25 * os] = t1013;
+    ro[26 * os] = t1036;
+    io[26 * os] = t1037;
+    ro[27 * os] = t1060;
+    io[27 * os] = t1061;
+    ro[28 * os] = t1084;
+    io[28 * os] = t1085;
+    ro[29 * os] = t1108;
+    io[29 * os] = t1109;
+    ro[30 * os] = t1132;
+    io[30 * os] = t1133;
+    ro[31 * os] = t1156;
+    io[31 * os] = t1157;
+    ro[32 * os] = t798;
+    io[32 * os] = t799;
+    ro[33 * os] = t822;
+    io[33 * os] = t823;
+    ro[34 * os] = t846;
+    io[34 * os] = t847;
+    ro[35 * os] = t870;
+    io[35 * os] = t871;
+    ro[36 * os] = t894;
+    io[36 * os] = t895;
+    ro[37 * os] = t918;
+    io[37 * os] = t919;
+    ro[38 * os] = t942;
+    io[38 * os] = t943;
+    ro[39 * os] = t966;
+    io[39 * os] = t967;
+    ro[40 * os] = t986;
+    io[40 * os] = t987;
+    ro[41 * os] = t1010;
+    io[41 * os] = t1011;
+    ro[42 * os] = t1034;
+    io[42 * os] = t1035;
+    ro[43 * os] = t1058;
+    io[43 * os] = t1059;
+    ro[44 * os] = t1082;
+    io[44 * os] = t1083;
+    ro[45 * os] = t1106;
+    io[45 * os] = t1107;
+    ro[46 * os] = t1130;
+    io[46 * os] = t1131;
+    ro[47 * os] = t1154;
+    io[47 * os] = t1155;
+    ro[48 * os] = t802;
+    io[48 * os] = t803;
+    ro[49 * os] = t826;
+    io[49 * os] = t827;
+    ro[50 * os] = t850;
+    io[50 * os] = t851;
+    ro[51 * os] = t874;
+    io[51 * os] = t875;
+    ro[52 * os] = t898;
+    io[52 * os] = t899;
+    ro[53 * os] = t922;
+    io[53 * os] = t923;
+    ro[54 * os] = t946;
+    io[54 * os] = t947;
+    ro[55 * os] = t970;
+    io[55 * os] = t971;
+    ro[56 * os] = t990;
+    io[56 * os] = t991;
+    ro[57 * os] = t1014;
+    io[57 * os] = t1015;
+    ro[58 * os] = t1038;
+    io[58 * os] = t1039;
+    ro[59 * os] = t1062;
+    io[59 * os] = t1063;
+    ro[60 * os] = t1086;
+    io[60 * os] = t1087;
+    ro[61 * os] = t1110;
+    io[61 * os] = t1111;
+    ro[62 * os] = t1134;
+    io[62 * os] = t1135;
+    ro[63 * os] = t1158;
+    io[63 * os] = t1159;
+}
+
+fft_codelet fft_codelet_find(int n) {
+    switch(n) {
+        case 2: return fft_codelet_2;
+        case 3: return fft_codelet_3;
+        case 4: return fft_codelet_4;
+        case 5: return fft_codelet_5;
+        case 6: return fft_codelet_6;
+        case 7: return fft_codelet_7;
+        case 8: return fft_codelet_8;
+        case 16: return fft_codelet_16;
+        case 32: return fft_codelet_32;
+        case 64: return fft_codelet_64;
+        default: return 0;
+    }
+}
+
+// 2 points: 4 additions, 0 multiplications
+void fftf_codelet_2(const float *ri, const float *ii, float *ro, float *io, long is, long os) {
+    const float x0r = ri[0], x0i = ii[0];
+    const float x1r = ri[is], x1i = ii[is];
+    const float t0 = x0r + x1r;
+    const float t1 = x0i + x1i;
+    const float t2 = x0r - x1r;
+    const float t3 = x0i - x1i;
+    ro[0] = t0;
+    io[0] = t1;
+    ro[os] = t2;
+    io[os] = t3;
+}
+
+// 3 points: 12 additions, 4 multiplications
+void fftf_codelet_3(const float *ri, const float *ii, float *ro, float *io, long is, long os) {
+    const float x0r = ri[0], x0i = ii[0];
+    const float x1r = ri[is], x1i = ii[is];
+    const float x2r = ri[2 * is], x2i = ii[2 * is];
+    const float t0 = x1r + x2r;
+    const float t1 = x1i + x2i;
+    const float t2 = x1r - x2r;
+    const float t3 = x1i - x2i;
+    const float t4 = x0r + t0;
+    const float t5 = x0i + t1;
+    const float t6 = 0.5f * t0;
+    const float t7 = 0.5f * t1;
+    const float t8 = 0.866025388f * t2;
+    const float t9 = 0.866025388f * t3;
+    const float t10 = x0r - t6;
+    const float t11 = x0i - t7;
+    const float t12 = t9 + t10;
+    const float t13 = t11 - t8;
+    const float t14 = t10 - t9;
+    const float t15 = t8 + t11;
+    ro[0] = t4;
+    io[0] = t5;
+    ro[os] = t12;
+    io[os] = t13;
+    ro[2 * os] = t14;
+    io[2 * os] = t15;
+}
+
+// 4 points: 16 additions, 0 multiplications
+void fftf_codelet_4(const float *ri, const float *ii, float *ro, float *io, long is, long os) {
+    const float x0r = ri[0], x0i = ii[0];
+    const float x1r = ri[is], x1i = ii[is];
+    const float x2r = ri[2 * is], x2i = ii[2 * is];
+    const float x3r = ri[3 * is], x3i = ii[3 * is];
+    const float t0 = x0r + x2r;
+    const float t1 = x0i + x2i;
+    const float t2 = x0r - x2r;
+    const float t3 = x0i - x2i;
+    const float t4 = x1r + x3r;
+    const float t5 = x1i + x3i;
+    const float t6 = x1i - x3i;
+    const float t7 = x3r - x1r;
+    const float t8 = t0 + t4;
+    const float t9 = t1 + t5;
+    const float t10 = t0 - t4;
+    const float t11 = t1 - t5;
+    const float t12 = t2 + t6;
+    const float t13 = t3 + t7;
+    const float t14 = t2 - t6;
+    const float t15 = t3 - t7;
+    ro[0] = t8;
+    io[0] = t9;
+    ro[os] = t12;
+    io[os] = t13;
+    ro[2 * os] = t10;
+    io[2 * os] = t11;
+    ro[3 * os] = t14;
+    io[3 * os] = t15;
+}
+
+// 5 points: 32 additions, 16 multiplications
+void fftf_codelet_5(const float *ri, const float *ii, float *ro, float *io, long is, long os) {
+    const float x0r = ri[0], x0i = ii[0];
+    const float x1r = ri[is], x1i = ii[is];
+    const float x2r = ri[2 * is], x2i = ii[2 * is];
+    const float x3r = ri[3 * is], x3i = ii[3 * is];
+    const float x4r = ri[4 * is], x4i = ii[4 * is];
+    const float t0 = x1r + x4r;
+    const float t1 = x1i + x4i;
+    const float t2 = x1r - x4r;
+    const float t3 = x1i - x4i;
+    const float t4 = x2r + x3r;
+    const float t5 = x2i + x3i;
+    const float t6 = x2r - x3r;
+    const float t7 = x2i - x3i;
+    const float t8 = x0r + t0;
+    const float t9 = x0i + t1;
+    const float t10 = t4 + t8;
+    const float t11 = t5 + t9;
+    const float t12 = 0.309017003f * t0;
+    const float t13 = 0.309017003f * t1;
+    const float t14 = 0.95105654f * t2;
+    const float t15 = 0.95105654f * t3;
+    const float t16 = x0r + t12;
+    const float t17 = x0i + t13;
+    const float t18 = 0.809017003f * t4;
+    const float t19 = 0.809017003f * t5;
+    const float t20 = 0.587785244f * t6;
+    const float t21 = 0.587785244f * t7;
+    const float t22 = t16 - t18;
+    const float t23 = t17 - t19;
+    const float t24 = t14 + t20;
+    const float t25 = t15 + t21;
+    const float t26 = t22 + t25;
+    const float t27 = t23 - t24;
+    const float t28 = t22 - t25;
+    const float t29 = t23 + t24;
+    const float t30 = 0.809017003f * t0;
+    const float t31 = 0.809017003f * t1;
+    const float t32 = 0.587785244f * t2;
+    const float t33 = 0.587785244f * t3;
+    const float t34 = x0r - t30;
+    const float t35 = x0i - t31;
+    const float t36 = 0.309017003f * t4;
+    const float t37 = 0.309017003f * t5;
+    const float t38 = 0.95105654f * t6;
+    const float t39 = 0.95105654f * t7;
+    const float t40 = t34 + t36;
+    const float t41 = t35 + t37;
+    const float t42 = t33 - t39;
+    const float t43 = t38 - t32;
+    const float t44 = t40 + t42;
+    const float t45 = t41 + t43;
+    const float t46 = t40 - t42;
+    const float t47 = t41 - t43;
+    ro[0] = t10;
+    io[0] = t11;
+    ro[os] = t26;
+    io[os] = t27;
+    ro[2 * os] = t44;
+    io[2 * os] = t45;
+    ro[3 * os] = t46;
+    io[3 * os] = t47;
+    ro[4 * os] = t28;
+    io[4 * os] = t29;
+}
+
+// 6 points: 40 additions, 16 multiplications
+void fftf_codelet_6(const float *ri, const float *ii, float *ro, float *io, long is, long os) {
+    const float x0r = ri[0], x0i = ii[0];
+    const float x1r = ri[is], x1i = ii[is];
+    const float x2r = ri[2 * is], x2i = ii[2 * is];
+    const float x3r = ri[3 * is], x3i = ii[3 * is];
+    const float x4r = ri[4 * is], x4i = ii[4 * is];
+    const float x5r = ri[5 * is], x5i = ii[5 * is];
+    const float t0 = x2r + x4r;
+    const float t1 = x2i + x4i;
+    const float t2 = x2r - x4r;
+    const float t3 = x2i - x4i;
+    const float t4 = x0r + t0;
+    const float t5 = x0i + t1;
+    const float t6 = 0.5f * t0;
+    const float t7 = 0.5f * t1;
+    const float t8 = 0.866025388f * t2;
+    const float t9 = 0.866025388f * t3;
+    const float t10 = x0r - t6;
+    const float t11 = x0i - t7;
+    const float t12 = t9 + t10;
+    const float t13 = t11 - t8;
+    const float t14 = t10 - t9;
+    const float t15 = t8 + t11;
+    const float t16 = x3r + x5r;
+    const float t17 = x3i + x5i;
+    const float t18 = x3r - x5r;
+    const float t19 = x3i - x5i;
+    const float t20 = x1r + t16;
+    const float t21 = x1i + t17;
+    const float t22 = 0.5f * t16;
+    const float t23 = 0.5f * t17;
+    const float t24 = 0.866025388f * t18;
+    const float t25 = 0.866025388f * t19;
+    const float t26 = x1r - t22;
+    const float t27 = x1i - t23;
+    const float t28 = t25 + t26;
+    const float t29 = t27 - t24;
+    const float t30 = t26 - t25;
+    const float t31 = t24 + t27;
+    const float t32 = t4 + t20;
+    const float t33 = t5 + t21;
+    const float t34 = t4 - t20;
+    const float t35 = t5 - t21;
+    const float t36 = 0.866025388f * t29;
+    const float t37 = 0.5f * t28;
+    const float t38 = t36 + t37;
+    const float t39 = 0.866025388f * t28;
+    const float t40 = 0.5f * t29;
+    const float t41 = t40 - t39;
+    const float t42 = t12 + t38;
+    const float t43 = t13 + t41;
+    const float t44 = t12 - t38;
+    const float t45 = t13 - t41;
+    const float t46 = 0.866025388f * t31;
+    const float t47 = 0.5f * t30;
+    const float t48 = t46 - t47;
+    const float t49 = 0.866025388f * t30;
+    const float t50 = 0.5f * t31;
+    const float t51 = t49 + t50;
+    const float t52 = t14 + t48;
+    const float t53 = t15 - t51;
+    const float t54 = t14 - t48;
+    const float t55 = t15 + t51;
+    ro[0] = t32;
+    io[0] = t33;
+    ro[os] = t42;
+    io[os] = t43;
+    ro[2 * os] = t52;
+    io[2 * os] = t53;
+    ro[3 * os] = t34;
+    io[3 * os] = t35;
+    ro[4 * os] = t44;
+    io[4 * os] = t45;
+    ro[5 * os] = t54;
+    io[5 * os] = t55;
+}
+
+// 7 points: 60 additions, 36 multiplications
+void fftf_codelet_7(const float *ri, const float *ii, float *ro, float *io, long is, long os) {
+    const float x0r = ri[0], x0i = ii[0];
+    const float x1r = ri[is], x1i = ii[is];
+    const float x2r = ri[2 * is], x2i = ii[2 * is];
+    const float x3r = ri[3 * is], x3i = ii[3 * is];
+    const float x4r = ri[4 * is], x4i = ii[4 * is];
+    const float x5r = ri[5 * is], x5i = ii[5 * is];
+    const float x6r = ri[6 * is], x6i = ii[6 * is];
+    const float t0 = x1r + x6r;
+    const float t1 = x1i + x6i;
+    const float t2 = x1r - x6r;
+    const float t3 = x1i - x6i;
+    const float t4 = x2r + x5r;
+    const float t5 = x2i + x5i;
+    const float t6 = x2r - x5r;
+    const float t7 = x2i - x5i;
+    const float t8 = x3r + x4r;
+    const float t9 = x3i + x4i;
+    const float t10 = x3r - x4r;
+    const float t11 = x3i - x4i;
+    const float t12 = x0r + t0;
+    const float t13 = x0i + t1;
+    const float t14 = t4 + t12;
+    const float t15 = t5 + t13;
+    const float t16 = t8 + t14;
+    const float t17 = t9 + t15;
+    const float t18 = 0.623489797f * t0;
+    const float t19 = 0.623489797f * t1;
+    const float t20 = 0.781831503f * t2;
+    const float t21 = 0.781831503f * t3;
+    const float t22 = x0r + t18;
+    const float t23 = x0i + t19;
+    const float t24 = 0.222520933f * t4;
+    const float t25 = 0.222520933f * t5;
+    const float t26 = 0.974927902f * t6;
+    const float t27 = 0.974927902f * t7;
+    const float t28 = t22 - t24;
+    const float t29 = t23 - t25;
+    const float t30 = t20 + t26;
+    const float t31 = t21 + t27;
+    const float t32 = 0.90096885f * t8;
+    const float t33 = 0.90096885f * t9;
+    const float t34 = 0.433883727f * t10;
+    const float t35 = 0.433883727f * t11;
+    const float t36 = t28 - t32;
+    const float t37 = t29 - t33;
+    const float t38 = t30 + t34;
+    const float t39 = t31 + t35;
+    const float t40 = t36 + t39;
+    const float t41 = t37 - t38;
+    const float t42 = t36 - t39;
+    const float t43 = t37 + t38;
+    const float t44 = 0.222520933f * t0;
+    const float t45 = 0.222520933f * t1;
+    const float t46 = 0.974927902f * t2;
+    const float t47 = 0.974927902f * t3;
+    const float t48 = x0r - t44;
+    const float t49 = x0i - t45;
+    const float t50 = 0.90096885f * t4;
+    const float t51 = 0.90096885f * t5;
+    const float t52 = 0.433883727f * t6;
+    const float t53 = 0.433883727f * t7;
+    const float t54 = t48 - t50;
+    const float t55 = t49 - t51;
+    const float t56 = t46 - t52;
+    const float t57 = t47 - t53;
+    const float t58 = 0.623489797f * t8;
+    const float t59 = 0.623489797f * t9;
+    const float t60 = 0.781831503f * t10;
+    const float t61 = 0.781831503f * t11;
+    const float t62 = t54 + t58;
+    const float t63 = t55 + t59;
+    const float t64 = t57 - t61;
+    const float t65 = t60 - t56;
+    const float t66 = t62 + t64;
+    const float t67 = t63 + t65;
+    const float t68 = t62 - t64;
+    const float t69 = t63 - t65;
+    const float t70 = 0.90096885f * t0;
+    const float t71 = 0.90096885f * t1;
+    const float t72 = 0.433883727f * t2;
+    const float t73 = 0.433883727f * t3;
+    const float t74 = x0r - t70;
+    const float t75 = x0i - t71;
+    const float t76 = 0.623489797f * t4;
+    const float t77 = 0.623489797f * t5;
+    const float t78 = 0.781831503f * t6;
+    const float t79 = 0.781831503f * t7;
+    const float t80 = t74 + t76;
+    const float t81 = t75 + t77;
+    const float t82 = t72 - t78;
+    const float t83 = t73 - t79;
+    const float t84 = 0.222520933f * t8;
+    const float t85 = 0.222520933f * t9;
+    const float t86 = 0.974927902f * t10;
+    const float t87 = 0.974927902f * t11;
+    const float t88 = t80 - t84;
+    const float t89 = t81 - t85;
+    const float t90 = t82 + t86;
+    const float t91 = t83 + t87;
+    const float t92 = t88 + t91;
+    const float t93 = t89 - t90;
+    const float t94 = t88 - t91;
+    const float t95 = t89 + t90;
+    ro[0] = t16;
+    io[0] = t17;
+    ro[os] = t40;
+    io[os] = t41;
+    ro[2 * os] = t66;
+    io[2 * os] = t67;
+    ro[3 * os] = t92;
+    io[3 * os] = t93;
+    ro[4 * os] = t94;
+    io[4 * os] = t95;
+    ro[5 * os] = t68;
+    io[5 * os] = t69;
+    ro[6 * os] = t42;
+    io[6 * os] = t43;
+}
+
+// 8 points: 52 additions, 4 multiplications
+void fftf_codelet_8(const float *ri, const float *ii, float *ro, float *io, long is, long os) {
+    const float x0r = ri[0], x0i = ii[0];
+    const float x1r = ri[is], x1i = ii[is];
+    const float x2r = ri[2 * is], x2i = ii[2 * is];
+    const float x3r = ri[3 * is], x3i = ii[3 * is];
+    const float x4r = ri[4 * is], x4i = ii[4 * is];
+    const float x5r = ri[5 * is], x5i = ii[5 * is];
+    const float x6r = ri[6 * is], x6i = ii[6 * is];
+    const float x7r = ri[7 * is], x7i = ii[7 * is];
+    const float t0 = x0r + x4r;
+    const float t1 = x0i + x4i;
+    const float t2 = x0r - x4r;
+    const float t3 = x0i - x4i;
+    const float t4 = x2r + x6r;
+    const float t5 = x2i + x6i;
+    const float t6 = x2i - x6i;
+    const float t7 = x6r - x2r;
+    const float t8 = t0 + t4;
+    const float t9 = t1 + t5;
+    const float t10 = t0 - t4;
+    const float t11 = t1 - t5;
+    const float t12 = t2 + t6;
+    const float t13 = t3 + t7;
+    const float t14 = t2 - t6;
+    const float t15 = t3 - t7;
+    const float t16 = x1r + x5r;
+    const float t17 = x1i + x5i;
+    const float t18 = x1r - x5r;
+    const float t19 = x1i - x5i;
+    const float t20 = x3r + x7r;
+    const float t21 = x3i + x7i;
+    const float t22 = x3r - x7r;
+    const float t23 = x3i - x7i;
+    const float t24 = t16 + t20;
+    const float t25 = t17 + t21;
+    const float t26 = t17 - t21;
+    const float t27 = t20 - t16;
+    const float t28 = t8 + t24;
+    const float t29 = t9 + t25;
+    const float t30 = t8 - t24;
+    const float t31 = t9 - t25;
+    const float t32 = t10 + t26;
+    const float t33 = t11 + t27;
+    const float t34 = t10 - t26;
+    const float t35 = t11 - t27;
+    const float t36 = t18 + t19;
+    const float t37 = 0.707106769f * t36;
+    const float t38 = t19 - t18;
+    const float t39 = 0.707106769f * t38;
+    const float t40 = t22 - t23;
+    const float t41 = 0.707106769f * t40;
+    const float t42 = t22 + t23;
+    const float t43 = 0.707106769f * t42;
+    const float t44 = t37 - t41;
+    const float t45 = t39 - t43;
+    const float t46 = t37 + t41;
+    const float t47 = t39 + t43;
+    const float t48 = t12 + t44;
+    const float t49 = t13 + t45;
+    const float t50 = t12 - t44;
+    const float t51 = t13 - t45;
+    const float t52 = t14 + t47;
+    const float t53 = t15 - t46;
+    const float t54 = t14 - t47;
+    const float t55 = t15 + t46;
+    ro[0] = t28;
+    io[0] = t29;
+    ro[os] = t48;
+    io[os] = t49;
+    ro[2 * os] = t32;
+    io[2 * os] = t33;
+    ro[3 * os] = t52;
+    io[3 * os] = t53;
+    ro[4 * os] = t30;
+    io[4 * os] = t31;
+    ro[5 * os] = t50;
+    io[5 * os] = t51;
+    ro[6 * os] = t34;
+    io[6 * os] = t35;
+    ro[7 * os] = t54;
+    io[7 * os] = t55;
+}
+
+// 16 points: 144 additions, 24 multiplications
+void fftf_codelet_16(const float *ri, const float *ii, float *ro, float *io, long is, long os) {
+    const float x0r = ri[0], x0i = ii[0];
+    const float x1r = ri[is], x1i = ii[is];
+    const float x2r = ri[2 * is], x2i = ii[2 * is];
+    const float x3r = ri[3 * is], x3i = ii[3 * is];
+    const float x4r = ri[4 * is], x4i = ii[4 * is];
+    const float x5r = ri[5 * is], x5i = ii[5 * is];
+    const float x6r = ri[6 * is], x6i = ii[6 * is];
+    const float x7r = ri[7 * is], x7i = ii[7 * is];
+    const float x8r = ri[8 * is], x8i = ii[8 * is];
+    const float x9r = ri[9 * is], x9i = ii[9 * is];
+    const float x10r = ri[10 * is], x10i = ii[10 * is];
+    const float x11r = ri[11 * is], x11i = ii[11 * is];
+    const float x12r = ri[12 * is], x12i = ii[12 * is];
+    const float x13r = ri[13 * is], x13i = ii[13 * is];
+    const float x14r = ri[14 * is], x14i = ii[14 * is];
+    const float x15r = ri[15 * is], x15i = ii[15 * is];
+    const float t0 = x0r + x8r;
+    const float t1 = x0i + x8i;
+    const float t2 = x0r - x8r;
+    const float t3 = x0i - x8i;
+    const float t4 = x4r + x12r;
+    const float t5 = x4i + x12i;
+    const float t6 = x4i - x12i;
+    const float t7 = x12r - x4r;
+    const float t8 = t0 + t4;
+    const float t9 = t1 + t5;
+    const float t10 = t0 - t4;
+    const float t11 = t1 - t5;
+    const float t12 = t2 + t6;
+    const float t13 = t3 + t7;
+    const float t14 = t2 - t6;
+    const float t15 = t3 - t7;
+    const float t16 = x2r + x10r;
+    const float t17 = x2i + x10i;
+    const float t18 = x2r - x10r;
+    const float t19 = x2i - x10i;
+    const float t20 = x6r + x14r;
+    const float t21 = x6i + x14i;
+    const float t22 = x6r - x14r;
+    const float t23 = x6i - x14i;
+    const float t24 = t16 + t20;
+    const float t25 = t17 + t21;
+    const float t26 = t17 - t21;
+    const float t27 = t20 - t16;
+    const float t28 = t8 + t24;
+    const float t29 = t9 + t25;
+    const float t30 = t8 - t24;
+    const float t31 = t9 - t25;
+    const float t32 = t10 + t26;
+    const float t33 = t11 + t27;
+    const float t34 = t10 - t26;
+    const float t35 = t11 - t27;
+    const float t36 = t18 + t19;
+    const float t37 = 0.707106769f * t36;
+    const float t38 = t19 - t18;
+    const float t39 = 0.707106769f * t38;
+    const float t40 = t22 - t23;
+    const float t41 = 0.707106769f * t40;
+    const float t42 = t22 + t23;
+    const float t43 = 0.707106769f * t42;
+    const float t44 = t37 - t41;
+    const float t45 = t39 - t43;
+    const float t46 = t37 + t41;
+    const float t47 = t39 + t43;
+    const float t48 = t12 + t44;
+    const float t49 = t13 + t45;
+    const float t50 = t12 - t44;
+    const float t51 = t13 - t45;
+    const float t52 = t14 + t47;
+    const float t53 = t15 - t46;
+    const float t54 = t14 - t47;
+    const float t55 = t15 + t46;
+    const float t56 = x1r + x9r;
+    const float t57 = x1i + x9i;
+    const float t58 = x1r - x9r;
+    const float t59 = x1i - x9i;
+    const float t60 = x5r + x13r;
+    const float t61 = x5i + x13i;
+    const float t62 = x5i - x13i;
+    const float t63 = x13r - x5r;
+    const float t64 = t56 + t60;
+    const float t65 = t57 + t61;
+    const float t66 = t56 - t60;
+    const float t67 = t57 - t61;
+    const float t68 = t58 + t62;
+    const float t69 = t59 + t63;
+    const float t70 = t58 - t62;
+    const float t71 = t59 - t63;
+    const float t72 = x3r + x11r;
+    const float t73 = x3i + x11i;
+    const float t74 = x3r - x11r;
+    const float t75 = x3i - x11i;
+    const float t76 = x7r + x15r;
+    const float t77 = x7i + x15i;
+    const float t78 = x7i - x15i;
+    const float t79 = x15r - x7r;
+    const float t80 = t72 + t76;
+    const float t81 = t73 + t77;
+    const float t82 = t72 - t76;
+    const float t83 = t73 - t77;
+    const float t84 = t74 + t78;
+    const float t85 = t75 + t79;
+    const float t86 = t74 - t78;
+    const float t87 = t75 - t79;
+    const float t88 = t64 + t80;
+    const float t89 = t65 + t81;
+    const float t90 = t65 - t81;
+    const float t91 = t80 - t64;
+    const float t92 = t28 + t88;
+    const float t93 = t29 + t89;
+    const float t94 = t28 - t88;
+    const float t95 = t29 - t89;
+    const float t96 = t30 + t90;
+    const float t97 = t31 + t91;
+    const float t98 = t30 - t90;
+    const float t99 = t31 - t91;
+    const float t100 = 0.382683426f * t69;
+    const float t101 = 0.923879504f * t68;
+    const float t102 = t100 + t101;
+    const float t103 = 0.382683426f * t68;
+    const float t104 = 0.923879504f * t69;
+    const float t105 = t104 - t103;
+    const float t106 = 0.923879504f * t85;
+    const float t107 = 0.382683426f * t84;
+    const float t108 = t106 + t107;
+    const float t109 = 0.923879504f * t84;
+    const float t110 = 0.382683426f * t85;
+    const float t111 = t110 - t109;
+    const float t112 = t102 + t108;
+    const float t113 = t105 + t111;
+    const float t114 = t105 - t111;
+    const float t115 = t108 - t102;
+    const float t116 = t48 + t112;
+    const float t117 = t49 + t113;
+    const float t118 = t48 - t112;
+    const float t119 = t49 - t113;
+    const float t120 = t50 + t114;
+    const float t121 = t51 + t115;
+    const float t122 = t50 - t114;
+    const float t123 = t51 - t115;
+    const float t124 = t66 + t67;
+    const float t125 = 0.707106769f * t124;
+    const float t126 = t67 - t66;
+    const float t127 = 0.707106769f * t126;
+    const float t128 = t82 - t83;
+    const float t129 = 0.707106769f * t128;
+    const float t130 = t82 + t83;
+    const float t131 = 0.707106769f * t130;
+    const float t132 = t125 - t129;
+    const float t133 = t127 - t131;
+    const float t134 = t125 + t129;
+    const float t135 = t127 + t131;
+    const float t136 = t32 + t132;
+    const float t137 = t33 + t133;
+    const float t138 = t32 - t132;
+    const float t139 = t33 - t133;
+    const float t140 = t34 + t135;
+    const float t141 = t35 - t134;
+    const float t142 = t34 - t135;
+    const float t143 = t35 + t134;
+    const float t144 = 0.923879504f * t71;
+    const float t145 = 0.382683426f * t70;
+    const float t146 = t144 + t145;
+    const float t147 = 0.923879504f * t70;
+    const float t148 = 0.382683426f * t71;
+    const float t149 = t148 - t147;
+    const float t150 = 0.382683426f * t87;
+    const float t151 = 0.923879504f * t86;
+    const float t152 = t150 + t151;
+    const float t153 = 0.382683426f * t86;
+    const float t154 = 0.923879504f * t87;
+    const float t155 = t153 - t154;
+    const float t156 = t146 - t152;
+    const float t157 = t149 + t155;
+    const float t158 = t146 + t152;
+    const float t159 = t149 - t155;
+    const float t160 = t52 + t156;
+    const float t161 = t53 + t157;
+    const float t162 = t52 - t156;
+    const float t163 = t53 - t157;
+    const float t164 = t54 + t159;
+    const float t165 = t55 - t158;
+    const float t166 = t54 - t159;
+    const float t167 = t55 + t158;
+    ro[0] = t92;
+    io[0] = t93;
+    ro[os] = t116;
+    io[os] = t117;
+    ro[2 * os] = t136;
+    io[2 * os] = t137;
+    ro[3 * os] = t160;
+    io[3 * os] = t161;
+    ro[4 * os] = t96;
+    io[4 * os] = t97;
+    ro[5 * os] = t120;
+    io[5 * os] = t121;
+    ro[6 * os] = t140;
+    io[6 * os] = t141;
+    ro[7 * os] = t164;
+    io[7 * os] = t165;
+    ro[8 * os] = t94;
+    io[8 * os] = t95;
+    ro[9 * os] = t118;
+    io[9 * os] = t119;
+    ro[10 * os] = t138;
+    io[10 * os] = t139;
+    ro[11 * os] = t162;
+    io[11 * os] = t163;
+    ro[12 * os] = t98;
+    io[12 * os] = t99;
+    ro[13 * os] = t122;
+    io[13 * os] = t123;
+    ro[14 * os] = t142;
+    io[14 * os] = t143;
+    ro[15 * os] = t166;
+    io[15 * os] = t167;
+}
+
+// 32 points: 372 additions, 84 multiplications
+void fftf_codelet_32(const float *ri, const float *ii, float *ro, float *io, long is, long os) {
+    const float x0r = ri[0], x0i = ii[0];
+    const float x1r = ri[is], x1i = ii[is];
+    const float x2r = ri[2 * is], x2i = ii[2 * is];
+    const float x3r = ri[3 * is], x3i = ii[3 * is];
+    const float x4r = ri[4 * is], x4i = ii[4 * is];
+    const float x5r = ri[5 * is], x5i = ii[5 * is];
+    const float x6r = ri[6 * is], x6i = ii[6 * is];
+    const float x7r = ri[7 * is], x7i = ii[7 * is];
+    const float x8r = ri[8 * is], x8i = ii[8 * is];
+    const float x9r = ri[9 * is], x9i = ii[9 * is];
+    const float x10r = ri[10 * is], x10i = ii[10 * is];
+    const float x11r = ri[11 * is], x11i = ii[11 * is];
+    const float x12r = ri[12 * is], x12i = ii[12 * is];
+    const float x13r = ri[13 * is], x13i = ii[13 * is];
+    const float x14r = ri[14 * is], x14i = ii[14 * is];
+    const float x15r = ri[15 * is], x15i = ii[15 * is];
+    const float x16r = ri[16 * is], x16i = ii[16 * is];
+    const float x17r = ri[17 * is], x17i = ii[17 * is];
+    const float x18r = ri[18 * is], x18i = ii[18 * is];
+    const float x19r = ri[19 * is], x19i = ii[19 * is];
+    const float x20r = ri[20 * is], x20i = ii[20 * is];
+    const float x21r = ri[21 * is], x21i = ii[21 * is];
+    const float x22r = ri[22 * is], x22i = ii[22 * is];
+    const float x23r = ri[23 * is], x23i = ii[23 * is];
+    const float x24r = ri[24 * is], x24i = ii[24 * is];
+    const float x25r = ri[25 * is], x25i = ii[25 * is];
+    const float x26r = ri[26 * is], x26i = ii[26 * is];
+    const float x27r = ri[27 * is], x27i = ii[27 * is];
+    const float x28r = ri[28 * is], x28i = ii[28 * is];
+    const float x29r = ri[29 * is], x29i = ii[29 * is];
+    const float x30r = ri[30 * is], x30i = ii[30 * is];
+    const float x31r = ri[31 * is], x31i = ii[31 * is];
+    const float t0 = x0r + x16r;
+    const float t1 = x0i + x16i;
+    const float t2 = x0r - x16r;
+    const float t3 = x0i - x16i;
+    const float t4 = x8r + x24r;
+    const float t5 = x8i + x24i;
+    const float t6 = x8i - x24i;
+    const float t7 = x24r - x8r;
+    const float t8 = t0 + t4;
+    const float t9 = t1 + t5;
+    const float t10 = t0 - t4;
+    const float t11 = t1 - t5;
+    const float t12 = t2 + t6;
+    const float t13 = t3 + t7;
+    const float t14 = t2 - t6;
+    const float t15 = t3 - t7;
+    const float t16 = x4r + x20r;
+    const float t17 = x4i + x20i;
+    const float t18 = x4r - x20r;
+    const float t19 = x4i - x20i;
+    const float t20 = x12r + x28r;
+    const float t21 = x12i + x28i;
+    const float t22 = x12r - x28r;
+    const float t23 = x12i - x28i;
+    const float t24 = t16 + t20;
+    const float t25 = t17 + t21;
+    const float t26 = t17 - t21;
+    const float t27 = t20 - t16;
+    const float t28 = t8 + t24;
+    const float t29 = t9 + t25;
+    const float t30 = t8 - t24;
+    const float t31 = t9 - t25;
+    const float t32 = t10 + t26;
+    const float t33 = t11 + t27;
+    const float t34 = t10 - t26;
+    const float t35 = t11 - t27;
+    const float t36 = t18 + t19;
+    const float t37 = 0.707106769f * t36;
+    const float t38 = t19 - t18;
+    const float t39 = 0.707106769f * t38;
+    const float t40 = t22 - t23;
+    const float t41 = 0.707106769f * t40;
+    const float t42 = t22 + t23;
+    const float t43 = 0.707106769f * t42;
+    const float t44 = t37 - t41;
+    const float t45 = t39 - t43;
+    const float t46 = t37 + t41;
+    const float t47 = t39 + t43;
+    const float t48 = t12 + t44;
+    const float t49 = t13 + t45;
+    const float t50 = t12 - t44;
+    const float t51 = t13 - t45;
+    const float t52 = t14 + t47;
+    const float t53 = t15 - t46;
+    const float t54 = t14 - t47;
+    const float t55 = t15 + t46;
+    const float t56 = x2r + x18r;
+    const float t57 = x2i + x18i;
+    const float t58 = x2r - x18r;
+    const float t59 = x2i - x18i;
+    const float t60 = x10r + x26r;
+    const float t61 = x10i + x26i;
+    const float t62 = x10i - x26i;
+    const float t63 = x26r - x10r;
+    const float t64 = t56 + t60;
+    const float t65 = t57 + t61;
+    const float t66 = t56 - t60;
+    const float t67 = t57 - t61;
+    const float t68 = t58 + t62;
+    const float t69 = t59 + t63;
+    const float t70 = t58 - t62;
+    const float t71 = t59 - t63;
+    const float t72 = x6r + x22r;
+    const float t73 = x6i + x22i;
+    const float t74 = x6r - x22r;
+    const float t75 = x6i - x22i;
+    const float t76 = x14r + x30r;
+    const float t77 = x14i + x30i;
+    const float t78 = x14i - x30i;
+    const float t79 = x30r - x14r;
+    const float t80 = t72 + t76;
+    const float t81 = t73 + t77;
+    const float t82 = t72 - t76;
+    const float t83 = t73 - t77;
+    const float t84 = t74 + t78;
+    const float t85 = t75 + t79;
+    const float t86 = t74 - t78;
+    const float t87 = t75 - t79;
+    const float t88 = t64 + t80;
+    const float t89 = t65 + t81;
+    const float t90 = t65 - t81;
+    const float t91 = t80 - t64;
+    const float t92 = t28 + t88;
+    const float t93 = t29 + t89;
+    const float t94 = t28 - t88;
+    const float t95 = t29 - t89;
+    const float t96 = t30 + t90;
+    const float t97 = t31 + t91;
+    const float t98 = t30 - t90;
+    const float t99 = t31 - t91;
+    const float t100 = 0.382683426f * t69;
+    const float t101 = 0.923879504f * t68;
+    const float t102 = t100 + t101;
+    const float t103 = 0.382683426f * t68;
+    const float t104 = 0.923879504f * t69;
+    const float t105 = t104 - t103;
+    const float t106 = 0.923879504f * t85;
+    const float t107 = 0.382683426f * t84;
+    const float t108 = t106 + t107;
+    const float t109 = 0.923879504f * t84;
+    const float t110 = 0.382683426f * t85;
+    const float t111 = t110 - t109;
+    const float t112 = t102 + t108;
+    const float t113 = t105 + t111;
+    const float t114 = t105 - t111;
+    const float t115 = t108 - t102;
+    const float t116 = t48 + t112;
+    const float t117 = t49 + t113;
+    const float t118 = t48 - t112;
+    const float t119 = t49 - t113;
+    const float t120 = t50 + t114;
+    const float t121 = t51 + t115;
+    const float t122 = t50 - t114;
+    const float t123 = t51 - t115;
+    const float t124 = t66 + t67;
+    const float t125 = 0.707106769f * t124;
+    const float t126 = t67 - t66;
+    const float t127 = 0.707106769f * t126;
+    const float t128 = t82 - t83;
+    const float t129 = 0.707106769f * t128;
+    const float t130 = t82 + t83;
+    const float t131 = 0.707106769f * t130;
+    const float t132 = t125 - t129;
+    const float t133 = t127 - t131;
+    const float t134 = t125 + t129;
+    const float t135 = t127 + t131;
+    const float t136 = t32 + t132;
+    const float t137 = t33 + t133;
+    const float t138 = t32 - t132;
+    const float t139 = t33 - t133;
+    const float t140 = t34 + t135;
+    const float t141 = t35 - t134;
+    const float t142 = t34 - t135;
+    const float t143 = t35 + t134;
+    const float t144 = 0.923879504f * t71;
+    const float t145 = 0.382683426f * t70;
+    const float t146 = t144 + t145;
+    const float t147 = 0.923879504f * t70;
+    const float t148 = 0.382683426f * t71;
+    const float t149 = t148 - t147;
+    const float t150 = 0.382683426f * t87;
+    const float t151 = 0.923879504f * t86;
+    const float t152 = t150 + t151;
+    const float t153 = 0.382683426f * t86;
+    const float t154 = 0.923879504f * t87;
+    const float t155 = t153 - t154;
+    const float t156 = t146 - t152;
+    const float t157 = t149 + t155;
+    const float t158 = t146 + t152;
+    const float t159 = t149 - t155;
+    const float t160 = t52 + t156;
+    const float t161 = t53 + t157;
+    const float t162 = t52 - t156;
+    const float t163 = t53 - t157;
+    const float t164 = t54 + t159;
+    const float t165 = t55 - t158;
+    const float t166 = t54 - t159;
+    const float t167 = t55 + t158;
+    const float t168 = x1r + x17r;
+    const float t169 = x1i + x17i;
+    const float t170 = x1r - x17r;
+    const float t171 = x1i - x17i;
+    const float t172 = x9r + x25r;
+    const float t173 = x9i + x25i;
+    const float t174 = x9i - x25i;
+    const float t175 = x25r - x9r;
+    const float t176 = t168 + t172;
+    const float t177 = t169 + t173;
+    const float t178 = t168 - t172;
+    const float t179 = t169 - t173;
+    const float t180 = t170 + t174;
+    const float t181 = t171 + t175;
+    const float t182 = t170 - t174;
+    const float t183 = t171 - t175;
+    const float t184 = x5r + x21r;
+    const float t185 = x5i + x21i;
+    const float t186 = x5r - x21r;
+    const float t187 = x5i - x21i;
+    const float t188 = x13r + x29r;
+    const float t189 = x13i + x29i;
+    const float t190 = x13r - x29r;
+    const float t191 = x13i - x29i;
+    const float t192 = t184 + t188;
+    const float t193 = t185 + t189;
+    const float t194 = t185 - t189;
+    const float t195 = t188 - t184;
+    const float t196 = t176 + t192;
+    const float t197 = t177 + t193;
+    const float t198 = t176 - t192;
+    const float t199 = t177 - t193;
+    const float t200 = t178 + t194;
+    const float t201 = t179 + t195;
+    const float t202 = t178 - t194;
+    const float t203 = t179 - t195;
+    const float t204 = t186 + t187;
+    const float t205 = 0.707106769f * t204;
+    const float t206 = t187 - t186;
+    const float t207 = 0.707106769f * t206;
+    const float t208 = t190 - t191;
+    const float t209 = 0.707106769f * t208;
+    const float t210 = t190 + t191;
+    const float t211 = 0.707106769f * t210;
+    const float t212 = t205 - t209;
+    const float t213 = t207 - t211;
+    const float t214 = t205 + t209;
+    const float t215 = t207 + t211;
+    const float t216 = t180 + t212;
+    const float t217 = t181 + t213;
+    const float t218 = t180 - t212;
+    const float t219 = t181 - t213;
+    const float t220 = t182 + t215;
+    const float t221 = t183 - t214;
+    const float t222 = t182 - t215;
+    const float t223 = t183 + t214;
+    const float t224 = x3r + x19r;
+    const float t225 = x3i + x19i;
+    const float t226 = x3r - x19r;
+    const float t227 = x3i - x19i;
+    const float t228 = x11r + x27r;
+    const float t229 = x11i + x27i;
+    const float t230 = x11i - x27i;
+    const float t231 = x27r - x11r;
+    const float t232 = t224 + t228;
+    const float t233 = t225 + t229;
+    const float t234 = t224 - t228;
+    const float t235 = t225 - t229;
+    const float t236 = t226 + t230;
+    const float t237 = t227 + t231;
+    const float t238 = t226 - t230;
+    const float t239 = t227 - t231;
+    const float t240 = x7r + x23r;
+    const float t241 = x7i + x23i;
+    const float t242 = x7r - x23r;
+    const float t243 = x7i - x23i;
+    const float t244 = x15r + x31r;
+    const float t245 = x15i + x31i;
+    const float t246 = x15r - x31r;
+    const float t247 = x15i - x31i;
+    const float t248 = t240 + t244;
+    const float t249 = t241 + t245;
+    const float t250 = t241 - t245;
+    const float t251 = t244 - t240;
+    const float t252 = t232 + t248;
+    const float t253 = t233 + t249;
+    const float t254 = t232 - t248;
+    const float t255 = t233 - t249;
+    const float t256 = t234 + t250;
+    const float t257 = t235 + t251;
+    const float t258 = t234 - t250;
+    const float t259 = t235 - t251;
+    const float t260 = t242 + t243;
+    const float t261 = 0.707106769f * t260;
+    const float t262 = t243 - t242;
+    const float t263 = 0.707106769f * t262;
+    const float t264 = t246 - t247;
+    const float t265 = 0.707106769f * t264;
+    const float t266 = t246 + t247;
+    const float t267 = 0.707106769f * t266;
+    const float t268 = t261 - t265;
+    const float t269 = t263 - t267;
+    const float t270 = t261 + t265;
+    const float t271 = t263 + t267;
+    const float t272 = t236 + t268;
+    const float t273 = t237 + t269;
+    const float t274 = t236 - t268;
+    const float t275 = t237 - t269;
+    const float t276 = t238 + t271;
+    const float t277 = t239 - t270;
+    const float t278 = t238 - t271;
+    const float t279 = t239 + t270;
+    const float t280 = t196 + t252;
+    const float t281 = t197 + t253;
+    const float t282 = t197 - t253;
+    const float t283 = t252 - t196;
+    const float t284 = t92 + t280;
+    const float t285 = t93 + t281;
+    const float t286 = t92 - t280;
+    const float t287 = t93 - t281;
+    const float t288 = t94 + t282;
+    const float t289 = t95 + t283;
+    const float t290 = t94 - t282;
+    const float t291 = t95 - t283;
+    const float t292 = 0.195090324f * t217;
+    const float t293 = 0.980785251f * t216;
+    const float t294 = t292 + t293;
+    const float t295 = 0.195090324f * t216;
+    const float t296 = 0.980785251f * t217;
+    const float t297 = t296 - t295;
+    const float t298 = 0.555570245f * t273;
+    const float t299 = 0.831469595f * t272;
+    const float t300 = t298 + t299;
+    const float t301 = 0.555570245f * t272;
+    const float t302 = 0.831469595f * t273;
+    const float t303 = t302 - t301;
+    const float t304 = t294 + t300;
+    const float t305 = t297 + t303;
+    const float t306 = t297 - t303;
+    const float t307 = t300 - t294;
+    const float t308 = t116 + t304;
+    const float t309 = t117 + t305;
+    const float t310 = t116 - t304;
+    const float t311 = t117 - t305;
+    const float t312 = t118 + t306;
+    const float t313 = t119 + t307;
+    const float t314 = t118 - t306;
+    const float t315 = t119 - t307;
+    const float t316 = 0.382683426f * t201;
+    const float t317 = 0.923879504f * t200;
+    const float t318 = t316 + t317;
+    const float t319 = 0.382683426f * t200;
+    const float t320 = 0.923879504f * t201;
+    const float t321 = t320 - t319;
+    const float t322 = 0.923879504f * t257;
+    const float t323 = 0.382683426f * t256;
+    const float t324 = t322 + t323;
+    const float t325 = 0.923879504f * t256;
+    const float t326 = 0.382683426f * t257;
+    const float t327 = t326 - t325;
+    const float t328 = t318 + t324;
+    const float t329 = t321 + t327;
+    const float t330 = t321 - t327;
+    const float t331 = t324 - t318;
+    const float t332 = t136 + t328;
+    const float t333 = t137 + t329;
+    const float t334 = t136 - t328;
+    const float t335 = t137 - t329;
+    const float t336 = t138 + t330;
+    const float t337 = t139 + t331;
+    const float t338 = t138 - t330;
+    const float t339 = t139 - t331;
+    const float t340 = 0.555570245f * t221;
+    const float t341 = 0.831469595f * t220;
+    const float t342 = t340 + t341;
+    const float t343 = 0.555570245f * t220;
+    const float t344 = 0.831469595f * t221;
+    const float t345 = t344 - t343;
+    const float t346 = 0.980785251f * t277;
+    const float t347 = 0.195090324f * t276;
+    const float t348 = t346 - t347;
+    const float t349 = 0.980785251f * t276;
+    const float t350 = 0.195090324f * t277;
+    const float t351 = t349 + t350;
+    const float t352 = t342 + t348;
+    const float t353 = t345 - t351;
+    const float t354 = t345 + t351;
+    const float t355 = t348 - t342;
+    const float t356 = t160 + t352;
+    const float t357 = t161 + t353;
+    const float t358 = t160 - t352;
+    const float t359 = t161 - t353;
+    const float t360 = t162 + t354;
+    const float t361 = t163 + t355;
+    const float t362 = t162 - t354;
+    const float t363 = t163 - t355;
+    const float t364 = t198 + t199;
+    const float t365 = 0.707106769f * t364;
+    const float t366 = t199 - t198;
+    const float t367 = 0.707106769f * t366;
+    const float t368 = t254 - t255;
+    const float t369 = 0.707106769f * t368;
+    const float t370 = t254 + t255;
+    const float t371 = 0.707106769f * t370;
+    const float t372 = t365 - t369;
+    const float t373 = t367 - t371;
+    const float t374 = t365 + t369;
+    const float t375 = t367 + t371;
+    const float t376 = t96 + t372;
+    const float t377 = t97 + t373;
+    const float t378 = t96 - t372;
+    const float t379 = t97 - t373;
+    const float t380 = t98 + t375;
+    const float t381 = t99 - t374;
+    const float t382 = t98 - t375;
+    const float t383 = t99 + t374;
+    const float t384 = 0.831469595f * t219;
+    const float t385 = 0.555570245f * t218;
+    const float t386 = t384 + t385;
+    const float t387 = 0.831469595f * t218;
+    const float t388 = 0.555570245f * t219;
+    const float t389 = t388 - t387;
+    const float t390 = 0.195090324f * t275;
+    const float t391 = 0.980785251f * t274;
+    const float t392 = t390 - t391;
+    const float t393 = 0.195090324f * t274;
+    const float t394 = 0.980785251f * t275;
+    const float t395 = t393 + t394;
+    const float t396 = t386 + t392;
+    const float t397 = t389 - t395;
+    const float t398 = t389 + t395;
+    const float t399 = t392 - t386;
+    const float t400 = t120 + t396;
+    const float t401 = t121 + t397;
+    const float t402 = t120 - t396;
+    const float t403 = t121 - t397;
+    const float t404 = t122 + t398;
+    const float t405 = t123 + t399;
+    const float t406 = t122 - t398;
+    const float t407 = t123 - t399;
+    const float t408 = 0.923879504f * t203;
+    const float t409 = 0.382683426f * t202;
+    const float t410 = t408 + t409;
+    const float t411 = 0.923879504f * t202;
+    const float t412 = 0.382683426f * t203;
+    const float t413 = t412 - t411;
+    const float t414 = 0.382683426f * t259;
+    const float t415 = 0.923879504f * t258;
+    const float t416 = t414 + t415;
+    const float t417 = 0.382683426f * t258;
+    const float t418 = 0.923879504f * t259;
+    const float t419 = t417 - t418;
+    const float t420 = t410 - t416;
+    const float t421 = t413 + t419;
+    const float t422 = t410 + t416;
+    const float t423 = t413 - t419;
+    const float t424 = t140 + t420;
+    const float t425 = t141 + t421;
+    const float t426 = t140 - t420;
+    const float t427 = t141 - t421;
+    const float t428 = t142 + t423;
+    const float t429 = t143 - t422;
+    const float t430 = t142 - t423;
+    const float t431 = t143 + t422;
+    const float t432 = 0.980785251f * t223;
+    const float t433 = 0.195090324f * t222;
+    const float t434 = t432 + t433;
+    const float t435 = 0.980785251f * t222;
+    const float t436 = 0.195090324f * t223;
+    const float t437 = t436 - t435;
+    const float t438 = 0.831469595f * t279;
+    const float t439 = 0.555570245f * t278;
+    const float t440 = t438 + t439;
+    const float t441 = 0.831469595f * t278;
+    const float t442 = 0.555570245f * t279;
+    const float t443 = t441 - t442;
+    const float t444 = t434 - t440;
+    const float t445 = t437 + t443;
+    const float t446 = t434 + t440;
+    const float t447 = t437 - t443;
+    const float t448 = t164 + t444;
+    const float t449 = t165 + t445;
+    const float t450 = t164 - t444;
+    const float t451 = t165 - t445;
+    const float t452 = t166 + t447;
+    const float t453 = t167 - t446;
+    const float t454 = t166 - t447;
+    const float t455 = t167 + t446;
+    ro[0] = t284;
+    io[0] = t285;
+    ro[os] = t308;
+    io[os] = t309;
+    ro[2 * os] = t332;
+    io[2 * os] = t333;
+    ro[3 * os] = t356;
+    io[3 * os] = t357;
+    ro[4 * os] = t376;
+    io[4 * os] = t377;
+    ro[5 * os] = t400;
+    io[5 * os] = t401;
+    ro[6 * os] = t424;
+    io[6 * os] = t425;
+    ro[7 * os] = t448;
+    io[7 * os] = t449;
+    ro[8 * os] = t288;
+    io[8 * os] = t289;
+    ro[9 * os] = t312;
+    io[9 * os] = t313;
+    ro[10 * os] = t336;
+    io[10 * os] = t337;
+    ro[11 * os] = t360;
+    io[11 * os] = t361;
+    ro[12 * os] = t380;
+    io[12 * os] = t381;
+    ro[13 * os] = t404;
+    io[13 * os] = t405;
+    ro[14 * os] = t428;
+    io[14 * os] = t429;
+    ro[15 * os] = t452;
+    io[15 * os] = t453;
+    ro[16 * os] = t286;
+    io[16 * os] = t287;
+    ro[17 * os] = t310;
+    io[17 * os] = t311;
+    ro[18 * os] = t334;
+    io[18 * os] = t335;
+    ro[19 * os] = t358;
+    io[19 * os] = t359;
+    ro[20 * os] = t378;
+    io[20 * os] = t379;
+    ro[21 * os] = t402;
+    io[21 * os] = t403;
+    ro[22 * os] = t426;
+    io[22 * os] = t427;
+    ro[23 * os] = t450;
+    io[23 * os] = t451;
+    ro[24 * os] = t290;
+    io[24 * os] = t291;
+    ro[25 * os] = t314;
+    io[25 * os] = t315;
+    ro[26 * os] = t338;
+    io[26 * os] = t339;
+    ro[27 * os] = t362;
+    io[27 * os] = t363;
+    ro[28 * os] = t382;
+    io[28 * os] = t383;
+    ro[29 * os] = t406;
+    io[29 * os] = t407;
+    ro[30 * os] = t430;
+    io[30 * os] = t431;
+    ro[31 * os] = t454;
+    io[31 * os] = t455;
+}
+
+// 64 points: 912 additions, 248 multiplications
+void fftf_codelet_64(const float *ri, const float *ii, float *ro, float *io, long is, long os) {
+    const float x0r = ri[0], x0i = ii[0];
+    const float x1r = ri[is], x1i = ii[is];
+    const float x2r = ri[2 * is], x2i = ii[2 * is];
+    const float x3r = ri[3 * is], x3i = ii[3 * is];
+    const float x4r = ri[4 * is], x4i = ii[4 * is];
+    const float x5r = ri[5 * is], x5i = ii[5 * is];
+    const float x6r = ri[6 * is], x6i = ii[6 * is];
+    const float x7r = ri[7 * is], x7i = ii[7 * is];
+    const float x8r = ri[8 * is], x8i = ii[8 * is];
+    const float x9r = ri[9 * is], x9i = ii[9 * is];
+    const float x10r = ri[10 * is], x10i = ii[10 * is];
+    const float x11r = ri[11 * is], x11i = ii[11 * is];
+    const float x12r = ri[12 * is], x12i = ii[12 * is];
+    const float x13r = ri[13 * is], x13i = ii[13 * is];
+    const float x14r = ri[14 * is], x14i = ii[14 * is];
+    const float x15r = ri[15 * is], x15i = ii[15 * is];
+    const float x16r = ri[16 * is], x16i = ii[16 * is];
+    const float x17r = ri[17 * is], x17i = ii[17 * is];
+    const float x18r = ri[18 * is], x18i = ii[18 * is];
+    const float x19r = ri[19 * is], x19i = ii[19 * is];
+    const float x20r = ri[20 * is], x20i = ii[20 * is];
+    const float x21r = ri[21 * is], x21i = ii[21 * is];
+    const float x22r = ri[22 * is], x22i = ii[22 * is];
+    const float x23r = ri[23 * is], x23i = ii[23 * is];
+    const float x24r = ri[24 * is], x24i = ii[24 * is];
+    const float x25r = ri[25 * is], x25i = ii[25 * is];
+    const float x26r = ri[26 * is], x26i = ii[26 * is];
+    const float x27r = ri[27 * is], x27i = ii[27 * is];
+    const float x28r = ri[28 * is], x28i = ii[28 * is];
+    const float x29r = ri[29 * is], x29i = ii[29 * is];
+    const float x30r = ri[30 * is], x30i = ii[30 * is];
+    const float x31r = ri[31 * is], x31i = ii[31 * is];
+    const float x32r = ri[32 * is], x32i = ii[32 * is];
+    const float x33r = ri[33 * is], x33i = ii[33 * is];
+    const float x34r = ri[34 * is], x34i = ii[34 * is];
+    const float x35r = ri[35 * is], x35i = ii[35 * is];
+    const float x36r = ri[36 * is], x36i = ii[36 * is];
+    const float x37r = ri[37 * is], x37i = ii[37 * is];
+    const float x38r = ri[38 * is], x38i = ii[38 * is];
+    const float x39r = ri[39 * is], x39i = ii[39 * is];
+    const float x40r = ri[40 * is], x40i = ii[40 * is];
+    const float x41r = ri[41 * is], x41i = ii[41 * is];
+    const float x42r = ri[42 * is], x42i = ii[42 * is];
+    const float x43r = ri[43 * is], x43i = ii[43 * is];
+    const float x44r = ri[44 * is], x44i = ii[44 * is];
+    const float x45r = ri[45 * is], x45i = ii[45 * is];
+    const float x46r = ri[46 * is], x46i = ii[46 * is];
+    const float x47r = ri[47 * is], x47i = ii[47 * is];
+    const float x48r = ri[48 * is], x48i = ii[48 * is];
+    const float x49r = ri[49 * is], x49i = ii[49 * is];
+    const float x50r = ri[50 * is], x50i = ii[50 * is];
+    const float x51r = ri[51 * is], x51i = ii[51 * is];
+    const float x52r = ri[52 * is], x52i = ii[52 * is];
+    const float x53r = ri[53 * is], x53i = ii[53 * is];
+    const float x54r = ri[54 * is], x54i = ii[54 * is];
+    const float x55r = ri[55 * is], x55i = ii[55 * is];
+    const float x56r = ri[56 * is], x56i = ii[56 * is];
+    const float x57r = ri[57 * is], x57i = ii[57 * is];
+    const float x58r = ri[58 * is], x58i = ii[58 * is];
+    const float x59r = ri[59 * is], x59i = ii[59 * is];
+    const float x60r = ri[60 * is], x60i = ii[60 * is];
+    const float x61r = ri[61 * is], x61i = ii[61 * is];
+    const float x62r = ri[62 * is], x62i = ii[62 * is];
+    const float x63r = ri[63 * is], x63i = ii[63 * is];
+    const float t0 = x0r + x32r;
+    const float t1 = x0i + x32i;
+    const float t2 = x0r - x32r;
+    const float t3 = x0i - x32i;
+    const float t4 = x16r + x48r;
+    const float t5 = x16i + x48i;
+    const float t6 = x16i - x48i;
+    const float t7 = x48r - x16r;
+    const float t8 = t0 + t4;
+    const float t9 = t1 + t5;
+    const float t10 = t0 - t4;
+    const float t11 = t1 - t5;
+    const float t12 = t2 + t6;
+    const float t13 = t3 + t7;
+    const float t14 = t2 - t6;
+    const float t15 = t3 - t7;
+    const float t16 = x8r + x40r;
+    const float t17 = x8i + x40i;
+    const float t18 = x8r - x40r;
+    const float t19 = x8i - x40i;
+    const float t20 = x24r + x56r;
+    const float t21 = x24i + x56i;
+    const float t22 = x24r - x56r;
+    const float t23 = x24i - x56i;
+    const float t24 = t16 + t20;
+    const float t25 = t17 + t21;
+    const float t26 = t17 - t21;
+    const float t27 = t20 - t16;
+    const float t28 = t8 + t24;
+    const float t29 = t9 + t25;
+    const float t30 = t8 - t24;
+    const float t31 = t9 - t25;
+    const float t32 = t10 + t26;
+    const float t33 = t11 + t27;
+    const float t34 = t10 - t26;
+    const float t35 = t11 - t27;
+    const float t36 = t18 + t19;
+    const float t37 = 0.707106769f * t36;
+    const float t38 = t19 - t18;
+    const float t39 = 0.707106769f * t38;
+    const float t40 = t22 - t23;
+    const float t41 = 0.707106769f * t40;
+    const float t42 = t22 + t23;
+    const float t43 = 0.707106769f * t42;
+    const float t44 = t37 - t41;
+    const float t45 = t39 - t43;
+    const float t46 = t37 + t41;
+    const float t47 = t39 + t43;
+    const float t48 = t12 + t44;
+    const float t49 = t13 + t45;
+    const float t50 = t12 - t44;
+    const float t51 = t13 - t45;
+    const float t52 = t14 + t47;
+    const float t53 = t15 - t46;
+    const float t54 = t14 - t47;
+    const float t55 = t15 + t46;
+    const float t56 = x4r + x36r;
+    const float t57 = x4i + x36i;
+    const float t58 = x4r - x36r;
+    const float t59 = x4i - x36i;
+    const float t60 = x20r + x52r;
+    const float t61 = x20i + x52i;
+    const float t62 = x20i - x52i;
+    const float t63 = x52r - x20r;
+    const float t64 = t56 + t60;
+    const float t65 = t57 + t61;
+    const float t66 = t56 - t60;
+    const float t67 = t57 - t61;
+    const float t68 = t58 + t62;
+    const float t69 = t59 + t63;
+    const float t70 = t58 - t62;
+    const float t71 = t59 - t63;
+    const float t72 = x12r + x44r;
+    const float t73 = x12i + x44i;
+    const float t74 = x12r - x44r;
+    const float t75 = x12i - x44i;
+    const float t76 = x28r + x60r;
+    const float t77 = x28i + x60i;
+    const float t78 = x28i - x60i;
+    const float t79 = x60r - x28r;
+    const float t80 = t72 + t76;
+    const float t81 = t73 + t77;
+    const float t82 = t72 - t76;
+    const float t83 = t73 - t77;
+    const float t84 = t74 + t78;
+    const float t85 = t75 + t79;
+    const float t86 = t74 - t78;
+    const float t87 = t75 - t79;
+    const float t88 = t64 + t80;
+    const float t89 = t65 + t81;
+    const float t90 = t65 - t81;
+    const float t91 = t80 - t64;
+    const float t92 = t28 + t88;
+    const float t93 = t29 + t89;
+    const float t94 = t28 - t88;
+    const float t95 = t29 - t89;
+    const float t96 = t30 + t90;
+    const float t97 = t31 + t91;
+    const float t98 = t30 - t90;
+    const float t99 = t31 - t91;
+    const float t100 = 0.382683426f * t69;
+    const float t101 = 0.923879504f * t68;
+    const float t102 = t100 + t101;
+    const float t103 = 0.382683426f * t68;
+    const float t104 = 0.923879504f * t69;
+    const float t105 = t104 - t103;
+    const float t106 = 0.923879504f * t85;
+    const float t107 = 0.382683426f * t84;
+    const float t108 = t106 + t107;
+    const float t109 = 0.923879504f * t84;
+    const float t110 = 0.382683426f * t85;
+    const float t111 = t110 - t109;
+    const float t112 = t102 + t108;
+    const float t113 = t105 + t111;
+    const float t114 = t105 - t111;
+    const float t115 = t108 - t102;
+    const float t116 = t48 + t112;
+    const float t117 = t49 + t113;
+    const float t118 = t48 - t112;
+    const float t119 = t49 - t113;
+    const float t120 = t50 + t114;
+    const float t121 = t51 + t115;
+    const float t122 = t50 - t114;
+    const float t123 = t51 - t115;
+    const float t124 = t66 + t67;
+    const float t125 = 0.707106769f * t124;
+    const float t126 = t67 - t66;
+    const float t127 = 0.707106769f * t126;
+    const float t128 = t82 - t83;
+    const float t129 = 0.707106769f * t128;
+    const float t130 = t82 + t83;
+    const float t131 = 0.707106769f * t130;
+    const float t132 = t125 - t129;
+    const float t133 = t127 - t131;
+    const float t134 = t125 + t129;
+    const float t135 = t127 + t131;
+    const float t136 = t32 + t132;
+    const float t137 = t33 + t133;
+    const float t138 = t32 - t132;
+    const float t139 = t33 - t133;
+    const float t140 = t34 + t135;
+    const float t141 = t35 - t134;
+    const float t142 = t34 - t135;
+    const float t143 = t35 + t134;
+    const float t144 = 0.923879504f * t71;
+    const float t145 = 0.382683426f * t70;
+    const float t146 = t144 + t145;
+    const float t147 = 0.923879504f * t70;
+    const float t148 = 0.382683426f * t71;
+    const float t149 = t148 - t147;
+    const float t150 = 0.382683426f * t87;
+    const float t151 = 0.923879504f * t86;
+    const float t152 = t150 + t151;
+    const float t153 = 0.382683426f * t86;
+    const float t154 = 0.923879504f * t87;
+    const float t155 = t153 - t154;
+    const float t156 = t146 - t152;
+    const float t157 = t149 + t155;
+    const float t158 = t146 + t152;
+    const float t159 = t149 - t155;
+    const float t160 = t52 + t156;
+    const float t161 = t53 + t157;
+    const float t162 = t52 - t156;
+    const float t163 = t53 - t157;
+    const float t164 = t54 + t159;
+    const float t165 = t55 - t158;
+    const float t166 = t54 - t159;
+    const float t167 = t55 + t158;
+    const float t168 = x2r + x34r;
+    const float t169 = x2i + x34i;
+    const float t170 = x2r - x34r;
+    const float t171 = x2i - x34i;
+    const float t172 = x18r + x50r;
+    const float t173 = x18i + x50i;
+    const float t174 = x18i - x50i;
+    const float t175 = x50r - x18r;
+    const float t176 = t168 + t172;
+    const float t177 = t169 + t173;
+    const float t178 = t168 - t172;
+    const float t179 = t169 - t173;
+    const float t180 = t170 + t174;
+    const float t181 = t171 + t175;
+    const float t182 = t170 - t174;
+    const float t183 = t171 - t175;
+    const float t184 = x10r + x42r;
+    const float t185 = x10i + x42i;
+    const float t186 = x10r - x42r;
+    const float t187 = x10i - x42i;
+    const float t188 = x26r + x58r;
+    const float t189 = x26i + x58i;
+    const float t190 = x26r - x58r;
+    const float t191 = x26i - x58i;
+    const float t192 = t184 + t188;
+    const float t193 = t185 + t189;
+    const float t194 = t185 - t189;
+    const float t195 = t188 - t184;
+    const float t196 = t176 + t192;
+    const float t197 = t177 + t193;
+    const float t198 = t176 - t192;
+    const float t199 = t177 - t193;
+    const float t200 = t178 + t194;
+    const float t201 = t179 + t195;
+    const float t202 = t178 - t194;
+    const float t203 = t179 - t195;
+    const float t204 = t186 + t187;
+    const float t205 = 0.707106769f * t204;
+    const float t206 = t187 - t186;
+    const float t207 = 0.707106769f * t206;
+    const float t208 = t190 - t191;
+    const float t209 = 0.707106769f * t208;
+    const float t210 = t190 + t191;
+    const float t211 = 0.707106769f * t210;
+    const float t212 = t205 - t209;
+    const float t213 = t207 - t211;
+    const float t214 = t205 + t209;
+    const float t215 = t207 + t211;
+    const float t216 = t180 + t212;
+    const float t217 = t181 + t213;
+    const float t218 = t180 - t212;
+    const float t219 = t181 - t213;
+    const float t220 = t182 + t215;
+    const float t221 = t183 - t214;
+    const float t222 = t182 - t215;
+    const float t223 = t183 + t214;
+    const float t224 = x6r + x38r;
+    const float t225 = x6i + x38i;
+    const float t226 = x6r - x38r;
+    const float t227 = x6i - x38i;
+    const float t228 = x22r + x54r;
+    const float t229 = x22i + x54i;
+    const float t230 = x22i - x54i;
+    const float t231 = x54r - x22r;
+    const float t232 = t224 + t228;
+    const float t233 = t225 + t229;
+    const float t234 = t224 - t228;
+    const float t235 = t225 - t229;
+    const float t236 = t226 + t230;
+    const float t237 = t227 + t231;
+    const float t238 = t226 - t230;
+    const float t239 = t227 - t231;
+    const float t240 = x14r + x46r;
+    const float t241 = x14i + x46i;
+    const float t242 = x14r - x46r;
+    const float t243 = x14i - x46i;
+    const float t244 = x30r + x62r;
+    const float t245 = x30i + x62i;
+    const float t246 = x30r - x62r;
+    const float t247 = x30i - x62i;
+    const float t248 = t240 + t244;
+    const float t249 = t241 + t245;
+    const float t250 = t241 - t245;
+    const float t251 = t244 - t240;
+    const float t252 = t232 + t248;
+    const float t253 = t233 + t249;
+    const float t254 = t232 - t248;
+    const float t255 = t233 - t249;
+    const float t256 = t234 + t250;
+    const float t257 = t235 + t251;
+    const float t258 = t234 - t250;
+    const float t259 = t235 - t251;
+    const float t260 = t242 + t243;
+    const float t261 = 0.707106769f * t260;
+    const float t262 = t243 - t242;
+    const float t263 = 0.707106769f * t262;
+    const float t264 = t246 - t247;
+    const float t265 = 0.707106769f * t264;
+    const float t266 = t246 + t247;
+    const float t267 = 0.707106769f * t266;
+    const float t268 = t261 - t265;
+    const float t269 = t263 - t267;
+    const float t270 = t261 + t265;
+    const float t271 = t263 + t267;
+    const float t272 = t236 + t268;
+    const float t273 = t237 + t269;
+    const float t274 = t236 - t268;
+    const float t275 = t237 - t269;
+    const float t276 = t238 + t271;
+    const float t277 = t239 - t270;
+    const float t278 = t238 - t271;
+    const float t279 = t239 + t270;
+    const float t280 = t196 + t252;
+    const float t281 = t197 + t253;
+    const float t282 = t197 - t253;
+    const float t283 = t252 - t196;
+    const float t284 = t92 + t280;
+    const float t285 = t93 + t281;
+    const float t286 = t92 - t280;
+    const float t287 = t93 - t281;
+    const float t288 = t94 + t282;
+    const float t289 = t95 + t283;
+    const float t290 = t94 - t282;
+    const float t291 = t95 - t283;
+    const float t292 = 0.195090324f * t217;
+    const float t293 = 0.980785251f * t216;
+    const float t294 = t292 + t293;
+    const float t295 = 0.195090324f * t216;
+    const float t296 = 0.980785251f * t217;
+    const float t297 = t296 - t295;
+    const float t298 = 0.555570245f * t273;
+    const float t299 = 0.831469595f * t272;
+    const float t300 = t298 + t299;
+    const float t301 = 0.555570245f * t272;
+    const float t302 = 0.831469595f * t273;
+    const float t303 = t302 - t301;
+    const float t304 = t294 + t300;
+    const float t305 = t297 + t303;
+    const float t306 = t297 - t303;
+    const float t307 = t300 - t294;
+    const float t308 = t116 + t304;
+    const float t309 = t117 + t305;
+    const float t310 = t116 - t304;
+    const float t311 = t117 - t305;
+    const float t312 = t118 + t306;
+    const float t313 = t119 + t307;
+    const float t314 = t118 - t306;
+    const float t315 = t119 - t307;
+    const float t316 = 0.382683426f * t201;
+    const float t317 = 0.923879504f * t200;
+    const float t318 = t316 + t317;
+    const float t319 = 0.382683426f * t200;
+    const float t320 = 0.923879504f * t201;
+    const float t321 = t320 - t319;
+    const float t322 = 0.923879504f * t257;
+    const float t323 = 0.382683426f * t256;
+    const float t324 = t322 + t323;
+    const float t325 = 0.923879504f * t256;
+    const float t326 = 0.382683426f * t257;
+    const float t327 = t326 - t325;
+    const float t328 = t318 + t324;
+    const float t329 = t321 + t327;
+    const float t330 = t321 - t327;
+    const float t331 = t324 - t318;
+    const float t332 = t136 + t328;
+    const float t333 = t137 + t329;
+    const float t334 = t136 - t328;
+    const float t335 = t137 - t329;
+    const float t336 = t138 + t330;
+    const float t337 = t139 + t331;
+    const float t338 = t138 - t330;
+    const float t339 = t139 - t331;
+    const float t340 = 0.555570245f * t221;
+    const float t341 = 0.831469595f * t220;
+    const float t342 = t340 + t341;
+    const float t343 = 0.555570245f * t220;
+    const float t344 = 0.831469595f * t221;
+    const float t345 = t344 - t343;
+    const float t346 = 0.980785251f * t277;
+    const float t347 = 0.195090324f * t276;
+    const float t348 = t346 - t347;
+    const float t349 = 0.980785251f * t276;
+    const float t350 = 0.195090324f * t277;
+    const float t351 = t349 + t350;
+    const float t352 = t342 + t348;
+    const float t353 = t345 - t351;
+    const float t354 = t345 + t351;
+    const float t355 = t348 - t342;
+    const float t356 = t160 + t352;
+    const float t357 = t161 + t353;
+    const float t358 = t160 - t352;
+    const float t359 = t161 - t353;
+    const float t360 = t162 + t354;
+    const float t361 = t163 + t355;
+    const float t362 = t162 - t354;
+    const float t363 = t163 - t355;
+    const float t364 = t198 + t199;
+    const float t365 = 0.707106769f * t364;
+    const float t366 = t199 - t198;
+    const float t367 = 0.707106769f * t366;
+    const float t368 = t254 - t255;
+    const float t369 = 0.707106769f * t368;
+    const float t370 = t254 + t255;
+    const float t371 = 0.707106769f * t370;
+    const float t372 = t365 - t369;
+    const float t373 = t367 - t371;
+    const float t374 = t365 + t369;
+    const float t375 = t367 + t371;
+    const float t376 = t96 + t372;
+    const float t377 = t97 + t373;
+    const float t378 = t96 - t372;
+    const float t379 = t97 - t373;
+    const float t380 = t98 + t375;
+    const float t381 = t99 - t374;
+    const float t382 = t98 - t375;
+    const float t383 = t99 + t374;
+    const float t384 = 0.831469595f * t219;
+    const float t385 = 0.555570245f * t218;
+    const float t386 = t384 + t385;
+    const float t387 = 0.831469595f * t218;
+    const float t388 = 0.555570245f * t219;
+    const float t389 = t388 - t387;
+    const float t390 = 0.195090324f * t275;
+    const float t391 = 0.980785251f * t274;
+    const float t392 = t390 - t391;
+    const float t393 = 0.195090324f * t274;
+    const float t394 = 0.980785251f * t275;
+    const float t395 = t393 + t394;
+    const float t396 = t386 + t392;
+    const float t397 = t389 - t395;
+    const float t398 = t389 + t395;
+    const float t399 = t392 - t386;
+    const float t400 = t120 + t396;
+    const float t401 = t121 + t397;
+    const float t402 = t120 - t396;
+    const float t403 = t121 - t397;
+    const float t404 = t122 + t398;
+    const float t405 = t123 + t399;
+    const float t406 = t122 - t398;
+    const float t407 = t123 - t399;
+    const float t408 = 0.923879504f * t203;
+    const float t409 = 0.382683426f * t202;
+    const float t410 = t408 + t409;
+    const float t411 = 0.923879504f * t202;
+    const float t412 = 0.382683426f * t203;
+    const float t413 = t412 - t411;
+    const float t414 = 0.382683426f * t259;
+    const float t415 = 0.923879504f * t258;
+    const float t416 = t414 + t415;
+    const float t417 = 0.382683426f * t258;
+    const float t418 = 0.923879504f * t259;
+    const float t419 = t417 - t418;
+    const float t420 = t410 - t416;
+    const float t421 = t413 + t419;
+    const float t422 = t410 + t416;
+    const float t423 = t413 - t419;
+    const float t424 = t140 + t420;
+    const float t425 = t141 + t421;
+    const float t426 = t140 - t420;
+    const float t427 = t141 - t421;
+    const float t428 = t142 + t423;
+    const float t429 = t143 - t422;
+    const float t430 = t142 - t423;
+    const float t431 = t143 + t422;
+    const float t432 = 0.980785251f * t223;
+    const float t433 = 0.195090324f * t222;
+    const float t434 = t432 + t433;
+    const float t435 = 0.980785251f * t222;
+    const float t436 = 0.195090324f * t223;
+    const float t437 = t436 - t435;
+    const float t438 = 0.831469595f * t279;
+    const float t439 = 0.555570245f * t278;
+    const float t440 = t438 + t439;
+    const float t441 = 0.831469595f * t278;
+    const float t442 = 0.555570245f * t279;
+    const float t443 = t441 - t442;
+    const float t444 = t434 - t440;
+    const float t445 = t437 + t443;
+    const float t446 = t434 + t440;
+    const float t447 = t437 - t443;
+    const float t448 = t164 + t444;
+    const float t449 = t165 + t445;
+    const float t450 = t164 - t444;
+    const float t451 = t165 - t445;
+    const float t452 = t166 + t447;
+    const float t453 = t167 - t446;
+    const float t454 = t166 - t447;
+    const float t455 = t167 + t446;
+    const float t456 = x1r + x33r;
+    const float t457 = x1i + x33i;
+    const float t458 = x1r - x33r;
+    const float t459 = x1i - x33i;
+    const float t460 = x17r + x49r;
+    const float t461 = x17i + x49i;
+    const float t462 = x17i - x49i;
+    const float t463 = x49r - x17r;
+    const float t464 = t456 + t460;
+    const float t465 = t457 + t461;
+    const float t466 = t456 - t460;
+    const float t467 = t457 - t461;
+    const float t468 = t458 + t462;
+    const float t469 = t459 + t463;
+    const float t470 = t458 - t462;
+    const float t471 = t459 - t463;
+    const float t472 = x9r + x41r;
+    const float t473 = x9i + x41i;
+    const float t474 = x9r - x41r;
+    const float t475 = x9i - x41i;
+    const float t476 = x25r + x57r;
+    const float t477 = x25i + x57i;
+    const float t478 = x25r - x57r;
+    const float t479 = x25i - x57i;
+    const float t480 = t472 + t476;
+    const float t481 = t473 + t477;
+    const float t482 = t473 - t477;
+    const float t483 = t476 - t472;
+    const float t484 = t464 + t480;
+    const float t485 = t465 + t481;
+    const float t486 = t464 - t480;
+    const float t487 = t465 - t481;
+    const float t488 = t466 + t482;
+    const float t489 = t467 + t483;
+    const float t490 = t466 - t482;
+    const float t491 = t467 - t483;
+    const float t492 = t474 + t475;
+    const float t493 = 0.707106769f * t492;
+    const float t494 = t475 - t474;
+    const float t495 = 0.707106769f * t494;
+    const float t496 = t478 - t479;
+    const float t497 = 0.707106769f * t496;
+    const float t498 = t478 + t479;
+    const float t499 = 0.707106769f * t498;
+    const float t500 = t493 - t497;
+    const float t501 = t495 - t499;
+    const float t502 = t493 + t497;
+    const float t503 = t495 + t499;
+    const float t504 = t468 + t500;
+    const float t505 = t469 + t501;
+    const float t506 = t468 - t500;
+    const float t507 = t469 - t501;
+    const float t508 = t470 + t503;
+    const float t509 = t471 - t502;
+    const float t510 = t470 - t503;
+    const float t511 = t471 + t502;
+    const float t512 = x5r + x37r;
+    const float t513 = x5i + x37i;
+    const float t514 = x5r - x37r;
+    const float t515 = x5i - x37i;
+    const float t516 = x21r + x53r;
+    const float t517 = x21i + x53i;
+    const float t518 = x21i - x53i;
+    const float t519 = x53r - x21r;
+    const float t520 = t512 + t516;
+    const float t521 = t513 + t517;
+    const float t522 = t512 - t516;
+    const float t523 = t513 - t517;
+    const float t524 = t514 + t518;
+    const float t525 = t515 + t519;
+    const float t526 = t514 - t518;
+    const float t527 = t515 - t519;
+    const float t528 = x13r + x45r;
+    const float t529 = x13i + x45i;
+    const float t530 = x13r - x45r;
+    const float t531 = x13i - x45i;
+    const float t532 = x29r + x61r;
+    const float t533 = x29i + x61i;
+    const float t534 = x29i - x61i;
+    const float t535 = x61r - x29r;
+    const float t536 = t528 + t532;
+    const float t537 = t529 + t533;
+    const float t538 = t528 - t532;
+    const float t539 = t529 - t533;
+    const float t540 = t530 + t534;
+    const float t541 = t531 + t535;
+    const float t542 = t530 - t534;
+    const float t543 = t531 - t535;
+    const float t544 = t520 + t536;
+    const float t545 = t521 + t537;
+    const float t546 = t521 - t537;
+    const float t547 = t536 - t520;
+    const float t548 = t484 + t544;
+    const float t549 = t485 + t545;
+    const float t550 = t484 - t544;
+    const float t551 = t485 - t545;
+    const float t552 = t486 + t546;
+    const float t553 = t487 + t547;
+    const float t554 = t486 - t546;
+    const float t555 = t487 - t547;
+    const float t556 = 0.382683426f * t525;
+    const float t557 = 0.923879504f * t524;
+    const float t558 = t556 + t557;
+    const float t559 = 0.382683426f * t524;
+    const float t560 = 0.923879504f * t525;
+    const float t561 = t560 - t559;
+    const float t562 = 0.923879504f * t541;
+    const float t563 = 0.382683426f * t540;
+    const float t564 = t562 + t563;
+    const float t565 = 0.923879504f * t540;
+    const float t566 = 0.382683426f * t541;
+    const float t567 = t566 - t565;
+    const float t568 = t558 + t564;
+    const float t569 = t561 + t567;
+    const float t570 = t561 - t567;
+    const float t571 = t564 - t558;
+    const float t572 = t504 + t568;
+    const float t573 = t505 + t569;
+    const float t574 = t504 - t568;
+    const float t575 = t505 - t569;
+    const float t576 = t506 + t570;
+    const float t577 = t507 + t571;
+    const float t578 = t506 - t570;
+    const float t579 = t507 - t571;
+    const float t580 = t522 + t523;
+    const float t581 = 0.707106769f * t580;
+    const float t582 = t523 - t522;
+    const float t583 = 0.707106769f * t582;
+    const float t584 = t538 - t539;
+    const float t585 = 0.707106769f * t584;
+    const float t586 = t538 + t539;
+    const float t587 = 0.707106769f * t586;
+    const float t588 = t581 - t585;
+    const float t589 = t583 - t587;
+    const float t590 = t581 + t585;
+    const float t591 = t583 + t587;
+    const float t592 = t488 + t588;
+    const float t593 = t489 + t589;
+    const float t594 = t488 - t588;
+    const float t595 = t489 - t589;
+    const float t596 = t490 + t591;
+    const float t597 = t491 - t590;
+    const float t598 = t490 - t591;
+    const float t599 = t491 + t590;
+    const float t600 = 0.923879504f * t527;
+    const float t601 = 0.382683426f * t526;
+    const float t602 = t600 + t601;
+    const float t603 = 0.923879504f * t526;
+    const float t604 = 0.382683426f * t527;
+    const float t605 = t604 - t603;
+    const float t606 = 0.382683426f * t543;
+    const float t607 = 0.923879504f * t542;
+    const float t608 = t606 + t607;
+    const float t609 = 0.382683426f * t542;
+    const float t610 = 0.923879504f * t543;
+    const float t611 = t609 - t610;
+    const float t612 = t602 - t608;
+    const float t613 = t605 + t611;
+    const float t614 = t602 + t608;
+    const float t615 = t605 - t611;
+    const float t616 = t508 + t612;
+    const float t617 = t509 + t613;
+    const float t618 = t508 - t612;
+    const float t619 = t509 - t613;
+    const float t620 = t510 + t615;
+    const float t621 = t511 - t614;
+    const float t622 = t510 - t615;
+    const float t623 = t511 + t614;
+    const float t624 = x3r + x35r;
+    const float t625 = x3i + x35i;
+    const float t626 = x3r - x35r;
+    const float t627 = x3i - x35i;
+    const float t628 = x19r + x51r;
+    const float t629 = x19i + x51i;
+    const float t630 = x19i - x51i;
+    const float t631 = x51r - x19r;
+    const float t632 = t624 + t628;
+    const float t633 = t625 + t629;
+    const float t634 = t624 - t628;
+    const float t635 = t625 - t629;
+    const float t636 = t626 + t630;
+    const float t637 = t627 + t631;
+    const float t638 = t626 - t630;
+    const float t639 = t627 - t631;
+    const float t640 = x11r + x43r;
+    const float t641 = x11i + x43i;
+    const float t642 = x11r - x43r;
+    const float t643 = x11i - x43i;
+    const float t644 = x27r + x59r;
+    const float t645 = x27i + x59i;
+    const float t646 = x27r - x59r;
+    const float t647 = x27i - x59i;
+    const float t648 = t640 + t644;
+    const float t649 = t641 + t645;
+    const float t650 = t641 - t645;
+    const float t651 = t644 - t640;
+    const float t652 = t632 + t648;
+    const float t653 = t633 + t649;
+    const float t654 = t632 - t648;
+    const float t655 = t633 - t649;
+    const float t656 = t634 + t650;
+    const float t657 = t635 + t651;
+    const float t658 = t634 - t650;
+    const float t659 = t635 - t651;
+    const float t660 = t642 + t643;
+    const float t661 = 0.707106769f * t660;
+    const float t662 = t643 - t642;
+    const float t663 = 0.707106769f * t662;
+    const float t664 = t646 - t647;
+    const float t665 = 0.707106769f * t664;
+    const float t666 = t646 + t647;
+    const float t667 = 0.707106769f * t666;
+    const float t668 = t661 - t665;
+    const float t669 = t663 - t667;
+    const float t670 = t661 + t665;
+    const float t671 = t663 + t667;
+    const float t672 = t636 + t668;
+    const float t673 = t637 + t669;
+    const float t674 = t636 - t668;
+    const float t675 = t637 - t669;
+    const float t676 = t638 + t671;
+    const float t677 = t639 - t670;
+    const float t678 = t638 - t671;
+    const float t679 = t639 + t670;
+    const float t680 = x7r + x39r;
+    const float t681 = x7i + x39i;
+    const float t682 = x7r - x39r;
+    const float t683 = x7i - x39i;
+    const float t684 = x23r + x55r;
+    const float t685 = x23i + x55i;
+    const float t686 = x23i - x55i;
+    const float t687 = x55r - x23r;
+    const float t688 = t680 + t684;
+    const float t689 = t681 + t685;
+    const float t690 = t680 - t684;
+    const float t691 = t681 - t685;
+    const float t692 = t682 + t686;
+    const float t693 = t683 + t687;
+    const float t694 = t682 - t686;
+    const float t695 = t683 - t687;
+    const float t696 = x15r + x47r;
+    const float t697 = x15i + x47i;
+    const float t698 = x15r - x47r;
+    const float t699 = x15i - x47i;
+    const float t700 = x31r + x63r;
+    const float t701 = x31i + x63i;
+    const float t702 = x31i - x63i;
+    const float t703 = x63r - x31r;
+    const float t704 = t696 + t700;
+    const float t705 = t697 + t701;
+    const float t706 = t696 - t700;
+    const float t707 = t697 - t701;
+    const float t708 = t698 + t702;
+    const float t709 = t699 + t703;
+    const float t710 = t698 - t702;
+    const float t711 = t699 - t703;
+    const float t712 = t688 + t704;
+    const float t713 = t689 + t705;
+    const float t714 = t689 - t705;
+    const float t715 = t704 - t688;
+    const float t716 = t652 + t712;
+    const float t717 = t653 + t713;
+    const float t718 = t652 - t712;
+    const float t719 = t653 - t713;
+    const float t720 = t654 + t714;
+    const float t721 = t655 + t715;
+    const float t722 = t654 - t714;
+    const float t723 = t655 - t715;
+    const float t724 = 0.382683426f * t693;
+    const float t725 = 0.923879504f * t692;
+    const float t726 = t724 + t725;
+    const float t727 = 0.382683426f * t692;
+    const float t728 = 0.923879504f * t693;
+    const float t729 = t728 - t727;
+    const float t730 = 0.923879504f * t709;
+    const float t731 = 0.382683426f * t708;
+    const float t732 = t730 + t731;
+    const float t733 = 0.923879504f * t708;
+    const float t734 = 0.382683426f * t709;
+    const float t735 = t734 - t733;
+    const float t736 = t726 + t732;
+    const float t737 = t729 + t735;
+    const float t738 = t729 - t735;
+    const float t739 = t732 - t726;
+    const float t740 = t672 + t736;
+    const float t741 = t673 + t737;
+    const float t742 = t672 - t736;
+    const float t743 = t673 - t737;
+    const float t744 = t674 + t738;
+    const float t745 = t675 + t739;
+    const float t746 = t674 - t738;
+    const float t747 = t675 - t739;
+    const float t748 = t690 + t691;
+    const float t749 = 0.707106769f * t748;
+    const float t750 = t691 - t690;
+    const float t751 = 0.707106769f * t750;
+    const float t752 = t706 - t707;
+    const float t753 = 0.707106769f * t752;
+    const float t754 = t706 + t707;
+    const float t755 = 0.707106769f * t754;
+    const float t756 = t749 - t753;
+    const float t757 = t751 - t755;
+    const float t758 = t749 + t753;
+    const float t759 = t751 + t755;
+    const float t760 = t656 + t756;
+    const float t761 = t657 + t757;
+    const float t762 = t656 - t756;
+    const float t763 = t657 - t757;
+    const float t764 = t658 + t759;
+    const float t765 = t659 - t758;
+    const float t766 = t658 - t759;
+    const float t767 = t659 + t758;
+    const float t768 = 0.923879504f * t695;
+    const float t769 = 0.382683426f * t694;
+    const float t770 = t768 + t769;
+    const float t771 = 0.923879504f * t694;
+    const float t772 = 0.382683426f * t695;
+    const float t773 = t772 - t771;
+    const float t774 = 0.382683426f * t711;
+    const float t775 = 0.923879504f * t710;
+    const float t776 = t774 + t775;
+    const float t777 = 0.382683426f * t710;
+    const float t778 = 0.923879504f * t711;
+    const float t779 = t777 - t778;
+    const float t780 = t770 - t776;
+    const float t781 = t773 + t779;
+    const float t782 = t770 + t776;
+    const float t783 = t773 - t779;
+    const float t784 = t676 + t780;
+    const float t785 = t677 + t781;
+    const float t786 = t676 - t780;
+    const float t787 = t677 - t781;
+    const float t788 = t678 + t783;
+    const float t789 = t679 - t782;
+    const float t790 = t678 - t783;
+    const float t791 = t679 + t782;
+    const float t792 = t548 + t716;
+    const float t793 = t549 + t717;
+    const float t794 = t549 - t717;
+    const float t795 = t716 - t548;
+    const float t796 = t284 + t792;
+    const float t797 = t285 + t793;
+    const float t798 = t284 - t792;
+    const float t799 = t285 - t793;
+    const float t800 = t286 + t794;
+    const float t801 = t287 + t795;
+    const float t802 = t286 - t794;
+    const float t803 = t287 - t795;
+    const float t804 = 0.0980171412f * t573;
+    const float t805 = 0.99518472f * t572;
+    const float t806 = t804 + t805;
+    const float t807 = 0.0980171412f * t572;
+    const float t808 = 0.99518472f * t573;
+    const float t809 = t808 - t807;
+    const float t810 = 0.290284663f * t741;
+    const float t811 = 0.956940353f * t740;
+    const float t812 = t810 + t811;
+    const float t813 = 0.290284663f * t740;
+    const float t814 = 0.956940353f * t741;
+    const float t815 = t814 - t813;
+    const float t816 = t806 + t812;
+    const float t817 = t809 + t815;
+    const float t818 = t809 - t815;
+    const float t819 = t812 - t806;
+    const float t820 = t308 + t816;
+    const float t821 = t309 + t817;
+    const float t822 = t308 - t816;
+    const float t823 = t309 - t817;
+    const float t824 = t310 + t818;
+    const float t825 = t311 + t819;
+    const float t826 = t310 - t818;
+    const float t827 = t311 - t819;
+    const float t828 = 0.195090324f * t593;
+    const float t829 = 0.980785251f * t592;
+    const float t830 = t828 + t829;
+    const float t831 = 0.195090324f * t592;
+    const float t832 = 0.980785251f * t593;
+    const float t833 = t832 - t831;
+    const float t834 = 0.555570245f * t761;
+    const float t835 = 0.831469595f * t760;
+    const float t836 = t834 + t835;
+    const float t837 = 0.555570245f * t760;
+    const float t838 = 0.831469595f * t761;
+    const float t839 = t838 - t837;
+    const float t840 = t830 + t836;
+    const float t841 = t833 + t839;
+    const float t842 = t833 - t839;
+    const float t843 = t836 - t830;
+    const float t844 = t332 + t840;
+    const float t845 = t333 + t841;
+    const float t846 = t332 - t840;
+    const float t847 = t333 - t841;
+    const float t848 = t334 + t842;
+    const float t849 = t335 + t843;
+    const float t850 = t334 - t842;
+    const float t851 = t335 - t843;
+    const float t852 = 0.290284663f * t617;
+    const float t853 = 0.956940353f * t616;
+    const float t854 = t852 + t853;
+    const float t855 = 0.290284663f * t616;
+    const float t856 = 0.956940353f * t617;
+    const float t857 = t856 - t855;
+    const float t858 = 0.773010433f * t785;
+    const float t859 = 0.634393275f * t784;
+    const float t860 = t858 + t859;
+    const float t861 = 0.773010433f * t784;
+    const float t862 = 0.634393275f * t785;
+    const float t863 = t862 - t861;
+    const float t864 = t854 + t860;
+    const float t865 = t857 + t863;
+    const float t866 = t857 - t863;
+    const float t867 = t860 - t854;
+    const float t868 = t356 + t864;
+    const float t869 = t357 + t865;
+    const float t870 = t356 - t864;
+    const float t871 = t357 - t865;
+    const float t872 = t358 + t866;
+    const float t873 = t359 + t867;
+    const float t874 = t358 - t866;
+    const float t875 = t359 - t867;
+    const float t876 = 0.382683426f * t553;
+    const float t877 = 0.923879504f * t552;
+    const float t878 = t876 + t877;
+    const float t879 = 0.382683426f * t552;
+    const float t880 = 0.923879504f * t553;
+    const float t881 = t880 - t879;
+    const float t882 = 0.923879504f * t721;
+    const float t883 = 0.382683426f * t720;
+    const float t884 = t882 + t883;
+    const float t885 = 0.923879504f * t720;
+    const float t886 = 0.382683426f * t721;
+    const float t887 = t886 - t885;
+    const float t888 = t878 + t884;
+    const float t889 = t881 + t887;
+    const float t890 = t881 - t887;
+    const float t891 = t884 - t878;
+    const float t892 = t376 + t888;
+    const float t893 = t377 + t889;
+    const float t894 = t376 - t888;
+    const float t895 = t377 - t889;
+    const float t896 = t378 + t890;
+    const float t897 = t379 + t891;
+    const float t898 = t378 - t890;
+    const float t899 = t379 - t891;
+    const float t900 = 0.471396744f * t577;
+    const float t901 = 0.881921291f * t576;
+    const float t902 = t900 + t901;
+    const float t903 = 0.471396744f * t576;
+    const float t904 = 0.881921291f * t577;
+    const float t905 = t904 - t903;
+    const float t906 = 0.99518472f * t745;
+    const float t907 = 0.0980171412f * t744;
+    const float t908 = t906 + t907;
+    const float t909 = 0.99518472f * t744;
+    const float t910 = 0.0980171412f * t745;
+    const float t911 = t910 - t909;
+    const float t912 = t902 + t908;
+    const float t913 = t905 + t911;
+    const float t914 = t905 - t911;
+    const float t915 = t908 - t902;
+    const float t916 = t400 + t912;
+    const float t917 = t401 + t913;
+    const float t918 = t400 - t912;
+    const float t919 = t401 - t913;
+    const float t920 = t402 + t914;
+    const float t921 = t403 + t915;
+    const float t922 = t402 - t914;
+    const float t923 = t403 - t915;
+    const float t924 = 0.555570245f * t597;
+    const float t925 = 0.831469595f * t596;
+    const float t926 = t924 + t925;
+    const float t927 = 0.555570245f * t596;
+    const float t928 = 0.831469595f * t597;
+    const float t929 = t928 - t927;
+    const float t930 = 0.980785251f * t765;
+    const float t931 = 0.195090324f * t764;
+    const float t932 = t930 - t931;
+    const float t933 = 0.980785251f * t764;
+    const float t934 = 0.195090324f * t765;
+    const float t935 = t933 + t934;
+    const float t936 = t926 + t932;
+    const float t937 = t929 - t935;
+    const float t938 = t929 + t935;
+    const float t939 = t932 - t926;
+    const float t940 = t424 + t936;
+    const float t941 = t425 + t937;
+    const float t942 = t424 - t936;
+    const float t943 = t425 - t937;
+    const float t944 = t426 + t938;
+    const float t945 = t427 + t939;
+    const float t946 = t426 - t938;
+    const float t947 = t427 - t939;
+    const float t948 = 0.634393275f * t621;
+    const float t949 = 0.773010433f * t620;
+    const float t950 = t948 + t949;
+    const float t951 = 0.634393275f * t620;
+    const float t952 = 0.773010433f * t621;
+    const float t953 = t952 - t951;
+    const float t954 = 0.881921291f * t789;
+    const float t955 = 0.471396744f * t788;
+    const float t956 = t954 - t955;
+    const float t957 = 0.881921291f * t788;
+    const float t958 = 0.471396744f * t789;
+    const float t959 = t957 + t958;
+    const float t960 = t950 + t956;
+    const float t961 = t953 - t959;
+    const float t962 = t953 + t959;
+    const float t963 = t956 - t950;
+    const float t964 = t448 + t960;
+    const float t965 = t449 + t961;
+    const float t966 = t448 - t960;
+    const float t967 = t449 - t961;
+    const float t968 = t450 + t962;
+    const float t969 = t451 + t963;
+    const float t970 = t450 - t962;
+    const float t971 = t451 - t963;
+    const float t972 = t550 + t551;
+    const float t973 = 0.707106769f * t972;
+    const float t974 = t551 - t550;
+    const float t975 = 0.707106769f * t974;
+    const float t976 = t718 - t719;
+    const float t977 = 0.707106769f * t976;
+    const float t978 = t718 + t719;
+    const float t979 = 0.707106769f * t978;
+    const float t980 = t973 - t977;
+    const float t981 = t975 - t979;
+    const float t982 = t973 + t977;
+    const float t983 = t975 + t979;
+    const float t984 = t288 + t980;
+    const float t985 = t289 + t981;
+    const float t986 = t288 - t980;
+    const float t987 = t289 - t981;
+    const float t988 = t290 + t983;
+    const float t989 = t291 - t982;
+    const float t990 = t290 - t983;
+    const float t991 = t291 + t982;
+    const float t992 = 0.773010433f * t575;
+    const float t993 = 0.634393275f * t574;
+    const float t994 = t992 + t993;
+    const float t995 = 0.773010433f * t574;
+    const float t996 = 0.634393275f * t575;
+    const float t997 = t996 - t995;
+    const float t998 = 0.471396744f * t743;
+    const float t999 = 0.881921291f * t742;
+    const float t1000 = t998 - t999;
+    const float t1001 = 0.471396744f * t742;
+    const float t1002 = 0.881921291f * t743;
+    const float t1003 = t1001 + t1002;
+    const float t1004 = t994 + t1000;
+    const float t1005 = t997 - t1003;
+    const float t1006 = t997 + t1003;
+    const float t1007 = t1000 - t994;
+    const float t1008 = t312 + t1004;
+    const float t1009 = t313 + t1005;
+    const float t1010 = t312 - t1004;
+    const float t1011 = t313 - t1005;
+    const float t1012 = t314 + t1006;
+    const float t1013 = t315 + t1007;
+    const float t1014 = t314 - t1006;
+    const float t1015 = t315 - t1007;
+    const float t1016 = 0.831469595f * t595;
+    const float t1017 = 0.555570245f * t594;
+    const float t1018 = t1016 + t1017;
+    const float t1019 = 0.831469595f * t594;
+    const float t1020 = 0.555570245f * t595;
+    const float t1021 = t1020 - t1019;
+    const float t1022 = 0.195090324f * t763;
+    const float t1023 = 0.980785251f * t762;
+    const float t1024 = t1022 - t1023;
+    const float t1025 = 0.195090324f * t762;
+    const float t1026 = 0.980785251f * t763;
+    const float t1027 = t1025 + t1026;
+    const float t1028 = t1018 + t1024;
+    const float t1029 = t1021 - t1027;
+    const float t1030 = t1021 + t1027;
+    const float t1031 = t1024 - t1018;
+    const float t1032 = t336 + t1028;
+    const float t1033 = t337 + t1029;
+    const float t1034 = t336 - t1028;
+    const float t1035 = t337 - t1029;
+    const float t1036 = t338 + t1030;
+    const float t1037 = t339 + t1031;
+    const float t1038 = t338 - t1030;
+    const float t1039 = t339 - t1031;
+    const float t1040 = 0.881921291f * t619;
+    const float t1041 = 0.471396744f * t618;
+    const float t1042 = t1040 + t1041;
+    const float t1043 = 0.881921291f * t618;
+    const float t1044 = 0.471396744f * t619;
+    const float t1045 = t1044 - t1043;
+    const float t1046 = 0.0980171412f * t787;
+    const float t1047 = 0.99518472f * t786;
+    const float t1048 = t1046 + t1047;
+    const float t1049 = 0.0980171412f * t786;
+    const float t1050 = 0.99518472f * t787;
+    const float t1051 = t1049 - t1050;
+    const float t1052 = t1042 - t1048;
+    const float t1053 = t1045 + t1051;
+    const float t1054 = t1042 + t1048;
+    const float t1055 = t1045 - t1051;
+    const float t1056 = t360 + t1052;
+    const float t1057 = t361 + t1053;
+    const float t1058 = t360 - t1052;
+    const float t1059 = t361 - t1053;
+    const float t1060 = t362 + t1055;
+    const float t1061 = t363 - t1054;
+    const float t1062 = t362 - t1055;
+    const float t1063 = t363 + t1054;
+    const float t1064 = 0.923879504f * t555;
+    const float t1065 = 0.382683426f * t554;
+    const float t1066 = t1064 + t1065;
+    const float t1067 = 0.923879504f * t554;
+    const float t1068 = 0.382683426f * t555;
+    const float t1069 = t1068 - t1067;
+    const float t1070 = 0.382683426f * t723;
+    const float t1071 = 0.923879504f * t722;
+    const float t1072 = t1070 + t1071;
+    const float t1073 = 0.382683426f * t722;
+    const float t1074 = 0.923879504f * t723;
+    const float t1075 = t1073 - t1074;
+    const float t1076 = t1066 - t1072;
+    const float t1077 = t1069 + t1075;
+    const float t1078 = t1066 + t1072;
+    const float t1079 = t1069 - t1075;
+    const float t1080 = t380 + t1076;
+    const float t1081 = t381 + t1077;
+    const float t1082 = t380 - t1076;
+    const float t1083 = t381 - t1077;
+    const float t1084 = t382 + t1079;
+    const float t1085 = t383 - t1078;
+    const float t1086 = t382 - t1079;
+    const float t1087 = t383 + t1078;
+    const float t1088 = 0.956940353f * t579;
+    const float t1089 = 0.290284663f * t578;
+    const float t1090 = t1088 + t1089;
+    const float t1091 = 0.956940353f * t578;
+    const float t1092 = 0.290284663f * t579;
+    const float t1093 = t1092 - t1091;
+    const float t1094 = 0.634393275f * t747;
+    const float t1095 = 0.773010433f * t746;
+    const float t1096 = t1094 + t1095;
+    const float t1097 = 0.634393275f * t746;
+    const float t1098 = 0.773010433f * t747;
+    const float t1099 = t1097 - t1098;
+    const float t1100 = t1090 - t1096;
+    const float t1101 = t1093 + t1099;
+    const float t1102 = t1090 + t1096;
+    const float t1103 = t1093 - t1099;
+    const float t1104 = t404 + t1100;
+    const float t1105 = t405 + t1101;
+    const float t1106 = t404 - t1100;
+    const float t1107 = t405 - t1101;
+    const float t1108 = t406 + t1103;
+    const float t1109 = t407 - t1102;
+    const float t1110 = t406 - t1103;
+    const float t1111 = t407 + t1102;
+    const float t1112 = 0.980785251f * t599;
+    const float t1113 = 0.195090324f * t598;
+    const float t1114 = t1112 + t1113;
+    const float t1115 = 0.980785251f * t598;
+    const float t1116 = 0.195090324f * t599;
+    const float t1117 = t1116 - t1115;
+    const float t1118 = 0.831469595f * t767;
+    const float t1119 = 0.555570245f * t766;
+    const float t1120 = t1118 + t1119;
+    const float t1121 = 0.831469595f * t766;
+    const float t1122 = 0.555570245f * t767;
+    const float t1123 = t1121 - t1122;
+    const float t1124 = t1114 - t1120;
+    const float t1125 = t1117 + t1123;
+    const float t1126 = t1114 + t1120;
+    const float t1127 = t1117 - t1123;
+    const float t1128 = t428 + t1124;
+    const float t1129 = t429 + t1125;
+    const float t1130 = t428 - t1124;
+    const float t1131 = t429 - t1125;
+    const float t1132 = t430 + t1127;
+    const float t1133 = t431 - t1126;
+    const float t1134 = t430 - t1127;
+    const float t1135 = t431 + t1126;
+    const float t1136 = 0.99518472f * t623;
+    const float t1137 = 0.0980171412f * t622;
+    const float t1138 = t1136 + t1137;
+    const float t1139 = 0.99518472f * t622;
+    const float t1140 = 0.0980171412f * t623;
+    const float t1141 = t1140 - t1139;
+    const float t1142 = 0.956940353f * t791;
+    const float t1143 = 0.290284663f * t790;
+    const float t1144 = t1142 + t1143;
+    const float t1145 = 0.956940353f * t790;
+    const float t1146 = 0.290284663f * t791;
+    const float t1147 = t1145 - t1146;
+    const float t1148 = t1138 - t1144;
+    const float t1149 = t1141 + t1147;
+    const float t1150 = t1138 + t1144;
+    const float t1151 = t1141 - t1147;
+    const float t1152 = t452 + t1148;
+    const float t1153 = t453 + t1149;
+    const float t1154 = t452 - t1148;
+    const float t1155 = t453 - t1149;
+    const float t1156 = t454 + t1151;
+    const float t1157 = t455 - t1150;
+    const float t1158 = t454 - t1151;
+    const float t1159 = t455 + t1150;
+    ro[0] = t796;
+    io[0] = t797;
+    ro[os] = t820;
+    io[os] = t821;
+    ro[2 * os] = t844;
+    io[2 * os] = t845;
+    ro[3 * os] = t868;
+    io[3 * os] = t869;
+    ro[4 * os] = t892;
+    io[4 * os] = t893;
+    ro[5 * os] = t916;
+    io[5 * os] = t917;
+    ro[6 * os] = t940;
+    io[6 * os] = t941;
+    ro[7 * os] = t964;
+    io[7 * os] = t965;
+    ro[8 * os] = t984;
+    io[8 * os] = t985;
+    ro[9 * os] = t1008;
+    io[9 * os] = t1009;
+    ro[10 * os] = t1032;
+    io[10 * os] = t1033;
+    ro[11 * os] = t1056;
+    io[11 * os] = t1057;
+    ro[12 * os] = t1080;
+    io[12 * os] = t1081;
+    ro[13 * os] = t1104;
+    io[13 * os] = t1105;
+    ro[14 * os] = t1128;
+    io[14 * os] = t1129;
+    ro[15 * os] = t1152;
+    io[15 * os] = t1153;
+    ro[16 * os] = t800;
+    io[16 * os] = t801;
+    ro[17 * os] = t824;
+    io[17 * os] = t825;
+    ro[18 * os] = t848;
+    io[18 * os] = t849;
+    ro[19 * os] = t872;
+    io[19 * os] = t873;
+    ro[20 * os] = t896;
+    io[20 * os] = t897;
+    ro[21 * os] = t920;
+    io[21 * os] = t921;
+    ro[22 * os] = t944;
+    io[22 * os] = t945;
+    ro[23 * os] = t968;
+    io[23 * os] = t969;
+    ro[24 * os] = t988;
+    io[24 * os] = t989;
+    ro[25 * os] = t1012;
+    io[25 * os] = t1013;
+    ro[26 * os] = t1036;
+    io[26 * os] = t1037;
+    ro[27 * os] = t1060;
+    io[27 * os] = t1061;
+    ro[28 * os] = t1084;
+    io[28 * os] = t1085;
+    ro[29 * os] = t1108;
+    io[29 * os] = t1109;
+    ro[30 * os] = t1132;
+    io[30 * os] = t1133;
+    ro[31 * os] = t1156;
+    io[31 * os] = t1157;
+    ro[32 * os] = t798;
+    io[32 * os] = t799;
+    ro[33 * os] = t822;
+    io[33 * os] = t823;
+    ro[34 * os] = t846;
+    io[34 * os] = t847;
+    ro[35 * os] = t870;
+    io[35 * os] = t871;
+    ro[36 * os] = t894;
+    io[36 * os] = t895;
+    ro[37 * os] = t918;
+    io[37 * os] = t919;
+    ro[38 * os] = t942;
+    io[38 * os] = t943;
+    ro[39 * os] = t966;
+    io[39 * os] = t967;
+    ro[40 * os] = t986;
+    io[40 * os] = t987;
+    ro[41 * os] = t1010;
+    io[41 * os] = t1011;
+    ro[42 * os] = t1034;
+    io[42 * os] = t1035;
+    ro[43 * os] = t1058;
+    io[43 * os] = t1059;
+    ro[44 * os] = t1082;
+    io[44 * os] = t1083;
+    ro[45 * os] = t1106;
+    io[45 * os] = t1107;
+    ro[46 * os] = t1130;
+    io[46 * os] = t1131;
+    ro[47 * os] = t1154;
+    io[47 * os] = t1155;
+    ro[48 * os] = t802;
+    io[48 * os] = t803;
+    ro[49 * os] = t826;
+    io[49 * os] = t827;
+    ro[50 * os] = t850;
+    io[50 * os] = t851;
+    ro[51 * os] = t874;
+    io[51 * os] = t875;
+    ro[52 * os] = t898;
+    io[52 * os] = t899;
+    ro[53 * os] = t922;
+    io[53 * os] = t923;
+    ro[54 * os] = t946;
+    io[54 * os] = t947;
+    ro[55 * os] = t970;
+    io[55 * os] = t971;
+    ro[56 * os] = t990;
+    io[56 * os] = t991;
+    ro[57 * os] = t1014;
+    io[57 * os] = t1015;
+    ro[58 * os] = t1038;
+    io[58 * os] = t1039;
+    ro[59 * os] = t1062;
+    io[59 * os] = t1063;
+    ro[60 * os] = t1086;
+    io[60 * os] = t1087;
+    ro[61 * os] = t1110;
+    io[61 * os] = t1111;
+    ro[62 * os] = t1134;
+    io[62 * os] = t1135;
+    ro[63 * os] = t1158;
+    io[63 * os] = t1159;
+}
+
+fftf_codelet fftf_codelet_find(int n) {
+    switch(n) {
+        case 2: return fftf_codelet_2;
+        case 3: return fftf_codelet_3;
+        case 4: return fftf_codelet_4;
+        case 5: return fftf_codelet_5;
+        case 6: return fftf_codelet_6;
+        case 7: return fftf_codelet_7;
+        case 8: return fftf_codelet_8;
+        case 16: return fftf_codelet_16;
+        case 32: return fftf_codelet_32;
+        case 64: return fftf_codelet_64;
+        default: return 0;
+    }
+}
+
+// 2 points: 4 additions, 0 multiplications
+void fftl_codelet_2(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os) {
+    const long double x0r = ri[0], x0i = ii[0];
+    const long double x1r = ri[is], x1i = ii[is];
+    const long double t0 = x0r + x1r;
+    const long double t1 = x0i + x1i;
+    const long double t2 = x0r - x1r;
+    const long double t3 = x0i - x1i;
+    ro[0] = t0;
+    io[0] = t1;
+    ro[os] = t2;
+    io[os] = t3;
+}
+
+// 3 points: 12 additions, 4 multiplications
+void fftl_codelet_3(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os) {
+    const long double x0r = ri[0], x0i = ii[0];
+    const long double x1r = ri[is], x1i = ii[is];
+    const long double x2r = ri[2 * is], x2i = ii[2 * is];
+    const long double t0 = x1r + x2r;
+    const long double t1 = x1i + x2i;
+    const long double t2 = x1r - x2r;
+    const long double t3 = x1i - x2i;
+    const long double t4 = x0r + t0;
+    const long double t5 = x0i + t1;
+    const long double t6 = 0.5L * t0;
+    const long double t7 = 0.5L * t1;
+    const long double t8 = 0.866025403784438646787L * t2;
+    const long double t9 = 0.866025403784438646787L * t3;
+    const long double t10 = x0r - t6;
+    const long double t11 = x0i - t7;
+    const long double t12 = t9 + t10;
+    const long double t13 = t11 - t8;
+    const long double t14 = t10 - t9;
+    const long double t15 = t8 + t11;
+    ro[0] = t4;
+    io[0] = t5;
+    ro[os] = t12;
+    io[os] = t13;
+    ro[2 * os] = t14;
+    io[2 * os] = t15;
+}
+
+// 4 points: 16 additions, 0 multiplications
+void fftl_codelet_4(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os) {
+    const long double x0r = ri[0], x0i = ii[0];
+    const long double x1r = ri[is], x1i = ii[is];
+    const long double x2r = ri[2 * is], x2i = ii[2 * is];
+    const long double x3r = ri[3 * is], x3i = ii[3 * is];
+    const long double t0 = x0r + x2r;
+    const long double t1 = x0i + x2i;
+    const long double t2 = x0r - x2r;
+    const long double t3 = x0i - x2i;
+    const long double t4 = x1r + x3r;
+    const long double t5 = x1i + x3i;
+    const long double t6 = x1i - x3i;
+    const long double t7 = x3r - x1r;
+    const long double t8 = t0 + t4;
+    const long double t9 = t1 + t5;
+    const long double t10 = t0 - t4;
+    const long double t11 = t1 - t5;
+    const long double t12 = t2 + t6;
+    const long double t13 = t3 + t7;
+    const long double t14 = t2 - t6;
+    const long double t15 = t3 - t7;
+    ro[0] = t8;
+    io[0] = t9;
+    ro[os] = t12;
+    io[os] = t13;
+    ro[2 * os] = t10;
+    io[2 * os] = t11;
+    ro[3 * os] = t14;
+    io[3 * os] = t15;
+}
+
+// 5 points: 32 additions, 16 multiplications
+void fftl_codelet_5(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os) {
+    const long double x0r = ri[0], x0i = ii[0];
+    const long double x1r = ri[is], x1i = ii[is];
+    const long double x2r = ri[2 * is], x2i = ii[2 * is];
+    const long double x3r = ri[3 * is], x3i = ii[3 * is];
+    const long double x4r = ri[4 * is], x4i = ii[4 * is];
+    const long double t0 = x1r + x4r;
+    const long double t1 = x1i + x4i;
+    const long double t2 = x1r - x4r;
+    const long double t3 = x1i - x4i;
+    const long double t4 = x2r + x3r;
+    const long double t5 = x2i + x3i;
+    const long double t6 = x2r - x3r;
+    const long double t7 = x2i - x3i;
+    const long double t8 = x0r + t0;
+    const long double t9 = x0i + t1;
+    const long double t10 = t4 + t8;
+    const long double t11 = t5 + t9;
+    const long double t12 = 0.309016994374947424076L * t0;
+    const long double t13 = 0.309016994374947424076L * t1;
+    const long double t14 = 0.951056516295153572111L * t2;
+    const long double t15 = 0.951056516295153572111L * t3;
+    const long double t16 = x0r + t12;
+    const long double t17 = x0i + t13;
+    const long double t18 = 0.809016994374947424104L * t4;
+    const long double t19 = 0.809016994374947424104L * t5;
+    const long double t20 = 0.587785252292473129135L * t6;
+    const long double t21 = 0.587785252292473129135L * t7;
+    const long double t22 = t16 - t18;
+    const long double t23 = t17 - t19;
+    const long double t24 = t14 + t20;
+    const long double t25 = t15 + t21;
+    const long double t26 = t22 + t25;
+    const long double t27 = t23 - t24;
+    const long double t28 = t22 - t25;
+    const long double t29 = t23 + t24;
+    const long double t30 = 0.809016994374947424104L * t0;
+    const long double t31 = 0.809016994374947424104L * t1;
+    const long double t32 = 0.587785252292473129135L * t2;
+    const long double t33 = 0.587785252292473129135L * t3;
+    const long double t34 = x0r - t30;
+    const long double t35 = x0i - t31;
+    const long double t36 = 0.309016994374947424185L * t4;
+    const long double t37 = 0.309016994374947424185L * t5;
+    const long double t38 = 0.951056516295153572111L * t6;
+    const long double t39 = 0.951056516295153572111L * t7;
+    const long double t40 = t34 + t36;
+    const long double t41 = t35 + t37;
+    const long double t42 = t33 - t39;
+    const long double t43 = t38 - t32;
+    const long double t44 = t40 + t42;
+    const long double t45 = t41 + t43;
+    const long double t46 = t40 - t42;
+    const long double t47 = t41 - t43;
+    ro[0] = t10;
+    io[0] = t11;
+    ro[os] = t26;
+    io[os] = t27;
+    ro[2 * os] = t44;
+    io[2 * os] = t45;
+    ro[3 * os] = t46;
+    io[3 * os] = t47;
+    ro[4 * os] = t28;
+    io[4 * os] = t29;
+}
+
+// 6 points: 40 additions, 16 multiplications
+void fftl_codelet_6(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os) {
+    const long double x0r = ri[0], x0i = ii[0];
+    const long double x1r = ri[is], x1i = ii[is];
+    const long double x2r = ri[2 * is], x2i = ii[2 * is];
+    const long double x3r = ri[3 * is], x3i = ii[3 * is];
+    const long double x4r = ri[4 * is], x4i = ii[4 * is];
+    const long double x5r = ri[5 * is], x5i = ii[5 * is];
+    const long double t0 = x2r + x4r;
+    const long double t1 = x2i + x4i;
+    const long double t2 = x2r - x4r;
+    const long double t3 = x2i - x4i;
+    const long double t4 = x0r + t0;
+    const long double t5 = x0i + t1;
+    const long double t6 = 0.5L * t0;
+    const long double t7 = 0.5L * t1;
+    const long double t8 = 0.866025403784438646787L * t2;
+    const long double t9 = 0.866025403784438646787L * t3;
+    const long double t10 = x0r - t6;
+    const long double t11 = x0i - t7;
+    const long double t12 = t9 + t10;
+    const long double t13 = t11 - t8;
+    const long double t14 = t10 - t9;
+    const long double t15 = t8 + t11;
+    const long double t16 = x3r + x5r;
+    const long double t17 = x3i + x5i;
+    const long double t18 = x3r - x5r;
+    const long double t19 = x3i - x5i;
+    const long double t20 = x1r + t16;
+    const long double t21 = x1i + t17;
+    const long double t22 = 0.5L * t16;
+    const long double t23 = 0.5L * t17;
+    const long double t24 = 0.866025403784438646787L * t18;
+    const long double t25 = 0.866025403784438646787L * t19;
+    const long double t26 = x1r - t22;
+    const long double t27 = x1i - t23;
+    const long double t28 = t25 + t26;
+    const long double t29 = t27 - t24;
+    const long double t30 = t26 - t25;
+    const long double t31 = t24 + t27;
+    const long double t32 = t4 + t20;
+    const long double t33 = t5 + t21;
+    const long double t34 = t4 - t20;
+    const long double t35 = t5 - t21;
+    const long double t36 = 0.866025403784438646733L * t29;
+    const long double t37 = 0.5L * t28;
+    const long double t38 = t36 + t37;
+    const long double t39 = 0.866025403784438646733L * t28;
+    const long double t40 = 0.5L * t29;
+    const long double t41 = t40 - t39;
+    const long double t42 = t12 + t38;
+    const long double t43 = t13 + t41;
+    const long double t44 = t12 - t38;
+    const long double t45 = t13 - t41;
+    const long double t46 = 0.866025403784438646787L * t31;
+    const long double t47 = 0.5L * t30;
+    const long double t48 = t46 - t47;
+    const long double t49 = 0.866025403784438646787L * t30;
+    const long double t50 = 0.5L * t31;
+    const long double t51 = t49 + t50;
+    const long double t52 = t14 + t48;
+    const long double t53 = t15 - t51;
+    const long double t54 = t14 - t48;
+    const long double t55 = t15 + t51;
+    ro[0] = t32;
+    io[0] = t33;
+    ro[os] = t42;
+    io[os] = t43;
+    ro[2 * os] = t52;
+    io[2 * os] = t53;
+    ro[3 * os] = t34;
+    io[3 * os] = t35;
+    ro[4 * os] = t44;
+    io[4 * os] = t45;
+    ro[5 * os] = t54;
+    io[5 * os] = t55;
+}
+
+// 7 points: 60 additions, 36 multiplications
+void fftl_codelet_7(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os) {
+    const long double x0r = ri[0], x0i = ii[0];
+    const long double x1r = ri[is], x1i = ii[is];
+    const long double x2r = ri[2 * is], x2i = ii[2 * is];
+    const long double x3r = ri[3 * is], x3i = ii[3 * is];
+    const long double x4r = ri[4 * is], x4i = ii[4 * is];
+    const long double x5r = ri[5 * is], x5i = ii[5 * is];
+    const long double x6r = ri[6 * is], x6i = ii[6 * is];
+    const long double t0 = x1r + x6r;
+    const long double t1 = x1i + x6i;
+    const long double t2 = x1r - x6r;
+    const long double t3 = x1i - x6i;
+    const long double t4 = x2r + x5r;
+    const long double t5 = x2i + x5i;
+    const long double t6 = x2r - x5r;
+    const long double t7 = x2i - x5i;
+    const long double t8 = x3r + x4r;
+    const long double t9 = x3i + x4i;
+    const long double t10 = x3r - x4r;
+    const long double t11 = x3i - x4i;
+    const long double t12 = x0r + t0;
+    const long double t13 = x0i + t1;
+    const long double t14 = t4 + t12;
+    const long double t15 = t5 + t13;
+    const long double t16 = t8 + t14;
+    const long double t17 = t9 + t15;
+    const long double t18 = 0.623489801858733530527L * t0;
+    const long double t19 = 0.623489801858733530527L * t1;
+    const long double t20 = 0.78183148246802980873L * t2;
+    const long double t21 = 0.78183148246802980873L * t3;
+    const long double t22 = x0r + t18;
+    const long double t23 = x0i + t19;
+    const long double t24 = 0.222520933956314404342L * t4;
+    const long double t25 = 0.222520933956314404342L * t5;
+    const long double t26 = 0.974927912181823606982L * t6;
+    const long double t27 = 0.974927912181823606982L * t7;
+    const long double t28 = t22 - t24;
+    const long double t29 = t23 - t25;
+    const long double t30 = t20 + t26;
+    const long double t31 = t21 + t27;
+    const long double t32 = 0.90096886790241912632L * t8;
+    const long double t33 = 0.90096886790241912632L * t9;
+    const long double t34 = 0.433883739117558120293L * t10;
+    const long double t35 = 0.433883739117558120293L * t11;
+    const long double t36 = t28 - t32;
+    const long double t37 = t29 - t33;
+    const long double t38 = t30 + t34;
+    const long double t39 = t31 + t35;
+    const long double t40 = t36 + t39;
+    const long double t41 = t37 - t38;
+    const long double t42 = t36 - t39;
+    const long double t43 = t37 + t38;
+    const long double t44 = 0.222520933956314404342L * t0;
+    const long double t45 = 0.222520933956314404342L * t1;
+    const long double t46 = 0.974927912181823606982L * t2;
+    const long double t47 = 0.974927912181823606982L * t3;
+    const long double t48 = x0r - t44;
+    const long double t49 = x0i - t45;
+    const long double t50 = 0.900968867902419126158L * t4;
+    const long double t51 = 0.900968867902419126158L * t5;
+    const long double t52 = 0.433883739117558120591L * t6;
+    const long double t53 = 0.433883739117558120591L * t7;
+    const long double t54 = t48 - t50;
+    const long double t55 = t49 - t51;
+    const long double t56 = t46 - t52;
+    const long double t57 = t47 - t53;
+    const long double t58 = 0.623489801858733530852L * t8;
+    const long double t59 = 0.623489801858733530852L * t9;
+    const long double t60 = 0.781831482468029808459L * t10;
+    const long double t61 = 0.781831482468029808459L * t11;
+    const long double t62 = t54 + t58;
+    const long double t63 = t55 + t59;
+    const long double t64 = t57 - t61;
+    const long double t65 = t60 - t56;
+    const long double t66 = t62 + t64;
+    const long double t67 = t63 + t65;
+    const long double t68 = t62 - t64;
+    const long double t69 = t63 - t65;
+    const long double t70 = 0.90096886790241912632L * t0;
+    const long double t71 = 0.90096886790241912632L * t1;
+    const long double t72 = 0.433883739117558120293L * t2;
+    const long double t73 = 0.433883739117558120293L * t3;
+    const long double t74 = x0r - t70;
+    const long double t75 = x0i - t71;
+    const long double t76 = 0.623489801858733530852L * t4;
+    const long double t77 = 0.623489801858733530852L * t5;
+    const long double t78 = 0.781831482468029808459L * t6;
+    const long double t79 = 0.781831482468029808459L * t7;
+    const long double t80 = t74 + t76;
+    const long double t81 = t75 + t77;
+    const long double t82 = t72 - t78;
+    const long double t83 = t73 - t79;
+    const long double t84 = 0.222520933956314404342L * t8;
+    const long double t85 = 0.222520933956314404342L * t9;
+    const long double t86 = 0.974927912181823606982L * t10;
+    const long double t87 = 0.974927912181823606982L * t11;
+    const long double t88 = t80 - t84;
+    const long double t89 = t81 - t85;
+    const long double t90 = t82 + t86;
+    const long double t91 = t83 + t87;
+    const long double t92 = t88 + t91;
+    const long double t93 = t89 - t90;
+    const long double t94 = t88 - t91;
+    const long double t95 = t89 + t90;
+    ro[0] = t16;
+    io[0] = t17;
+    ro[os] = t40;
+    io[os] = t41;
+    ro[2 * os] = t66;
+    io[2 * os] = t67;
+    ro[3 * os] = t92;
+    io[3 * os] = t93;
+    ro[4 * os] = t94;
+    io[4 * os] = t95;
+    ro[5 * os] = t68;
+    io[5 * os] = t69;
+    ro[6 * os] = t42;
+    io[6 * os] = t43;
+}
+
+// 8 points: 52 additions, 4 multiplications
+void fftl_codelet_8(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os) {
+    const long double x0r = ri[0], x0i = ii[0];
+    const long double x1r = ri[is], x1i = ii[is];
+    const long double x2r = ri[2 * is], x2i = ii[2 * is];
+    const long double x3r = ri[3 * is], x3i = ii[3 * is];
+    const long double x4r = ri[4 * is], x4i = ii[4 * is];
+    const long double x5r = ri[5 * is], x5i = ii[5 * is];
+    const long double x6r = ri[6 * is], x6i = ii[6 * is];
+    const long double x7r = ri[7 * is], x7i = ii[7 * is];
+    const long double t0 = x0r + x4r;
+    const long double t1 = x0i + x4i;
+    const long double t2 = x0r - x4r;
+    const long double t3 = x0i - x4i;
+    const long double t4 = x2r + x6r;
+    const long double t5 = x2i + x6i;
+    const long double t6 = x2i - x6i;
+    const long double t7 = x6r - x2r;
+    const long double t8 = t0 + t4;
+    const long double t9 = t1 + t5;
+    const long double t10 = t0 - t4;
+    const long double t11 = t1 - t5;
+    const long double t12 = t2 + t6;
+    const long double t13 = t3 + t7;
+    const long double t14 = t2 - t6;
+    const long double t15 = t3 - t7;
+    const long double t16 = x1r + x5r;
+    const long double t17 = x1i + x5i;
+    const long double t18 = x1r - x5r;
+    const long double t19 = x1i - x5i;
+    const long double t20 = x3r + x7r;
+    const long double t21 = x3i + x7i;
+    const long double t22 = x3r - x7r;
+    const long double t23 = x3i - x7i;
+    const long double t24 = t16 + t20;
+    const long double t25 = t17 + t21;
+    const long double t26 = t17 - t21;
+    const long double t27 = t20 - t16;
+    const long double t28 = t8 + t24;
+    const long double t29 = t9 + t25;
+    const long double t30 = t8 - t24;
+    const long double t31 = t9 - t25;
+    const long double t32 = t10 + t26;
+    const long double t33 = t11 + t27;
+    const long double t34 = t10 - t26;
+    const long double t35 = t11 - t27;
+    const long double t36 = t18 + t19;
+    const long double t37 = 0.707106781186547524382L * t36;
+    const long double t38 = t19 - t18;
+    const long double t39 = 0.707106781186547524382L * t38;
+    const long double t40 = t22 - t23;
+    const long double t41 = 0.707106781186547524382L * t40;
+    const long double t42 = t22 + t23;
+    const long double t43 = 0.707106781186547524382L * t42;
+    const long double t44 = t37 - t41;
+    const long double t45 = t39 - t43;
+    const long double t46 = t37 + t41;
+    const long double t47 = t39 + t43;
+    const long double t48 = t12 + t44;
+    const long double t49 = t13 + t45;
+    const long double t50 = t12 - t44;
+    const long double t51 = t13 - t45;
+    const long double t52 = t14 + t47;
+    const long double t53 = t15 - t46;
+    const long double t54 = t14 - t47;
+    const long double t55 = t15 + t46;
+    ro[0] = t28;
+    io[0] = t29;
+    ro[os] = t48;
+    io[os] = t49;
+    ro[2 * os] = t32;
+    io[2 * os] = t33;
+    ro[3 * os] = t52;
+    io[3 * os] = t53;
+    ro[4 * os] = t30;
+    io[4 * os] = t31;
+    ro[5 * os] = t50;
+    io[5 * os] = t51;
+    ro[6 * os] = t34;
+    io[6 * os] = t35;
+    ro[7 * os] = t54;
+    io[7 * os] = t55;
+}
+
+// 16 points: 144 additions, 24 multiplications
+void fftl_codelet_16(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os) {
+    const long double x0r = ri[0], x0i = ii[0];
+    const long double x1r = ri[is], x1i = ii[is];
+    const long double x2r = ri[2 * is], x2i = ii[2 * is];
+    const long double x3r = ri[3 * is], x3i = ii[3 * is];
+    const long double x4r = ri[4 * is], x4i = ii[4 * is];
+    const long double x5r = ri[5 * is], x5i = ii[5 * is];
+    const long double x6r = ri[6 * is], x6i = ii[6 * is];
+    const long double x7r = ri[7 * is], x7i = ii[7 * is];
+    const long double x8r = ri[8 * is], x8i = ii[8 * is];
+    const long double x9r = ri[9 * is], x9i = ii[9 * is];
+    const long double x10r = ri[10 * is], x10i = ii[10 * is];
+    const long double x11r = ri[11 * is], x11i = ii[11 * is];
+    const long double x12r = ri[12 * is], x12i = ii[12 * is];
+    const long double x13r = ri[13 * is], x13i = ii[13 * is];
+    const long double x14r = ri[14 * is], x14i = ii[14 * is];
+    const long double x15r = ri[15 * is], x15i = ii[15 * is];
+    const long double t0 = x0r + x8r;
+    const long double t1 = x0i + x8i;
+    const long double t2 = x0r - x8r;
+    const long double t3 = x0i - x8i;
+    const long double t4 = x4r + x12r;
+    const long double t5 = x4i + x12i;
+    const long double t6 = x4i - x12i;
+    const long double t7 = x12r - x4r;
+    const long double t8 = t0 + t4;
+    const long double t9 = t1 + t5;
+    const long double t10 = t0 - t4;
+    const long double t11 = t1 - t5;
+    const long double t12 = t2 + t6;
+    const long double t13 = t3 + t7;
+    const long double t14 = t2 - t6;
+    const long double t15 = t3 - t7;
+    const long double t16 = x2r + x10r;
+    const long double t17 = x2i + x10i;
+    const long double t18 = x2r - x10r;
+    const long double t19 = x2i - x10i;
+    const long double t20 = x6r + x14r;
+    const long double t21 = x6i + x14i;
+    const long double t22 = x6r - x14r;
+    const long double t23 = x6i - x14i;
+    const long double t24 = t16 + t20;
+    const long double t25 = t17 + t21;
+    const long double t26 = t17 - t21;
+    const long double t27 = t20 - t16;
+    const long double t28 = t8 + t24;
+    const long double t29 = t9 + t25;
+    const long double t30 = t8 - t24;
+    const long double t31 = t9 - t25;
+    const long double t32 = t10 + t26;
+    const long double t33 = t11 + t27;
+    const long double t34 = t10 - t26;
+    const long double t35 = t11 - t27;
+    const long double t36 = t18 + t19;
+    const long double t37 = 0.707106781186547524382L * t36;
+    const long double t38 = t19 - t18;
+    const long double t39 = 0.707106781186547524382L * t38;
+    const long double t40 = t22 - t23;
+    const long double t41 = 0.707106781186547524382L * t40;
+    const long double t42 = t22 + t23;
+    const long double t43 = 0.707106781186547524382L * t42;
+    const long double t44 = t37 - t41;
+    const long double t45 = t39 - t43;
+    const long double t46 = t37 + t41;
+    const long double t47 = t39 + t43;
+    const long double t48 = t12 + t44;
+    const long double t49 = t13 + t45;
+    const long double t50 = t12 - t44;
+    const long double t51 = t13 - t45;
+    const long double t52 = t14 + t47;
+    const long double t53 = t15 - t46;
+    const long double t54 = t14 - t47;
+    const long double t55 = t15 + t46;
+    const long double t56 = x1r + x9r;
+    const long double t57 = x1i + x9i;
+    const long double t58 = x1r - x9r;
+    const long double t59 = x1i - x9i;
+    const long double t60 = x5r + x13r;
+    const long double t61 = x5i + x13i;
+    const long double t62 = x5i - x13i;
+    const long double t63 = x13r - x5r;
+    const long double t64 = t56 + t60;
+    const long double t65 = t57 + t61;
+    const long double t66 = t56 - t60;
+    const long double t67 = t57 - t61;
+    const long double t68 = t58 + t62;
+    const long double t69 = t59 + t63;
+    const long double t70 = t58 - t62;
+    const long double t71 = t59 - t63;
+    const long double t72 = x3r + x11r;
+    const long double t73 = x3i + x11i;
+    const long double t74 = x3r - x11r;
+    const long double t75 = x3i - x11i;
+    const long double t76 = x7r + x15r;
+    const long double t77 = x7i + x15i;
+    const long double t78 = x7i - x15i;
+    const long double t79 = x15r - x7r;
+    const long double t80 = t72 + t76;
+    const long double t81 = t73 + t77;
+    const long double t82 = t72 - t76;
+    const long double t83 = t73 - t77;
+    const long double t84 = t74 + t78;
+    const long double t85 = t75 + t79;
+    const long double t86 = t74 - t78;
+    const long double t87 = t75 - t79;
+    const long double t88 = t64 + t80;
+    const long double t89 = t65 + t81;
+    const long double t90 = t65 - t81;
+    const long double t91 = t80 - t64;
+    const long double t92 = t28 + t88;
+    const long double t93 = t29 + t89;
+    const long double t94 = t28 - t88;
+    const long double t95 = t29 - t89;
+    const long double t96 = t30 + t90;
+    const long double t97 = t31 + t91;
+    const long double t98 = t30 - t90;
+    const long double t99 = t31 - t91;
+    const long double t100 = 0.382683432365089771723L * t69;
+    const long double t101 = 0.923879532511286756101L * t68;
+    const long double t102 = t100 + t101;
+    const long double t103 = 0.382683432365089771723L * t68;
+    const long double t104 = 0.923879532511286756101L * t69;
+    const long double t105 = t104 - t103;
+    const long double t106 = 0.923879532511286756156L * t85;
+    const long double t107 = 0.382683432365089771696L * t84;
+    const long double t108 = t106 + t107;
+    const long double t109 = 0.923879532511286756156L * t84;
+    const long double t110 = 0.382683432365089771696L * t85;
+    const long double t111 = t110 - t109;
+    const long double t112 = t102 + t108;
+    const long double t113 = t105 + t111;
+    const long double t114 = t105 - t111;
+    const long double t115 = t108 - t102;
+    const long double t116 = t48 + t112;
+    const long double t117 = t49 + t113;
+    const long double t118 = t48 - t112;
+    const long double t119 = t49 - t113;
+    const long double t120 = t50 + t114;
+    const long double t121 = t51 + t115;
+    const long double t122 = t50 - t114;
+    const long double t123 = t51 - t115;
+    const long double t124 = t66 + t67;
+    const long double t125 = 0.707106781186547524382L * t124;
+    const long double t126 = t67 - t66;
+    const long double t127 = 0.707106781186547524382L * t126;
+    const long double t128 = t82 - t83;
+    const long double t129 = 0.707106781186547524382L * t128;
+    const long double t130 = t82 + t83;
+    const long double t131 = 0.707106781186547524382L * t130;
+    const long double t132 = t125 - t129;
+    const long double t133 = t127 - t131;
+    const long double t134 = t125 + t129;
+    const long double t135 = t127 + t131;
+    const long double t136 = t32 + t132;
+    const long double t137 = t33 + t133;
+    const long double t138 = t32 - t132;
+    const long double t139 = t33 - t133;
+    const long double t140 = t34 + t135;
+    const long double t141 = t35 - t134;
+    const long double t142 = t34 - t135;
+    const long double t143 = t35 + t134;
+    const long double t144 = 0.923879532511286756156L * t71;
+    const long double t145 = 0.382683432365089771696L * t70;
+    const long double t146 = t144 + t145;
+    const long double t147 = 0.923879532511286756156L * t70;
+    const long double t148 = 0.382683432365089771696L * t71;
+    const long double t149 = t148 - t147;
+    const long double t150 = 0.382683432365089771859L * t87;
+    const long double t151 = 0.923879532511286756101L * t86;
+    const long double t152 = t150 + t151;
+    const long double t153 = 0.382683432365089771859L * t86;
+    const long double t154 = 0.923879532511286756101L * t87;
+    const long double t155 = t153 - t154;
+    const long double t156 = t146 - t152;
+    const long double t157 = t149 + t155;
+    const long double t158 = t146 + t152;
+    const long double t159 = t149 - t155;
+    const long double t160 = t52 + t156;
+    const long double t161 = t53 + t157;
+    const long double t162 = t52 - t156;
+    const long double t163 = t53 - t157;
+    const long double t164 = t54 + t159;
+    const long double t165 = t55 - t158;
+    const long double t166 = t54 - t159;
+    const long double t167 = t55 + t158;
+    ro[0] = t92;
+    io[0] = t93;
+    ro[os] = t116;
+    io[os] = t117;
+    ro[2 * os] = t136;
+    io[2 * os] = t137;
+    ro[3 * os] = t160;
+    io[3 * os] = t161;
+    ro[4 * os] = t96;
+    io[4 * os] = t97;
+    ro[5 * os] = t120;
+    io[5 * os] = t121;
+    ro[6 * os] = t140;
+    io[6 * os] = t141;
+    ro[7 * os] = t164;
+    io[7 * os] = t165;
+    ro[8 * os] = t94;
+    io[8 * os] = t95;
+    ro[9 * os] = t118;
+    io[9 * os] = t119;
+    ro[10 * os] = t138;
+    io[10 * os] = t139;
+    ro[11 * os] = t162;
+    io[11 * os] = t163;
+    ro[12 * os] = t98;
+    io[12 * os] = t99;
+    ro[13 * os] = t122;
+    io[13 * os] = t123;
+    ro[14 * os] = t142;
+    io[14 * os] = t143;
+    ro[15 * os] = t166;
+    io[15 * os] = t167;
+}
+
+// 32 points: 372 additions, 84 multiplications
+void fftl_codelet_32(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os) {
+    const long double x0r = ri[0], x0i = ii[0];
+    const long double x1r = ri[is], x1i = ii[is];
+    const long double x2r = ri[2 * is], x2i = ii[2 * is];
+    const long double x3r = ri[3 * is], x3i = ii[3 * is];
+    const long double x4r = ri[4 * is], x4i = ii[4 * is];
+    const long double x5r = ri[5 * is], x5i = ii[5 * is];
+    const long double x6r = ri[6 * is], x6i = ii[6 * is];
+    const long double x7r = ri[7 * is], x7i = ii[7 * is];
+    const long double x8r = ri[8 * is], x8i = ii[8 * is];
+    const long double x9r = ri[9 * is], x9i = ii[9 * is];
+    const long double x10r = ri[10 * is], x10i = ii[10 * is];
+    const long double x11r = ri[11 * is], x11i = ii[11 * is];
+    const long double x12r = ri[12 * is], x12i = ii[12 * is];
+    const long double x13r = ri[13 * is], x13i = ii[13 * is];
+    const long double x14r = ri[14 * is], x14i = ii[14 * is];
+    const long double x15r = ri[15 * is], x15i = ii[15 * is];
+    const long double x16r = ri[16 * is], x16i = ii[16 * is];
+    const long double x17r = ri[17 * is], x17i = ii[17 * is];
+    const long double x18r = ri[18 * is], x18i = ii[18 * is];
+    const long double x19r = ri[19 * is], x19i = ii[19 * is];
+    const long double x20r = ri[20 * is], x20i = ii[20 * is];
+    const long double x21r = ri[21 * is], x21i = ii[21 * is];
+    const long double x22r = ri[22 * is], x22i = ii[22 * is];
+    const long double x23r = ri[23 * is], x23i = ii[23 * is];
+    const long double x24r = ri[24 * is], x24i = ii[24 * is];
+    const long double x25r = ri[25 * is], x25i = ii[25 * is];
+    const long double x26r = ri[26 * is], x26i = ii[26 * is];
+    const long double x27r = ri[27 * is], x27i = ii[27 * is];
+    const long double x28r = ri[28 * is], x28i = ii[28 * is];
+    const long double x29r = ri[29 * is], x29i = ii[29 * is];
+    const long double x30r = ri[30 * is], x30i = ii[30 * is];
+    const long double x31r = ri[31 * is], x31i = ii[31 * is];
+    const long double t0 = x0r + x16r;
+    const long double t1 = x0i + x16i;
+    const long double t2 = x0r - x16r;
+    const long double t3 = x0i - x16i;
+    const long double t4 = x8r + x24r;
+    const long double t5 = x8i + x24i;
+    const long double t6 = x8i - x24i;
+    const long double t7 = x24r - x8r;
+    const long double t8 = t0 + t4;
+    const long double t9 = t1 + t5;
+    const long double t10 = t0 - t4;
+    const long double t11 = t1 - t5;
+    const long double t12 = t2 + t6;
+    const long double t13 = t3 + t7;
+    const long double t14 = t2 - t6;
+    const long double t15 = t3 - t7;
+    const long double t16 = x4r + x20r;
+    const long double t17 = x4i + x20i;
+    const long double t18 = x4r - x20r;
+    const long double t19 = x4i - x20i;
+    const long double t20 = x12r + x28r;
+    const long double t21 = x12i + x28i;
+    const long double t22 = x12r - x28r;
+    const long double t23 = x12i - x28i;
+    const long double t24 = t16 + t20;
+    const long double t25 = t17 + t21;
+    const long double t26 = t17 - t21;
+    const long double t27 = t20 - t16;
+    const long double t28 = t8 + t24;
+    const long double t29 = t9 + t25;
+    const long double t30 = t8 - t24;
+    const long double t31 = t9 - t25;
+    const long double t32 = t10 + t26;
+    const long double t33 = t11 + t27;
+    const long double t34 = t10 - t26;
+    const long double t35 = t11 - t27;
+    const long double t36 = t18 + t19;
+    const long double t37 = 0.707106781186547524382L * t36;
+    const long double t38 = t19 - t18;
+    const long double t39 = 0.707106781186547524382L * t38;
+    const long double t40 = t22 - t23;
+    const long double t41 = 0.707106781186547524382L * t40;
+    const long double t42 = t22 + t23;
+    const long double t43 = 0.707106781186547524382L * t42;
+    const long double t44 = t37 - t41;
+    const long double t45 = t39 - t43;
+    const long double t46 = t37 + t41;
+    const long double t47 = t39 + t43;
+    const long double t48 = t12 + t44;
+    const long double t49 = t13 + t45;
+    const long double t50 = t12 - t44;
+    const long double t51 = t13 - t45;
+    const long double t52 = t14 + t47;
+    const long double t53 = t15 - t46;
+    const long double t54 = t14 - t47;
+    const long double t55 = t15 + t46;
+    const long double t56 = x2r + x18r;
+    const long double t57 = x2i + x18i;
+    const long double t58 = x2r - x18r;
+    const long double t59 = x2i - x18i;
+    const long double t60 = x10r + x26r;
+    const long double t61 = x10i + x26i;
+    const long double t62 = x10i - x26i;
+    const long double t63 = x26r - x10r;
+    const long double t64 = t56 + t60;
+    const long double t65 = t57 + t61;
+    const long double t66 = t56 - t60;
+    const long double t67 = t57 - t61;
+    const long double t68 = t58 + t62;
+    const long double t69 = t59 + t63;
+    const long double t70 = t58 - t62;
+    const long double t71 = t59 - t63;
+    const long double t72 = x6r + x22r;
+    const long double t73 = x6i + x22i;
+    const long double t74 = x6r - x22r;
+    const long double t75 = x6i - x22i;
+    const long double t76 = x14r + x30r;
+    const long double t77 = x14i + x30i;
+    const long double t78 = x14i - x30i;
+    const long double t79 = x30r - x14r;
+    const long double t80 = t72 + t76;
+    const long double t81 = t73 + t77;
+    const long double t82 = t72 - t76;
+    const long double t83 = t73 - t77;
+    const long double t84 = t74 + t78;
+    const long double t85 = t75 + t79;
+    const long double t86 = t74 - t78;
+    const long double t87 = t75 - t79;
+    const long double t88 = t64 + t80;
+    const long double t89 = t65 + t81;
+    const long double t90 = t65 - t81;
+    const long double t91 = t80 - t64;
+    const long double t92 = t28 + t88;
+    const long double t93 = t29 + t89;
+    const long double t94 = t28 - t88;
+    const long double t95 = t29 - t89;
+    const long double t96 = t30 + t90;
+    const long double t97 = t31 + t91;
+    const long double t98 = t30 - t90;
+    const long double t99 = t31 - t91;
+    const long double t100 = 0.382683432365089771723L * t69;
+    const long double t101 = 0.923879532511286756101L * t68;
+    const long double t102 = t100 + t101;
+    const long double t103 = 0.382683432365089771723L * t68;
+    const long double t104 = 0.923879532511286756101L * t69;
+    const long double t105 = t104 - t103;
+    const long double t106 = 0.923879532511286756156L * t85;
+    const long double t107 = 0.382683432365089771696L * t84;
+    const long double t108 = t106 + t107;
+    const long double t109 = 0.923879532511286756156L * t84;
+    const long double t110 = 0.382683432365089771696L * t85;
+    const long double t111 = t110 - t109;
+    const long double t112 = t102 + t108;
+    const long double t113 = t105 + t111;
+    const long double t114 = t105 - t111;
+    const long double t115 = t108 - t102;
+    const long double t116 = t48 + t112;
+    const long double t117 = t49 + t113;
+    const long double t118 = t48 - t112;
+    const long double t119 = t49 - t113;
+    const long double t120 = t50 + t114;
+    const long double t121 = t51 + t115;
+    const long double t122 = t50 - t114;
+    const long double t123 = t51 - t115;
+    const long double t124 = t66 + t67;
+    const long double t125 = 0.707106781186547524382L * t124;
+    const long double t126 = t67 - t66;
+    const long double t127 = 0.707106781186547524382L * t126;
+    const long double t128 = t82 - t83;
+    const long double t129 = 0.707106781186547524382L * t128;
+    const long double t130 = t82 + t83;
+    const long double t131 = 0.707106781186547524382L * t130;
+    const long double t132 = t125 - t129;
+    const long double t133 = t127 - t131;
+    const long double t134 = t125 + t129;
+    const long double t135 = t127 + t131;
+    const long double t136 = t32 + t132;
+    const long double t137 = t33 + t133;
+    const long double t138 = t32 - t132;
+    const long double t139 = t33 - t133;
+    const long double t140 = t34 + t135;
+    const long double t141 = t35 - t134;
+    const long double t142 = t34 - t135;
+    const long double t143 = t35 + t134;
+    const long double t144 = 0.923879532511286756156L * t71;
+    const long double t145 = 0.382683432365089771696L * t70;
+    const long double t146 = t144 + t145;
+    const long double t147 = 0.923879532511286756156L * t70;
+    const long double t148 = 0.382683432365089771696L * t71;
+    const long double t149 = t148 - t147;
+    const long double t150 = 0.382683432365089771859L * t87;
+    const long double t151 = 0.923879532511286756101L * t86;
+    const long double t152 = t150 + t151;
+    const long double t153 = 0.382683432365089771859L * t86;
+    const long double t154 = 0.923879532511286756101L * t87;
+    const long double t155 = t153 - t154;
+    const long double t156 = t146 - t152;
+    const long double t157 = t149 + t155;
+    const long double t158 = t146 + t152;
+    const long double t159 = t149 - t155;
+    const long double t160 = t52 + t156;
+    const long double t161 = t53 + t157;
+    const long double t162 = t52 - t156;
+    const long double t163 = t53 - t157;
+    const long double t164 = t54 + t159;
+    const long double t165 = t55 - t158;
+    const long double t166 = t54 - t159;
+    const long double t167 = t55 + t158;
+    const long double t168 = x1r + x17r;
+    const long double t169 = x1i + x17i;
+    const long double t170 = x1r - x17r;
+    const long double t171 = x1i - x17i;
+    const long double t172 = x9r + x25r;
+    const long double t173 = x9i + x25i;
+    const long double t174 = x9i - x25i;
+    const long double t175 = x25r - x9r;
+    const long double t176 = t168 + t172;
+    const long double t177 = t169 + t173;
+    const long double t178 = t168 - t172;
+    const long double t179 = t169 - t173;
+    const long double t180 = t170 + t174;
+    const long double t181 = t171 + t175;
+    const long double t182 = t170 - t174;
+    const long double t183 = t171 - t175;
+    const long double t184 = x5r + x21r;
+    const long double t185 = x5i + x21i;
+    const long double t186 = x5r - x21r;
+    const long double t187 = x5i - x21i;
+    const long double t188 = x13r + x29r;
+    const long double t189 = x13i + x29i;
+    const long double t190 = x13r - x29r;
+    const long double t191 = x13i - x29i;
+    const long double t192 = t184 + t188;
+    const long double t193 = t185 + t189;
+    const long double t194 = t185 - t189;
+    const long double t195 = t188 - t184;
+    const long double t196 = t176 + t192;
+    const long double t197 = t177 + t193;
+    const long double t198 = t176 - t192;
+    const long double t199 = t177 - t193;
+    const long double t200 = t178 + t194;
+    const long double t201 = t179 + t195;
+    const long double t202 = t178 - t194;
+    const long double t203 = t179 - t195;
+    const long double t204 = t186 + t187;
+    const long double t205 = 0.707106781186547524382L * t204;
+    const long double t206 = t187 - t186;
+    const long double t207 = 0.707106781186547524382L * t206;
+    const long double t208 = t190 - t191;
+    const long double t209 = 0.707106781186547524382L * t208;
+    const long double t210 = t190 + t191;
+    const long double t211 = 0.707106781186547524382L * t210;
+    const long double t212 = t205 - t209;
+    const long double t213 = t207 - t211;
+    const long double t214 = t205 + t209;
+    const long double t215 = t207 + t211;
+    const long double t216 = t180 + t212;
+    const long double t217 = t181 + t213;
+    const long double t218 = t180 - t212;
+    const long double t219 = t181 - t213;
+    const long double t220 = t182 + t215;
+    const long double t221 = t183 - t214;
+    const long double t222 = t182 - t215;
+    const long double t223 = t183 + t214;
+    const long double t224 = x3r + x19r;
+    const long double t225 = x3i + x19i;
+    const long double t226 = x3r - x19r;
+    const long double t227 = x3i - x19i;
+    const long double t228 = x11r + x27r;
+    const long double t229 = x11i + x27i;
+    const long double t230 = x11i - x27i;
+    const long double t231 = x27r - x11r;
+    const long double t232 = t224 + t228;
+    const long double t233 = t225 + t229;
+    const long double t234 = t224 - t228;
+    const long double t235 = t225 - t229;
+    const long double t236 = t226 + t230;
+    const long double t237 = t227 + t231;
+    const long double t238 = t226 - t230;
+    const long double t239 = t227 - t231;
+    const long double t240 = x7r + x23r;
+    const long double t241 = x7i + x23i;
+    const long double t242 = x7r - x23r;
+    const long double t243 = x7i - x23i;
+    const long double t244 = x15r + x31r;
+    const long double t245 = x15i + x31i;
+    const long double t246 = x15r - x31r;
+    const long double t247 = x15i - x31i;
+    const long double t248 = t240 + t244;
+    const long double t249 = t241 + t245;
+    const long double t250 = t241 - t245;
+    const long double t251 = t244 - t240;
+    const long double t252 = t232 + t248;
+    const long double t253 = t233 + t249;
+    const long double t254 = t232 - t248;
+    const long double t255 = t233 - t249;
+    const long double t256 = t234 + t250;
+    const long double t257 = t235 + t251;
+    const long double t258 = t234 - t250;
+    const long double t259 = t235 - t251;
+    const long double t260 = t242 + t243;
+    const long double t261 = 0.707106781186547524382L * t260;
+    const long double t262 = t243 - t242;
+    const long double t263 = 0.707106781186547524382L * t262;
+    const long double t264 = t246 - t247;
+    const long double t265 = 0.707106781186547524382L * t264;
+    const long double t266 = t246 + t247;
+    const long double t267 = 0.707106781186547524382L * t266;
+    const long double t268 = t261 - t265;
+    const long double t269 = t263 - t267;
+    const long double t270 = t261 + t265;
+    const long double t271 = t263 + t267;
+    const long double t272 = t236 + t268;
+    const long double t273 = t237 + t269;
+    const long double t274 = t236 - t268;
+    const long double t275 = t237 - t269;
+    const long double t276 = t238 + t271;
+    const long double t277 = t239 - t270;
+    const long double t278 = t238 - t271;
+    const long double t279 = t239 + t270;
+    const long double t280 = t196 + t252;
+    const long double t281 = t197 + t253;
+    const long double t282 = t197 - t253;
+    const long double t283 = t252 - t196;
+    const long double t284 = t92 + t280;
+    const long double t285 = t93 + t281;
+    const long double t286 = t92 - t280;
+    const long double t287 = t93 - t281;
+    const long double t288 = t94 + t282;
+    const long double t289 = t95 + t283;
+    const long double t290 = t94 - t282;
+    const long double t291 = t95 - t283;
+    const long double t292 = 0.195090322016128267857L * t217;
+    const long double t293 = 0.980785280403230449119L * t216;
+    const long double t294 = t292 + t293;
+    const long double t295 = 0.195090322016128267857L * t216;
+    const long double t296 = 0.980785280403230449119L * t217;
+    const long double t297 = t296 - t295;
+    const long double t298 = 0.555570233019602224757L * t273;
+    const long double t299 = 0.831469612302545237081L * t272;
+    const long double t300 = t298 + t299;
+    const long double t301 = 0.555570233019602224757L * t272;
+    const long double t302 = 0.831469612302545237081L * t273;
+    const long double t303 = t302 - t301;
+    const long double t304 = t294 + t300;
+    const long double t305 = t297 + t303;
+    const long double t306 = t297 - t303;
+    const long double t307 = t300 - t294;
+    const long double t308 = t116 + t304;
+    const long double t309 = t117 + t305;
+    const long double t310 = t116 - t304;
+    const long double t311 = t117 - t305;
+    const long double t312 = t118 + t306;
+    const long double t313 = t119 + t307;
+    const long double t314 = t118 - t306;
+    const long double t315 = t119 - t307;
+    const long double t316 = 0.382683432365089771723L * t201;
+    const long double t317 = 0.923879532511286756101L * t200;
+    const long double t318 = t316 + t317;
+    const long double t319 = 0.382683432365089771723L * t200;
+    const long double t320 = 0.923879532511286756101L * t201;
+    const long double t321 = t320 - t319;
+    const long double t322 = 0.923879532511286756156L * t257;
+    const long double t323 = 0.382683432365089771696L * t256;
+    const long double t324 = t322 + t323;
+    const long double t325 = 0.923879532511286756156L * t256;
+    const long double t326 = 0.382683432365089771696L * t257;
+    const long double t327 = t326 - t325;
+    const long double t328 = t318 + t324;
+    const long double t329 = t321 + t327;
+    const long double t330 = t321 - t327;
+    const long double t331 = t324 - t318;
+    const long double t332 = t136 + t328;
+    const long double t333 = t137 + t329;
+    const long double t334 = t136 - t328;
+    const long double t335 = t137 - t329;
+    const long double t336 = t138 + t330;
+    const long double t337 = t139 + t331;
+    const long double t338 = t138 - t330;
+    const long double t339 = t139 - t331;
+    const long double t340 = 0.555570233019602224757L * t221;
+    const long double t341 = 0.831469612302545237081L * t220;
+    const long double t342 = t340 + t341;
+    const long double t343 = 0.555570233019602224757L * t220;
+    const long double t344 = 0.831469612302545237081L * t221;
+    const long double t345 = t344 - t343;
+    const long double t346 = 0.980785280403230449119L * t277;
+    const long double t347 = 0.195090322016128267911L * t276;
+    const long double t348 = t346 - t347;
+    const long double t349 = 0.980785280403230449119L * t276;
+    const long double t350 = 0.195090322016128267911L * t277;
+    const long double t351 = t349 + t350;
+    const long double t352 = t342 + t348;
+    const long double t353 = t345 - t351;
+    const long double t354 = t345 + t351;
+    const long double t355 = t348 - t342;
+    const long double t356 = t160 + t352;
+    const long double t357 = t161 + t353;
+    const long double t358 = t160 - t352;
+    const long double t359 = t161 - t353;
+    const long double t360 = t162 + t354;
+    const long double t361 = t163 + t355;
+    const long double t362 = t162 - t354;
+    const long double t363 = t163 - t355;
+    const long double t364 = t198 + t199;
+    const long double t365 = 0.707106781186547524382L * t364;
+    const long double t366 = t199 - t198;
+    const long double t367 = 0.707106781186547524382L * t366;
+    const long double t368 = t254 - t255;
+    const long double t369 = 0.707106781186547524382L * t368;
+    const long double t370 = t254 + t255;
+    const long double t371 = 0.707106781186547524382L * t370;
+    const long double t372 = t365 - t369;
+    const long double t373 = t367 - t371;
+    const long double t374 = t365 + t369;
+    const long double t375 = t367 + t371;
+    const long double t376 = t96 + t372;
+    const long double t377 = t97 + t373;
+    const long double t378 = t96 - t372;
+    const long double t379 = t97 - t373;
+    const long double t380 = t98 + t375;
+    const long double t381 = t99 - t374;
+    const long double t382 = t98 - t375;
+    const long double t383 = t99 + t374;
+    const long double t384 = 0.831469612302545237081L * t219;
+    const long double t385 = 0.555570233019602224757L * t218;
+    const long double t386 = t384 + t385;
+    const long double t387 = 0.831469612302545237081L * t218;
+    const long double t388 = 0.555570233019602224757L * t219;
+    const long double t389 = t388 - t387;
+    const long double t390 = 0.195090322016128267735L * t275;
+    const long double t391 = 0.980785280403230449173L * t274;
+    const long double t392 = t390 - t391;
+    const long double t393 = 0.195090322016128267735L * t274;
+    const long double t394 = 0.980785280403230449173L * t275;
+    const long double t395 = t393 + t394;
+    const long double t396 = t386 + t392;
+    const long double t397 = t389 - t395;
+    const long double t398 = t389 + t395;
+    const long double t399 = t392 - t386;
+    const long double t400 = t120 + t396;
+    const long double t401 = t121 + t397;
+    const long double t402 = t120 - t396;
+    const long double t403 = t121 - t397;
+    const long double t404 = t122 + t398;
+    const long double t405 = t123 + t399;
+    const long double t406 = t122 - t398;
+    const long double t407 = t123 - t399;
+    const long double t408 = 0.923879532511286756156L * t203;
+    const long double t409 = 0.382683432365089771696L * t202;
+    const long double t410 = t408 + t409;
+    const long double t411 = 0.923879532511286756156L * t202;
+    const long double t412 = 0.382683432365089771696L * t203;
+    const long double t413 = t412 - t411;
+    const long double t414 = 0.382683432365089771859L * t259;
+    const long double t415 = 0.923879532511286756101L * t258;
+    const long double t416 = t414 + t415;
+    const long double t417 = 0.382683432365089771859L * t258;
+    const long double t418 = 0.923879532511286756101L * t259;
+    const long double t419 = t417 - t418;
+    const long double t420 = t410 - t416;
+    const long double t421 = t413 + t419;
+    const long double t422 = t410 + t416;
+    const long double t423 = t413 - t419;
+    const long double t424 = t140 + t420;
+    const long double t425 = t141 + t421;
+    const long double t426 = t140 - t420;
+    const long double t427 = t141 - t421;
+    const long double t428 = t142 + t423;
+    const long double t429 = t143 - t422;
+    const long double t430 = t142 - t423;
+    const long double t431 = t143 + t422;
+    const long double t432 = 0.980785280403230449119L * t223;
+    const long double t433 = 0.19509032201612826787L * t222;
+    const long double t434 = t432 + t433;
+    const long double t435 = 0.980785280403230449119L * t222;
+    const long double t436 = 0.19509032201612826787L * t223;
+    const long double t437 = t436 - t435;
+    const long double t438 = 0.831469612302545237189L * t279;
+    const long double t439 = 0.555570233019602224595L * t278;
+    const long double t440 = t438 + t439;
+    const long double t441 = 0.831469612302545237189L * t278;
+    const long double t442 = 0.555570233019602224595L * t279;
+    const long double t443 = t441 - t442;
+    const long double t444 = t434 - t440;
+    const long double t445 = t437 + t443;
+    const long double t446 = t434 + t440;
+    const long double t447 = t437 - t443;
+    const long double t448 = t164 + t444;
+    const long double t449 = t165 + t445;
+    const long double t450 = t164 - t444;
+    const long double t451 = t165 - t445;
+    const long double t452 = t166 + t447;
+    const long double t453 = t167 - t446;
+    const long double t454 = t166 - t447;
+    const long double t455 = t167 + t446;
+    ro[0] = t284;
+    io[0] = t285;
+    ro[os] = t308;
+    io[os] = t309;
+    ro[2 * os] = t332;
+    io[2 * os] = t333;
+    ro[3 * os] = t356;
+    io[3 * os] = t357;
+    ro[4 * os] = t376;
+    io[4 * os] = t377;
+    ro[5 * os] = t400;
+    io[5 * os] = t401;
+    ro[6 * os] = t424;
+    io[6 * os] = t425;
+    ro[7 * os] = t448;
+    io[7 * os] = t449;
+    ro[8 * os] = t288;
+    io[8 * os] = t289;
+    ro[9 * os] = t312;
+    io[9 * os] = t313;
+    ro[10 * os] = t336;
+    io[10 * os] = t337;
+    ro[11 * os] = t360;
+    io[11 * os] = t361;
+    ro[12 * os] = t380;
+    io[12 * os] = t381;
+    ro[13 * os] = t404;
+    io[13 * os] = t405;
+    ro[14 * os] = t428;
+    io[14 * os] = t429;
+    ro[15 * os] = t452;
+    io[15 * os] = t453;
+    ro[16 * os] = t286;
+    io[16 * os] = t287;
+    ro[17 * os] = t310;
+    io[17 * os] = t311;
+    ro[18 * os] = t334;
+    io[18 * os] = t335;
+    ro[19 * os] = t358;
+    io[19 * os] = t359;
+    ro[20 * os] = t378;
+    io[20 * os] = t379;
+    ro[21 * os] = t402;
+    io[21 * os] = t403;
+    ro[22 * os] = t426;
+    io[22 * os] = t427;
+    ro[23 * os] = t450;
+    io[23 * os] = t451;
+    ro[24 * os] = t290;
+    io[24 * os] = t291;
+    ro[25 * os] = t314;
+    io[25 * os] = t315;
+    ro[26 * os] = t338;
+    io[26 * os] = t339;
+    ro[27 * os] = t362;
+    io[27 * os] = t363;
+    ro[28 * os] = t382;
+    io[28 * os] = t383;
+    ro[29 * os] = t406;
+    io[29 * os] = t407;
+    ro[30 * os] = t430;
+    io[30 * os] = t431;
+    ro[31 * os] = t454;
+    io[31 * os] = t455;
+}
+
+// 64 points: 912 additions, 248 multiplications
+void fftl_codelet_64(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os) {
+    const long double x0r = ri[0], x0i = ii[0];
+    const long double x1r = ri[is], x1i = ii[is];
+    const long double x2r = ri[2 * is], x2i = ii[2 * is];
+    const long double x3r = ri[3 * is], x3i = ii[3 * is];
+    const long double x4r = ri[4 * is], x4i = ii[4 * is];
+    const long double x5r = ri[5 * is], x5i = ii[5 * is];
+    const long double x6r = ri[6 * is], x6i = ii[6 * is];
+    const long double x7r = ri[7 * is], x7i = ii[7 * is];
+    const long double x8r = ri[8 * is], x8i = ii[8 * is];
+    const long double x9r = ri[9 * is], x9i = ii[9 * is];
+    const long double x10r = ri[10 * is], x10i = ii[10 * is];
+    const long double x11r = ri[11 * is], x11i = ii[11 * is];
+    const long double x12r = ri[12 * is], x12i = ii[12 * is];
+    const long double x13r = ri[13 * is], x13i = ii[13 * is];
+    const long double x14r = ri[14 * is], x14i = ii[14 * is];
+    const long double x15r = ri[15 * is], x15i = ii[15 * is];
+    const long double x16r = ri[16 * is], x16i = ii[16 * is];
+    const long double x17r = ri[17 * is], x17i = ii[17 * is];
+    const long double x18r = ri[18 * is], x18i = ii[18 * is];
+    const long double x19r = ri[19 * is], x19i = ii[19 * is];
+    const long double x20r = ri[20 * is], x20i = ii[20 * is];
+    const long double x21r = ri[21 * is], x21i = ii[21 * is];
+    const long double x22r = ri[22 * is], x22i = ii[22 * is];
+    const long double x23r = ri[23 * is], x23i = ii[23 * is];
+    const long double x24r = ri[24 * is], x24i = ii[24 * is];
+    const long double x25r = ri[25 * is], x25i = ii[25 * is];
+    const long double x26r = ri[26 * is], x26i = ii[26 * is];
+    const long double x27r = ri[27 * is], x27i = ii[27 * is];
+    const long double x28r = ri[28 * is], x28i = ii[28 * is];
+    const long double x29r = ri[29 * is], x29i = ii[29 * is];
+    const long double x30r = ri[30 * is], x30i = ii[30 * is];
+    const long double x31r = ri[31 * is], x31i = ii[31 * is];
+    const long double x32r = ri[32 * is], x32i = ii[32 * is];
+    const long double x33r = ri[33 * is], x33i = ii[33 * is];
+    const long double x34r = ri[34 * is], x34i = ii[34 * is];
+    const long double x35r = ri[35 * is], x35i = ii[35 * is];
+    const long double x36r = ri[36 * is], x36i = ii[36 * is];
+    const long double x37r = ri[37 * is], x37i = ii[37 * is];
+    const long double x38r = ri[38 * is], x38i = ii[38 * is];
+    const long double x39r = ri[39 * is], x39i = ii[39 * is];
+    const long double x40r = ri[40 * is], x40i = ii[40 * is];
+    const long double x41r = ri[41 * is], x41i = ii[41 * is];
+    const long double x42r = ri[42 * is], x42i = ii[42 * is];
+    const long double x43r = ri[43 * is], x43i = ii[43 * is];
+    const long double x44r = ri[44 * is], x44i = ii[44 * is];
+    const long double x45r = ri[45 * is], x45i = ii[45 * is];
+    const long double x46r = ri[46 * is], x46i = ii[46 * is];
+    const long double x47r = ri[47 * is], x47i = ii[47 * is];
+    const long double x48r = ri[48 * is], x48i = ii[48 * is];
+    const long double x49r = ri[49 * is], x49i = ii[49 * is];
+    const long double x50r = ri[50 * is], x50i = ii[50 * is];
+    const long double x51r = ri[51 * is], x51i = ii[51 * is];
+    const long double x52r = ri[52 * is], x52i = ii[52 * is];
+    const long double x53r = ri[53 * is], x53i = ii[53 * is];
+    const long double x54r = ri[54 * is], x54i = ii[54 * is];
+    const long double x55r = ri[55 * is], x55i = ii[55 * is];
+    const long double x56r = ri[56 * is], x56i = ii[56 * is];
+    const long double x57r = ri[57 * is], x57i = ii[57 * is];
+    const long double x58r = ri[58 * is], x58i = ii[58 * is];
+    const long double x59r = ri[59 * is], x59i = ii[59 * is];
+    const long double x60r = ri[60 * is], x60i = ii[60 * is];
+    const long double x61r = ri[61 * is], x61i = ii[61 * is];
+    const long double x62r = ri[62 * is], x62i = ii[62 * is];
+    const long double x63r = ri[63 * is], x63i = ii[63 * is];
+    const long double t0 = x0r + x32r;
+    const long double t1 = x0i + x32i;
+    const long double t2 = x0r - x32r;
+    const long double t3 = x0i - x32i;
+    const long double t4 = x16r + x48r;
+    const long double t5 = x16i + x48i;
+    const long double t6 = x16i - x48i;
+    const long double t7 = x48r - x16r;
+    const long double t8 = t0 + t4;
+    const long double t9 = t1 + t5;
+    const long double t10 = t0 - t4;
+    const long double t11 = t1 - t5;
+    const long double t12 = t2 + t6;
+    const long double t13 = t3 + t7;
+    const long double t14 = t2 - t6;
+    const long double t15 = t3 - t7;
+    const long double t16 = x8r + x40r;
+    const long double t17 = x8i + x40i;
+    const long double t18 = x8r - x40r;
+    const long double t19 = x8i - x40i;
+    const long double t20 = x24r + x56r;
+    const long double t21 = x24i + x56i;
+    const long double t22 = x24r - x56r;
+    const long double t23 = x24i - x56i;
+    const long double t24 = t16 + t20;
+    const long double t25 = t17 + t21;
+    const long double t26 = t17 - t21;
+    const long double t27 = t20 - t16;
+    const long double t28 = t8 + t24;
+    const long double t29 = t9 + t25;
+    const long double t30 = t8 - t24;
+    const long double t31 = t9 - t25;
+    const long double t32 = t10 + t26;
+    const long double t33 = t11 + t27;
+    const long double t34 = t10 - t26;
+    const long double t35 = t11 - t27;
+    const long double t36 = t18 + t19;
+    const long double t37 = 0.707106781186547524382L * t36;
+    const long double t38 = t19 - t18;
+    const long double t39 = 0.707106781186547524382L * t38;
+    const long double t40 = t22 - t23;
+    const long double t41 = 0.707106781186547524382L * t40;
+    const long double t42 = t22 + t23;
+    const long double t43 = 0.707106781186547524382L * t42;
+    const long double t44 = t37 - t41;
+    const long double t45 = t39 - t43;
+    const long double t46 = t37 + t41;
+    const long double t47 = t39 + t43;
+    const long double t48 = t12 + t44;
+    const long double t49 = t13 + t45;
+    const long double t50 = t12 - t44;
+    const long double t51 = t13 - t45;
+    const long double t52 = t14 + t47;
+    const long double t53 = t15 - t46;
+    const long double t54 = t14 - t47;
+    const long double t55 = t15 + t46;
+    const long double t56 = x4r + x36r;
+    const long double t57 = x4i + x36i;
+    const long double t58 = x4r - x36r;
+    const long double t59 = x4i - x36i;
+    const long double t60 = x20r + x52r;
+    const long double t61 = x20i + x52i;
+    const long double t62 = x20i - x52i;
+    const long double t63 = x52r - x20r;
+    const long double t64 = t56 + t60;
+    const long double t65 = t57 + t61;
+    const long double t66 = t56 - t60;
+    const long double t67 = t57 - t61;
+    const long double t68 = t58 + t62;
+    const long double t69 = t59 + t63;
+    const long double t70 = t58 - t62;
+    const long double t71 = t59 - t63;
+    const long double t72 = x12r + x44r;
+    const long double t73 = x12i + x44i;
+    const long double t74 = x12r - x44r;
+    const long double t75 = x12i - x44i;
+    const long double t76 = x28r + x60r;
+    const long double t77 = x28i + x60i;
+    const long double t78 = x28i - x60i;
+    const long double t79 = x60r - x28r;
+    const long double t80 = t72 + t76;
+    const long double t81 = t73 + t77;
+    const long double t82 = t72 - t76;
+    const long double t83 = t73 - t77;
+    const long double t84 = t74 + t78;
+    const long double t85 = t75 + t79;
+    const long double t86 = t74 - t78;
+    const long double t87 = t75 - t79;
+    const long double t88 = t64 + t80;
+    const long double t89 = t65 + t81;
+    const long double t90 = t65 - t81;
+    const long double t91 = t80 - t64;
+    const long double t92 = t28 + t88;
+    const long double t93 = t29 + t89;
+    const long double t94 = t28 - t88;
+    const long double t95 = t29 - t89;
+    const long double t96 = t30 + t90;
+    const long double t97 = t31 + t91;
+    const long double t98 = t30 - t90;
+    const long double t99 = t31 - t91;
+    const long double t100 = 0.382683432365089771723L * t69;
+    const long double t101 = 0.923879532511286756101L * t68;
+    const long double t102 = t100 + t101;
+    const long double t103 = 0.382683432365089771723L * t68;
+    const long double t104 = 0.923879532511286756101L * t69;
+    const long double t105 = t104 - t103;
+    const long double t106 = 0.923879532511286756156L * t85;
+    const long double t107 = 0.382683432365089771696L * t84;
+    const long double t108 = t106 + t107;
+    const long double t109 = 0.923879532511286756156L * t84;
+    const long double t110 = 0.382683432365089771696L * t85;
+    const long double t111 = t110 - t109;
+    const long double t112 = t102 + t108;
+    const long double t113 = t105 + t111;
+    const long double t114 = t105 - t111;
+    const long double t115 = t108 - t102;
+    const long double t116 = t48 + t112;
+    const long double t117 = t49 + t113;
+    const long double t118 = t48 - t112;
+    const long double t119 = t49 - t113;
+    const long double t120 = t50 + t114;
+    const long double t121 = t51 + t115;
+    const long double t122 = t50 - t114;
+    const long double t123 = t51 - t115;
+    const long double t124 = t66 + t67;
+    const long double t125 = 0.707106781186547524382L * t124;
+    const long double t126 = t67 - t66;
+    const long double t127 = 0.707106781186547524382L * t126;
+    const long double t128 = t82 - t83;
+    const long double t129 = 0.707106781186547524382L * t128;
+    const long double t130 = t82 + t83;
+    const long double t131 = 0.707106781186547524382L * t130;
+    const long double t132 = t125 - t129;
+    const long double t133 = t127 - t131;
+    const long double t134 = t125 + t129;
+    const long double t135 = t127 + t131;
+    const long double t136 = t32 + t132;
+    const long double t137 = t33 + t133;
+    const long double t138 = t32 - t132;
+    const long double t139 = t33 - t133;
+    const long double t140 = t34 + t135;
+    const long double t141 = t35 - t134;
+    const long double t142 = t34 - t135;
+    const long double t143 = t35 + t134;
+    const long double t144 = 0.923879532511286756156L * t71;
+    const long double t145 = 0.382683432365089771696L * t70;
+    const long double t146 = t144 + t145;
+    const long double t147 = 0.923879532511286756156L * t70;
+    const long double t148 = 0.382683432365089771696L * t71;
+    const long double t149 = t148 - t147;
+    const long double t150 = 0.382683432365089771859L * t87;
+    const long double t151 = 0.923879532511286756101L * t86;
+    const long double t152 = t150 + t151;
+    const long double t153 = 0.382683432365089771859L * t86;
+    const long double t154 = 0.923879532511286756101L * t87;
+    const long double t155 = t153 - t154;
+    const long double t156 = t146 - t152;
+    const long double t157 = t149 + t155;
+    const long double t158 = t146 + t152;
+    const long double t159 = t149 - t155;
+    const long double t160 = t52 + t156;
+    const long double t161 = t53 + t157;
+    const long double t162 = t52 - t156;
+    const long double t163 = t53 - t157;
+    const long double t164 = t54 + t159;
+    const long double t165 = t55 - t158;
+    const long double t166 = t54 - t159;
+    const long double t167 = t55 + t158;
+    const long double t168 = x2r + x34r;
+    const long double t169 = x2i + x34i;
+    const long double t170 = x2r - x34r;
+    const long double t171 = x2i - x34i;
+    const long double t172 = x18r + x50r;
+    const long double t173 = x18i + x50i;
+    const long double t174 = x18i - x50i;
+    const long double t175 = x50r - x18r;
+    const long double t176 = t168 + t172;
+    const long double t177 = t169 + t173;
+    const long double t178 = t168 - t172;
+    const long double t179 = t169 - t173;
+    const long double t180 = t170 + t174;
+    const long double t181 = t171 + t175;
+    const long double t182 = t170 - t174;
+    const long double t183 = t171 - t175;
+    const long double t184 = x10r + x42r;
+    const long double t185 = x10i + x42i;
+    const long double t186 = x10r - x42r;
+    const long double t187 = x10i - x42i;
+    const long double t188 = x26r + x58r;
+    const long double t189 = x26i + x58i;
+    const long double t190 = x26r - x58r;
+    const long double t191 = x26i - x58i;
+    const long double t192 = t184 + t188;
+    const long double t193 = t185 + t189;
+    const long double t194 = t185 - t189;
+    const long double t195 = t188 - t184;
+    const long double t196 = t176 + t192;
+    const long double t197 = t177 + t193;
+    const long double t198 = t176 - t192;
+    const long double t199 = t177 - t193;
+    const long double t200 = t178 + t194;
+    const long double t201 = t179 + t195;
+    const long double t202 = t178 - t194;
+    const long double t203 = t179 - t195;
+    const long double t204 = t186 + t187;
+    const long double t205 = 0.707106781186547524382L * t204;
+    const long double t206 = t187 - t186;
+    const long double t207 = 0.707106781186547524382L * t206;
+    const long double t208 = t190 - t191;
+    const long double t209 = 0.707106781186547524382L * t208;
+    const long double t210 = t190 + t191;
+    const long double t211 = 0.707106781186547524382L * t210;
+    const long double t212 = t205 - t209;
+    const long double t213 = t207 - t211;
+    const long double t214 = t205 + t209;
+    const long double t215 = t207 + t211;
+    const long double t216 = t180 + t212;
+    const long double t217 = t181 + t213;
+    const long double t218 = t180 - t212;
+    const long double t219 = t181 - t213;
+    const long double t220 = t182 + t215;
+    const long double t221 = t183 - t214;
+    const long double t222 = t182 - t215;
+    const long double t223 = t183 + t214;
+    const long double t224 = x6r + x38r;
+    const long double t225 = x6i + x38i;
+    const long double t226 = x6r - x38r;
+    const long double t227 = x6i - x38i;
+    const long double t228 = x22r + x54r;
+    const long double t229 = x22i + x54i;
+    const long double t230 = x22i - x54i;
+    const long double t231 = x54r - x22r;
+    const long double t232 = t224 + t228;
+    const long double t233 = t225 + t229;
+    const long double t234 = t224 - t228;
+    const long double t235 = t225 - t229;
+    const long double t236 = t226 + t230;
+    const long double t237 = t227 + t231;
+    const long double t238 = t226 - t230;
+    const long double t239 = t227 - t231;
+    const long double t240 = x14r + x46r;
+    const long double t241 = x14i + x46i;
+    const long double t242 = x14r - x46r;
+    const long double t243 = x14i - x46i;
+    const long double t244 = x30r + x62r;
+    const long double t245 = x30i + x62i;
+    const long double t246 = x30r - x62r;
+    const long double t247 = x30i - x62i;
+    const long double t248 = t240 + t244;
+    const long double t249 = t241 + t245;
+    const long double t250 = t241 - t245;
+    const long double t251 = t244 - t240;
+    const long double t252 = t232 + t248;
+    const long double t253 = t233 + t249;
+    const long double t254 = t232 - t248;
+    const long double t255 = t233 - t249;
+    const long double t256 = t234 + t250;
+    const long double t257 = t235 + t251;
+    const long double t258 = t234 - t250;
+    const long double t259 = t235 - t251;
+    const long double t260 = t242 + t243;
+    const long double t261 = 0.707106781186547524382L * t260;
+    const long double t262 = t243 - t242;
+    const long double t263 = 0.707106781186547524382L * t262;
+    const long double t264 = t246 - t247;
+    const long double t265 = 0.707106781186547524382L * t264;
+    const long double t266 = t246 + t247;
+    const long double t267 = 0.707106781186547524382L * t266;
+    const long double t268 = t261 - t265;
+    const long double t269 = t263 - t267;
+    const long double t270 = t261 + t265;
+    const long double t271 = t263 + t267;
+    const long double t272 = t236 + t268;
+    const long double t273 = t237 + t269;
+    const long double t274 = t236 - t268;
+    const long double t275 = t237 - t269;
+    const long double t276 = t238 + t271;
+    const long double t277 = t239 - t270;
+    const long double t278 = t238 - t271;
+    const long double t279 = t239 + t270;
+    const long double t280 = t196 + t252;
+    const long double t281 = t197 + t253;
+    const long double t282 = t197 - t253;
+    const long double t283 = t252 - t196;
+    const long double t284 = t92 + t280;
+    const long double t285 = t93 + t281;
+    const long double t286 = t92 - t280;
+    const long double t287 = t93 - t281;
+    const long double t288 = t94 + t282;
+    const long double t289 = t95 + t283;
+    const long double t290 = t94 - t282;
+    const long double t291 = t95 - t283;
+    const long double t292 = 0.195090322016128267857L * t217;
+    const long double t293 = 0.980785280403230449119L * t216;
+    const long double t294 = t292 + t293;
+    const long double t295 = 0.195090322016128267857L * t216;
+    const long double t296 = 0.980785280403230449119L * t217;
+    const long double t297 = t296 - t295;
+    const long double t298 = 0.555570233019602224757L * t273;
+    const long double t299 = 0.831469612302545237081L * t272;
+    const long double t300 = t298 + t299;
+    const long double t301 = 0.555570233019602224757L * t272;
+    const long double t302 = 0.831469612302545237081L * t273;
+    const long double t303 = t302 - t301;
+    const long double t304 = t294 + t300;
+    const long double t305 = t297 + t303;
+    const long double t306 = t297 - t303;
+    const long double t307 = t300 - t294;
+    const long double t308 = t116 + t304;
+    const long double t309 = t117 + t305;
+    const long double t310 = t116 - t304;
+    const long double t311 = t117 - t305;
+    const long double t312 = t118 + t306;
+    const long double t313 = t119 + t307;
+    const long double t314 = t118 - t306;
+    const long double t315 = t119 - t307;
+    const long double t316 = 0.382683432365089771723L * t201;
+    const long double t317 = 0.923879532511286756101L * t200;
+    const long double t318 = t316 + t317;
+    const long double t319 = 0.382683432365089771723L * t200;
+    const long double t320 = 0.923879532511286756101L * t201;
+    const long double t321 = t320 - t319;
+    const long double t322 = 0.923879532511286756156L * t257;
+    const long double t323 = 0.382683432365089771696L * t256;
+    const long double t324 = t322 + t323;
+    const long double t325 = 0.923879532511286756156L * t256;
+    const long double t326 = 0.382683432365089771696L * t257;
+    const long double t327 = t326 - t325;
+    const long double t328 = t318 + t324;
+    const long double t329 = t321 + t327;
+    const long double t330 = t321 - t327;
+    const long double t331 = t324 - t318;
+    const long double t332 = t136 + t328;
+    const long double t333 = t137 + t329;
+    const long double t334 = t136 - t328;
+    const long double t335 = t137 - t329;
+    const long double t336 = t138 + t330;
+    const long double t337 = t139 + t331;
+    const long double t338 = t138 - t330;
+    const long double t339 = t139 - t331;
+    const long double t340 = 0.555570233019602224757L * t221;
+    const long double t341 = 0.831469612302545237081L * t220;
+    const long double t342 = t340 + t341;
+    const long double t343 = 0.555570233019602224757L * t220;
+    const long double t344 = 0.831469612302545237081L * t221;
+    const long double t345 = t344 - t343;
+    const long double t346 = 0.980785280403230449119L * t277;
+    const long double t347 = 0.195090322016128267911L * t276;
+    const long double t348 = t346 - t347;
+    const long double t349 = 0.980785280403230449119L * t276;
+    const long double t350 = 0.195090322016128267911L * t277;
+    const long double t351 = t349 + t350;
+    const long double t352 = t342 + t348;
+    const long double t353 = t345 - t351;
+    const long double t354 = t345 + t351;
+    const long double t355 = t348 - t342;
+    const long double t356 = t160 + t352;
+    const long double t357 = t161 + t353;
+    const long double t358 = t160 - t352;
+    const long double t359 = t161 - t353;
+    const long double t360 = t162 + t354;
+    const long double t361 = t163 + t355;
+    const long double t362 = t162 - t354;
+    const long double t363 = t163 - t355;
+    const long double t364 = t198 + t199;
+    const long double t365 = 0.707106781186547524382L * t364;
+    const long double t366 = t199 - t198;
+    const long double t367 = 0.707106781186547524382L * t366;
+    const long double t368 = t254 - t255;
+    const long double t369 = 0.707106781186547524382L * t368;
+    const long double t370 = t254 + t255;
+    const long double t371 = 0.707106781186547524382L * t370;
+    const long double t372 = t365 - t369;
+    const long double t373 = t367 - t371;
+    const long double t374 = t365 + t369;
+    const long double t375 = t367 + t371;
+    const long double t376 = t96 + t372;
+    const long double t377 = t97 + t373;
+    const long double t378 = t96 - t372;
+    const long double t379 = t97 - t373;
+    const long double t380 = t98 + t375;
+    const long double t381 = t99 - t374;
+    const long double t382 = t98 - t375;
+    const long double t383 = t99 + t374;
+    const long double t384 = 0.831469612302545237081L * t219;
+    const long double t385 = 0.555570233019602224757L * t218;
+    const long double t386 = t384 + t385;
+    const long double t387 = 0.831469612302545237081L * t218;
+    const long double t388 = 0.555570233019602224757L * t219;
+    const long double t389 = t388 - t387;
+    const long double t390 = 0.195090322016128267735L * t275;
+    const long double t391 = 0.980785280403230449173L * t274;
+    const long double t392 = t390 - t391;
+    const long double t393 = 0.195090322016128267735L * t274;
+    const long double t394 = 0.980785280403230449173L * t275;
+    const long double t395 = t393 + t394;
+    const long double t396 = t386 + t392;
+    const long double t397 = t389 - t395;
+    const long double t398 = t389 + t395;
+    const long double t399 = t392 - t386;
+    const long double t400 = t120 + t396;
+    const long double t401 = t121 + t397;
+    const long double t402 = t120 - t396;
+    const long double t403 = t121 - t397;
+    const long double t404 = t122 + t398;
+    const long double t405 = t123 + t399;
+    const long double t406 = t122 - t398;
+    const long double t407 = t123 - t399;
+    const long double t408 = 0.923879532511286756156L * t203;
+    const long double t409 = 0.382683432365089771696L * t202;
+    const long double t410 = t408 + t409;
+    const long double t411 = 0.923879532511286756156L * t202;
+    const long double t412 = 0.382683432365089771696L * t203;
+    const long double t413 = t412 - t411;
+    const long double t414 = 0.382683432365089771859L * t259;
+    const long double t415 = 0.923879532511286756101L * t258;
+    const long double t416 = t414 + t415;
+    const long double t417 = 0.382683432365089771859L * t258;
+    const long double t418 = 0.923879532511286756101L * t259;
+    const long double t419 = t417 - t418;
+    const long double t420 = t410 - t416;
+    const long double t421 = t413 + t419;
+    const long double t422 = t410 + t416;
+    const long double t423 = t413 - t419;
+    const long double t424 = t140 + t420;
+    const long double t425 = t141 + t421;
+    const long double t426 = t140 - t420;
+    const long double t427 = t141 - t421;
+    const long double t428 = t142 + t423;
+    const long double t429 = t143 - t422;
+    const long double t430 = t142 - t423;
+    const long double t431 = t143 + t422;
+    const long double t432 = 0.980785280403230449119L * t223;
+    const long double t433 = 0.19509032201612826787L * t222;
+    const long double t434 = t432 + t433;
+    const long double t435 = 0.980785280403230449119L * t222;
+    const long double t436 = 0.19509032201612826787L * t223;
+    const long double t437 = t436 - t435;
+    const long double t438 = 0.831469612302545237189L * t279;
+    const long double t439 = 0.555570233019602224595L * t278;
+    const long double t440 = t438 + t439;
+    const long double t441 = 0.831469612302545237189L * t278;
+    const long double t442 = 0.555570233019602224595L * t279;
+    const long double t443 = t441 - t442;
+    const long double t444 = t434 - t440;
+    const long double t445 = t437 + t443;
+    const long double t446 = t434 + t440;
+    const long double t447 = t437 - t443;
+    const long double t448 = t164 + t444;
+    const long double t449 = t165 + t445;
+    const long double t450 = t164 - t444;
+    const long double t451 = t165 - t445;
+    const long double t452 = t166 + t447;
+    const long double t453 = t167 - t446;
+    const long double t454 = t166 - t447;
+    const long double t455 = t167 + t446;
+    const long double t456 = x1r + x33r;
+    const long double t457 = x1i + x33i;
+    const long double t458 = x1r - x33r;
+    const long double t459 = x1i - x33i;
+    const long double t460 = x17r + x49r;
+    const long double t461 = x17i + x49i;
+    const long double t462 = x17i - x49i;
+    const long double t463 = x49r - x17r;
+    const long double t464 = t456 + t460;
+    const long double t465 = t457 + t461;
+    const long double t466 = t456 - t460;
+    const long double t467 = t457 - t461;
+    const long double t468 = t458 + t462;
+    const long double t469 = t459 + t463;
+    const long double t470 = t458 - t462;
+    const long double t471 = t459 - t463;
+    const long double t472 = x9r + x41r;
+    const long double t473 = x9i + x41i;
+    const long double t474 = x9r - x41r;
+    const long double t475 = x9i - x41i;
+    const long double t476 = x25r + x57r;
+    const long double t477 = x25i + x57i;
+    const long double t478 = x25r - x57r;
+    const long double t479 = x25i - x57i;
+    const long double t480 = t472 + t476;
+    const long double t481 = t473 + t477;
+    const long double t482 = t473 - t477;
+    const long double t483 = t476 - t472;
+    const long double t484 = t464 + t480;
+    const long double t485 = t465 + t481;
+    const long double t486 = t464 - t480;
+    const long double t487 = t465 - t481;
+    const long double t488 = t466 + t482;
+    const long double t489 = t467 + t483;
+    const long double t490 = t466 - t482;
+    const long double t491 = t467 - t483;
+    const long double t492 = t474 + t475;
+    const long double t493 = 0.707106781186547524382L * t492;
+    const long double t494 = t475 - t474;
+    const long double t495 = 0.707106781186547524382L * t494;
+    const long double t496 = t478 - t479;
+    const long double t497 = 0.707106781186547524382L * t496;
+    const long double t498 = t478 + t479;
+    const long double t499 = 0.707106781186547524382L * t498;
+    const long double t500 = t493 - t497;
+    const long double t501 = t495 - t499;
+    const long double t502 = t493 + t497;
+    const long double t503 = t495 + t499;
+    const long double t504 = t468 + t500;
+    const long double t505 = t469 + t501;
+    const long double t506 = t468 - t500;
+    const long double t507 = t469 - t501;
+    const long double t508 = t470 + t503;
+    const long double t509 = t471 - t502;
+    const long double t510 = t470 - t503;
+    const long double t511 = t471 + t502;
+    const long double t512 = x5r + x37r;
+    const long double t513 = x5i + x37i;
+    const long double t514 = x5r - x37r;
+    const long double t515 = x5i - x37i;
+    const long double t516 = x21r + x53r;
+    const long double t517 = x21i + x53i;
+    const long double t518 = x21i - x53i;
+    const long double t519 = x53r - x21r;
+    const long double t520 = t512 + t516;
+    const long double t521 = t513 + t517;
+    const long double t522 = t512 - t516;
+    const long double t523 = t513 - t517;
+    const long double t524 = t514 + t518;
+    const long double t525 = t515 + t519;
+    const long double t526 = t514 - t518;
+    const long double t527 = t515 - t519;
+    const long double t528 = x13r + x45r;
+    const long double t529 = x13i + x45i;
+    const long double t530 = x13r - x45r;
+    const long double t531 = x13i - x45i;
+    const long double t532 = x29r + x61r;
+    const long double t533 = x29i + x61i;
+    const long double t534 = x29i - x61i;
+    const long double t535 = x61r - x29r;
+    const long double t536 = t528 + t532;
+    const long double t537 = t529 + t533;
+    const long double t538 = t528 - t532;
+    const long double t539 = t529 - t533;
+    const long double t540 = t530 + t534;
+    const long double t541 = t531 + t535;
+    const long double t542 = t530 - t534;
+    const long double t543 = t531 - t535;
+    const long double t544 = t520 + t536;
+    const long double t545 = t521 + t537;
+    const long double t546 = t521 - t537;
+    const long double t547 = t536 - t520;
+    const long double t548 = t484 + t544;
+    const long double t549 = t485 + t545;
+    const long double t550 = t484 - t544;
+    const long double t551 = t485 - t545;
+    const long double t552 = t486 + t546;
+    const long double t553 = t487 + t547;
+    const long double t554 = t486 - t546;
+    const long double t555 = t487 - t547;
+    const long double t556 = 0.382683432365089771723L * t525;
+    const long double t557 = 0.923879532511286756101L * t524;
+    const long double t558 = t556 + t557;
+    const long double t559 = 0.382683432365089771723L * t524;
+    const long double t560 = 0.923879532511286756101L * t525;
+    const long double t561 = t560 - t559;
+    const long double t562 = 0.923879532511286756156L * t541;
+    const long double t563 = 0.382683432365089771696L * t540;
+    const long double t564 = t562 + t563;
+    const long double t565 = 0.923879532511286756156L * t540;
+    const long double t566 = 0.382683432365089771696L * t541;
+    const long double t567 = t566 - t565;
+    const long double t568 = t558 + t564;
+    const long double t569 = t561 + t567;
+    const long double t570 = t561 - t567;
+    const long double t571 = t564 - t558;
+    const long double t572 = t504 + t568;
+    const long double t573 = t505 + t569;
+    const long double t574 = t504 - t568;
+    const long double t575 = t505 - t569;
+    const long double t576 = t506 + t570;
+    const long double t577 = t507 + t571;
+    const long double t578 = t506 - t570;
+    const long double t579 = t507 - t571;
+    const long double t580 = t522 + t523;
+    const long double t581 = 0.707106781186547524382L * t580;
+    const long double t582 = t523 - t522;
+    const long double t583 = 0.707106781186547524382L * t582;
+    const long double t584 = t538 - t539;
+    const long double t585 = 0.707106781186547524382L * t584;
+    const long double t586 = t538 + t539;
+    const long double t587 = 0.707106781186547524382L * t586;
+    const long double t588 = t581 - t585;
+    const long double t589 = t583 - t587;
+    const long double t590 = t581 + t585;
+    const long double t591 = t583 + t587;
+    const long double t592 = t488 + t588;
+    const long double t593 = t489 + t589;
+    const long double t594 = t488 - t588;
+    const long double t595 = t489 - t589;
+    const long double t596 = t490 + t591;
+    const long double t597 = t491 - t590;
+    const long double t598 = t490 - t591;
+    const long double t599 = t491 + t590;
+    const long double t600 = 0.923879532511286756156L * t527;
+    const long double t601 = 0.382683432365089771696L * t526;
+    const long double t602 = t600 + t601;
+    const long double t603 = 0.923879532511286756156L * t526;
+    const long double t604 = 0.382683432365089771696L * t527;
+    const long double t605 = t604 - t603;
+    const long double t606 = 0.382683432365089771859L * t543;
+    const long double t607 = 0.923879532511286756101L * t542;
+    const long double t608 = t606 + t607;
+    const long double t609 = 0.382683432365089771859L * t542;
+    const long double t610 = 0.923879532511286756101L * t543;
+    const long double t611 = t609 - t610;
+    const long double t612 = t602 - t608;
+    const long double t613 = t605 + t611;
+    const long double t614 = t602 + t608;
+    const long double t615 = t605 - t611;
+    const long double t616 = t508 + t612;
+    const long double t617 = t509 + t613;
+    const long double t618 = t508 - t612;
+    const long double t619 = t509 - t613;
+    const long double t620 = t510 + t615;
+    const long double t621 = t511 - t614;
+    const long double t622 = t510 - t615;
+    const long double t623 = t511 + t614;
+    const long double t624 = x3r + x35r;
+    const long double t625 = x3i + x35i;
+    const long double t626 = x3r - x35r;
+    const long double t627 = x3i - x35i;
+    const long double t628 = x19r + x51r;
+    const long double t629 = x19i + x51i;
+    const long double t630 = x19i - x51i;
+    const long double t631 = x51r - x19r;
+    const long double t632 = t624 + t628;
+    const long double t633 = t625 + t629;
+    const long double t634 = t624 - t628;
+    const long double t635 = t625 - t629;
+    const long double t636 = t626 + t630;
+    const long double t637 = t627 + t631;
+    const long double t638 = t626 - t630;
+    const long double t639 = t627 - t631;
+    const long double t640 = x11r + x43r;
+    const long double t641 = x11i + x43i;
+    const long double t642 = x11r - x43r;
+    const long double t643 = x11i - x43i;
+    const long double t644 = x27r + x59r;
+    const long double t645 = x27i + x59i;
+    const long double t646 = x27r - x59r;
+    const long double t647 = x27i - x59i;
+    const long double t648 = t640 + t644;
+    const long double t649 = t641 + t645;
+    const long double t650 = t641 - t645;
+    const long double t651 = t644 - t640;
+    const long double t652 = t632 + t648;
+    const long double t653 = t633 + t649;
+    const long double t654 = t632 - t648;
+    const long double t655 = t633 - t649;
+    const long double t656 = t634 + t650;
+    const long double t657 = t635 + t651;
+    const long double t658 = t634 - t650;
+    const long double t659 = t635 - t651;
+    const long double t660 = t642 + t643;
+    const long double t661 = 0.707106781186547524382L * t660;
+    const long double t662 = t643 - t642;
+    const long double t663 = 0.707106781186547524382L * t662;
+    const long double t664 = t646 - t647;
+    const long double t665 = 0.707106781186547524382L * t664;
+    const long double t666 = t646 + t647;
+    const long double t667 = 0.707106781186547524382L * t666;
+    const long double t668 = t661 - t665;
+    const long double t669 = t663 - t667;
+    const long double t670 = t661 + t665;
+    const long double t671 = t663 + t667;
+    const long double t672 = t636 + t668;
+    const long double t673 = t637 + t669;
+    const long double t674 = t636 - t668;
+    const long double t675 = t637 - t669;
+    const long double t676 = t638 + t671;
+    const long double t677 = t639 - t670;
+    const long double t678 = t638 - t671;
+    const long double t679 = t639 + t670;
+    const long double t680 = x7r + x39r;
+    const long double t681 = x7i + x39i;
+    const long double t682 = x7r - x39r;
+    const long double t683 = x7i - x39i;
+    const long double t684 = x23r + x55r;
+    const long double t685 = x23i + x55i;
+    const long double t686 = x23i - x55i;
+    const long double t687 = x55r - x23r;
+    const long double t688 = t680 + t684;
+    const long double t689 = t681 + t685;
+    const long double t690 = t680 - t684;
+    const long double t691 = t681 - t685;
+    const long double t692 = t682 + t686;
+    const long double t693 = t683 + t687;
+    const long double t694 = t682 - t686;
+    const long double t695 = t683 - t687;
+    const long double t696 = x15r + x47r;
+    const long double t697 = x15i + x47i;
+    const long double t698 = x15r - x47r;
+    const long double t699 = x15i - x47i;
+    const long double t700 = x31r + x63r;
+    const long double t701 = x31i + x63i;
+    const long double t702 = x31i - x63i;
+    const long double t703 = x63r - x31r;
+    const long double t704 = t696 + t700;
+    const long double t705 = t697 + t701;
+    const long double t706 = t696 - t700;
+    const long double t707 = t697 - t701;
+    const long double t708 = t698 + t702;
+    const long double t709 = t699 + t703;
+    const long double t710 = t698 - t702;
+    const long double t711 = t699 - t703;
+    const long double t712 = t688 + t704;
+    const long double t713 = t689 + t705;
+    const long double t714 = t689 - t705;
+    const long double t715 = t704 - t688;
+    const long double t716 = t652 + t712;
+    const long double t717 = t653 + t713;
+    const long double t718 = t652 - t712;
+    const long double t719 = t653 - t713;
+    const long double t720 = t654 + t714;
+    const long double t721 = t655 + t715;
+    const long double t722 = t654 - t714;
+    const long double t723 = t655 - t715;
+    const long double t724 = 0.382683432365089771723L * t693;
+    const long double t725 = 0.923879532511286756101L * t692;
+    const long double t726 = t724 + t725;
+    const long double t727 = 0.382683432365089771723L * t692;
+    const long double t728 = 0.923879532511286756101L * t693;
+    const long double t729 = t728 - t727;
+    const long double t730 = 0.923879532511286756156L * t709;
+    const long double t731 = 0.382683432365089771696L * t708;
+    const long double t732 = t730 + t731;
+    const long double t733 = 0.923879532511286756156L * t708;
+    const long double t734 = 0.382683432365089771696L * t709;
+    const long double t735 = t734 - t733;
+    const long double t736 = t726 + t732;
+    const long double t737 = t729 + t735;
+    const long double t738 = t729 - t735;
+    const long double t739 = t732 - t726;
+    const long double t740 = t672 + t736;
+    const long double t741 = t673 + t737;
+    const long double t742 = t672 - t736;
+    const long double t743 = t673 - t737;
+    const long double t744 = t674 + t738;
+    const long double t745 = t675 + t739;
+    const long double t746 = t674 - t738;
+    const long double t747 = t675 - t739;
+    const long double t748 = t690 + t691;
+    const long double t749 = 0.707106781186547524382L * t748;
+    const long double t750 = t691 - t690;
+    const long double t751 = 0.707106781186547524382L * t750;
+    const long double t752 = t706 - t707;
+    const long double t753 = 0.707106781186547524382L * t752;
+    const long double t754 = t706 + t707;
+    const long double t755 = 0.707106781186547524382L * t754;
+    const long double t756 = t749 - t753;
+    const long double t757 = t751 - t755;
+    const long double t758 = t749 + t753;
+    const long double t759 = t751 + t755;
+    const long double t760 = t656 + t756;
+    const long double t761 = t657 + t757;
+    const long double t762 = t656 - t756;
+    const long double t763 = t657 - t757;
+    const long double t764 = t658 + t759;
+    const long double t765 = t659 - t758;
+    const long double t766 = t658 - t759;
+    const long double t767 = t659 + t758;
+    const long double t768 = 0.923879532511286756156L * t695;
+    const long double t769 = 0.382683432365089771696L * t694;
+    const long double t770 = t768 + t769;
+    const long double t771 = 0.923879532511286756156L * t694;
+    const long double t772 = 0.382683432365089771696L * t695;
+    const long double t773 = t772 - t771;
+    const long double t774 = 0.382683432365089771859L * t711;
+    const long double t775 = 0.923879532511286756101L * t710;
+    const long double t776 = t774 + t775;
+    const long double t777 = 0.382683432365089771859L * t710;
+    const long double t778 = 0.923879532511286756101L * t711;
+    const long double t779 = t777 - t778;
+    const long double t780 = t770 - t776;
+    const long double t781 = t773 + t779;
+    const long double t782 = t770 + t776;
+    const long double t783 = t773 - t779;
+    const long double t784 = t676 + t780;
+    const long double t785 = t677 + t781;
+    const long double t786 = t676 - t780;
+    const long double t787 = t677 - t781;
+    const long double t788 = t678 + t783;
+    const long double t789 = t679 - t782;
+    const long double t790 = t678 - t783;
+    const long double t791 = t679 + t782;
+    const long double t792 = t548 + t716;
+    const long double t793 = t549 + t717;
+    const long double t794 = t549 - t717;
+    const long double t795 = t716 - t548;
+    const long double t796 = t284 + t792;
+    const long double t797 = t285 + t793;
+    const long double t798 = t284 - t792;
+    const long double t799 = t285 - t793;
+    const long double t800 = t286 + t794;
+    const long double t801 = t287 + t795;
+    const long double t802 = t286 - t794;
+    const long double t803 = t287 - t795;
+    const long double t804 = 0.0980171403295606019957L * t573;
+    const long double t805 = 0.995184726672196886231L * t572;
+    const long double t806 = t804 + t805;
+    const long double t807 = 0.0980171403295606019957L * t572;
+    const long double t808 = 0.995184726672196886231L * t573;
+    const long double t809 = t808 - t807;
+    const long double t810 = 0.290284677254462367645L * t741;
+    const long double t811 = 0.956940335732208864931L * t740;
+    const long double t812 = t810 + t811;
+    const long double t813 = 0.290284677254462367645L * t740;
+    const long double t814 = 0.956940335732208864931L * t741;
+    const long double t815 = t814 - t813;
+    const long double t816 = t806 + t812;
+    const long double t817 = t809 + t815;
+    const long double t818 = t809 - t815;
+    const long double t819 = t812 - t806;
+    const long double t820 = t308 + t816;
+    const long double t821 = t309 + t817;
+    const long double t822 = t308 - t816;
+    const long double t823 = t309 - t817;
+    const long double t824 = t310 + t818;
+    const long double t825 = t311 + t819;
+    const long double t826 = t310 - t818;
+    const long double t827 = t311 - t819;
+    const long double t828 = 0.195090322016128267857L * t593;
+    const long double t829 = 0.980785280403230449119L * t592;
+    const long double t830 = t828 + t829;
+    const long double t831 = 0.195090322016128267857L * t592;
+    const long double t832 = 0.980785280403230449119L * t593;
+    const long double t833 = t832 - t831;
+    const long double t834 = 0.555570233019602224757L * t761;
+    const long double t835 = 0.831469612302545237081L * t760;
+    const long double t836 = t834 + t835;
+    const long double t837 = 0.555570233019602224757L * t760;
+    const long double t838 = 0.831469612302545237081L * t761;
+    const long double t839 = t838 - t837;
+    const long double t840 = t830 + t836;
+    const long double t841 = t833 + t839;
+    const long double t842 = t833 - t839;
+    const long double t843 = t836 - t830;
+    const long double t844 = t332 + t840;
+    const long double t845 = t333 + t841;
+    const long double t846 = t332 - t840;
+    const long double t847 = t333 - t841;
+    const long double t848 = t334 + t842;
+    const long double t849 = t335 + t843;
+    const long double t850 = t334 - t842;
+    const long double t851 = t335 - t843;
+    const long double t852 = 0.290284677254462367645L * t617;
+    const long double t853 = 0.956940335732208864931L * t616;
+    const long double t854 = t852 + t853;
+    const long double t855 = 0.290284677254462367645L * t616;
+    const long double t856 = 0.956940335732208864931L * t617;
+    const long double t857 = t856 - t855;
+    const long double t858 = 0.773010453362736960851L * t785;
+    const long double t859 = 0.634393284163645498203L * t784;
+    const long double t860 = t858 + t859;
+    const long double t861 = 0.773010453362736960851L * t784;
+    const long double t862 = 0.634393284163645498203L * t785;
+    const long double t863 = t862 - t861;
+    const long double t864 = t854 + t860;
+    const long double t865 = t857 + t863;
+    const long double t866 = t857 - t863;
+    const long double t867 = t860 - t854;
+    const long double t868 = t356 + t864;
+    const long double t869 = t357 + t865;
+    const long double t870 = t356 - t864;
+    const long double t871 = t357 - t865;
+    const long double t872 = t358 + t866;
+    const long double t873 = t359 + t867;
+    const long double t874 = t358 - t866;
+    const long double t875 = t359 - t867;
+    const long double t876 = 0.382683432365089771723L * t553;
+    const long double t877 = 0.923879532511286756101L * t552;
+    const long double t878 = t876 + t877;
+    const long double t879 = 0.382683432365089771723L * t552;
+    const long double t880 = 0.923879532511286756101L * t553;
+    const long double t881 = t880 - t879;
+    const long double t882 = 0.923879532511286756156L * t721;
+    const long double t883 = 0.382683432365089771696L * t720;
+    const long double t884 = t882 + t883;
+    const long double t885 = 0.923879532511286756156L * t720;
+    const long double t886 = 0.382683432365089771696L * t721;
+    const long double t887 = t886 - t885;
+    const long double t888 = t878 + t884;
+    const long double t889 = t881 + t887;
+    const long double t890 = t881 - t887;
+    const long double t891 = t884 - t878;
+    const long double t892 = t376 + t888;
+    const long double t893 = t377 + t889;
+    const long double t894 = t376 - t888;
+    const long double t895 = t377 - t889;
+    const long double t896 = t378 + t890;
+    const long double t897 = t379 + t891;
+    const long double t898 = t378 - t890;
+    const long double t899 = t379 - t891;
+    const long double t900 = 0.471396736825997648545L * t577;
+    const long double t901 = 0.881921264348355029715L * t576;
+    const long double t902 = t900 + t901;
+    const long double t903 = 0.471396736825997648545L * t576;
+    const long double t904 = 0.881921264348355029715L * t577;
+    const long double t905 = t904 - t903;
+    const long double t906 = 0.995184726672196886231L * t745;
+    const long double t907 = 0.0980171403295606019347L * t744;
+    const long double t908 = t906 + t907;
+    const long double t909 = 0.995184726672196886231L * t744;
+    const long double t910 = 0.0980171403295606019347L * t745;
+    const long double t911 = t910 - t909;
+    const long double t912 = t902 + t908;
+    const long double t913 = t905 + t911;
+    const long double t914 = t905 - t911;
+    const long double t915 = t908 - t902;
+    const long double t916 = t400 + t912;
+    const long double t917 = t401 + t913;
+    const long double t918 = t400 - t912;
+    const long double t919 = t401 - t913;
+    const long double t920 = t402 + t914;
+    const long double t921 = t403 + t915;
+    const long double t922 = t402 - t914;
+    const long double t923 = t403 - t915;
+    const long double t924 = 0.555570233019602224757L * t597;
+    const long double t925 = 0.831469612302545237081L * t596;
+    const long double t926 = t924 + t925;
+    const long double t927 = 0.555570233019602224757L * t596;
+    const long double t928 = 0.831469612302545237081L * t597;
+    const long double t929 = t928 - t927;
+    const long double t930 = 0.980785280403230449119L * t765;
+    const long double t931 = 0.195090322016128267911L * t764;
+    const long double t932 = t930 - t931;
+    const long double t933 = 0.980785280403230449119L * t764;
+    const long double t934 = 0.195090322016128267911L * t765;
+    const long double t935 = t933 + t934;
+    const long double t936 = t926 + t932;
+    const long double t937 = t929 - t935;
+    const long double t938 = t929 + t935;
+    const long double t939 = t932 - t926;
+    const long double t940 = t424 + t936;
+    const long double t941 = t425 + t937;
+    const long double t942 = t424 - t936;
+    const long double t943 = t425 - t937;
+    const long double t944 = t426 + t938;
+    const long double t945 = t427 + t939;
+    const long double t946 = t426 - t938;
+    const long double t947 = t427 - t939;
+    const long double t948 = 0.634393284163645498203L * t621;
+    const long double t949 = 0.773010453362736960797L * t620;
+    const long double t950 = t948 + t949;
+    const long double t951 = 0.634393284163645498203L * t620;
+    const long double t952 = 0.773010453362736960797L * t621;
+    const long double t953 = t952 - t951;
+    const long double t954 = 0.881921264348355029661L * t789;
+    const long double t955 = 0.471396736825997648626L * t788;
+    const long double t956 = t954 - t955;
+    const long double t957 = 0.881921264348355029661L * t788;
+    const long double t958 = 0.471396736825997648626L * t789;
+    const long double t959 = t957 + t958;
+    const long double t960 = t950 + t956;
+    const long double t961 = t953 - t959;
+    const long double t962 = t953 + t959;
+    const long double t963 = t956 - t950;
+    const long double t964 = t448 + t960;
+    const long double t965 = t449 + t961;
+    const long double t966 = t448 - t960;
+    const long double t967 = t449 - t961;
+    const long double t968 = t450 + t962;
+    const long double t969 = t451 + t963;
+    const long double t970 = t450 - t962;
+    const long double t971 = t451 - t963;
+    const long double t972 = t550 + t551;
+    const long double t973 = 0.707106781186547524382L * t972;
+    const long double t974 = t551 - t550;
+    const long double t975 = 0.707106781186547524382L * t974;
+    const long double t976 = t718 - t719;
+    const long double t977 = 0.707106781186547524382L * t976;
+    const long double t978 = t718 + t719;
+    const long double t979 = 0.707106781186547524382L * t978;
+    const long double t980 = t973 - t977;
+    const long double t981 = t975 - t979;
+    const long double t982 = t973 + t977;
+    const long double t983 = t975 + t979;
+    const long double t984 = t288 + t980;
+    const long double t985 = t289 + t981;
+    const long double t986 = t288 - t980;
+    const long double t987 = t289 - t981;
+    const long double t988 = t290 + t983;
+    const long double t989 = t291 - t982;
+    const long double t990 = t290 - t983;
+    const long double t991 = t291 + t982;
+    const long double t992 = 0.773010453362736960851L * t575;
+    const long double t993 = 0.634393284163645498203L * t574;
+    const long double t994 = t992 + t993;
+    const long double t995 = 0.773010453362736960851L * t574;
+    const long double t996 = 0.634393284163645498203L * t575;
+    const long double t997 = t996 - t995;
+    const long double t998 = 0.471396736825997648464L * t743;
+    const long double t999 = 0.881921264348355029769L * t742;
+    const long double t1000 = t998 - t999;
+    const long double t1001 = 0.471396736825997648464L * t742;
+    const long double t1002 = 0.881921264348355029769L * t743;
+    const long double t1003 = t1001 + t1002;
+    const long double t1004 = t994 + t1000;
+    const long double t1005 = t997 - t1003;
+    const long double t1006 = t997 + t1003;
+    const long double t1007 = t1000 - t994;
+    const long double t1008 = t312 + t1004;
+    const long double t1009 = t313 + t1005;
+    const long double t1010 = t312 - t1004;
+    const long double t1011 = t313 - t1005;
+    const long double t1012 = t314 + t1006;
+    const long double t1013 = t315 + t1007;
+    const long double t1014 = t314 - t1006;
+    const long double t1015 = t315 - t1007;
+    const long double t1016 = 0.831469612302545237081L * t595;
+    const long double t1017 = 0.555570233019602224757L * t594;
+    const long double t1018 = t1016 + t1017;
+    const long double t1019 = 0.831469612302545237081L * t594;
+    const long double t1020 = 0.555570233019602224757L * t595;
+    const long double t1021 = t1020 - t1019;
+    const long double t1022 = 0.195090322016128267735L * t763;
+    const long double t1023 = 0.980785280403230449173L * t762;
+    const long double t1024 = t1022 - t1023;
+    const long double t1025 = 0.195090322016128267735L * t762;
+    const long double t1026 = 0.980785280403230449173L * t763;
+    const long double t1027 = t1025 + t1026;
+    const long double t1028 = t1018 + t1024;
+    const long double t1029 = t1021 - t1027;
+    const long double t1030 = t1021 + t1027;
+    const long double t1031 = t1024 - t1018;
+    const long double t1032 = t336 + t1028;
+    const long double t1033 = t337 + t1029;
+    const long double t1034 = t336 - t1028;
+    const long double t1035 = t337 - t1029;
+    const long double t1036 = t338 + t1030;
+    const long double t1037 = t339 + t1031;
+    const long double t1038 = t338 - t1030;
+    const long double t1039 = t339 - t1031;
+    const long double t1040 = 0.881921264348355029715L * t619;
+    const long double t1041 = 0.471396736825997648572L * t618;
+    const long double t1042 = t1040 + t1041;
+    const long double t1043 = 0.881921264348355029715L * t618;
+    const long double t1044 = 0.471396736825997648572L * t619;
+    const long double t1045 = t1044 - t1043;
+    const long double t1046 = 0.0980171403295606021177L * t787;
+    const long double t1047 = 0.995184726672196886231L * t786;
+    const long double t1048 = t1046 + t1047;
+    const long double t1049 = 0.0980171403295606021177L * t786;
+    const long double t1050 = 0.995184726672196886231L * t787;
+    const long double t1051 = t1049 - t1050;
+    const long double t1052 = t1042 - t1048;
+    const long double t1053 = t1045 + t1051;
+    const long double t1054 = t1042 + t1048;
+    const long double t1055 = t1045 - t1051;
+    const long double t1056 = t360 + t1052;
+    const long double t1057 = t361 + t1053;
+    const long double t1058 = t360 - t1052;
+    const long double t1059 = t361 - t1053;
+    const long double t1060 = t362 + t1055;
+    const long double t1061 = t363 - t1054;
+    const long double t1062 = t362 - t1055;
+    const long double t1063 = t363 + t1054;
+    const long double t1064 = 0.923879532511286756156L * t555;
+    const long double t1065 = 0.382683432365089771696L * t554;
+    const long double t1066 = t1064 + t1065;
+    const long double t1067 = 0.923879532511286756156L * t554;
+    const long double t1068 = 0.382683432365089771696L * t555;
+    const long double t1069 = t1068 - t1067;
+    const long double t1070 = 0.382683432365089771859L * t723;
+    const long double t1071 = 0.923879532511286756101L * t722;
+    const long double t1072 = t1070 + t1071;
+    const long double t1073 = 0.382683432365089771859L * t722;
+    const long double t1074 = 0.923879532511286756101L * t723;
+    const long double t1075 = t1073 - t1074;
+    const long double t1076 = t1066 - t1072;
+    const long double t1077 = t1069 + t1075;
+    const long double t1078 = t1066 + t1072;
+    const long double t1079 = t1069 - t1075;
+    const long double t1080 = t380 + t1076;
+    const long double t1081 = t381 + t1077;
+    const long double t1082 = t380 - t1076;
+    const long double t1083 = t381 - t1077;
+    const long double t1084 = t382 + t1079;
+    const long double t1085 = t383 - t1078;
+    const long double t1086 = t382 - t1079;
+    const long double t1087 = t383 + t1078;
+    const long double t1088 = 0.956940335732208864931L * t579;
+    const long double t1089 = 0.290284677254462367618L * t578;
+    const long double t1090 = t1088 + t1089;
+    const long double t1091 = 0.956940335732208864931L * t578;
+    const long double t1092 = 0.290284677254462367618L * t579;
+    const long double t1093 = t1092 - t1091;
+    const long double t1094 = 0.634393284163645498311L * t747;
+    const long double t1095 = 0.773010453362736960742L * t746;
+    const long double t1096 = t1094 + t1095;
+    const long double t1097 = 0.634393284163645498311L * t746;
+    const long double t1098 = 0.773010453362736960742L * t747;
+    const long double t1099 = t1097 - t1098;
+    const long double t1100 = t1090 - t1096;
+    const long double t1101 = t1093 + t1099;
+    const long double t1102 = t1090 + t1096;
+    const long double t1103 = t1093 - t1099;
+    const long double t1104 = t404 + t1100;
+    const long double t1105 = t405 + t1101;
+    const long double t1106 = t404 - t1100;
+    const long double t1107 = t405 - t1101;
+    const long double t1108 = t406 + t1103;
+    const long double t1109 = t407 - t1102;
+    const long double t1110 = t406 - t1103;
+    const long double t1111 = t407 + t1102;
+    const long double t1112 = 0.980785280403230449119L * t599;
+    const long double t1113 = 0.19509032201612826787L * t598;
+    const long double t1114 = t1112 + t1113;
+    const long double t1115 = 0.980785280403230449119L * t598;
+    const long double t1116 = 0.19509032201612826787L * t599;
+    const long double t1117 = t1116 - t1115;
+    const long double t1118 = 0.831469612302545237189L * t767;
+    const long double t1119 = 0.555570233019602224595L * t766;
+    const long double t1120 = t1118 + t1119;
+    const long double t1121 = 0.831469612302545237189L * t766;
+    const long double t1122 = 0.555570233019602224595L * t767;
+    const long double t1123 = t1121 - t1122;
+    const long double t1124 = t1114 - t1120;
+    const long double t1125 = t1117 + t1123;
+    const long double t1126 = t1114 + t1120;
+    const long double t1127 = t1117 - t1123;
+    const long double t1128 = t428 + t1124;
+    const long double t1129 = t429 + t1125;
+    const long double t1130 = t428 - t1124;
+    const long double t1131 = t429 - t1125;
+    const long double t1132 = t430 + t1127;
+    const long double t1133 = t431 - t1126;
+    const long double t1134 = t430 - t1127;
+    const long double t1135 = t431 + t1126;
+    const long double t1136 = 0.995184726672196886231L * t623;
+    const long double t1137 = 0.0980171403295606019347L * t622;
+    const long double t1138 = t1136 + t1137;
+    const long double t1139 = 0.995184726672196886231L * t622;
+    const long double t1140 = 0.0980171403295606019347L * t623;
+    const long double t1141 = t1140 - t1139;
+    const long double t1142 = 0.956940335732208864931L * t791;
+    const long double t1143 = 0.290284677254462367672L * t790;
+    const long double t1144 = t1142 + t1143;
+    const long double t1145 = 0.956940335732208864931L * t790;
+    const long double t1146 = 0.290284677254462367672L * t791;
+    const long double t1147 = t1145 - t1146;
+    const long double t1148 = t1138 - t1144;
+    const long double t1149 = t1141 + t1147;
+    const long double t1150 = t1138 + t1144;
+    const long double t1151 = t1141 - t1147;
+    const long double t1152 = t452 + t1148;
+    const long double t1153 = t453 + t1149;
+    const long double t1154 = t452 - t1148;
+    const long double t1155 = t453 - t1149;
+    const long double t1156 = t454 + t1151;
+    const long double t1157 = t455 - t1150;
+    const long double t1158 = t454 - t1151;
+    const long double t1159 = t455 + t1150;
+    ro[0] = t796;
+    io[0] = t797;
+    ro[os] = t820;
+    io[os] = t821;
+    ro[2 * os] = t844;
+    io[2 * os] = t845;
+    ro[3 * os] = t868;
+    io[3 * os] = t869;
+    ro[4 * os] = t892;
+    io[4 * os] = t893;
+    ro[5 * os] = t916;
+    io[5 * os] = t917;
+    ro[6 * os] = t940;
+    io[6 * os] = t941;
+    ro[7 * os] = t964;
+    io[7 * os] = t965;
+    ro[8 * os] = t984;
+    io[8 * os] = t985;
+    ro[9 * os] = t1008;
+    io[9 * os] = t1009;
+    ro[10 * os] = t1032;
+    io[10 * os] = t1033;
+    ro[11 * os] = t1056;
+    io[11 * os] = t1057;
+    ro[12 * os] = t1080;
+    io[12 * os] = t1081;
+    ro[13 * os] = t1104;
+    io[13 * os] = t1105;
+    ro[14 * os] = t1128;
+    io[14 * os] = t1129;
+    ro[15 * os] = t1152;
+    io[15 * os] = t1153;
+    ro[16 * os] = t800;
+    io[16 * os] = t801;
+    ro[17 * os] = t824;
+    io[17 * os] = t825;
+    ro[18 * os] = t848;
+    io[18 * os] = t849;
+    ro[19 * os] = t872;
+    io[19 * os] = t873;
+    ro[20 * os] = t896;
+    io[20 * os] = t897;
+    ro[21 * os] = t920;
+    io[21 * os] = t921;
+    ro[22 * os] = t944;
+    io[22 * os] = t945;
+    ro[23 * os] = t968;
+    io[23 * os] = t969;
+    ro[24 * os] = t988;
+    io[24 * os] = t989;
+    ro[25 * os] = t1012;
+    io[25 * os] = t1013;
+    ro[26 * os] = t1036;
+    io[26 * os] = t1037;
+    ro[27 * os] = t1060;
+    io[27 * os] = t1061;
+    ro[28 * os] = t1084;
+    io[28 * os] = t1085;
+    ro[29 * os] = t1108;
+    io[29 * os] = t1109;
+    ro[30 * os] = t1132;
+    io[30 * os] = t1133;
+    ro[31 * os] = t1156;
+    io[31 * os] = t1157;
+    ro[32 * os] = t798;
+    io[32 * os] = t799;
+    ro[33 * os] = t822;
+    io[33 * os] = t823;
+    ro[34 * os] = t846;
+    io[34 * os] = t847;
+    ro[35 * os] = t870;
+    io[35 * os] = t871;
+    ro[36 * os] = t894;
+    io[36 * os] = t895;
+    ro[37 * os] = t918;
+    io[37 * os] = t919;
+    ro[38 * os] = t942;
+    io[38 * os] = t943;
+    ro[39 * os] = t966;
+    io[39 * os] = t967;
+    ro[40 * os] = t986;
+    io[40 * os] = t987;
+    ro[41 * os] = t1010;
+    io[41 * os] = t1011;
+    ro[42 * os] = t1034;
+    io[42 * os] = t1035;
+    ro[43 * os] = t1058;
+    io[43 * os] = t1059;
+    ro[44 * os] = t1082;
+    io[44 * os] = t1083;
+    ro[45 * os] = t1106;
+    io[45 * os] = t1107;
+    ro[46 * os] = t1130;
+    io[46 * os] = t1131;
+    ro[47 * os] = t1154;
+    io[47 * os] = t1155;
+    ro[48 * os] = t802;
+    io[48 * os] = t803;
+    ro[49 * os] = t826;
+    io[49 * os] = t827;
+    ro[50 * os] = t850;
+    io[50 * os] = t851;
+    ro[51 * os] = t874;
+    io[51 * os] = t875;
+    ro[52 * os] = t898;
+    io[52 * os] = t899;
+    ro[53 * os] = t922;
+    io[53 * os] = t923;
+    ro[54 * os] = t946;
+    io[54 * os] = t947;
+    ro[55 * os] = t970;
+    io[55 * os] = t971;
+    ro[56 * os] = t990;
+    io[56 * os] = t991;
+    ro[57 * os] = t1014;
+    io[57 * os] = t1015;
+    ro[58 * os] = t1038;
+    io[58 * os] = t1039;
+    ro[59 * os] = t1062;
+    io[59 * os] = t1063;
+    ro[60 * os] = t1086;
+    io[60 * os] = t1087;
+    ro[61 * os] = t1110;
+    io[61 * os] = t1111;
+    ro[62 * os] = t1134;
+    io[62 * os] = t1135;
+    ro[63 * os] = t1158;
+    io[63 * os] = t1159;
+}
+
+fftl_codelet fftl_codelet_find(int n) {
+    switch(n) {
+        case 2: return fftl_codelet_2;
+        case 3: return fftl_codelet_3;
+        case 4: return fftl_codelet_4;
+        case 5: return fftl_codelet_5;
+        case 6: return fftl_codelet_6;
+        case 7: return fftl_codelet_7;
+        case 8: return fftl_codelet_8;
+        case 16: return fftl_codelet_16;
+        case 32: return fftl_codelet_32;
+        case 64: return fftl_codelet_64;
+        default: return 0;
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef FFT_CODELETS_H
+#define FFT_CODELETS_H
+
+// Generated by gen_codelets.c, do not edit.
+// Straight-line DFTs of fixed sizes. A codelet reads the n points (ri[j*is], ii[j*is]), real and
+// imaginary parts through separate pointers and strides in scalars, and writes the forward
+// transform, sum_j x_j exp(-2*pi*i*j*k/n), to (ro[k*os], io[k*os]). All the inputs are loaded
+// before the first store, so the transform may be done in place. For interleaved complex data
+// (Complex, fftw_complex) pass ri = (double*)x, ii = ri + 1 and twice the stride in elements;
+// for split data pass the two arrays. The backward transform is the forward one with the real
+// and imaginary pointers swapped, on input and output.
+// fft_codelet_N works on doubles, fftf_codelet_N on floats and fftl_codelet_N on long doubles.
+
+#define FFT_CODELET_MAX 64
+
+typedef void (*fft_codelet)(const double *ri, const double *ii, double *ro, double *io, long is, long os);
+void fft_codelet_2(const double *ri, const double *ii, double *ro, double *io, long is, long os);
+void fft_codelet_3(const double *ri, const double *ii, double *ro, double *io, long is, long os);
+void fft_codelet_4(const double *ri, const double *ii, double *ro, double *io, long is, long os);
+void fft_codelet_5(const double *ri, const double *ii, double *ro, double *io, long is, long os);
+void fft_codelet_6(const double *ri, const double *ii, double *ro, double *io, long is, long os);
+void fft_codelet_7(const double *ri, const double *ii, double *ro, double *io, long is, long os);
+void fft_codelet_8(const double *ri, const double *ii, double *ro, double *io, long is, long os);
+void fft_codelet_16(const double *ri, const double *ii, double *ro, double *io, long is, long os);
+void fft_codelet_32(const double *ri, const double *ii, double *ro, double *io, long is, long os);
+void fft_codelet_64(const double *ri, const double *ii, double *ro, double *io, long is, long os);
+// Codelet of n points, NULL if there is none
+fft_codelet fft_codelet_find(int n);
+
+typedef void (*fftf_codelet)(const float *ri, const float *ii, float *ro, float *io, long is, long os);
+void fftf_codelet_2(const float *ri, const float *ii, float *ro, float *io, long is, long os);
+void fftf_codelet_3(const float *ri, const float *ii, float *ro, float *io, long is, long os);
+void fftf_codelet_4(const float *ri, const float *ii, float *ro, float *io, long is, long os);
+void fftf_codelet_5(const float *ri, const float *ii, float *ro, float *io, long is, long os);
+void fftf_codelet_6(const float *ri, const float *ii, float *ro, float *io, long is, long os);
+void fftf_codelet_7(const float *ri, const float *ii, float *ro, float *io, long is, long os);
+void fftf_codelet_8(const float *ri, const float *ii, float *ro, float *io, long is, long os);
+void fftf_codelet_16(const float *ri, const float *ii, float *ro, float *io, long is, long os);
+void fftf_codelet_32(const float *ri, const float *ii, float *ro, float *io, long is, long os);
+void fftf_codelet_64(const float *ri, const float *ii, float *ro, float *io, long is, long os);
+// Codelet of n points, NULL if there is none
+fftf_codelet fftf_codelet_find(int n);
+
+typedef void (*fftl_codelet)(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os);
+void fftl_codelet_2(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os);
+void fftl_codelet_3(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os);
+void fftl_codelet_4(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os);
+void fftl_codelet_5(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os);
+void fftl_codelet_6(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os);
+void fftl_codelet_7(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os);
+void fftl_codelet_8(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os);
+void fftl_codelet_16(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os);
+void fftl_codelet_32(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os);
+void fftl_codelet_64(const long double *ri, const long double *ii, long double *ro, long double *io, long is, long os);
+// Codelet of n points, NULL if there is none
+fftl_codelet fftl_codelet_find(int n);
+
+#endif
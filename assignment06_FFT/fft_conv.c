@@ -0,0 +1,371 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "fft_conv.h"
+#include "fft_internal.h"
+
+// Multiply-adds of the direct sum that take as long as one P log2 P of the FFT path (forward and
+// backward real transforms of P points and the product of the spectra), measured with FFT_conv
+#define FFT_CONV_DIRECT_COST 1.0
+
+// Default block of the direct streams (the FFT streams get theirs from the kernel size)
+#define FFT_CONV_DIRECT_BLOCK 4096
+
+struct fft_conv_s {
+    int rank;
+    int n[2], k[2], out[2];    // signal, kernel and output shapes (rank 1: n[0] = k[0] = out[0] = 1)
+    int shift[2];              // circular correlation: the output is rolled by k - 1
+    int mode;
+    int direct;
+    double *kernel;            // k[0] x k[1], in convolution order (reversed for correlation)
+    int L[2];                  // transform shape (L[0] = 1 for rank 1)
+    fft_plan r2c, c2r;
+    Complex *kernel_spectrum;  // L[0] x (L[1]/2+1), divided by L[0]*L[1]
+    double *padded;            // L[0] x L[1]
+    Complex *spectrum;         // L[0] x (L[1]/2+1)
+};
+
+struct fft_conv_stream_s {
+    int k, block, L;
+    int direct;
+    double *kernel;            // k values, in convolution order
+    double *frame;             // the last k-1 samples, then up to block new ones
+    int filled;                // new samples in the frame
+    long total_in, emitted;
+    fft_plan r2c, c2r;
+    Complex *kernel_spectrum;  // L/2+1 values, divided by L
+    Complex *spectrum;
+    double *result;            // L values
+};
+
+static int next_power_of_two(int n) {
+    int p = 1;
+    while(p < n) p *= 2;
+    return p;
+}
+
+static double fft_cost(double points) {
+    return points > 1 ? FFT_CONV_DIRECT_COST * points * log2(points) : 1.0;
+}
+
+// Kernel in convolution order: correlating with h is convolving with h reversed along every axis
+static double *copy_kernel(const double *kernel, int k0, int k1, int operation) {
+    double *g = (double*)checked_malloc((size_t)k0 * k1 * sizeof(double));
+    for(int a = 0; a < k0; a++) {
+        for(int b = 0; b < k1; b++) {
+            g[a*k1 + b] = operation == FFT_CONV_CORRELATION ? kernel[(k0-1-a)*k1 + (k1-1-b)] : kernel[a*k1 + b];
+        }
+    }
+    return g;
+}
+
+// kernel_spectrum = FFT of the kernel placed in an L[0] x L[1] array, divided by L[0]*L[1] so
+// that the backward transform needs no normalization
+static void build_kernel_spectrum(struct fft_conv_s *c) {
+    size_t points = (size_t)c->L[0] * c->L[1];
+    size_t half = (size_t)c->L[0] * (c->L[1]/2 + 1);
+    memset(c->padded, 0, points * sizeof(double));
+    for(int a = 0; a < c->k[0]; a++) {
+        for(int b = 0; b < c->k[1]; b++) {
+            int r = ((a - c->shift[0]) % c->L[0] + c->L[0]) % c->L[0];
+            int s = ((b - c->shift[1]) % c->L[1] + c->L[1]) % c->L[1];
+            c->padded[(size_t)r * c->L[1] + s] += c->kernel[a*c->k[1] + b];
+        }
+    }
+    fft_execute_r2c(c->r2c, c->padded, c->kernel_spectrum);
+    for(size_t i = 0; i < half; i++) {
+        c->kernel_spectrum[i].real /= (double)points;
+        c->kernel_spectrum[i].imag /= (double)points;
+    }
+}
+
+static fft_conv create(int rank, int n0, int n1, const double *kernel, int k0, int k1, int operation, int mode,
+                       unsigned flags) {
+    if(n0 < 1 || n1 < 1 || k0 < 1 || k1 < 1 || !kernel) return NULL;
+    if(mode == FFT_CONV_CIRCULAR && (k0 > n0 || k1 > n1)) return NULL;
+
+    struct fft_conv_s *c = (struct fft_conv_s*)checked_malloc(sizeof(struct fft_conv_s));
+    memset(c, 0, sizeof(struct fft_conv_s));
+    c->rank = rank;
+    c->mode = mode;
+    c->n[0] = n0; c->n[1] = n1;
+    c->k[0] = k0; c->k[1] = k1;
+    if(mode == FFT_CONV_LINEAR) {
+        c->out[0] = n0 + k0 - 1;
+        c->out[1] = n1 + k1 - 1;
+        c->L[0] = next_power_of_two(c->out[0]);
+        c->L[1] = next_power_of_two(c->out[1]);
+    } else {
+        c->out[0] = c->L[0] = n0;
+        c->out[1] = c->L[1] = n1;
+        if(operation == FFT_CONV_CORRELATION) {
+            c->shift[0] = k0 - 1;
+            c->shift[1] = k1 - 1;
+        }
+    }
+    c->kernel = copy_kernel(kernel, k0, k1, operation);
+
+    double direct_cost = (double)n0 * n1 * k0 * k1;
+    if(flags & FFT_CONV_DIRECT) {
+        c->direct = 1;
+    } else if(flags & FFT_CONV_FFT) {
+        c->direct = 0;
+    } else {
+        c->direct = direct_cost <= fft_cost((double)c->L[0] * c->L[1]);
+    }
+    if(c->direct) return c;
+
+    unsigned fft_flags = flags & ~(FFT_CONV_DIRECT | FFT_CONV_FFT);
+    c->r2c = fft_plan_create_r2c_nd(rank, c->L + 2 - rank, fft_flags);
+    c->c2r = fft_plan_create_c2r_nd(rank, c->L + 2 - rank, fft_flags);
+    size_t half = (size_t)c->L[0] * (c->L[1]/2 + 1);
+    c->padded = (double*)checked_malloc((size_t)c->L[0] * c->L[1] * sizeof(double));
+    c->spectrum = (Complex*)checked_malloc(half * sizeof(Complex));
+    c->kernel_spectrum = (Complex*)checked_malloc(half * sizeof(Complex));
+    build_kernel_spectrum(c);
+    return c;
+}
+
+fft_conv fft_conv_create(int n, const double *kernel, int k, int operation, int mode, unsigned flags) {
+    return create(1, 1, n, kernel, 1, k, operation, mode, flags);
+}
+
+fft_conv fft_conv_create_2d(int n0, int n1, const double *kernel, int k0, int k1, int operation, int mode,
+                            unsigned flags) {
+    return create(2, n0, n1, kernel, k0, k1, operation, mode, flags);
+}
+
+int fft_conv_output_size(const fft_conv plan) {
+    return plan->out[0] * plan->out[1];
+}
+
+int fft_conv_is_direct(const fft_conv plan) {
+    return plan->direct;
+}
+
+// One tap at a time: out += g[a][b] * x shifted by (a, b), so the inner loop runs over a whole row
+static void execute_direct(const struct fft_conv_s *c, const double *in, double *out) {
+    int n0 = c->n[0], n1 = c->n[1], m1 = c->out[1];
+    memset(out, 0, (size_t)c->out[0] * m1 * sizeof(double));
+
+    for(int a = 0; a < c->k[0]; a++) {
+        for(int b = 0; b < c->k[1]; b++) {
+            double g = c->kernel[a*c->k[1] + b];
+            if(g == 0.0) continue;
+            if(c->mode == FFT_CONV_LINEAR) {
+                for(int i = 0; i < n0; i++) {
+                    const double *x = in + (size_t)i * n1;
+                    double *y = out + (size_t)(i + a) * m1 + b;
+                    for(int j = 0; j < n1; j++) {
+                        y[j] += g * x[j];
+                    }
+                }
+            } else {
+                // Column j goes to (j + s) mod n1: the row is added in two segments
+                int s = ((b - c->shift[1]) % n1 + n1) % n1;
+                for(int i = 0; i < n0; i++) {
+                    const double *x = in + (size_t)i * n1;
+                    double *y = out + (size_t)(((i + a - c->shift[0]) % n0 + n0) % n0) * n1;
+                    for(int j = 0; j < n1 - s; j++) {
+                        y[s + j] += g * x[j];
+                    }
+                    for(int j = n1 - s; j < n1; j++) {
+                        y[j - (n1 - s)] += g * x[j];
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void multiply_spectra(Complex *spectrum, const Complex *kernel_spectrum, size_t count) {
+    for(size_t i = 0; i < count; i++) {
+        double re = spectrum[i].real * kernel_spectrum[i].real - spectrum[i].imag * kernel_spectrum[i].imag;
+        double im = spectrum[i].real * kernel_spectrum[i].imag + spectrum[i].imag * kernel_spectrum[i].real;
+        spectrum[i].real = re;
+        spectrum[i].imag = im;
+    }
+}
+
+void fft_conv_execute(const fft_conv plan, const double *in, double *out) {
+    const struct fft_conv_s *c = plan;
+    if(c->direct) {
+        execute_direct(c, in, out);
+        return;
+    }
+
+    int L1 = c->L[1];
+    memset(c->padded, 0, (size_t)c->L[0] * L1 * sizeof(double));
+    for(int i = 0; i < c->n[0]; i++) {
+        memcpy(c->padded + (size_t)i * L1, in + (size_t)i * c->n[1], c->n[1] * sizeof(double));
+    }
+    fft_execute_r2c(c->r2c, c->padded, c->spectrum);
+    multiply_spectra(c->spectrum, c->kernel_spectrum, (size_t)c->L[0] * (L1/2 + 1));
+    fft_execute_c2r(c->c2r, c->spectrum, c->padded);
+    for(int i = 0; i < c->out[0]; i++) {
+        memcpy(out + (size_t)i * c->out[1], c->padded + (size_t)i * L1, c->out[1] * sizeof(double));
+    }
+}
+
+void fft_conv_destroy(fft_conv plan) {
+    if(!plan) return;
+    if(!plan->direct) {
+        fft_plan_destroy(plan->r2c);
+        fft_plan_destroy(plan->c2r);
+        free(plan->padded);
+        free(plan->spectrum);
+        free(plan->kernel_spectrum);
+    }
+    free(plan->kernel);
+    free(plan);
+}
+
+fft_conv_stream fft_conv_stream_create(const double *kernel, int k, int operation, int block, unsigned flags) {
+    if(k < 1 || block < 0 || !kernel) return NULL;
+
+    struct fft_conv_stream_s *s = (struct fft_conv_stream_s*)checked_malloc(sizeof(struct fft_conv_stream_s));
+    memset(s, 0, sizeof(struct fft_conv_stream_s));
+    s->k = k;
+    s->kernel = copy_kernel(kernel, 1, k, operation);
+
+    // Overlap-save costs about one L log2 L per block of L - k + 1 outputs; four times the kernel
+    // length keeps the overlap (the k - 1 repeated samples) to a quarter of each transform
+    s->L = next_power_of_two(block > 0 ? block + k - 1 : 4 * k);
+    if(s->L < 64) s->L = 64;
+    int fft_block = s->L - k + 1;
+
+    if(flags & FFT_CONV_DIRECT) {
+        s->direct = 1;
+    } else if(flags & FFT_CONV_FFT) {
+        s->direct = 0;
+    } else {
+        s->direct = (double)k * fft_block <= fft_cost(s->L);
+    }
+
+    if(s->direct) {
+        s->block = block > 0 ? block : FFT_CONV_DIRECT_BLOCK;
+        s->frame = (double*)checked_malloc((size_t)(k - 1 + s->block) * sizeof(double));
+    } else {
+        unsigned fft_flags = flags & ~(FFT_CONV_DIRECT | FFT_CONV_FFT);
+        s->block = fft_block;
+        s->frame = (double*)checked_malloc((size_t)s->L * sizeof(double));
+        s->result = (double*)checked_malloc((size_t)s->L * sizeof(double));
+        s->spectrum = (Complex*)checked_malloc((size_t)(s->L/2 + 1) * sizeof(Complex));
+        s->kernel_spectrum = (Complex*)checked_malloc((size_t)(s->L/2 + 1) * sizeof(Complex));
+        s->r2c = fft_plan_create_r2c(s->L, fft_flags);
+        s->c2r = fft_plan_create_c2r(s->L, fft_flags);
+
+        memset(s->result, 0, (size_t)s->L * sizeof(double));
+        memcpy(s->result, s->kernel, (size_t)k * sizeof(double));
+        fft_execute_r2c(s->r2c, s->result, s->kernel_spectrum);
+        for(int i = 0; i <= s->L/2; i++) {
+            s->kernel_spectrum[i].real /= s->L;
+            s->kernel_spectrum[i].imag /= s->L;
+        }
+    }
+    memset(s->frame, 0, (size_t)(k - 1) * sizeof(double));
+    return s;
+}
+
+int fft_conv_stream_block(const fft_conv_stream stream) {
+    return stream->block;
+}
+
+// Direct path: the count samples after the history give count outputs, then the last k-1
+// samples become the history
+static void stream_direct(struct fft_conv_stream_s *s, int count, double *out) {
+    int k = s->k;
+    const double *x = s->frame + k - 1;
+    memset(out, 0, (size_t)count * sizeof(double));
+    for(int j = 0; j < k; j++) {
+        double g = s->kernel[j];
+        const double *xj = x - j;
+        for(int t = 0; t < count; t++) {
+            out[t] += g * xj[t];
+        }
+    }
+    memmove(s->frame, s->frame + count, (size_t)(k - 1) * sizeof(double));
+}
+
+// FFT path: circular convolution of the whole frame, whose last block values are the linear
+// convolution outputs of the block (the first k-1 wrap around and are dropped)
+static void stream_block(struct fft_conv_stream_s *s, double *out, int count) {
+    int k = s->k;
+    fft_execute_r2c(s->r2c, s->frame, s->spectrum);
+    multiply_spectra(s->spectrum, s->kernel_spectrum, (size_t)(s->L/2 + 1));
+    fft_execute_c2r(s->c2r, s->spectrum, s->result);
+    memcpy(out, s->result + k - 1, (size_t)count * sizeof(double));
+    memmove(s->frame, s->frame + s->L - (k - 1), (size_t)(k - 1) * sizeof(double));
+    s->filled = 0;
+}
+
+int fft_conv_stream_push(fft_conv_stream stream, const double *in, int count, double *out) {
+    struct fft_conv_stream_s *s = stream;
+    int written = 0;
+    while(count > 0) {
+        int take = s->block - s->filled < count ? s->block - s->filled : count;
+        memcpy(s->frame + s->k - 1 + s->filled, in, (size_t)take * sizeof(double));
+        s->filled += take;
+        s->total_in += take;
+        in += take;
+        count -= take;
+
+        if(s->direct) {
+            stream_direct(s, take, out + written);
+            s->filled = 0;
+            written += take;
+        } else if(s->filled == s->block) {
+            stream_block(s, out + written, s->block);
+            written += s->block;
+        }
+    }
+    s->emitted += written;
+    return written;
+}
+
+int fft_conv_stream_flush(fft_conv_stream stream, double *out) {
+    struct fft_conv_stream_s *s = stream;
+    long remaining = s->total_in + s->k - 1 - s->emitted;
+    int written = 0;
+
+    if(s->direct) {
+        // The tail is the direct sum over k-1 zeros after the last sample
+        while(remaining > 0) {
+            int count = remaining < s->block ? (int)remaining : s->block;
+            memset(s->frame + s->k - 1, 0, (size_t)count * sizeof(double));
+            stream_direct(s, count, out + written);
+            written += count;
+            remaining -= count;
+        }
+    } else {
+        while(remaining > 0) {
+            int count = remaining < s->block ? (int)remaining : s->block;
+            memset(s->frame + s->k - 1 + s->filled, 0, (size_t)(s->block - s->filled) * sizeof(double));
+            stream_block(s, out + written, count);
+            written += count;
+            remaining -= count;
+        }
+    }
+
+    memset(s->frame, 0, (size_t)(s->k - 1) * sizeof(double));
+    s->filled = 0;
+    s->total_in = 0;
+    s->emitted = 0;
+    return written;
+}
+
+void fft_conv_stream_destroy(fft_conv_stream stream) {
+    if(!stream) return;
+    if(!stream->direct) {
+        fft_plan_destroy(stream->r2c);
+        fft_plan_destroy(stream->c2r);
+        free(stream->result);
+        free(stream->spectrum);
+        free(stream->kernel_spectrum);
+    }
+    free(stream->kernel);
+    free(stream->frame);
+    free(stream);
+}
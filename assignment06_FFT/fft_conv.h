@@ -0,0 +1,51 @@
+#ifndef FFT_CONV_H
+#define FFT_CONV_H
+
+// Convolution and cross-correlation of real 1D signals and 2D fields with a fixed real kernel,
+// on top of the real-input plans of fft_engine.h. The kernel spectrum is computed once, when the
+// plan is created, and reused by every execution. Small kernels are summed directly when that
+// takes fewer operations than the transforms; FFT_CONV_DIRECT / FFT_CONV_FFT force one path.
+
+#include "fft_engine.h"
+
+// Operations, for a kernel h of k values (k0 x k1 in 2D)
+#define FFT_CONV_CONVOLUTION 0 // y[m] = sum_j h[j] x[m - j]
+#define FFT_CONV_CORRELATION 1 // y[m] = sum_j h[j] x[m + j - (k - 1)] (linear), x[m + j] (circular)
+
+// Modes
+#define FFT_CONV_LINEAR 0   // full result, n + k - 1 values (n0+k0-1 x n1+k1-1): x is zero outside
+#define FFT_CONV_CIRCULAR 1 // n values (n0 x n1): x is periodic, the kernel must fit in it
+
+// Flags, combined with the planner flags of fft_engine.h
+#define FFT_CONV_DIRECT (1u << 8) // always sum directly
+#define FFT_CONV_FFT (1u << 9)    // always use the FFT path
+
+typedef struct fft_conv_s *fft_conv;
+typedef struct fft_conv_stream_s *fft_conv_stream;
+
+// Plans for signals of n values (n0 x n1 fields) and the given kernel, which is copied.
+// Returns NULL for invalid sizes (circular with a kernel larger than the signal).
+fft_conv fft_conv_create(int n, const double *kernel, int k, int operation, int mode, unsigned flags);
+fft_conv fft_conv_create_2d(int n0, int n1, const double *kernel, int k0, int k1, int operation, int mode,
+                            unsigned flags);
+// out holds fft_conv_output_size(plan) values (row-major in 2D) and must not overlap in
+void fft_conv_execute(const fft_conv plan, const double *in, double *out);
+int fft_conv_output_size(const fft_conv plan);
+int fft_conv_is_direct(const fft_conv plan); // 1 if the plan sums directly
+void fft_conv_destroy(fft_conv plan);
+
+// Streaming linear convolution (or correlation) of a 1D signal of any length, given in pieces,
+// by overlap-save: blocks of B new samples and the last k-1 ones are transformed together. B is
+// at least block (block = 0 chooses it) and is returned by fft_conv_stream_block, since the
+// transform length is rounded up to a power of two. The outputs are the same as those of the
+// FFT_CONV_LINEAR plan on the whole signal, delivered in order: push returns how many were written
+// to out (at most count + B - 1, fewer than count while a block is incomplete), flush writes the
+// rest (at most B + k - 1) and makes the stream ready for a new signal. Direct streams deliver
+// every output as soon as its sample is pushed.
+fft_conv_stream fft_conv_stream_create(const double *kernel, int k, int operation, int block, unsigned flags);
+int fft_conv_stream_push(fft_conv_stream stream, const double *in, int count, double *out);
+int fft_conv_stream_flush(fft_conv_stream stream, double *out);
+int fft_conv_stream_block(const fft_conv_stream stream);
+void fft_conv_stream_destroy(fft_conv_stream stream);
+
+#endif
@@ -0,0 +1,106 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "fft_internal.h"
+#include "fft_transpose.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define FFT_HAVE_X86 1
+#endif
+
+static int is_power_of_two(int N) {
+    return N > 0 && (N & (N - 1)) == 0;
+}
+
+// The double engine; fft_precision.c builds the float and long double ones from the same code
+#define REAL double
+#define COMPLEX Complex
+#define PREFIX(name) fft_##name
+#define TRIG double
+#define VECTORIZE 1
+#define TRANSPOSE transpose_complex
+#include "fft_engine_template.h"
+#undef REAL
+#undef COMPLEX
+#undef PREFIX
+#undef TRIG
+#undef VECTORIZE
+#undef TRANSPOSE
+
+// Plans used by the plan-less interface, one per size (the direction is chosen at execution).
+// Plans are only added to the list until fft_cleanup, so a plan found under the lock can be
+// executed after it is released.
+static fft_plan cached_plans = NULL;
+static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static fft_plan get_cached_plan(enum fft_kind kind, int rank, int n0, int n1) {
+    pthread_mutex_lock(&cache_lock);
+    fft_plan p;
+    for(p = cached_plans; p; p = p->next_cached) {
+        if(p->kind != kind || p->rank != rank) continue;
+        if(rank == 1 && p->N == n1) break;
+        if(rank == 2 && p->shape[0] == n0 && p->shape[1] == n1 && p->nthreads == fft_planner_nthreads()) break;
+    }
+    if(p) {
+        pthread_mutex_unlock(&cache_lock);
+        return p;
+    }
+
+    if(kind == FFT_KIND_DFT) {
+        p = rank == 1 ? fft_plan_create(n1, FFT_FORWARD, FFT_DEFAULT)
+                      : fft_plan_create_2d(n0, n1, FFT_FORWARD, FFT_DEFAULT);
+    } else {
+        p = fft_create_real_1d(kind, n1, FFT_DEFAULT);
+    }
+    p->next_cached = cached_plans;
+    cached_plans = p;
+    pthread_mutex_unlock(&cache_lock);
+    return p;
+}
+
+void fft_cleanup(void) {
+    pthread_mutex_lock(&cache_lock);
+    while(cached_plans) {
+        fft_plan next = cached_plans->next_cached;
+        fft_plan_destroy(cached_plans);
+        cached_plans = next;
+    }
+    pthread_mutex_unlock(&cache_lock);
+}
+
+// In-place FFT of any length N (forward uses exp(-2*pi*i*jk/N), as FFTW_FORWARD)
+void fft(Complex *data, int N, int is_inverse) {
+    if(N <= 1) return;
+    fft_plan p = get_cached_plan(FFT_KIND_DFT, 1, 1, N);
+    Complex *work = fft_acquire_work(p);
+    fft_execute_1d(p, data, data, is_inverse, work);
+    fft_release_work(p, work);
+}
+
+void fft2d(Complex *data, int N, int is_inverse) {
+    if(N < 1) return;
+    fft_plan p = get_cached_plan(FFT_KIND_DFT, 2, N, N);
+    fft_execute_nd(p, data, data, is_inverse);
+}
+
+// FFT of a real row: only the first half + 1 of the spectrum is computed and stored
+void fft_real(double *input, Complex *output, int N) {
+    fft_plan p = get_cached_plan(FFT_KIND_R2C, 1, 1, N);
+    Complex *work = fft_acquire_work(p);
+    fft_execute_r2c_1d(p, input, output, work);
+    fft_release_work(p, work);
+}
+
+// Inverse of fft_real, normalized by N
+void ifft_real(Complex *input, double *output, int N) {
+    fft_plan p = get_cached_plan(FFT_KIND_C2R, 1, 1, N);
+    Complex *work = fft_acquire_work(p);
+    fft_execute_c2r_1d(p, input, output, work);
+    fft_release_work(p, work);
+    for(int i = 0; i < N; i++) {
+        output[i] /= N;
+    }
+}
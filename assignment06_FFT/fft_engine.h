@@ -0,0 +1,79 @@
+#ifndef FFT_ENGINE_H
+#define FFT_ENGINE_H
+
+typedef struct {
+    double real;
+    double imag;
+} Complex;
+
+// Transform directions, same values as FFTW_FORWARD / FFTW_BACKWARD
+#define FFT_FORWARD (-1)
+#define FFT_BACKWARD (+1)
+
+// Planner flags
+#define FFT_DEFAULT 0u
+#define FFT_FORCE_BLUESTEIN (1u << 0) // use the chirp-z path whatever the factorization of N
+#define FFT_NO_SIMD (1u << 1)         // keep the scalar butterflies even if the CPU has AVX2/AVX-512
+
+// A plan caches everything that depends only on the size: algorithm choice,
+// twiddle and permutation tables, sub-plans and scratch memory.
+typedef struct fft_plan_s *fft_plan;
+
+// Plans (modelled on fftw_plan_dft_1d / fftw_plan_dft_2d). The backward transform is
+// unnormalized: callers divide by N (or n0*n1). in == out is allowed (in-place transform).
+fft_plan fft_plan_create(int N, int direction, unsigned flags);
+fft_plan fft_plan_create_2d(int n0, int n1, int direction, unsigned flags);
+fft_plan fft_plan_create_3d(int n0, int n1, int n2, int direction, unsigned flags);
+// Any rank (modelled on fftw_plan_dft): row-major n[0] x n[1] x ... x n[rank-1] array
+fft_plan fft_plan_create_nd(int rank, const int *n, int direction, unsigned flags);
+void fft_execute(const fft_plan plan, const Complex *in, Complex *out);
+
+// Batched transforms (modelled on fftw_plan_many_dft with rank 1): howmany signals of length N,
+// element k of signal b at in[b*idist + k*istride] and out[b*odist + k*ostride]. Contiguous rows
+// are istride = 1, idist = N; the columns of an n0 x n1 matrix are N = n0, istride = n1, idist = 1.
+// In place (in == out) requires the same layout for input and output.
+fft_plan fft_plan_create_many(int N, int howmany, int istride, int idist, int ostride, int odist,
+                              int direction, unsigned flags);
+
+// Real-input transforms (modelled on fftw_plan_dft_r2c_2d / fftw_plan_dft_c2r_2d): a real
+// n0 x n1 array maps to the n0 x (n1/2+1) half spectrum, the rest follows from conjugate
+// symmetry. c2r is unnormalized and, like FFTW's, the 2D version overwrites its input.
+fft_plan fft_plan_create_r2c(int N, unsigned flags);
+fft_plan fft_plan_create_c2r(int N, unsigned flags);
+fft_plan fft_plan_create_r2c_2d(int n0, int n1, unsigned flags);
+fft_plan fft_plan_create_c2r_2d(int n0, int n1, unsigned flags);
+fft_plan fft_plan_create_r2c_3d(int n0, int n1, int n2, unsigned flags);
+fft_plan fft_plan_create_c2r_3d(int n0, int n1, int n2, unsigned flags);
+// Any rank: the real array is n[0] x ... x n[rank-1], the half spectrum n[0] x ... x (n[rank-1]/2+1).
+// c2r overwrites its input for rank >= 2.
+fft_plan fft_plan_create_r2c_nd(int rank, const int *n, unsigned flags);
+fft_plan fft_plan_create_c2r_nd(int rank, const int *n, unsigned flags);
+void fft_execute_r2c(const fft_plan plan, const double *in, Complex *out);
+void fft_execute_c2r(const fft_plan plan, Complex *in, double *out);
+void fft_plan_destroy(fft_plan plan);
+
+// Thread safety: plans may be created and executed from several threads at once, the same plan
+// included (on different arrays). An execution uses the plan's scratch when it is free and
+// allocates its own while another execution of the plan holds it. A plan must not be destroyed
+// while it is executed. The plan-less functions below may also be called from several threads;
+// fft_cleanup must not run concurrently with them.
+
+// Frees the plans cached by the functions below
+void fft_cleanup(void);
+
+// Threads (modelled on fftw_plan_with_nthreads): batched and 2D plans created after the call
+// spread their signals over nthreads threads (default 1). Every thread has its own scratch and
+// always gets the same signals, so the result is bitwise identical whatever the thread count.
+// fft_cleanup_threads stops the worker threads.
+void fft_plan_with_nthreads(int nthreads);
+int fft_planner_nthreads(void);
+void fft_cleanup_threads(void);
+
+// Plan-less interface: plans are created on the first call of each size and reused.
+// is_inverse = 0 computes the forward transform, is_inverse = 1 the unnormalized inverse.
+void fft(Complex *data, int N, int is_inverse);
+void fft2d(Complex *data, int N, int is_inverse); // data is a 2D NxN array reshaped into a 1D array
+void fft_real(double *input, Complex *output, int N);
+void ifft_real(Complex *input, double *output, int N);
+
+#endif
@@ -0,0 +1,1156 @@
+// Code of the engine for one precision, included once per scalar type (double by fft_engine.c,
+// float and long double by fft_precision.c) after fft_plan_template.h, with
+//   REAL          the scalar type
+//   COMPLEX       its interleaved (real, imag) pair
+//   PREFIX(name)  the prefix of every function and type of the precision (fft_, fftf_, fftl_)
+//   TRIG          the type the twiddles are computed in before being rounded once to REAL
+//   VECTORIZE     1 if the radix-4 passes have vector kernels (GCC vector types of REAL), else 0
+//   TRANSPOSE     the name of the blocked transpose of COMPLEX matrices defined here and declared
+//                 in fft_transpose.h (transpose_complex, transpose_complexf, transpose_complexl)
+// and FFT_HAVE_X86 and is_power_of_two defined by the including file (checked_malloc is in
+// fft_internal.h).
+// No include guard: every inclusion defines a new precision.
+
+void TRANSPOSE(const COMPLEX *in, int ld_in, COMPLEX *out, int ld_out, int rows, int cols) {
+    for(int i0 = 0; i0 < rows; i0 += TRANSPOSE_BLOCK) {
+        int i_end = i0 + TRANSPOSE_BLOCK < rows ? i0 + TRANSPOSE_BLOCK : rows;
+        for(int j0 = 0; j0 < cols; j0 += TRANSPOSE_BLOCK) {
+            int j_end = j0 + TRANSPOSE_BLOCK < cols ? j0 + TRANSPOSE_BLOCK : cols;
+            for(int i = i0; i < i_end; i++) {
+                for(int j = j0; j < j_end; j++) {
+                    out[(long)j*ld_out + i] = in[(long)i*ld_in + j];
+                }
+            }
+        }
+    }
+}
+
+// exp(-2*pi*i*k/n)
+static COMPLEX PREFIX(twiddle)(long long k, long long n) {
+    TRIG angle = -2 * (TRIG)3.14159265358979323846264338327950288L * (TRIG)k / (TRIG)n;
+    COMPLEX w;
+    if(sizeof(TRIG) > sizeof(double)) {
+        w.real = (REAL)cosl(angle);
+        w.imag = (REAL)sinl(angle);
+    } else {
+        w.real = (REAL)cos(angle);
+        w.imag = (REAL)sin(angle);
+    }
+    return w;
+}
+
+static void PREFIX(fill_twiddles)(COMPLEX *twiddles, int count, int N) {
+    for(int k = 0; k < count; k++) {
+        twiddles[k] = PREFIX(twiddle)(k, N);
+    }
+}
+
+// Split N into a leaf, the largest codelet size dividing N, and radices 4, 8, 2, 3, 5, 7 for the
+// rest; returns 0 if a larger prime factor is left. 2^a becomes radix-4 factors, with one radix 8
+// (a odd, a >= 3) or 2 (a = 1) for the odd power. The leaf comes last: mixed_radix_work runs it as
+// a codelet on the strided input, and every radix has a codelet for its butterflies.
+static int PREFIX(factorize)(int N, int *factors) {
+    static const int radices[] = {3, 5, 7};
+    int leaf = FFT_CODELET_MAX;
+    while(leaf > 1 && (N % leaf != 0 || !PREFIX(codelet_find)(leaf))) leaf--;
+    int n = N / leaf, count = 0;
+    int twos = 0;
+    while(n % 2 == 0) {
+        n /= 2;
+        twos++;
+    }
+    int power = 1 << twos;
+    while(power > 1) {
+        int radix = twos % 2 == 0 ? 4 : (twos >= 3 ? 8 : 2);
+        power /= radix;
+        twos -= radix == 8 ? 3 : radix / 2;
+        factors[2*count] = radix;
+        factors[2*count + 1] = n * power * leaf;
+        count++;
+    }
+    for(int r = 0; r < 3; r++) {
+        while(n % radices[r] == 0) {
+            n /= radices[r];
+            factors[2*count] = radices[r];
+            factors[2*count + 1] = n * leaf;
+            count++;
+        }
+    }
+    factors[2*count] = leaf;
+    factors[2*count + 1] = 1;
+    return n == 1 && leaf > 1;
+}
+
+static struct PREFIX(plan_s) *PREFIX(new_plan)(enum fft_kind kind, int rank, int direction, unsigned flags) {
+    struct PREFIX(plan_s) *p = (struct PREFIX(plan_s)*)checked_malloc(sizeof(struct PREFIX(plan_s)));
+    memset(p, 0, sizeof(struct PREFIX(plan_s)));
+    p->kind = kind;
+    p->rank = rank;
+    p->direction = direction;
+    p->flags = flags;
+    p->nthreads = 1;
+    return p;
+}
+
+static void PREFIX(build_radix2_tables)(struct PREFIX(plan_s) *p) {
+    int N = p->N;
+    p->bitrev = (int*)checked_malloc(N * sizeof(int));
+
+    int log2N = 0;
+    while((1 << log2N) < N) log2N++;
+
+    for(int i = 0; i < N; i++) {
+        int reversed = 0;
+        for(int b = 0; b < log2N; b++) {
+            if(i & (1 << b)) reversed |= 1 << (log2N - 1 - b);
+        }
+        p->bitrev[i] = reversed;
+    }
+
+    // Per-stage tables: W^k for every half-span h, W^3k for every radix-4 quarter-span h
+    p->stage_twiddles_re = (REAL*)checked_malloc(N * sizeof(REAL));
+    p->stage_twiddles_im = (REAL*)checked_malloc(N * sizeof(REAL));
+    p->stage_twiddles3_re = (REAL*)checked_malloc(N * sizeof(REAL));
+    p->stage_twiddles3_im = (REAL*)checked_malloc(N * sizeof(REAL));
+    for(int half = 1; half < N; half <<= 1) {
+        for(int k = 0; k < half; k++) {
+            COMPLEX w = PREFIX(twiddle)(k, 2*half);
+            p->stage_twiddles_re[half + k] = w.real;
+            p->stage_twiddles_im[half + k] = w.imag;
+        }
+    }
+    for(int quarter = 1; 4*quarter <= N; quarter <<= 1) {
+        for(int k = 0; k < quarter; k++) {
+            COMPLEX w = PREFIX(twiddle)(3*k, 4*quarter);
+            p->stage_twiddles3_re[quarter + k] = w.real;
+            p->stage_twiddles3_im[quarter + k] = w.imag;
+        }
+    }
+
+    // The vector kernels work on a split copy of the data (2N REAL of scratch), the scalar
+    // split-radix needs a copy of the input for in-place execution
+    if(VECTORIZE && N >= FFT_SIMD_MIN_N && !(p->flags & FFT_NO_SIMD)) {
+        p->simd = fft_simd_level_detect();
+    }
+    p->work_size = N;
+}
+
+static void PREFIX(build_bluestein_tables)(struct PREFIX(plan_s) *p) {
+    int N = p->N;
+    p->M = 1;
+    while(p->M < 2*N - 1) p->M <<= 1;
+    int M = p->M;
+
+    p->chirp = (COMPLEX*)checked_malloc(N * sizeof(COMPLEX));
+    p->chirp_spectrum = (COMPLEX*)checked_malloc(M * sizeof(COMPLEX));
+
+    // k^2 is reduced modulo 2N to keep the angle small and accurate
+    for(int k = 0; k < N; k++) {
+        long long k2 = ((long long)k * k) % (2LL * N);
+        p->chirp[k] = PREFIX(twiddle)(k2, 2LL * N);
+    }
+
+    // Conjugate chirp laid out for a circular convolution of length M
+    memset(p->chirp_spectrum, 0, M * sizeof(COMPLEX));
+    for(int k = 0; k < N; k++) {
+        COMPLEX conj_chirp = {p->chirp[k].real, -p->chirp[k].imag};
+        p->chirp_spectrum[k] = conj_chirp;
+        if(k > 0) p->chirp_spectrum[M - k] = conj_chirp;
+    }
+
+    p->sub = PREFIX(plan_create)(M, FFT_FORWARD, p->flags & ~FFT_FORCE_BLUESTEIN);
+    PREFIX(execute_1d)(p->sub, p->chirp_spectrum, p->chirp_spectrum, 0, p->sub->work);
+}
+
+PREFIX(plan) PREFIX(plan_create)(int N, int direction, unsigned flags) {
+    if(N < 1 || (direction != FFT_FORWARD && direction != FFT_BACKWARD)) return NULL;
+
+    struct PREFIX(plan_s) *p = PREFIX(new_plan)(FFT_KIND_DFT, 1, direction, flags);
+    p->N = N;
+
+    if(flags & FFT_FORCE_BLUESTEIN && N > 1) {
+        p->algorithm = FFT_BLUESTEIN;
+    } else if(PREFIX(codelet_find)(N) && !(is_power_of_two(N) && N > FFT_CODELET_MAX_RADIX2)) {
+        p->algorithm = FFT_CODELET;
+    } else if(is_power_of_two(N)) {
+        p->algorithm = FFT_RADIX2;
+    } else if(PREFIX(factorize)(N, p->factors)) {
+        p->algorithm = FFT_MIXED_RADIX;
+    } else {
+        p->algorithm = FFT_BLUESTEIN;
+    }
+
+    switch(p->algorithm) {
+        case FFT_CODELET:
+            p->codelet = PREFIX(codelet_find)(N);
+            break;
+        case FFT_RADIX2:
+            PREFIX(build_radix2_tables)(p);
+            break;
+        case FFT_MIXED_RADIX:
+            p->twiddles = (COMPLEX*)checked_malloc(N * sizeof(COMPLEX));
+            PREFIX(fill_twiddles)(p->twiddles, N, N);
+            for(int f = 0; ; f++) {
+                if(p->factors[2*f + 1] == 1) {
+                    p->codelet = PREFIX(codelet_find)(p->factors[2*f]);
+                    break;
+                }
+            }
+            p->work_size = N; // copy of the input for in-place execution
+            break;
+        case FFT_BLUESTEIN:
+            PREFIX(build_bluestein_tables)(p);
+            p->work_size = p->M + p->sub->work_size;
+            break;
+    }
+
+    if(p->work_size > 0) {
+        p->work = (COMPLEX*)checked_malloc(p->work_size * sizeof(COMPLEX));
+    }
+    return p;
+}
+
+// Real transform of length N: the packed half-length plan and the post-processing twiddles
+static PREFIX(plan) PREFIX(create_real_1d)(enum fft_kind kind, int N, unsigned flags) {
+    int direction = kind == FFT_KIND_R2C ? FFT_FORWARD : FFT_BACKWARD;
+    struct PREFIX(plan_s) *p = PREFIX(new_plan)(kind, 1, direction, flags);
+    p->N = N;
+
+    if(N % 2 == 0) {
+        p->half_plan = PREFIX(plan_create)(N/2, direction, flags);
+        p->real_twiddles = (COMPLEX*)checked_malloc((N/4 + 1) * sizeof(COMPLEX));
+        PREFIX(fill_twiddles)(p->real_twiddles, N/4 + 1, N);
+        // c2r builds the packed spectrum in a separate buffer
+        p->work_size = (kind == FFT_KIND_C2R ? N/2 : 0) + p->half_plan->work_size;
+    } else {
+        p->half_plan = PREFIX(plan_create)(N, direction, flags);
+        p->work_size = N + p->half_plan->work_size;
+    }
+
+    if(p->work_size > 0) {
+        p->work = (COMPLEX*)checked_malloc(p->work_size * sizeof(COMPLEX));
+    }
+    return p;
+}
+
+PREFIX(plan) PREFIX(plan_create_r2c)(int N, unsigned flags) {
+    if(N < 1) return NULL;
+    return PREFIX(create_real_1d)(FFT_KIND_R2C, N, flags);
+}
+
+PREFIX(plan) PREFIX(plan_create_c2r)(int N, unsigned flags) {
+    if(N < 1) return NULL;
+    return PREFIX(create_real_1d)(FFT_KIND_C2R, N, flags);
+}
+
+// Batched 1D plan: howmany signals of length N, signal b element k at in[b*idist + k*istride]
+// and out[b*odist + k*ostride], split over the planner threads. The batch is repeated on n_blocks
+// blocks (iblock_dist / oblock_dist elements apart), e.g. the planes of a 3D array.
+static PREFIX(plan) PREFIX(create_many)(enum fft_kind kind, int N, int howmany, int istride, int idist, int ostride,
+                                        int odist, int direction, unsigned flags) {
+    struct PREFIX(plan_s) *p = PREFIX(new_plan)(kind, 1, direction, flags);
+    p->N = N;
+    p->howmany = howmany;
+    p->istride = istride;
+    p->idist = idist;
+    p->ostride = ostride;
+    p->odist = odist;
+    p->n_blocks = 1;
+    p->signal_plan = kind == FFT_KIND_DFT ? PREFIX(plan_create)(N, direction, flags)
+                                          : PREFIX(create_real_1d)(kind, N, flags);
+
+    // strided signals need a panel of FFT_PANEL_WIDTH signals, once per thread
+    p->nthreads = fft_planner_nthreads();
+    p->work_size = (istride != 1 || ostride != 1 ? N * FFT_PANEL_WIDTH : 0) + p->signal_plan->work_size;
+    if(p->work_size > 0) {
+        p->work = (COMPLEX*)checked_malloc((size_t)p->nthreads * p->work_size * sizeof(COMPLEX));
+    }
+    return p;
+}
+
+PREFIX(plan) PREFIX(plan_create_many)(int N, int howmany, int istride, int idist, int ostride, int odist,
+                                      int direction, unsigned flags) {
+    if(N < 1 || howmany < 1 || istride < 1 || ostride < 1 || (direction != FFT_FORWARD && direction != FFT_BACKWARD)) {
+        return NULL;
+    }
+    return PREFIX(create_many)(FFT_KIND_DFT, N, howmany, istride, idist, ostride, odist, direction, flags);
+}
+
+// Row-major n[0] x ... x n[rank-1] plan, one batched pass per axis. The last axis is a batch of
+// contiguous rows (real rows for r2c / c2r, whose complex side has n[rank-1]/2+1 entries). Axis
+// d < rank-1 has its signals side by side: inner = n[d+1] x ... entries apart, inner of them in
+// each of the n[0] x ... x n[d-1] blocks, so it is read in contiguous segments of the array.
+static PREFIX(plan) PREFIX(create_nd)(enum fft_kind kind, int rank, const int *n, int direction, unsigned flags) {
+    struct PREFIX(plan_s) *p = PREFIX(new_plan)(kind, rank, direction, flags);
+    p->shape = (int*)checked_malloc(rank * sizeof(int));
+    p->axis_plans = (PREFIX(plan)*)checked_malloc(rank * sizeof(PREFIX(plan)));
+    memcpy(p->shape, n, rank * sizeof(int));
+    p->nthreads = fft_planner_nthreads();
+
+    int last = n[rank - 1];
+    int nc = kind == FFT_KIND_DFT ? last : last/2 + 1; // complex entries along the last axis
+    int rows = 1;
+    for(int d = 0; d < rank - 1; d++) rows *= n[d];
+
+    p->axis_plans[rank - 1] = PREFIX(create_many)(kind, last, rows, 1, kind == FFT_KIND_C2R ? nc : last,
+                                                  1, kind == FFT_KIND_R2C ? nc : last, direction, flags);
+
+    int inner = nc;
+    for(int d = rank - 2; d >= 0; d--) {
+        struct PREFIX(plan_s) *axis = PREFIX(create_many)(FFT_KIND_DFT, n[d], inner, inner, 1, inner, 1,
+                                                          direction, flags);
+        axis->n_blocks = rows / n[d];
+        axis->iblock_dist = (long)n[d] * inner;
+        axis->oblock_dist = axis->iblock_dist;
+        p->axis_plans[d] = axis;
+        rows /= n[d];
+        inner *= n[d];
+    }
+    return p;
+}
+
+static int PREFIX(valid_shape)(int rank, const int *n) {
+    if(rank < 1 || !n) return 0;
+    for(int d = 0; d < rank; d++) {
+        if(n[d] < 1) return 0;
+    }
+    return 1;
+}
+
+PREFIX(plan) PREFIX(plan_create_nd)(int rank, const int *n, int direction, unsigned flags) {
+    if(!PREFIX(valid_shape)(rank, n) || (direction != FFT_FORWARD && direction != FFT_BACKWARD)) return NULL;
+    if(rank == 1) return PREFIX(plan_create)(n[0], direction, flags);
+    return PREFIX(create_nd)(FFT_KIND_DFT, rank, n, direction, flags);
+}
+
+PREFIX(plan) PREFIX(plan_create_r2c_nd)(int rank, const int *n, unsigned flags) {
+    if(!PREFIX(valid_shape)(rank, n)) return NULL;
+    if(rank == 1) return PREFIX(create_real_1d)(FFT_KIND_R2C, n[0], flags);
+    return PREFIX(create_nd)(FFT_KIND_R2C, rank, n, FFT_FORWARD, flags);
+}
+
+PREFIX(plan) PREFIX(plan_create_c2r_nd)(int rank, const int *n, unsigned flags) {
+    if(!PREFIX(valid_shape)(rank, n)) return NULL;
+    if(rank == 1) return PREFIX(create_real_1d)(FFT_KIND_C2R, n[0], flags);
+    return PREFIX(create_nd)(FFT_KIND_C2R, rank, n, FFT_BACKWARD, flags);
+}
+
+PREFIX(plan) PREFIX(plan_create_2d)(int n0, int n1, int direction, unsigned flags) {
+    int n[2] = {n0, n1};
+    return PREFIX(plan_create_nd)(2, n, direction, flags);
+}
+
+PREFIX(plan) PREFIX(plan_create_r2c_2d)(int n0, int n1, unsigned flags) {
+    int n[2] = {n0, n1};
+    return PREFIX(plan_create_r2c_nd)(2, n, flags);
+}
+
+PREFIX(plan) PREFIX(plan_create_c2r_2d)(int n0, int n1, unsigned flags) {
+    int n[2] = {n0, n1};
+    return PREFIX(plan_create_c2r_nd)(2, n, flags);
+}
+
+PREFIX(plan) PREFIX(plan_create_3d)(int n0, int n1, int n2, int direction, unsigned flags) {
+    int n[3] = {n0, n1, n2};
+    return PREFIX(plan_create_nd)(3, n, direction, flags);
+}
+
+PREFIX(plan) PREFIX(plan_create_r2c_3d)(int n0, int n1, int n2, unsigned flags) {
+    int n[3] = {n0, n1, n2};
+    return PREFIX(plan_create_r2c_nd)(3, n, flags);
+}
+
+PREFIX(plan) PREFIX(plan_create_c2r_3d)(int n0, int n1, int n2, unsigned flags) {
+    int n[3] = {n0, n1, n2};
+    return PREFIX(plan_create_c2r_nd)(3, n, flags);
+}
+
+void PREFIX(plan_destroy)(PREFIX(plan) plan) {
+    if(!plan) return;
+
+    if(plan->axis_plans) {
+        for(int d = 0; d < plan->rank; d++) {
+            PREFIX(plan_destroy)(plan->axis_plans[d]);
+        }
+        free(plan->axis_plans);
+    }
+    free(plan->shape);
+    PREFIX(plan_destroy)(plan->signal_plan);
+    PREFIX(plan_destroy)(plan->sub);
+    PREFIX(plan_destroy)(plan->half_plan);
+    free(plan->bitrev);
+    free(plan->twiddles);
+    free(plan->stage_twiddles_re);
+    free(plan->stage_twiddles_im);
+    free(plan->stage_twiddles3_re);
+    free(plan->stage_twiddles3_im);
+    free(plan->chirp);
+    free(plan->chirp_spectrum);
+    free(plan->real_twiddles);
+    free(plan->work);
+    free(plan);
+}
+
+// x times the twiddle of the given index in the size-N table (conjugated for sign = -1)
+static COMPLEX PREFIX(twiddle_mul)(const COMPLEX *twiddles, int index, REAL sign, COMPLEX x) {
+    COMPLEX w = twiddles[index];
+    w.imag *= sign;
+    COMPLEX y = {w.real * x.real - w.imag * x.imag, w.real * x.imag + w.imag * x.real};
+    return y;
+}
+
+// Codelet f on the n points in[0], in[istride], ... of interleaved data, result to out[0], out[ostride], ...
+// The inverse transform swaps the real and imaginary parts on both sides.
+static void PREFIX(run_codelet)(PREFIX(codelet) f, const COMPLEX *in, int istride, COMPLEX *out, int ostride,
+                                REAL sign) {
+    const REAL *ri = &in->real, *ii = &in->imag;
+    REAL *ro = &out->real, *io = &out->imag;
+    if(sign > 0) {
+        f(ri, ii, ro, io, 2L * istride, 2L * ostride);
+    } else {
+        f(ii, ri, io, ro, 2L * istride, 2L * ostride);
+    }
+}
+
+// Split-radix decimation in time, out of place: out gets the DFT of the n points in[0], in[stride], ...
+// The even points make a transform of n/2 points, the odd ones two of n/4 (indices 1 and 3 mod 4),
+// which are combined with W^k and W^3k (W = exp(-2*pi*i/n)) from the stage tables of the plan.
+// The recursion stops at the codelet sizes.
+// This takes the fewest operations of the power-of-two algorithms, about 4 N log2(N) real
+// additions and multiplications against 5 N log2(N) for radix-2.
+static void PREFIX(split_radix_work)(const struct PREFIX(plan_s) *p, COMPLEX *out, const COMPLEX *in, int stride,
+                                     int n, REAL sign) {
+    if(n <= FFT_CODELET_MAX) {
+        PREFIX(run_codelet)(PREFIX(codelet_find)(n), in, stride, out, 1, sign);
+        return;
+    }
+
+    int q = n / 4;
+    PREFIX(split_radix_work)(p, out, in, 2*stride, n/2, sign);
+    PREFIX(split_radix_work)(p, out + 2*q, in + stride, 4*stride, q, sign);
+    PREFIX(split_radix_work)(p, out + 3*q, in + 3*stride, 4*stride, q, sign);
+
+    const REAL *w1r = p->stage_twiddles_re + 2*q, *w1i = p->stage_twiddles_im + 2*q;
+    const REAL *w3r = p->stage_twiddles3_re + q, *w3i = p->stage_twiddles3_im + q;
+    for(int k = 0; k < q; k++) {
+        COMPLEX z1 = out[2*q + k], z3 = out[3*q + k];
+        REAL ar = w1r[k], ai = sign * w1i[k];
+        REAL br = w3r[k], bi = sign * w3i[k];
+        REAL t1r = ar * z1.real - ai * z1.imag, t1i = ar * z1.imag + ai * z1.real;
+        REAL t3r = br * z3.real - bi * z3.imag, t3i = br * z3.imag + bi * z3.real;
+        REAL sr = t1r + t3r, si = t1i + t3i;
+        // -i (forward) or +i (inverse) times the difference
+        REAL dr = sign * (t1i - t3i), di = -sign * (t1r - t3r);
+
+        COMPLEX u0 = out[k], u1 = out[q + k];
+        out[k].real = u0.real + sr;
+        out[k].imag = u0.imag + si;
+        out[2*q + k].real = u0.real - sr;
+        out[2*q + k].imag = u0.imag - si;
+        out[q + k].real = u1.real + dr;
+        out[q + k].imag = u1.imag + di;
+        out[3*q + k].real = u1.real - dr;
+        out[3*q + k].imag = u1.imag - di;
+    }
+}
+
+// Radix-2 on width <= FFT_PANEL_WIDTH signals stored side by side (element k of signal j at
+// in[k*istride + j], e.g. adjacent columns of a matrix). The rows are read in bit-reversed
+// order into a split panel with one signal per lane, where every butterfly applies one
+// twiddle to all the signals; unused lanes are zero and not written back.
+static void PREFIX(radix2_batch)(const struct PREFIX(plan_s) *p, const COMPLEX *in, int istride, COMPLEX *out,
+                                 int ostride, int width, int is_inverse, REAL *work) {
+    int N = p->N;
+    REAL *re = work;
+    REAL *im = work + N * FFT_PANEL_WIDTH;
+
+    for(int k = 0; k < N; k++) {
+        const COMPLEX *row = &in[(long)p->bitrev[k] * istride];
+        REAL *row_re = &re[k * FFT_PANEL_WIDTH], *row_im = &im[k * FFT_PANEL_WIDTH];
+        for(int j = 0; j < width; j++) {
+            row_re[j] = row[j].real;
+            row_im[j] = row[j].imag;
+        }
+        for(int j = width; j < FFT_PANEL_WIDTH; j++) {
+            row_re[j] = 0;
+            row_im[j] = 0;
+        }
+    }
+
+    PREFIX(batch_stages)(p, re, im, is_inverse);
+
+    for(int k = 0; k < N; k++) {
+        COMPLEX *row = &out[(long)k * ostride];
+        for(int j = 0; j < width; j++) {
+            row[j].real = re[k * FFT_PANEL_WIDTH + j];
+            row[j].imag = im[k * FFT_PANEL_WIDTH + j];
+        }
+    }
+}
+
+// Radix-2 sizes on a split copy of the data: the bit-reversal permutation is fused with the
+// deinterleave, the radix-4 passes run with the vector kernels
+static void PREFIX(radix2_split)(const struct PREFIX(plan_s) *p, const COMPLEX *in, COMPLEX *out, int is_inverse,
+                                 COMPLEX *work) {
+    int N = p->N;
+    REAL *re = (REAL*)work;
+    REAL *im = re + N;
+
+    for(int i = 0; i < N; i++) {
+        COMPLEX x = in[p->bitrev[i]];
+        re[i] = x.real;
+        im[i] = x.imag;
+    }
+    PREFIX(split_stages)(p, re, im, is_inverse);
+    for(int i = 0; i < N; i++) {
+        out[i].real = re[i];
+        out[i].imag = im[i];
+    }
+}
+
+// Butterfly of radix p on p sub-transforms of length m stored contiguously in out: the p - 1
+// twiddles from the size-N table, then the codelet of p points, written back with stride m.
+static void PREFIX(mixed_radix_butterfly)(COMPLEX *out, int stride, const struct PREFIX(plan_s) *plan, int m, int p,
+                                          REAL sign) {
+    PREFIX(codelet) dft = PREFIX(codelet_find)(p);
+    COMPLEX scratch[8];
+
+    // k = 0 has no twiddles
+    PREFIX(run_codelet)(dft, out, m, out, m, sign);
+    for(int k = 1; k < m; k++) {
+        scratch[0] = out[k];
+        for(int q = 1; q < p; q++) {
+            scratch[q] = PREFIX(twiddle_mul)(plan->twiddles, q * k * stride, sign, out[k + q*m]);
+        }
+        PREFIX(run_codelet)(dft, scratch, 1, out + k, m, sign);
+    }
+}
+
+// Decimation in time over the factor list: out gets the DFT of in[0], in[stride], in[2*stride], ...
+// The last factor is the leaf, one codelet call on the strided input.
+static void PREFIX(mixed_radix_work)(COMPLEX *out, const COMPLEX *in, int stride, const int *factors,
+                                     const struct PREFIX(plan_s) *plan, REAL sign) {
+    int p = factors[0];
+    int m = factors[1];
+
+    if(m == 1) {
+        PREFIX(run_codelet)(plan->codelet, in, stride, out, 1, sign);
+        return;
+    }
+    for(int q = 0; q < p; q++) {
+        PREFIX(mixed_radix_work)(out + q*m, in + q*stride, stride * p, factors + 2, plan, sign);
+    }
+    PREFIX(mixed_radix_butterfly)(out, stride, plan, m, p, sign);
+}
+
+// Bluestein: X[k] = chirp[k] * sum_j (x[j] chirp[j]) conj(chirp[k-j]), the sum done as an FFT convolution.
+// The inverse transform uses conj(FFT(conj(x))).
+static void PREFIX(bluestein)(const struct PREFIX(plan_s) *p, const COMPLEX *in, COMPLEX *out, int is_inverse,
+                              COMPLEX *work) {
+    int N = p->N, M = p->M;
+    const REAL sign = is_inverse ? -1 : 1;
+    COMPLEX *a = work;
+
+    for(int k = 0; k < N; k++) {
+        COMPLEX x = {in[k].real, sign * in[k].imag};
+        a[k].real = x.real * p->chirp[k].real - x.imag * p->chirp[k].imag;
+        a[k].imag = x.real * p->chirp[k].imag + x.imag * p->chirp[k].real;
+    }
+    memset(a + N, 0, (M - N) * sizeof(COMPLEX));
+
+    PREFIX(execute_1d)(p->sub, a, a, 0, work + M);
+    for(int k = 0; k < M; k++) {
+        COMPLEX b = p->chirp_spectrum[k];
+        COMPLEX temp = {
+            a[k].real * b.real - a[k].imag * b.imag,
+            a[k].real * b.imag + a[k].imag * b.real
+        };
+        a[k] = temp;
+    }
+    PREFIX(execute_1d)(p->sub, a, a, 1, work + M);
+
+    for(int k = 0; k < N; k++) {
+        COMPLEX y = {a[k].real / M, a[k].imag / M};
+        out[k].real = y.real * p->chirp[k].real - y.imag * p->chirp[k].imag;
+        out[k].imag = sign * (y.real * p->chirp[k].imag + y.imag * p->chirp[k].real);
+    }
+}
+
+void PREFIX(execute_1d)(const struct PREFIX(plan_s) *p, const COMPLEX *in, COMPLEX *out, int is_inverse,
+                        COMPLEX *work) {
+    int N = p->N;
+    if(N == 1) {
+        out[0] = in[0];
+        return;
+    }
+
+    switch(p->algorithm) {
+        case FFT_CODELET:
+            PREFIX(run_codelet)(p->codelet, in, 1, out, 1, is_inverse ? -1 : 1);
+            break;
+        case FFT_RADIX2:
+            if(p->simd != FFT_SIMD_NONE) {
+                PREFIX(radix2_split)(p, in, out, is_inverse, work);
+                break;
+            }
+            if(in == out) {
+                memcpy(work, in, N * sizeof(COMPLEX));
+                in = work;
+            }
+            PREFIX(split_radix_work)(p, out, in, 1, N, is_inverse ? -1 : 1);
+            break;
+        case FFT_MIXED_RADIX:
+            if(in == out) {
+                memcpy(work, in, N * sizeof(COMPLEX));
+                in = work;
+            }
+            PREFIX(mixed_radix_work)(out, in, 1, p->factors, p, is_inverse ? -1 : 1);
+            break;
+        case FFT_BLUESTEIN:
+            PREFIX(bluestein)(p, in, out, is_inverse, work);
+            break;
+    }
+}
+
+// Real input of length N to N/2+1 spectrum entries. For even N the N/2-point FFT of
+// z[k] = x[2k] + i x[2k+1] gives Z, then with E = (Z[k] + conj(Z[N/2-k]))/2 (even samples)
+// and O = (Z[k] - conj(Z[N/2-k]))/2i (odd samples): X[k] = E + W^k O, X[N/2-k] = conj(E - W^k O)
+static void PREFIX(execute_r2c_1d)(const struct PREFIX(plan_s) *p, const REAL *in, COMPLEX *out, COMPLEX *work) {
+    int N = p->N;
+
+    if(N % 2 != 0) {
+        COMPLEX *full = work;
+        for(int i = 0; i < N; i++) {
+            full[i].real = in[i];
+            full[i].imag = 0;
+        }
+        PREFIX(execute_1d)(p->half_plan, full, full, 0, work + N);
+        memcpy(out, full, (N/2 + 1) * sizeof(COMPLEX));
+        return;
+    }
+
+    int h = N / 2;
+    for(int k = 0; k < h; k++) {
+        out[k].real = in[2*k];
+        out[k].imag = in[2*k + 1];
+    }
+    PREFIX(execute_1d)(p->half_plan, out, out, 0, work);
+
+    COMPLEX z0 = out[0];
+    out[0].real = z0.real + z0.imag;
+    out[0].imag = 0;
+    out[h].real = z0.real - z0.imag;
+    out[h].imag = 0;
+
+    const REAL half = (REAL)0.5;
+    for(int k = 1; k <= h/2; k++) {
+        COMPLEX zk = out[k], zm = out[h - k];
+        COMPLEX e = {half * (zk.real + zm.real), half * (zk.imag - zm.imag)};
+        COMPLEX o = {half * (zk.imag + zm.imag), -half * (zk.real - zm.real)};
+        COMPLEX w = p->real_twiddles[k];
+        COMPLEX wo = {w.real * o.real - w.imag * o.imag, w.real * o.imag + w.imag * o.real};
+
+        out[k].real = e.real + wo.real;
+        out[k].imag = e.imag + wo.imag;
+        out[h - k].real = e.real - wo.real;
+        out[h - k].imag = -(e.imag - wo.imag);
+    }
+}
+
+// N/2+1 spectrum entries to N real values (unnormalized: the result is N times the signal).
+// Inverse of the r2c post-processing: Z[k] = (X[k] + conj(X[N/2-k])) + i W^-k (X[k] - conj(X[N/2-k])),
+// then an inverse N/2-point FFT gives x[2k] + i x[2k+1]
+static void PREFIX(execute_c2r_1d)(const struct PREFIX(plan_s) *p, const COMPLEX *in, REAL *out, COMPLEX *work) {
+    int N = p->N;
+
+    if(N % 2 != 0) {
+        COMPLEX *full = work;
+        memcpy(full, in, (N/2 + 1) * sizeof(COMPLEX));
+        for(int i = N/2 + 1; i < N; i++) {
+            full[i].real = in[N - i].real;
+            full[i].imag = -in[N - i].imag;
+        }
+        PREFIX(execute_1d)(p->half_plan, full, full, 1, work + N);
+        for(int i = 0; i < N; i++) {
+            out[i] = full[i].real;
+        }
+        return;
+    }
+
+    int h = N / 2;
+    COMPLEX *z = work;
+    for(int k = 0; k <= h/2; k++) {
+        int m = h - k;
+        COMPLEX xk = in[k], xm = in[m];
+        COMPLEX w = p->real_twiddles[k];
+        w.imag = -w.imag; // W^-k
+
+        // k and h-k are handled together, h-k uses W^-(h-k) = -conj(W^-k)
+        COMPLEX sum = {xk.real + xm.real, xk.imag - xm.imag};
+        COMPLEX diff = {xk.real - xm.real, xk.imag + xm.imag};
+        COMPLEX wd = {w.real * diff.real - w.imag * diff.imag, w.real * diff.imag + w.imag * diff.real};
+        z[k].real = sum.real - wd.imag;
+        z[k].imag = sum.imag + wd.real;
+
+        if(k > 0 && m != k) {
+            COMPLEX sum_m = {xm.real + xk.real, xm.imag - xk.imag};
+            COMPLEX diff_m = {xm.real - xk.real, xm.imag + xk.imag};
+            COMPLEX w_m = {-w.real, w.imag};
+            COMPLEX wd_m = {w_m.real * diff_m.real - w_m.imag * diff_m.imag,
+                            w_m.real * diff_m.imag + w_m.imag * diff_m.real};
+            z[m].real = sum_m.real - wd_m.imag;
+            z[m].imag = sum_m.imag + wd_m.real;
+        }
+    }
+    PREFIX(execute_1d)(p->half_plan, z, z, 1, work + h);
+
+    for(int k = 0; k < h; k++) {
+        out[2*k] = z[k].real;
+        out[2*k + 1] = z[k].imag;
+    }
+}
+
+// Gathers width strided signals of N elements into contiguous rows of the panel
+static void PREFIX(gather_signals)(const COMPLEX *in, int stride, int dist, COMPLEX *panel, int N, int width) {
+    if(dist == 1) {
+        TRANSPOSE(in, stride, panel, N, N, width);
+        return;
+    }
+    for(int j = 0; j < width; j++) {
+        for(int k = 0; k < N; k++) {
+            panel[(long)j*N + k] = in[(long)j*dist + (long)k*stride];
+        }
+    }
+}
+
+static void PREFIX(scatter_signals)(const COMPLEX *panel, int N, int width, COMPLEX *out, int stride, int dist) {
+    if(dist == 1) {
+        TRANSPOSE(panel, N, out, stride, width, N);
+        return;
+    }
+    for(int j = 0; j < width; j++) {
+        for(int k = 0; k < N; k++) {
+            out[(long)j*dist + (long)k*stride] = panel[(long)j*N + k];
+        }
+    }
+}
+
+// Signals b_begin..b_end-1 of a batched plan. Contiguous signals are transformed where they
+// are, and so are strided complex signals of a codelet size that do not sit side by side (the
+// codelets take strides). The other strided signals go FFT_PANEL_WIDTH at a time: side by side
+// signals (dist 1, e.g. matrix columns) of a radix-2 size are transformed in place by the batch
+// kernel, the others are gathered in tiles into the panel, transformed and scattered back.
+static void PREFIX(execute_batch)(const struct PREFIX(plan_s) *p, const void *in, void *out, int b_begin, int b_end,
+                                  int is_inverse, COMPLEX *work) {
+    const struct PREFIX(plan_s) *s = p->signal_plan;
+    int N = p->N;
+
+    if(p->istride == 1 && p->ostride == 1) {
+        for(int b = b_begin; b < b_end; b++) {
+            switch(s->kind) {
+                case FFT_KIND_DFT:
+                    PREFIX(execute_1d)(s, (const COMPLEX*)in + (long)b*p->idist, (COMPLEX*)out + (long)b*p->odist,
+                                       is_inverse, work);
+                    break;
+                case FFT_KIND_R2C:
+                    PREFIX(execute_r2c_1d)(s, (const REAL*)in + (long)b*p->idist, (COMPLEX*)out + (long)b*p->odist,
+                                           work);
+                    break;
+                case FFT_KIND_C2R:
+                    PREFIX(execute_c2r_1d)(s, (const COMPLEX*)in + (long)b*p->idist, (REAL*)out + (long)b*p->odist,
+                                           work);
+                    break;
+            }
+        }
+        return;
+    }
+
+    const COMPLEX *cin = (const COMPLEX*)in;
+    COMPLEX *cout = (COMPLEX*)out;
+    if(s->kind == FFT_KIND_DFT && s->algorithm == FFT_CODELET && p->idist != 1) {
+        for(int b = b_begin; b < b_end; b++) {
+            PREFIX(run_codelet)(s->codelet, &cin[(long)b*p->idist], p->istride, &cout[(long)b*p->odist], p->ostride,
+                                is_inverse ? -1 : 1);
+        }
+        return;
+    }
+
+    int side_by_side = s->algorithm == FFT_RADIX2 && p->idist == 1 && p->odist == 1;
+    COMPLEX *panel = work;
+    COMPLEX *sub_work = work + N * FFT_PANEL_WIDTH;
+
+    for(int b0 = b_begin; b0 < b_end; b0 += FFT_PANEL_WIDTH) {
+        int width = b0 + FFT_PANEL_WIDTH < b_end ? FFT_PANEL_WIDTH : b_end - b0;
+
+        if(side_by_side) {
+            PREFIX(radix2_batch)(s, &cin[b0], p->istride, &cout[b0], p->ostride, width, is_inverse, (REAL*)panel);
+            continue;
+        }
+
+        PREFIX(gather_signals)(&cin[(long)b0*p->idist], p->istride, p->idist, panel, N, width);
+        for(int j = 0; j < width; j++) {
+            PREFIX(execute_1d)(s, &panel[(long)j*N], &panel[(long)j*N], is_inverse, sub_work);
+        }
+        PREFIX(scatter_signals)(panel, N, width, &cout[(long)b0*p->odist], p->ostride, p->odist);
+    }
+}
+
+struct PREFIX(batch_args) {
+    const struct PREFIX(plan_s) *p;
+    const void *in;
+    void *out;
+    int is_inverse;
+    COMPLEX *work;              // nthreads * work_size entries
+};
+
+// The batch is cut into units of one panel of one block. Thread t of T gets a fixed contiguous
+// range of units and its own slice of the plan scratch, so every signal is computed the same
+// way whatever the thread count.
+static void PREFIX(batch_worker)(void *arg, int thread_id, int nthreads) {
+    const struct PREFIX(batch_args) *a = (const struct PREFIX(batch_args)*)arg;
+    const struct PREFIX(plan_s) *p = a->p;
+    size_t in_size = p->kind == FFT_KIND_R2C ? sizeof(REAL) : sizeof(COMPLEX);
+    size_t out_size = p->kind == FFT_KIND_C2R ? sizeof(REAL) : sizeof(COMPLEX);
+    COMPLEX *work = a->work + (size_t)thread_id * p->work_size;
+
+    long n_panels = (p->howmany + FFT_PANEL_WIDTH - 1) / FFT_PANEL_WIDTH;
+    long n_units = n_panels * p->n_blocks;
+    long u = n_units * thread_id / nthreads;
+    long u_end = n_units * (thread_id + 1) / nthreads;
+
+    while(u < u_end) {
+        long block = u / n_panels;
+        long panel_begin = u % n_panels;
+        long panel_end = panel_begin + (u_end - u) < n_panels ? panel_begin + (u_end - u) : n_panels;
+        int b_begin = (int)(panel_begin * FFT_PANEL_WIDTH);
+        int b_end = panel_end * FFT_PANEL_WIDTH < p->howmany ? (int)(panel_end * FFT_PANEL_WIDTH) : p->howmany;
+
+        PREFIX(execute_batch)(p, (const char*)a->in + block * p->iblock_dist * in_size,
+                              (char*)a->out + block * p->oblock_dist * out_size, b_begin, b_end, a->is_inverse,
+                              work);
+        u += panel_end - panel_begin;
+    }
+}
+
+static void PREFIX(execute_many)(const struct PREFIX(plan_s) *p, const void *in, void *out, int is_inverse) {
+    struct PREFIX(batch_args) args = {p, in, out, is_inverse, PREFIX(acquire_work)(p)};
+    fft_parallel_run(PREFIX(batch_worker), &args, p->nthreads);
+    PREFIX(release_work)(p, args.work);
+}
+
+// One batched pass per axis, last (contiguous) axis first for c2c and r2c: it maps the input to
+// the output, the other axes then run in place on the output. c2r runs the complex axes in place
+// on its input (which is overwritten) and ends with the last axis, half spectra to real rows.
+static void PREFIX(execute_nd)(const struct PREFIX(plan_s) *p, const void *in, void *out, int is_inverse) {
+    int last = p->rank - 1;
+    if(p->kind == FFT_KIND_C2R) {
+        for(int d = last - 1; d >= 0; d--) {
+            PREFIX(execute_many)(p->axis_plans[d], in, (void*)in, is_inverse);
+        }
+        PREFIX(execute_many)(p->axis_plans[last], in, out, is_inverse);
+    } else {
+        PREFIX(execute_many)(p->axis_plans[last], in, out, is_inverse);
+        for(int d = last - 1; d >= 0; d--) {
+            PREFIX(execute_many)(p->axis_plans[d], out, out, is_inverse);
+        }
+    }
+}
+
+static void PREFIX(execute_plan)(const struct PREFIX(plan_s) *p, const void *in, void *out, int is_inverse) {
+    if(p->rank >= 2) {
+        PREFIX(execute_nd)(p, in, out, is_inverse);
+    } else if(p->howmany > 0) {
+        PREFIX(execute_many)(p, in, out, is_inverse);
+    } else {
+        COMPLEX *work = PREFIX(acquire_work)(p);
+        if(p->kind == FFT_KIND_R2C) {
+            PREFIX(execute_r2c_1d)(p, (const REAL*)in, (COMPLEX*)out, work);
+        } else if(p->kind == FFT_KIND_C2R) {
+            PREFIX(execute_c2r_1d)(p, (const COMPLEX*)in, (REAL*)out, work);
+        } else {
+            PREFIX(execute_1d)(p, (const COMPLEX*)in, (COMPLEX*)out, is_inverse, work);
+        }
+        PREFIX(release_work)(p, work);
+    }
+}
+
+COMPLEX *PREFIX(acquire_work)(const struct PREFIX(plan_s) *p) {
+    if(!p->work) return NULL;
+    // work_busy is the only field written during an execution, so the plan stays const otherwise
+    if(!__atomic_exchange_n(&((struct PREFIX(plan_s)*)p)->work_busy, 1, __ATOMIC_ACQUIRE)) return p->work;
+    return (COMPLEX*)checked_malloc((size_t)p->nthreads * p->work_size * sizeof(COMPLEX));
+}
+
+void PREFIX(release_work)(const struct PREFIX(plan_s) *p, COMPLEX *work) {
+    if(work == p->work) {
+        __atomic_store_n(&((struct PREFIX(plan_s)*)p)->work_busy, 0, __ATOMIC_RELEASE);
+    } else {
+        free(work);
+    }
+}
+
+void PREFIX(execute)(const PREFIX(plan) plan, const COMPLEX *in, COMPLEX *out) {
+    if(plan->kind != FFT_KIND_DFT) {
+        printf("%s: plan is not a complex-to-complex plan\n", __func__);
+        return;
+    }
+    PREFIX(execute_plan)(plan, in, out, plan->direction == FFT_BACKWARD);
+}
+
+void PREFIX(execute_r2c)(const PREFIX(plan) plan, const REAL *in, COMPLEX *out) {
+    if(plan->kind != FFT_KIND_R2C) {
+        printf("%s: plan is not a real-to-complex plan\n", __func__);
+        return;
+    }
+    PREFIX(execute_plan)(plan, in, out, 0);
+}
+
+void PREFIX(execute_c2r)(const PREFIX(plan) plan, COMPLEX *in, REAL *out) {
+    if(plan->kind != FFT_KIND_C2R) {
+        printf("%s: plan is not a complex-to-real plan\n", __func__);
+        return;
+    }
+    PREFIX(execute_plan)(plan, in, out, 1);
+}
+
+// The radix-2 sizes run in passes of decimation in time on bit-reversed data. A radix-4 pass of
+// quarter-span h does the radix-2 stages of half-spans h and 2h at once: in each block of 4h
+// elements the quarters hold the sub-transforms of the points 0, 2, 1 and 3 mod 4, element k
+// of quarters 1, 2, 3 is multiplied by W^2k, W^k, W^3k (W = exp(-2*pi*i/4h)) and the four
+// are combined by a 4-point DFT whose only twiddle is -i. That is 3 complex multiplies and one
+// read and write of the data where two radix-2 stages take 4 multiplies and two passes.
+// The passes run on vectors of 16, 32 or 64 bytes (2 to 16 lanes) from fft_passes_template.h,
+// or one butterfly at a time.
+
+#define VEC REAL
+#define LANES 1
+#define PASS(name) PREFIX(name##_scalar)
+#include "fft_passes_template.h"
+#undef VEC
+#undef LANES
+#undef PASS
+
+#if VECTORIZE
+typedef REAL PREFIX(v16) __attribute__((vector_size(16)));
+typedef REAL PREFIX(v32) __attribute__((vector_size(32)));
+typedef REAL PREFIX(v64) __attribute__((vector_size(64)));
+
+#define VEC PREFIX(v16)
+#define LANES (int)(16 / sizeof(REAL))
+#define PASS(name) PREFIX(name##_v16)
+#include "fft_passes_template.h"
+#undef VEC
+#undef LANES
+#undef PASS
+
+#define VEC PREFIX(v32)
+#define LANES (int)(32 / sizeof(REAL))
+#define PASS(name) PREFIX(name##_v32)
+#include "fft_passes_template.h"
+#undef VEC
+#undef LANES
+#undef PASS
+
+#define VEC PREFIX(v64)
+#define LANES (int)(64 / sizeof(REAL))
+#define PASS(name) PREFIX(name##_v64)
+#include "fft_passes_template.h"
+#undef VEC
+#undef LANES
+#undef PASS
+#endif
+
+static int PREFIX(log2_of)(int N) {
+    int log2N = 0;
+    while((1 << log2N) < N) log2N++;
+    return log2N;
+}
+
+// First pass on groups of 2, 4 or 8 contiguous elements, whose twiddles are trivial (-i, and
+// (1 - i)/sqrt(2) for radix 8, up to sign). The radix leaves an even number of stages for the
+// radix-4 passes; returns the quarter-span of the first of them.
+static int PREFIX(split_first_pass)(REAL *re, REAL *im, int N, REAL sign) {
+    const REAL c = (REAL)0.70710678118654752440084436210484903L; // sqrt(1/2)
+    int log2N = PREFIX(log2_of)(N);
+
+    if(log2N == 1) {
+        REAL tr = re[1], ti = im[1];
+        re[1] = re[0] - tr; im[1] = im[0] - ti;
+        re[0] += tr;        im[0] += ti;
+        return 2;
+    }
+
+    if(log2N % 2 == 0) {
+        for(int i = 0; i < N; i += 4) {
+            REAL a0r = re[i] + re[i+1], a0i = im[i] + im[i+1];
+            REAL a1r = re[i] - re[i+1], a1i = im[i] - im[i+1];
+            REAL a2r = re[i+2] + re[i+3], a2i = im[i+2] + im[i+3];
+            REAL a3r = re[i+2] - re[i+3], a3i = im[i+2] - im[i+3];
+            REAL tr = sign * a3i, ti = -sign * a3r;
+            re[i] = a0r + a2r;   im[i] = a0i + a2i;
+            re[i+2] = a0r - a2r; im[i+2] = a0i - a2i;
+            re[i+1] = a1r + tr;  im[i+1] = a1i + ti;
+            re[i+3] = a1r - tr;  im[i+3] = a1i - ti;
+        }
+        return 4;
+    }
+
+    // Radix 8: the 4-point DFTs of the two halves (points 0, 4, 2, 6 and 1, 5, 3, 7 of the
+    // group in bit-reversed order), then the twiddles 1, W8, -i, W8^3 on the second one
+    for(int i = 0; i < N; i += 8) {
+        REAL *r = re + i, *m = im + i;
+        REAL a0r = r[0] + r[1], a0i = m[0] + m[1], a1r = r[0] - r[1], a1i = m[0] - m[1];
+        REAL a2r = r[2] + r[3], a2i = m[2] + m[3], a3r = r[2] - r[3], a3i = m[2] - m[3];
+        REAL b0r = r[4] + r[5], b0i = m[4] + m[5], b1r = r[4] - r[5], b1i = m[4] - m[5];
+        REAL b2r = r[6] + r[7], b2i = m[6] + m[7], b3r = r[6] - r[7], b3i = m[6] - m[7];
+
+        REAL e0r = a0r + a2r, e0i = a0i + a2i, e2r = a0r - a2r, e2i = a0i - a2i;
+        REAL e1r = a1r + sign * a3i, e1i = a1i - sign * a3r, e3r = a1r - sign * a3i, e3i = a1i + sign * a3r;
+        REAL o0r = b0r + b2r, o0i = b0i + b2i, o2r = b0r - b2r, o2i = b0i - b2i;
+        REAL o1r = b1r + sign * b3i, o1i = b1i - sign * b3r, o3r = b1r - sign * b3i, o3i = b1i + sign * b3r;
+
+        REAL t1r = c * (o1r + sign * o1i), t1i = c * (o1i - sign * o1r);
+        REAL t2r = sign * o2i, t2i = -sign * o2r;
+        REAL t3r = c * (sign * o3i - o3r), t3i = -c * (o3i + sign * o3r);
+        r[0] = e0r + o0r; m[0] = e0i + o0i; r[4] = e0r - o0r; m[4] = e0i - o0i;
+        r[1] = e1r + t1r; m[1] = e1i + t1i; r[5] = e1r - t1r; m[5] = e1i - t1i;
+        r[2] = e2r + t2r; m[2] = e2i + t2i; r[6] = e2r - t2r; m[6] = e2i - t2i;
+        r[3] = e3r + t3r; m[3] = e3i + t3i; r[7] = e3r - t3r; m[7] = e3i - t3i;
+    }
+    return 8;
+}
+
+// The first pass, then each radix-4 pass on the widest vector of at most max_bytes bytes whose
+// lanes fit in the quarter-span (max_bytes = 0: one butterfly at a time)
+static inline __attribute__((always_inline))
+void PREFIX(split_stages_body)(const struct PREFIX(plan_s) *p, REAL *re, REAL *im, REAL sign, int max_bytes) {
+    int N = p->N;
+    int h = PREFIX(split_first_pass)(re, im, N, sign);
+    for(; 4*h <= N; h *= 4) {
+        long bytes = (long)h * sizeof(REAL);
+#if VECTORIZE
+        if(max_bytes >= 64 && bytes >= 64) {
+            PREFIX(split_radix4_v64)(p, re, im, h, sign);
+            continue;
+        }
+        if(max_bytes >= 32 && bytes >= 32) {
+            PREFIX(split_radix4_v32)(p, re, im, h, sign);
+            continue;
+        }
+        if(max_bytes >= 16 && bytes >= 16) {
+            PREFIX(split_radix4_v16)(p, re, im, h, sign);
+            continue;
+        }
+#else
+        (void)bytes;
+        (void)max_bytes;
+#endif
+        PREFIX(split_radix4_scalar)(p, re, im, h, sign);
+    }
+}
+
+// Radix-2 pass of half-span 1 in batch layout, which has no twiddle, when log2(N) is odd
+static void PREFIX(batch_radix2_first)(REAL *re, REAL *im, int N) {
+    for(int start = 0; start < N; start += 2) {
+        REAL *ar = re + start * FFT_PANEL_WIDTH, *ai = im + start * FFT_PANEL_WIDTH;
+        REAL *br = ar + FFT_PANEL_WIDTH, *bi = ai + FFT_PANEL_WIDTH;
+        for(int j = 0; j < FFT_PANEL_WIDTH; j++) {
+            REAL tr = br[j], ti = bi[j];
+            br[j] = ar[j] - tr;
+            bi[j] = ai[j] - ti;
+            ar[j] += tr;
+            ai[j] += ti;
+        }
+    }
+}
+
+// Batch layout: row k holds element k of FFT_PANEL_WIDTH signals, one signal per lane, so a
+// butterfly is the same operation on every lane with a single (broadcast) twiddle. The rows are
+// cut into the widest vectors of at most max_bytes bytes (max_bytes = 0: scalar).
+static inline __attribute__((always_inline))
+void PREFIX(batch_stages_body)(const struct PREFIX(plan_s) *p, REAL *re, REAL *im, REAL sign, int max_bytes) {
+    int N = p->N;
+    int h = 1;
+    if(PREFIX(log2_of)(N) % 2 == 1) {
+        PREFIX(batch_radix2_first)(re, im, N);
+        h = 2;
+    }
+    long row_bytes = FFT_PANEL_WIDTH * (long)sizeof(REAL);
+    for(; 4*h <= N; h *= 4) {
+#if VECTORIZE
+        if(max_bytes >= 64 && row_bytes >= 64) {
+            PREFIX(batch_radix4_v64)(p, re, im, h, sign);
+            continue;
+        }
+        if(max_bytes >= 32 && row_bytes >= 32) {
+            PREFIX(batch_radix4_v32)(p, re, im, h, sign);
+            continue;
+        }
+#else
+        (void)row_bytes;
+        (void)max_bytes;
+#endif
+        PREFIX(batch_radix4_scalar)(p, re, im, h, sign);
+    }
+}
+
+static void PREFIX(split_stages_scalar)(const struct PREFIX(plan_s) *p, REAL *re, REAL *im, REAL sign) {
+    PREFIX(split_stages_body)(p, re, im, sign, 0);
+}
+
+static void PREFIX(batch_stages_scalar)(const struct PREFIX(plan_s) *p, REAL *re, REAL *im, REAL sign) {
+    PREFIX(batch_stages_body)(p, re, im, sign, 0);
+}
+
+#if VECTORIZE && defined(FFT_HAVE_X86)
+__attribute__((target("avx2,fma")))
+static void PREFIX(split_stages_avx2)(const struct PREFIX(plan_s) *p, REAL *re, REAL *im, REAL sign) {
+    PREFIX(split_stages_body)(p, re, im, sign, 32);
+}
+
+__attribute__((target("avx512f,fma")))
+static void PREFIX(split_stages_avx512)(const struct PREFIX(plan_s) *p, REAL *re, REAL *im, REAL sign) {
+    PREFIX(split_stages_body)(p, re, im, sign, 64);
+}
+
+__attribute__((target("avx2,fma")))
+static void PREFIX(batch_stages_avx2)(const struct PREFIX(plan_s) *p, REAL *re, REAL *im, REAL sign) {
+    PREFIX(batch_stages_body)(p, re, im, sign, 32);
+}
+
+__attribute__((target("avx512f,fma")))
+static void PREFIX(batch_stages_avx512)(const struct PREFIX(plan_s) *p, REAL *re, REAL *im, REAL sign) {
+    PREFIX(batch_stages_body)(p, re, im, sign, 64);
+}
+#endif
+
+void PREFIX(split_stages)(const struct PREFIX(plan_s) *p, REAL *re, REAL *im, int is_inverse) {
+    REAL sign = is_inverse ? -1 : 1;
+    if(p->N < 2) return;
+#if VECTORIZE && defined(FFT_HAVE_X86)
+    if(p->simd == FFT_SIMD_AVX2) {
+        PREFIX(split_stages_avx2)(p, re, im, sign);
+        return;
+    }
+    if(p->simd == FFT_SIMD_AVX512) {
+        PREFIX(split_stages_avx512)(p, re, im, sign);
+        return;
+    }
+#endif
+    PREFIX(split_stages_scalar)(p, re, im, sign);
+}
+
+void PREFIX(batch_stages)(const struct PREFIX(plan_s) *p, REAL *re, REAL *im, int is_inverse) {
+    REAL sign = is_inverse ? -1 : 1;
+#if VECTORIZE && defined(FFT_HAVE_X86)
+    if(p->simd == FFT_SIMD_AVX2) {
+        PREFIX(batch_stages_avx2)(p, re, im, sign);
+        return;
+    }
+    if(p->simd == FFT_SIMD_AVX512) {
+        PREFIX(batch_stages_avx512)(p, re, im, sign);
+        return;
+    }
+#endif
+    PREFIX(batch_stages_scalar)(p, re, im, sign);
+}
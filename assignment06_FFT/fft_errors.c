@@ -0,0 +1,465 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "fft_errors.h"
+#include "fft_internal.h"
+
+enum {SOURCE_REAL, SOURCE_COMPLEX, SOURCE_ROWS};
+
+// Errors computed at a time by each thread
+#define BLOCK 512
+
+// Radix of the histograms: 16 bits of the error at a time
+#define DIGIT_BITS 16
+#define BUCKETS (1 << DIGIT_BITS)
+
+// Buckets of at most max(GATHER_MIN, count / GATHER_FRACTION) values are gathered and selected from,
+// larger ones are refined by one more histogram pass
+#define GATHER_MIN 16384
+#define GATHER_FRACTION 64
+
+fft_error_source fft_error_source_real(const double *reference, const double *values, long count) {
+    fft_error_source s = {SOURCE_REAL, reference, values, count, 0};
+    return s;
+}
+
+fft_error_source fft_error_source_complex(const Complex *reference, const Complex *values, long count) {
+    fft_error_source s = {SOURCE_COMPLEX, reference, values, count, 0};
+    return s;
+}
+
+fft_error_source fft_error_source_rows(double *const *reference, double *const *values, int rows, int cols) {
+    fft_error_source s = {SOURCE_ROWS, reference, values, (long)rows * cols, cols};
+    return s;
+}
+
+// Errors of the values start..start+count-1: abs gets all of them, rel those of the values with
+// |r| > threshold. Returns the number of relative errors.
+static int fill_block(const fft_error_source *s, long start, int count, double threshold, double *abs, double *rel) {
+    int nrel = 0;
+    if(s->kind == SOURCE_COMPLEX) {
+        const Complex *r = (const Complex*)s->reference + start;
+        const Complex *v = (const Complex*)s->values + start;
+        for(int k = 0; k < count; k++) {
+            double dr = v[k].real - r[k].real, di = v[k].imag - r[k].imag;
+            double norm = sqrt(r[k].real * r[k].real + r[k].imag * r[k].imag);
+            abs[k] = sqrt(dr * dr + di * di);
+            if(norm > threshold) rel[nrel++] = abs[k] / norm;
+        }
+    } else if(s->kind == SOURCE_ROWS) {
+        double *const *r = (double *const *)s->reference;
+        double *const *v = (double *const *)s->values;
+        long i = start / s->cols;
+        int j = (int)(start % s->cols);
+        for(int k = 0; k < count; k++) {
+            double norm = fabs(r[i][j]);
+            abs[k] = fabs(v[i][j] - r[i][j]);
+            if(norm > threshold) rel[nrel++] = abs[k] / norm;
+            if(++j == s->cols) {
+                j = 0;
+                i++;
+            }
+        }
+    } else {
+        const double *r = (const double*)s->reference + start;
+        const double *v = (const double*)s->values + start;
+        for(int k = 0; k < count; k++) {
+            double norm = fabs(r[k]);
+            abs[k] = fabs(v[k] - r[k]);
+            if(norm > threshold) rel[nrel++] = abs[k] / norm;
+        }
+    }
+    return nrel;
+}
+
+static uint64_t double_bits(double x) {
+    uint64_t u;
+    memcpy(&u, &x, sizeof(u));
+    return u;
+}
+
+// Histogram bucket: count, and smallest and largest bit patterns of its errors, so that a bucket
+// whose errors are all equal (rounding errors often are) needs no further pass
+struct bucket {
+    long count;
+    uint64_t lo, hi;
+};
+
+static void bucket_add(struct bucket *h, uint64_t u) {
+    if(h->count++ == 0) {
+        h->lo = u;
+        h->hi = u;
+    } else if(u < h->lo) {
+        h->lo = u;
+    } else if(u > h->hi) {
+        h->hi = u;
+    }
+}
+
+static double bits_double(uint64_t u) {
+    double x;
+    memcpy(&x, &u, sizeof(x));
+    return x;
+}
+
+// One quantile of the absolute or relative errors. After the first pass, the candidates are the
+// errors whose top `bits` bits are `prefix`, and the quantile is the one of rank `rank` among them.
+struct target {
+    int relative;
+    double q;
+    long rank;
+    uint64_t prefix;
+    int bits;
+    int gather;         // the next pass gathers the candidates rather than making a histogram of them
+    int done;
+    double result;
+    struct bucket *hist; // nthreads x BUCKETS buckets of the next DIGIT_BITS bits of the candidates
+    double *values;     // gathered candidates
+    long *base;         // where each thread writes its gathered candidates
+    long *written;      // and how many it wrote
+};
+
+struct pass {
+    const fft_error_source *source;
+    double threshold;
+    int first;
+    // First pass: per-thread sums, maxima and counts, and either the histograms of the top
+    // DIGIT_BITS bits of all the absolute and relative errors or, for small inputs, the errors
+    // themselves, each thread writing from the start of its range
+    int gather_all;
+    double *sum_abs, *sum_rel, *max_abs, *max_rel;
+    long *count_rel;
+    struct bucket *first_hist[2];
+    double *all[2];
+    long *all_written[2];
+    // Following passes
+    struct target *targets;
+    int ntargets;
+};
+
+static void pass_worker(void *arg, int thread_id, int nthreads) {
+    struct pass *p = (struct pass*)arg;
+    long begin = p->source->count * thread_id / nthreads;
+    long end = p->source->count * (thread_id + 1) / nthreads;
+    double abs[BLOCK], rel[BLOCK];
+    double sum_abs = 0.0, sum_rel = 0.0, max_abs = 0.0, max_rel = 0.0;
+    long count_rel = 0;
+    struct bucket *first_hist[2] = {NULL, NULL};
+
+    if(p->first && !p->gather_all) {
+        for(int r = 0; r < 2; r++) {
+            first_hist[r] = p->first_hist[r] + (size_t)thread_id * BUCKETS;
+            memset(first_hist[r], 0, BUCKETS * sizeof(struct bucket));
+        }
+    }
+    for(int t = 0; t < p->ntargets; t++) {
+        struct target *tg = &p->targets[t];
+        if(tg->done) continue;
+        if(tg->gather) tg->written[thread_id] = 0;
+        else memset(tg->hist + (size_t)thread_id * BUCKETS, 0, BUCKETS * sizeof(struct bucket));
+    }
+
+    for(long start = begin; start < end; start += BLOCK) {
+        int n = end - start < BLOCK ? (int)(end - start) : BLOCK;
+        int nrel = fill_block(p->source, start, n, p->threshold, abs, rel);
+
+        if(p->first) {
+            for(int k = 0; k < n; k++) {
+                sum_abs += abs[k] * abs[k];
+                if(abs[k] > max_abs) max_abs = abs[k];
+            }
+            for(int k = 0; k < nrel; k++) {
+                sum_rel += rel[k] * rel[k];
+                if(rel[k] > max_rel) max_rel = rel[k];
+            }
+            if(p->gather_all) {
+                memcpy(p->all[0] + start, abs, n * sizeof(double));
+                memcpy(p->all[1] + begin + count_rel, rel, nrel * sizeof(double));
+            } else {
+                for(int k = 0; k < n; k++) {
+                    uint64_t u = double_bits(abs[k]);
+                    bucket_add(&first_hist[0][u >> (64 - DIGIT_BITS)], u);
+                }
+                for(int k = 0; k < nrel; k++) {
+                    uint64_t u = double_bits(rel[k]);
+                    bucket_add(&first_hist[1][u >> (64 - DIGIT_BITS)], u);
+                }
+            }
+            count_rel += nrel;
+            continue;
+        }
+
+        for(int t = 0; t < p->ntargets; t++) {
+            struct target *tg = &p->targets[t];
+            if(tg->done) continue;
+            const double *e = tg->relative ? rel : abs;
+            int m = tg->relative ? nrel : n;
+            int shift = 64 - tg->bits;
+            if(tg->gather) {
+                double *out = tg->values + tg->base[thread_id];
+                long w = tg->written[thread_id];
+                for(int k = 0; k < m; k++) {
+                    if((double_bits(e[k]) >> shift) == tg->prefix) out[w++] = e[k];
+                }
+                tg->written[thread_id] = w;
+            } else {
+                struct bucket *h = tg->hist + (size_t)thread_id * BUCKETS;
+                for(int k = 0; k < m; k++) {
+                    uint64_t u = double_bits(e[k]);
+                    if((u >> shift) == tg->prefix) bucket_add(&h[(u >> (shift - DIGIT_BITS)) & (BUCKETS - 1)], u);
+                }
+            }
+        }
+    }
+
+    if(p->first) {
+        p->sum_abs[thread_id] = sum_abs;
+        p->sum_rel[thread_id] = sum_rel;
+        p->max_abs[thread_id] = max_abs;
+        p->max_rel[thread_id] = max_rel;
+        p->count_rel[thread_id] = count_rel;
+        if(p->gather_all) {
+            p->all_written[0][thread_id] = end - begin;
+            p->all_written[1][thread_id] = count_rel;
+        }
+    }
+}
+
+static void swap_doubles(double *a, double *b) {
+    double t = *a;
+    *a = *b;
+    *b = t;
+}
+
+static int compare_doubles(const void *a, const void *b) {
+    double da = *(const double*)a;
+    double db = *(const double*)b;
+    return (da > db) - (da < db);
+}
+
+// Value of rank k of v[0..n-1] (which is reordered): quickselect with a median-of-three pivot and
+// a three-way partition (errors are often equal), sorting the remaining range instead if
+// partitioning keeps going badly (introselect)
+static double select_rank(double *v, long n, long k) {
+    long lo = 0, hi = n - 1;
+    int depth = 2;
+    for(long m = n; m > 1; m >>= 1) depth += 2;
+    while(lo < hi) {
+        if(depth-- == 0) {
+            qsort(v + lo, hi - lo + 1, sizeof(double), compare_doubles);
+            return v[k];
+        }
+        double a = v[lo], b = v[lo + (hi - lo) / 2], c = v[hi];
+        double pivot = a < b ? (b < c ? b : (a < c ? c : a)) : (a < c ? a : (b < c ? c : b));
+        // [lo, lt) < pivot, [lt, gt] == pivot, (gt, hi] > pivot
+        long lt = lo, i = lo, gt = hi;
+        while(i <= gt) {
+            if(v[i] < pivot) swap_doubles(&v[lt++], &v[i++]);
+            else if(v[i] > pivot) swap_doubles(&v[i], &v[gt--]);
+            else i++;
+        }
+        if(k < lt) hi = lt - 1;
+        else if(k > gt) lo = gt + 1;
+        else return pivot;
+    }
+    return v[k];
+}
+
+// Packs the pieces the threads wrote at base[i] into values[0..], returns their total
+static long pack(double *values, const long *base, const long *written, int nthreads) {
+    long size = 0;
+    for(int i = 0; i < nthreads; i++) {
+        if(base[i] != size) memmove(values + size, values + base[i], written[i] * sizeof(double));
+        size += written[i];
+    }
+    return size;
+}
+
+// Moves the target into the bucket of h (nthreads histograms) holding its rank: done if the errors
+// of that bucket are all equal, otherwise set up to gather the bucket if it is small or to refine it
+static void choose_bucket(struct target *tg, const struct bucket *h, int nthreads, long cap) {
+    long below = 0, in_bucket = 0;
+    uint64_t lo = UINT64_MAX, hi = 0;
+    int b;
+    for(b = 0; b < BUCKETS; b++) {
+        in_bucket = 0;
+        for(int i = 0; i < nthreads; i++) {
+            in_bucket += h[(size_t)i * BUCKETS + b].count;
+        }
+        if(below + in_bucket > tg->rank) break;
+        below += in_bucket;
+    }
+    for(int i = 0; i < nthreads; i++) {
+        const struct bucket *hb = &h[(size_t)i * BUCKETS + b];
+        if(hb->count == 0) continue;
+        if(hb->lo < lo) lo = hb->lo;
+        if(hb->hi > hi) hi = hb->hi;
+    }
+    tg->rank -= below;
+    tg->prefix = (tg->prefix << DIGIT_BITS) | (uint64_t)b;
+    tg->bits += DIGIT_BITS;
+    if(lo == hi) {
+        tg->result = bits_double(lo);
+        tg->done = 1;
+    } else if(in_bucket <= cap) {
+        tg->gather = 1;
+        long offset = 0;
+        for(int i = 0; i < nthreads; i++) {
+            tg->base[i] = offset;
+            offset += h[(size_t)i * BUCKETS + b].count;
+        }
+        tg->values = (double*)checked_malloc(in_bucket * sizeof(double));
+    } else if(!tg->hist) {
+        tg->hist = (struct bucket*)checked_malloc((size_t)nthreads * BUCKETS * sizeof(struct bucket));
+    }
+}
+
+// Computes the quantiles of the targets (relative and q set), and the stats if not NULL
+static void compute(const fft_error_source *source, double threshold, struct target *targets, int ntargets,
+                    fft_error_stats *stats) {
+    long count = source->count;
+    int nthreads = fft_planner_nthreads();
+    if(nthreads > count / BLOCK + 1) nthreads = (int)(count / BLOCK + 1);
+    long cap = count / GATHER_FRACTION > GATHER_MIN ? count / GATHER_FRACTION : GATHER_MIN;
+
+    struct pass p;
+    memset(&p, 0, sizeof(p));
+    p.source = source;
+    p.threshold = threshold;
+    p.first = 1;
+    p.gather_all = count <= cap;
+    p.sum_abs = (double*)checked_malloc(4 * nthreads * sizeof(double));
+    p.sum_rel = p.sum_abs + nthreads;
+    p.max_abs = p.sum_abs + 2 * nthreads;
+    p.max_rel = p.sum_abs + 3 * nthreads;
+    p.count_rel = (long*)checked_malloc(3 * nthreads * sizeof(long));
+    for(int r = 0; r < 2; r++) {
+        if(p.gather_all) {
+            p.all[r] = (double*)checked_malloc(count * sizeof(double));
+            p.all_written[r] = p.count_rel + (1 + r) * nthreads;
+        } else {
+            p.first_hist[r] = (struct bucket*)checked_malloc((size_t)nthreads * BUCKETS * sizeof(struct bucket));
+        }
+    }
+    fft_parallel_run(pass_worker, &p, nthreads);
+
+    long n_rel = 0;
+    double sum_abs = 0.0, sum_rel = 0.0, max_abs = 0.0, max_rel = 0.0;
+    for(int i = 0; i < nthreads; i++) {
+        sum_abs += p.sum_abs[i];
+        sum_rel += p.sum_rel[i];
+        if(p.max_abs[i] > max_abs) max_abs = p.max_abs[i];
+        if(p.max_rel[i] > max_rel) max_rel = p.max_rel[i];
+        n_rel += p.count_rel[i];
+    }
+    if(stats) {
+        stats->count = count;
+        stats->count_rel = n_rel;
+        stats->rms_abs = count > 0 ? sqrt(sum_abs / count) : 0.0;
+        stats->rms_rel = n_rel > 0 ? sqrt(sum_rel / n_rel) : 0.0;
+        stats->max_abs = max_abs;
+        stats->max_rel = max_rel;
+    }
+
+    long size[2] = {count, n_rel};
+    if(p.gather_all) {
+        long *base = (long*)checked_malloc(nthreads * sizeof(long));
+        for(int i = 0; i < nthreads; i++) {
+            base[i] = count * i / nthreads;
+        }
+        pack(p.all[1], base, p.all_written[1], nthreads);
+        free(base);
+    }
+
+    for(int t = 0; t < ntargets; t++) {
+        struct target *tg = &targets[t];
+        long n = size[tg->relative];
+        long rank = (long)ceil(tg->q * n) - 1;
+        tg->rank = rank < 0 ? 0 : (rank >= n ? n - 1 : rank);
+        tg->base = (long*)checked_malloc(2 * nthreads * sizeof(long));
+        tg->written = tg->base + nthreads;
+        if(n == 0) {
+            tg->result = 0.0;
+            tg->done = 1;
+        } else if(p.gather_all) {
+            tg->result = select_rank(p.all[tg->relative], n, tg->rank);
+            tg->done = 1;
+        } else {
+            choose_bucket(tg, p.first_hist[tg->relative], nthreads, cap);
+        }
+    }
+
+    p.first = 0;
+    p.targets = targets;
+    p.ntargets = ntargets;
+    for(;;) {
+        int active = 0;
+        for(int t = 0; t < ntargets; t++) {
+            active += !targets[t].done;
+        }
+        if(!active) break;
+
+        fft_parallel_run(pass_worker, &p, nthreads);
+
+        for(int t = 0; t < ntargets; t++) {
+            struct target *tg = &targets[t];
+            if(tg->done) continue;
+            if(tg->gather) {
+                long n = pack(tg->values, tg->base, tg->written, nthreads);
+                tg->result = select_rank(tg->values, n, tg->rank);
+                tg->done = 1;
+            } else {
+                choose_bucket(tg, tg->hist, nthreads, cap);
+            }
+        }
+    }
+
+    for(int t = 0; t < ntargets; t++) {
+        free(targets[t].hist);
+        free(targets[t].values);
+        free(targets[t].base);
+    }
+    for(int r = 0; r < 2; r++) {
+        free(p.first_hist[r]);
+        free(p.all[r]);
+    }
+    free(p.sum_abs);
+    free(p.count_rel);
+}
+
+void fft_error_stats_compute(const fft_error_source *source, double rel_threshold, fft_error_stats *stats) {
+    struct target targets[2];
+    memset(targets, 0, sizeof(targets));
+    for(int r = 0; r < 2; r++) {
+        targets[r].relative = r;
+        targets[r].q = 0.5;
+    }
+    compute(source, rel_threshold, targets, 2, stats);
+    stats->median_abs = targets[0].result;
+    stats->median_rel = targets[1].result;
+}
+
+void fft_error_quantiles(const fft_error_source *source, double rel_threshold, const double *q, int nq,
+                         double *abs_out, double *rel_out) {
+    struct target *targets = (struct target*)checked_malloc(2 * nq * sizeof(struct target));
+    memset(targets, 0, 2 * nq * sizeof(struct target));
+    int ntargets = 0;
+    for(int i = 0; i < nq; i++) {
+        for(int r = 0; r < 2; r++) {
+            if(!(r ? rel_out : abs_out)) continue;
+            targets[ntargets].relative = r;
+            targets[ntargets].q = q[i];
+            ntargets++;
+        }
+    }
+    compute(source, rel_threshold, targets, ntargets, NULL);
+    ntargets = 0;
+    for(int i = 0; i < nq; i++) {
+        if(abs_out) abs_out[i] = targets[ntargets++].result;
+        if(rel_out) rel_out[i] = targets[ntargets++].result;
+    }
+    free(targets);
+}
@@ -0,0 +1,47 @@
+#ifndef FFT_ERRORS_H
+#define FFT_ERRORS_H
+
+// Error statistics of a result against a reference: RMS, maximum, median and any quantile of the
+// absolute errors |v - r| and of the relative errors |v - r| / |r|. Relative errors are only taken
+// where |r| > rel_threshold, so that values close to zero do not dominate them.
+// The errors are never stored: they are recomputed, in blocks, by every pass over the data. The
+// first pass sums the squares, takes the maximum and builds a histogram of the top 16 bits of the
+// errors (for non-negative doubles the bit patterns sort like the values); each quantile is then
+// narrowed down to one bucket, refined 16 bits at a time while the bucket is large, and finally
+// selected (introselect) among the few values gathered from it. A bucket whose errors are all
+// equal, as rounding errors often are, ends the search at once. Usually two passes are enough.
+// The passes run on the thread pool of fft_engine.h, with fft_planner_nthreads() threads.
+
+#include "fft_engine.h"
+
+// What is compared; filled by the functions below, which only keep the pointers
+typedef struct {
+    int kind;
+    const void *reference;
+    const void *values;
+    long count;
+    int cols;           // row length of fft_error_source_rows
+} fft_error_source;
+
+fft_error_source fft_error_source_real(const double *reference, const double *values, long count);
+// Modulus of the complex difference, relative to the modulus of the reference
+fft_error_source fft_error_source_complex(const Complex *reference, const Complex *values, long count);
+// rows x cols matrices stored as arrays of row pointers
+fft_error_source fft_error_source_rows(double *const *reference, double *const *values, int rows, int cols);
+
+typedef struct {
+    long count;         // values compared
+    long count_rel;     // values with |r| > rel_threshold, over which the relative errors are taken
+    double rms_abs, max_abs, median_abs;
+    double rms_rel, max_rel, median_rel;
+} fft_error_stats;
+
+void fft_error_stats_compute(const fft_error_source *source, double rel_threshold, fft_error_stats *stats);
+
+// The nq quantiles q[i] in [0, 1] of the absolute and relative errors (nearest rank: the value of
+// rank ceil(q * count) among the sorted errors, so 0.5 is the lower median and 1 the maximum).
+// abs_out or rel_out may be NULL; quantiles of an empty set are 0.
+void fft_error_quantiles(const fft_error_source *source, double rel_threshold, const double *q, int nq,
+                         double *abs_out, double *rel_out);
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef FFT_INTERNAL_H
+#define FFT_INTERNAL_H
+
+// Plan layout and helpers shared by the translation units of the custom FFT library.
+// Users of the library only see the opaque fft_plan of fft_engine.h.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "fft_engine.h"
+#include "fft_simd.h"
+#include "fft_codelets.h"
+
+// malloc that prints an error and exits on failure, for the engine, the modules built on it and
+// the drivers; size 0 still returns a block that can be freed
+static inline void *checked_malloc(size_t size) {
+    void *ptr = malloc(size > 0 ? size : 1);
+    if (!ptr) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return ptr;
+}
+
+// Wall-clock time in seconds (clock() adds the CPU time of every thread)
+static inline double wall_time(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+// Algorithms used for a 1D transform depending on the factorization of N
+enum fft_algorithm {
+    FFT_RADIX2,      // N = 2^m: radix-4 passes (split-radix in the scalar interleaved path)
+    FFT_MIXED_RADIX, // N = 2^a 3^b 5^c 7^d: recursive mixed-radix Cooley-Tukey with codelet leaves
+    FFT_BLUESTEIN,   // any other N: chirp-z convolution through a power-of-two FFT
+    FFT_CODELET      // N with a generated codelet (fft_codelets.c): one straight-line call
+};
+
+enum fft_kind {
+    FFT_KIND_DFT, // complex to complex
+    FFT_KIND_R2C, // real to half spectrum
+    FFT_KIND_C2R  // half spectrum to real
+};
+
+#define MAX_FACTORS 32
+
+// Smallest radix-2 size that uses the split-format vector kernels
+#define FFT_SIMD_MIN_N 16
+
+// Largest power of two done by a single codelet call; from 64 points on, the radix-4 vector passes
+// are as fast in 1D and their batch kernel is faster on the columns of 2D transforms
+#define FFT_CODELET_MAX_RADIX2 32
+
+// Columns gathered at once by the column pass of a 2D transform
+#define FFT_PANEL_WIDTH 16
+
+// Plans of the double engine; float and long double instantiate the same template in fft_precision.c
+#define REAL double
+#define COMPLEX Complex
+#define PREFIX(name) fft_##name
+#include "fft_plan_template.h"
+#undef REAL
+#undef COMPLEX
+#undef PREFIX
+
+// Runs job(arg, thread_id, nthreads) for thread_id = 0..nthreads-1 on the thread pool
+// (thread 0 is the caller) and returns when all of them are done
+typedef void (*fft_parallel_job)(void *arg, int thread_id, int nthreads);
+void fft_parallel_run(fft_parallel_job job, void *arg, int nthreads);
+
+#endif
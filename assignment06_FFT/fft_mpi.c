@@ -0,0 +1,418 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fft_mpi.h"
+#include "fft_internal.h"
+
+#define MAX_STAGES 5
+
+// Global transpose of a local array whose axis x is split over the ranks of comm (y whole)
+// into one whose axis y is split (x whole). w is an axis kept whole on both sides, z a run
+// of contiguous elements moved together. Strides are in elements of the local arrays.
+struct exchange {
+    MPI_Comm comm;
+    int nprocs, me;
+    int nx, ny, nw, nz;
+    long in_sx, in_sw, in_sy;
+    long out_sx, out_sw, out_sy;
+    int *x_start, *x_count;     // x block of every rank
+    int *y_start, *y_count;     // y block of every rank
+    int *send_counts, *send_displs;
+    int *recv_counts, *recv_displs;
+    int uniform;                // all blocks equal: MPI_Alltoall instead of MPI_Alltoallv
+};
+
+enum stage_type {
+    STAGE_FFT,
+    STAGE_EXCHANGE
+};
+
+struct stage {
+    enum stage_type type;
+    fft_plan plan;              // STAGE_FFT: local plan run on `planes` blocks of plane_size elements,
+    int planes;                 // NULL when this rank has no data at this stage
+    long plane_size;
+    struct exchange *exchange;  // STAGE_EXCHANGE
+};
+
+struct fft_mpi_plan_s {
+    fft_mpi_block in_block, out_block;
+    int n_stages;
+    struct stage stages[MAX_STAGES];
+    MPI_Comm row_comm, col_comm; // pencil: sub-communicators of the process grid
+    long buffer_size;
+    Complex *buffers[2];         // ping-pong buffers between the stages
+};
+
+// Block distribution of n indices over nprocs ranks, the first n % nprocs ranks get one more
+static void block_range(int n, int nprocs, int r, int *start, int *count) {
+    int base = n / nprocs, extra = n % nprocs;
+    *count = base + (r < extra ? 1 : 0);
+    *start = r * base + (r < extra ? r : extra);
+}
+
+static long max_long(long a, long b) {
+    return a > b ? a : b;
+}
+
+static struct exchange *create_exchange(MPI_Comm comm, int nx, int ny, int nw, int nz,
+                                        long in_sx, long in_sw, long in_sy, long out_sx, long out_sw, long out_sy) {
+    struct exchange *e = (struct exchange*)checked_malloc(sizeof(struct exchange));
+    e->comm = comm;
+    MPI_Comm_size(comm, &e->nprocs);
+    MPI_Comm_rank(comm, &e->me);
+    e->nx = nx;
+    e->ny = ny;
+    e->nw = nw;
+    e->nz = nz;
+    e->in_sx = in_sx;
+    e->in_sw = in_sw;
+    e->in_sy = in_sy;
+    e->out_sx = out_sx;
+    e->out_sw = out_sw;
+    e->out_sy = out_sy;
+
+    int P = e->nprocs;
+    e->x_start = (int*)checked_malloc(P * sizeof(int));
+    e->x_count = (int*)checked_malloc(P * sizeof(int));
+    e->y_start = (int*)checked_malloc(P * sizeof(int));
+    e->y_count = (int*)checked_malloc(P * sizeof(int));
+    e->send_counts = (int*)checked_malloc(P * sizeof(int));
+    e->send_displs = (int*)checked_malloc(P * sizeof(int));
+    e->recv_counts = (int*)checked_malloc(P * sizeof(int));
+    e->recv_displs = (int*)checked_malloc(P * sizeof(int));
+
+    for(int r = 0; r < P; r++) {
+        block_range(nx, P, r, &e->x_start[r], &e->x_count[r]);
+        block_range(ny, P, r, &e->y_start[r], &e->y_count[r]);
+    }
+
+    int send_offset = 0, recv_offset = 0;
+    for(int r = 0; r < P; r++) {
+        e->send_counts[r] = e->x_count[e->me] * nw * e->y_count[r] * nz;
+        e->recv_counts[r] = e->x_count[r] * nw * e->y_count[e->me] * nz;
+        e->send_displs[r] = send_offset;
+        e->recv_displs[r] = recv_offset;
+        send_offset += e->send_counts[r];
+        recv_offset += e->recv_counts[r];
+    }
+    // Same decision on every rank, as MPI_Alltoall is collective
+    e->uniform = nx % P == 0 && ny % P == 0;
+    return e;
+}
+
+static void destroy_exchange(struct exchange *e) {
+    free(e->x_start);
+    free(e->x_count);
+    free(e->y_start);
+    free(e->y_count);
+    free(e->send_counts);
+    free(e->send_displs);
+    free(e->recv_counts);
+    free(e->recv_displs);
+    free(e);
+}
+
+// Blocks for every destination, in (x, w, y) order
+static void pack(const struct exchange *e, const Complex *in, Complex *send) {
+    int lx = e->x_count[e->me];
+    for(int r = 0; r < e->nprocs; r++) {
+        Complex *buf = send + e->send_displs[r];
+        int y_end = e->y_start[r] + e->y_count[r];
+        for(int x = 0; x < lx; x++) {
+            for(int w = 0; w < e->nw; w++) {
+                for(int y = e->y_start[r]; y < y_end; y++) {
+                    memcpy(buf, &in[x*e->in_sx + w*e->in_sw + y*e->in_sy], e->nz * sizeof(Complex));
+                    buf += e->nz;
+                }
+            }
+        }
+    }
+}
+
+static void unpack(const struct exchange *e, const Complex *recv, Complex *out) {
+    int ly = e->y_count[e->me];
+    for(int r = 0; r < e->nprocs; r++) {
+        const Complex *buf = recv + e->recv_displs[r];
+        int x_end = e->x_start[r] + e->x_count[r];
+        for(int x = e->x_start[r]; x < x_end; x++) {
+            for(int w = 0; w < e->nw; w++) {
+                for(int y = 0; y < ly; y++) {
+                    memcpy(&out[x*e->out_sx + w*e->out_sw + y*e->out_sy], buf, e->nz * sizeof(Complex));
+                    buf += e->nz;
+                }
+            }
+        }
+    }
+}
+
+static void run_exchange(const struct exchange *e, const Complex *in, Complex *send, Complex *recv, Complex *out) {
+    pack(e, in, send);
+    if(e->uniform) {
+        MPI_Alltoall(send, e->send_counts[0], MPI_C_DOUBLE_COMPLEX,
+                     recv, e->recv_counts[0], MPI_C_DOUBLE_COMPLEX, e->comm);
+    } else {
+        MPI_Alltoallv(send, e->send_counts, e->send_displs, MPI_C_DOUBLE_COMPLEX,
+                      recv, e->recv_counts, e->recv_displs, MPI_C_DOUBLE_COMPLEX, e->comm);
+    }
+    unpack(e, recv, out);
+}
+
+// Stages are described in forward order; a backward plan runs them in reverse, each
+// exchange with its x and y roles swapped
+struct stage_spec {
+    enum stage_type type;
+    int N, howmany, stride, dist; // STAGE_FFT: batch of 1D transforms, or a 2D transform
+    int n0, n1;                   // of n0 x n1 when n0 > 0, on each of the planes
+    int planes;
+    long plane_size;
+    MPI_Comm comm;                // STAGE_EXCHANGE
+    int nx, ny, nw, nz;
+    long in_sx, in_sw, in_sy, out_sx, out_sw, out_sy;
+};
+
+static struct stage_spec fft_spec(int N, int howmany, int stride, int dist, int planes, long plane_size) {
+    struct stage_spec s;
+    memset(&s, 0, sizeof(s));
+    s.type = STAGE_FFT;
+    s.N = N;
+    s.howmany = howmany;
+    s.stride = stride;
+    s.dist = dist;
+    s.planes = planes;
+    s.plane_size = plane_size;
+    return s;
+}
+
+static struct stage_spec exchange_spec(MPI_Comm comm, int nx, int ny, int nw, int nz,
+                                       long in_sx, long in_sw, long in_sy, long out_sx, long out_sw, long out_sy) {
+    struct stage_spec s;
+    memset(&s, 0, sizeof(s));
+    s.type = STAGE_EXCHANGE;
+    s.comm = comm;
+    s.nx = nx;
+    s.ny = ny;
+    s.nw = nw;
+    s.nz = nz;
+    s.in_sx = in_sx;
+    s.in_sw = in_sw;
+    s.in_sy = in_sy;
+    s.out_sx = out_sx;
+    s.out_sw = out_sw;
+    s.out_sy = out_sy;
+    return s;
+}
+
+static void build_stages(struct fft_mpi_plan_s *p, const struct stage_spec *specs, int n_specs,
+                         int direction, unsigned flags) {
+    int backward = direction == FFT_BACKWARD;
+    p->n_stages = n_specs;
+    p->buffer_size = 1;
+
+    for(int i = 0; i < n_specs; i++) {
+        const struct stage_spec *s = &specs[backward ? n_specs - 1 - i : i];
+        struct stage *st = &p->stages[i];
+        memset(st, 0, sizeof(struct stage));
+        st->type = s->type;
+
+        if(s->type == STAGE_FFT) {
+            st->planes = s->planes;
+            st->plane_size = s->plane_size;
+            if(s->n0 > 0 && s->planes > 0) {
+                st->plan = fft_plan_create_2d(s->n0, s->n1, direction, flags);
+            } else if(s->howmany > 0 && s->planes > 0) {
+                st->plan = fft_plan_create_many(s->N, s->howmany, s->stride, s->dist, s->stride, s->dist, direction, flags);
+            }
+            p->buffer_size = max_long(p->buffer_size, s->planes * s->plane_size);
+            continue;
+        }
+
+        if(backward) {
+            st->exchange = create_exchange(s->comm, s->ny, s->nx, s->nw, s->nz,
+                                           s->out_sy, s->out_sw, s->out_sx, s->in_sy, s->in_sw, s->in_sx);
+        } else {
+            st->exchange = create_exchange(s->comm, s->nx, s->ny, s->nw, s->nz,
+                                           s->in_sx, s->in_sw, s->in_sy, s->out_sx, s->out_sw, s->out_sy);
+        }
+        const struct exchange *e = st->exchange;
+        long send_size = (long)e->x_count[e->me] * e->nw * e->ny * e->nz;
+        long recv_size = (long)e->nx * e->nw * e->y_count[e->me] * e->nz;
+        p->buffer_size = max_long(p->buffer_size, max_long(send_size, recv_size));
+    }
+
+    p->buffers[0] = (Complex*)checked_malloc(p->buffer_size * sizeof(Complex));
+    p->buffers[1] = (Complex*)checked_malloc(p->buffer_size * sizeof(Complex));
+}
+
+static struct fft_mpi_plan_s *new_mpi_plan(void) {
+    struct fft_mpi_plan_s *p = (struct fft_mpi_plan_s*)checked_malloc(sizeof(struct fft_mpi_plan_s));
+    memset(p, 0, sizeof(struct fft_mpi_plan_s));
+    p->row_comm = MPI_COMM_NULL;
+    p->col_comm = MPI_COMM_NULL;
+    return p;
+}
+
+static void set_block(fft_mpi_block *b, int rank, const int *axis, const int *start, const int *count) {
+    b->rank = rank;
+    for(int d = 0; d < 3; d++) {
+        b->axis[d] = d < rank ? axis[d] : 0;
+        b->start[d] = d < rank ? start[d] : 0;
+        b->count[d] = d < rank ? count[d] : 1;
+    }
+}
+
+// The forward blocks; a backward plan takes the output block as input and vice versa
+static void set_blocks(struct fft_mpi_plan_s *p, int direction, int rank,
+                       const int *in_axis, const int *in_start, const int *in_count,
+                       const int *out_axis, const int *out_start, const int *out_count) {
+    if(direction == FFT_FORWARD) {
+        set_block(&p->in_block, rank, in_axis, in_start, in_count);
+        set_block(&p->out_block, rank, out_axis, out_start, out_count);
+    } else {
+        set_block(&p->in_block, rank, out_axis, out_start, out_count);
+        set_block(&p->out_block, rank, in_axis, in_start, in_count);
+    }
+}
+
+// Slab 2D: rows of the n0-block, exchange to the n1-block stored as [j][i], rows of length n0
+fft_mpi_plan fft_mpi_plan_create_2d(int n0, int n1, int direction, MPI_Comm comm, unsigned flags) {
+    if(n0 < 1 || n1 < 1 || (direction != FFT_FORWARD && direction != FFT_BACKWARD)) return NULL;
+
+    int nprocs, me, i0, li, j0, lj;
+    MPI_Comm_size(comm, &nprocs);
+    MPI_Comm_rank(comm, &me);
+    block_range(n0, nprocs, me, &i0, &li);
+    block_range(n1, nprocs, me, &j0, &lj);
+
+    struct fft_mpi_plan_s *p = new_mpi_plan();
+    struct stage_spec specs[3] = {
+        fft_spec(n1, li, 1, n1, 1, (long)li * n1),
+        exchange_spec(comm, n0, n1, 1, 1, n1, 0, 1, 1, 0, n0),
+        fft_spec(n0, lj, 1, n0, 1, (long)lj * n0)
+    };
+    build_stages(p, specs, 3, direction, flags);
+
+    int in_axis[2] = {0, 1}, in_start[2] = {i0, 0}, in_count[2] = {li, n1};
+    int out_axis[2] = {1, 0}, out_start[2] = {j0, 0}, out_count[2] = {lj, n0};
+    set_blocks(p, direction, 2, in_axis, in_start, in_count, out_axis, out_start, out_count);
+    return p;
+}
+
+// Slab 3D: (n1, n2) planes of the n0-block, exchange of whole k rows to the n1-block stored as
+// [j][i][k], then the n0 transforms run on the side by side columns of each j plane.
+// Pencil 3D on a P0 x P1 grid: k rows of the (n0, n1)-block, exchange inside each grid row to
+// [i][k][j] (k split over P1), j rows, exchange inside each grid column to [k][j][i] (j split over P0), i rows.
+fft_mpi_plan fft_mpi_plan_create_3d(int n0, int n1, int n2, int direction, fft_mpi_decomposition decomposition,
+                                    MPI_Comm comm, unsigned flags) {
+    if(n0 < 1 || n1 < 1 || n2 < 1 || (direction != FFT_FORWARD && direction != FFT_BACKWARD)) return NULL;
+
+    int nprocs, me;
+    MPI_Comm_size(comm, &nprocs);
+    MPI_Comm_rank(comm, &me);
+    struct fft_mpi_plan_s *p = new_mpi_plan();
+
+    if(decomposition == FFT_MPI_SLAB) {
+        int i0, li, j0, lj;
+        block_range(n0, nprocs, me, &i0, &li);
+        block_range(n1, nprocs, me, &j0, &lj);
+
+        struct stage_spec specs[3] = {
+            fft_spec(0, 0, 0, 0, li, (long)n1 * n2),
+            exchange_spec(comm, n0, n1, 1, n2, (long)n1 * n2, 0, n2, n2, 0, (long)n0 * n2),
+            fft_spec(n0, n2, n2, 1, lj, (long)n0 * n2)
+        };
+        specs[0].n0 = n1;
+        specs[0].n1 = n2;
+        build_stages(p, specs, 3, direction, flags);
+
+        int in_axis[3] = {0, 1, 2}, in_start[3] = {i0, 0, 0}, in_count[3] = {li, n1, n2};
+        int out_axis[3] = {1, 0, 2}, out_start[3] = {j0, 0, 0}, out_count[3] = {lj, n0, n2};
+        set_blocks(p, direction, 3, in_axis, in_start, in_count, out_axis, out_start, out_count);
+        return p;
+    }
+
+    // Process grid: row_comm links the ranks with the same p0 (size P1), col_comm the same p1 (size P0)
+    int dims[2] = {0, 0}, periods[2] = {0, 0}, coords[2];
+    MPI_Comm grid_comm;
+    MPI_Dims_create(nprocs, 2, dims);
+    MPI_Cart_create(comm, 2, dims, periods, 0, &grid_comm);
+    MPI_Cart_coords(grid_comm, me, 2, coords);
+    int keep_p1[2] = {0, 1}, keep_p0[2] = {1, 0};
+    MPI_Cart_sub(grid_comm, keep_p1, &p->row_comm);
+    MPI_Cart_sub(grid_comm, keep_p0, &p->col_comm);
+    MPI_Comm_free(&grid_comm);
+
+    int P0 = dims[0], P1 = dims[1], p0 = coords[0], p1 = coords[1];
+    int i0, li, j0, lj, k0, lk, j2_0, lj2;
+    block_range(n0, P0, p0, &i0, &li);
+    block_range(n1, P1, p1, &j0, &lj);
+    block_range(n2, P1, p1, &k0, &lk);
+    block_range(n1, P0, p0, &j2_0, &lj2);
+
+    struct stage_spec specs[5] = {
+        fft_spec(n2, li * lj, 1, n2, 1, (long)li * lj * n2),
+        exchange_spec(p->row_comm, n1, n2, li, 1, n2, (long)lj * n2, 1, 1, (long)lk * n1, n1),
+        fft_spec(n1, li * lk, 1, n1, 1, (long)li * lk * n1),
+        exchange_spec(p->col_comm, n0, n1, lk, 1, (long)lk * n1, n1, 1, 1, (long)lj2 * n0, n0),
+        fft_spec(n0, lk * lj2, 1, n0, 1, (long)lk * lj2 * n0)
+    };
+    build_stages(p, specs, 5, direction, flags);
+
+    int in_axis[3] = {0, 1, 2}, in_start[3] = {i0, j0, 0}, in_count[3] = {li, lj, n2};
+    int out_axis[3] = {2, 1, 0}, out_start[3] = {k0, j2_0, 0}, out_count[3] = {lk, lj2, n0};
+    set_blocks(p, direction, 3, in_axis, in_start, in_count, out_axis, out_start, out_count);
+    return p;
+}
+
+void fft_mpi_local_blocks(const fft_mpi_plan plan, fft_mpi_block *in, fft_mpi_block *out) {
+    if(in) *in = plan->in_block;
+    if(out) *out = plan->out_block;
+}
+
+long fft_mpi_block_size(const fft_mpi_block *block) {
+    long size = 1;
+    for(int d = 0; d < block->rank; d++) {
+        size *= block->count[d];
+    }
+    return size;
+}
+
+// Each stage reads the output of the previous one and writes into the other ping-pong buffer
+// (the last one into out); an exchange packs into one buffer and receives into the other.
+// The input is only read.
+void fft_mpi_execute(const fft_mpi_plan plan, const Complex *in, Complex *out) {
+    const Complex *src = in;
+
+    for(int s = 0; s < plan->n_stages; s++) {
+        const struct stage *st = &plan->stages[s];
+        Complex *spare = src == plan->buffers[0] ? plan->buffers[1] : plan->buffers[0];
+        Complex *dst = s == plan->n_stages - 1 ? out : spare;
+
+        if(st->type == STAGE_FFT) {
+            if(st->plan) {
+                for(int i = 0; i < st->planes; i++) {
+                    fft_execute(st->plan, src + i * st->plane_size, dst + i * st->plane_size);
+                }
+            }
+        } else {
+            Complex *recv = spare == plan->buffers[0] ? plan->buffers[1] : plan->buffers[0];
+            run_exchange(st->exchange, src, spare, recv, dst);
+        }
+        src = dst;
+    }
+}
+
+void fft_mpi_plan_destroy(fft_mpi_plan plan) {
+    if(!plan) return;
+
+    for(int s = 0; s < plan->n_stages; s++) {
+        fft_plan_destroy(plan->stages[s].plan);
+        if(plan->stages[s].exchange) destroy_exchange(plan->stages[s].exchange);
+    }
+    if(plan->row_comm != MPI_COMM_NULL) MPI_Comm_free(&plan->row_comm);
+    if(plan->col_comm != MPI_COMM_NULL) MPI_Comm_free(&plan->col_comm);
+    free(plan->buffers[0]);
+    free(plan->buffers[1]);
+    free(plan);
+}
@@ -0,0 +1,46 @@
+#ifndef FFT_MPI_H
+#define FFT_MPI_H
+
+// Distributed 2D/3D FFT over MPI, built on the plans of fft_engine.h (modelled on fftw_mpi).
+// Each rank owns a block of a row-major global array; the global transposes between the
+// local 1D passes are MPI_Alltoall (equal blocks) or MPI_Alltoallv exchanges.
+
+#include <mpi.h>
+
+#include "fft_engine.h"
+
+typedef enum {
+    FFT_MPI_SLAB,   // 1D decomposition: blocks of n0 on input, of n1 on output
+    FFT_MPI_PENCIL  // 3D only, 2D process grid: blocks of (n0, n1) on input, of (n2, n1) on output
+} fft_mpi_decomposition;
+
+typedef struct fft_mpi_plan_s *fft_mpi_plan;
+
+// Local part of the global array: the local array is count[0] x count[1] (x count[2]), its
+// dimension d holding global axis axis[d], indices start[d] ... start[d] + count[d] - 1
+typedef struct {
+    int rank;
+    int axis[3];
+    int start[3];
+    int count[3];
+} fft_mpi_block;
+
+// Like FFTW_MPI_TRANSPOSED_OUT / FFTW_MPI_TRANSPOSED_IN, the forward transform leaves the
+// spectrum in the transposed layout of its last exchange and the backward transform takes it
+// back from there, which saves one global transpose each way:
+//   slab 2D:   forward n0-block [i][j]     -> n1-block [j][i]
+//   slab 3D:   forward n0-block [i][j][k]  -> n1-block [j][i][k]
+//   pencil 3D: forward (n0, n1)-block [i][j][k] -> (n2, n1)-block [k][j][i]
+// The backward plan maps the output layout of the forward plan back to its input layout.
+// Both are unnormalized. Every rank of comm must call the functions below collectively.
+fft_mpi_plan fft_mpi_plan_create_2d(int n0, int n1, int direction, MPI_Comm comm, unsigned flags);
+fft_mpi_plan fft_mpi_plan_create_3d(int n0, int n1, int n2, int direction, fft_mpi_decomposition decomposition,
+                                    MPI_Comm comm, unsigned flags);
+void fft_mpi_local_blocks(const fft_mpi_plan plan, fft_mpi_block *in, fft_mpi_block *out);
+void fft_mpi_execute(const fft_mpi_plan plan, const Complex *in, Complex *out);
+void fft_mpi_plan_destroy(fft_mpi_plan plan);
+
+// Number of elements of a local block
+long fft_mpi_block_size(const fft_mpi_block *block);
+
+#endif
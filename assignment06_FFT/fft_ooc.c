@@ -0,0 +1,282 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "fft_ooc.h"
+#include "fft_transpose.h"
+#include "fft_internal.h"
+
+// Rows gathered, scattered or transposed between two releases of their pages
+#define OOC_ROW_GROUP 64
+
+struct mapped_file {
+    int fd;
+    Complex *data;
+    size_t bytes;
+};
+
+// W_N^m = high[m / split] * low[m % split]: two tables of about sqrt(N) entries instead of one of N
+struct twiddles {
+    long split;
+    Complex *high, *low;
+};
+
+static int min_int(int a, int b) {
+    return a < b ? a : b;
+}
+
+static int map_file(const char *path, size_t bytes, int create, struct mapped_file *f) {
+    f->fd = open(path, create ? O_RDWR | O_CREAT | O_TRUNC : O_RDWR, 0644);
+    if(f->fd < 0) {
+        printf("fft_ooc: cannot open %s\n", path);
+        return -1;
+    }
+    if(create) {
+        if(ftruncate(f->fd, (off_t)bytes) != 0) {
+            printf("fft_ooc: cannot resize %s to %zu bytes\n", path, bytes);
+            close(f->fd);
+            return -1;
+        }
+    } else {
+        struct stat st;
+        if(fstat(f->fd, &st) != 0 || (size_t)st.st_size != bytes) {
+            printf("fft_ooc: %s does not hold %zu bytes\n", path, bytes);
+            close(f->fd);
+            return -1;
+        }
+    }
+    f->data = (Complex*)mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, f->fd, 0);
+    if(f->data == MAP_FAILED) {
+        printf("fft_ooc: cannot map %s\n", path);
+        close(f->fd);
+        return -1;
+    }
+    f->bytes = bytes;
+    return 0;
+}
+
+static void unmap_file(struct mapped_file *f) {
+    munmap(f->data, f->bytes);
+    close(f->fd);
+}
+
+// Drops the pages holding elements [from, to) from the process. Dirty pages stay in the page
+// cache and are written back by the kernel, so this bounds the resident memory, not the I/O.
+// The column passes release whole rows: a page fault also maps the cached neighbours of the
+// page (fault-around), which lie outside the column band.
+static void release(const struct mapped_file *f, size_t from, size_t to) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t begin = from * sizeof(Complex) / page * page;
+    size_t end = to * sizeof(Complex);
+    if(end > f->bytes) end = f->bytes;
+    if(end > begin) madvise((char*)f->data + begin, end - begin, MADV_DONTNEED);
+}
+
+static struct twiddles *create_twiddles(long N, int direction) {
+    struct twiddles *tw = (struct twiddles*)checked_malloc(sizeof(struct twiddles));
+    tw->split = (long)ceil(sqrt((double)N));
+    long n_high = (N + tw->split - 1) / tw->split;
+    tw->high = (Complex*)checked_malloc(n_high * sizeof(Complex));
+    tw->low = (Complex*)checked_malloc(tw->split * sizeof(Complex));
+    const double pi = acos(-1.0);
+    double step = direction * 2.0 * pi / N;
+    for(long h = 0; h < n_high; h++) {
+        tw->high[h].real = cos(step * (double)(h * tw->split));
+        tw->high[h].imag = sin(step * (double)(h * tw->split));
+    }
+    for(long l = 0; l < tw->split; l++) {
+        tw->low[l].real = cos(step * l);
+        tw->low[l].imag = sin(step * l);
+    }
+    return tw;
+}
+
+static void destroy_twiddles(struct twiddles *tw) {
+    if(!tw) return;
+    free(tw->high);
+    free(tw->low);
+    free(tw);
+}
+
+// Transforms the n0 rows of length n1 in place on the mapping, band_rows rows at a time
+static void row_pass(const struct mapped_file *f, int n0, int n1, int direction, int band_rows) {
+    fft_plan plan = NULL;
+    int plan_rows = 0;
+
+    madvise(f->data, f->bytes, MADV_SEQUENTIAL);
+    for(int r0 = 0; r0 < n0; r0 += band_rows) {
+        int rows = min_int(band_rows, n0 - r0);
+        if(rows != plan_rows) {
+            fft_plan_destroy(plan);
+            plan = fft_plan_create_many(n1, rows, 1, n1, 1, n1, direction, FFT_DEFAULT);
+            plan_rows = rows;
+        }
+        Complex *band = f->data + (size_t)r0 * n1;
+        fft_execute(plan, band, band);
+        release(f, (size_t)r0 * n1, (size_t)(r0 + rows) * n1);
+    }
+    fft_plan_destroy(plan);
+    madvise(f->data, f->bytes, MADV_NORMAL);
+}
+
+// Transforms the n1 columns of length n0 in place, band_cols at a time: each band is gathered
+// into a tile (n0 x band_cols), transformed as side by side signals and scattered back. With
+// twiddles (four-step algorithm), tile[k][c] is also multiplied by W_N^(k * (c0 + c)).
+static void column_pass(const struct mapped_file *f, int n0, int n1, int direction, int band_cols,
+                        const struct twiddles *tw) {
+    Complex *tile = (Complex*)checked_malloc((size_t)n0 * band_cols * sizeof(Complex));
+    fft_plan plan = NULL;
+    int plan_cols = 0;
+
+    for(int c0 = 0; c0 < n1; c0 += band_cols) {
+        int cols = min_int(band_cols, n1 - c0);
+        if(cols != plan_cols) {
+            fft_plan_destroy(plan);
+            plan = fft_plan_create_many(n0, cols, cols, 1, cols, 1, direction, FFT_DEFAULT);
+            plan_cols = cols;
+        }
+
+        for(int i0 = 0; i0 < n0; i0 += OOC_ROW_GROUP) {
+            int i_end = min_int(i0 + OOC_ROW_GROUP, n0);
+            for(int i = i0; i < i_end; i++) {
+                memcpy(tile + (size_t)i * cols, f->data + (size_t)i * n1 + c0, cols * sizeof(Complex));
+            }
+            release(f, (size_t)i0 * n1, (size_t)i_end * n1);
+        }
+
+        fft_execute(plan, tile, tile);
+
+        if(tw) {
+            for(int k = 0; k < n0; k++) {
+                Complex *row = tile + (size_t)k * cols;
+                for(int c = 0; c < cols; c++) {
+                    long m = (long)k * (c0 + c);
+                    Complex h = tw->high[m / tw->split], l = tw->low[m % tw->split];
+                    double wr = h.real * l.real - h.imag * l.imag;
+                    double wi = h.real * l.imag + h.imag * l.real;
+                    double xr = row[c].real, xi = row[c].imag;
+                    row[c].real = xr * wr - xi * wi;
+                    row[c].imag = xr * wi + xi * wr;
+                }
+            }
+        }
+
+        for(int i0 = 0; i0 < n0; i0 += OOC_ROW_GROUP) {
+            int i_end = min_int(i0 + OOC_ROW_GROUP, n0);
+            for(int i = i0; i < i_end; i++) {
+                memcpy(f->data + (size_t)i * n1 + c0, tile + (size_t)i * cols, cols * sizeof(Complex));
+            }
+            release(f, (size_t)i0 * n1, (size_t)i_end * n1);
+        }
+    }
+    fft_plan_destroy(plan);
+    free(tile);
+}
+
+// out (n1 x n0) = transpose of in (n0 x n1), band_rows rows of out at a time: each band of out
+// is one contiguous range of the file, filled from segments of band_rows elements of every row of in
+static void transpose_pass(const struct mapped_file *in, const struct mapped_file *out, int n0, int n1, int band_rows) {
+    for(int c0 = 0; c0 < n1; c0 += band_rows) {
+        int cols = min_int(band_rows, n1 - c0);
+        for(int i0 = 0; i0 < n0; i0 += OOC_ROW_GROUP) {
+            int rows = min_int(OOC_ROW_GROUP, n0 - i0);
+            transpose_complex(in->data + (size_t)i0 * n1 + c0, n1, out->data + (size_t)c0 * n0 + i0, n0, rows, cols);
+            release(in, (size_t)i0 * n1, (size_t)(i0 + rows) * n1);
+        }
+        release(out, (size_t)c0 * n0, (size_t)(c0 + cols) * n0);
+    }
+}
+
+// Number of rows (or columns) of length len that fit in the budget, at most total
+static int band_size(size_t memory_budget, long len, int total) {
+    size_t band = memory_budget / (len * sizeof(Complex));
+    return band < (size_t)total ? (int)band : total;
+}
+
+int fft_ooc_2d(const char *path, int n0, int n1, int direction, size_t memory_budget, fft_ooc_stats *stats) {
+    if(n0 < 1 || n1 < 1 || (direction != FFT_FORWARD && direction != FFT_BACKWARD)) return -1;
+    int band_rows = band_size(memory_budget, n1, n0);
+    int band_cols = band_size(memory_budget, n0, n1);
+    if(band_rows < 1 || band_cols < 1) {
+        printf("fft_ooc_2d: a memory budget of %zu bytes does not hold one row and one column\n", memory_budget);
+        return -1;
+    }
+
+    struct mapped_file f;
+    size_t size = (size_t)n0 * n1;
+    if(map_file(path, size * sizeof(Complex), 0, &f) != 0) return -1;
+
+    double start = wall_time();
+    row_pass(&f, n0, n1, direction, band_rows);
+    column_pass(&f, n0, n1, direction, band_cols, NULL);
+    double elapsed = wall_time() - start;
+
+    unmap_file(&f);
+
+    if(stats) {
+        stats->passes = 2;
+        stats->seconds = elapsed;
+        stats->bytes_moved = 2.0 * 2.0 * size * sizeof(Complex);
+        size_t row_band = (size_t)band_rows * n1 * sizeof(Complex);
+        size_t col_band = (size_t)band_cols * n0 * sizeof(Complex);
+        stats->tile_bytes = row_band > col_band ? row_band : col_band;
+    }
+    return 0;
+}
+
+int fft_ooc_1d(const char *in_path, const char *out_path, long N, int direction, size_t memory_budget,
+               fft_ooc_stats *stats) {
+    if(N < 1 || (direction != FFT_FORWARD && direction != FFT_BACKWARD)) return -1;
+
+    long n1 = (long)sqrt((double)N);
+    while(n1 > 1 && N % n1 != 0) n1--;
+    long n2 = N / n1;
+    if(n2 > 0x7fffffffL) {
+        printf("fft_ooc_1d: N = %ld has no factor pair below 2^31\n", N);
+        return -1;
+    }
+    int N1 = (int)n1, N2 = (int)n2;
+
+    // The file is N1 x N2; the column and transpose passes work on bands of columns of length N1
+    int band_rows = band_size(memory_budget, N2, N1);
+    int band_cols = band_size(memory_budget, N1, N2);
+    if(band_rows < 1 || band_cols < 1) {
+        printf("fft_ooc_1d: a memory budget of %zu bytes does not hold %d values\n", memory_budget, N2);
+        return -1;
+    }
+
+    struct mapped_file in, out;
+    size_t bytes = (size_t)N * sizeof(Complex);
+    if(map_file(in_path, bytes, 0, &in) != 0) return -1;
+    if(map_file(out_path, bytes, 1, &out) != 0) {
+        unmap_file(&in);
+        return -1;
+    }
+    struct twiddles *tw = create_twiddles(N, direction);
+
+    double start = wall_time();
+    column_pass(&in, N1, N2, direction, band_cols, tw);
+    row_pass(&in, N1, N2, direction, band_rows);
+    transpose_pass(&in, &out, N1, N2, band_cols);
+    double elapsed = wall_time() - start;
+
+    destroy_twiddles(tw);
+    unmap_file(&in);
+    unmap_file(&out);
+
+    if(stats) {
+        stats->passes = 3;
+        stats->seconds = elapsed;
+        stats->bytes_moved = 3.0 * 2.0 * bytes;
+        size_t row_band = (size_t)band_rows * N2 * sizeof(Complex);
+        size_t col_band = (size_t)band_cols * N1 * sizeof(Complex);
+        stats->tile_bytes = row_band > col_band ? row_band : col_band;
+    }
+    return 0;
+}
@@ -0,0 +1,34 @@
+#ifndef FFT_OOC_H
+#define FFT_OOC_H
+
+// Out-of-core FFTs for arrays larger than the memory, stored in a binary file of Complex values
+// (native byte order, row-major). The file is memory-mapped and processed in bands of rows or
+// columns that fit in a memory budget; every pass sweeps the file once from start to end, and
+// the pages of a band are dropped from the process as soon as the band is done.
+
+#include <stddef.h>
+
+#include "fft_engine.h"
+
+typedef struct {
+    int passes;         // sweeps over the file
+    double seconds;     // wall-clock time of all the passes
+    double bytes_moved; // bytes read plus bytes written by the passes
+    size_t tile_bytes;  // largest band held in memory at a time
+} fft_ooc_stats;
+
+// In-place 2D transform of the n0 x n1 matrix stored in path: one pass over bands of rows, one
+// over bands of columns (each column band is gathered into a tile, transformed and scattered back).
+// memory_budget must hold at least one row and one column (16 * max(n0, n1) bytes); the plan
+// scratch and a few pages per group of rows come on top of it. Returns 0, or -1 on error.
+int fft_ooc_2d(const char *path, int n0, int n1, int direction, size_t memory_budget, fft_ooc_stats *stats);
+
+// 1D transform of the N values stored in in_path into out_path (created or overwritten), with
+// the four-step algorithm on N = N1 x N2 (N1 the largest divisor of N not above sqrt(N)):
+// N1-point column FFTs and twiddles, N2-point row FFTs, then an out-of-core transpose into
+// out_path. in_path is used as scratch and is overwritten. memory_budget must hold N2 values.
+// Returns 0, or -1 on error.
+int fft_ooc_1d(const char *in_path, const char *out_path, long N, int direction, size_t memory_budget,
+               fft_ooc_stats *stats);
+
+#endif
@@ -0,0 +1,91 @@
+// Radix-4 passes of the radix-2 sizes on LANES consecutive butterflies at a time, included by
+// fft_engine_template.h once per vector width with
+//   VEC         REAL or a GCC vector of LANES REAL
+//   LANES       number of REAL in a VEC
+//   PASS(name)  the name of each function of this width
+// The functions are always inlined, so they take the instruction set of the caller.
+
+// Radix-4 butterflies on x[0], x[q], x[2q], x[3q] (real parts in re, imaginary parts in im) of
+// LANES consecutive k, with w = {w1r, w1i, w2r, w2i, w3r, w3i} already conjugated for the inverse
+// transform (passed by address: 64-byte vectors have no stable calling convention); with notw the
+// twiddles are all 1 (k = 0) and not applied
+static inline __attribute__((always_inline))
+void PASS(radix4)(REAL *re, REAL *im, long q, const VEC *w, REAL sign, int notw) {
+    VEC x0r, x0i, x1r, x1i, x2r, x2i, x3r, x3i;
+    memcpy(&x0r, re, sizeof(VEC));
+    memcpy(&x0i, im, sizeof(VEC));
+    memcpy(&x1r, re + q, sizeof(VEC));
+    memcpy(&x1i, im + q, sizeof(VEC));
+    memcpy(&x2r, re + 2*q, sizeof(VEC));
+    memcpy(&x2i, im + 2*q, sizeof(VEC));
+    memcpy(&x3r, re + 3*q, sizeof(VEC));
+    memcpy(&x3i, im + 3*q, sizeof(VEC));
+
+    VEC t1r = x1r, t1i = x1i, t2r = x2r, t2i = x2i, t3r = x3r, t3i = x3i;
+    if(!notw) {
+        t1r = w[2] * x1r - w[3] * x1i;
+        t1i = w[2] * x1i + w[3] * x1r;
+        t2r = w[0] * x2r - w[1] * x2i;
+        t2i = w[0] * x2i + w[1] * x2r;
+        t3r = w[4] * x3r - w[5] * x3i;
+        t3i = w[4] * x3i + w[5] * x3r;
+    }
+    VEC ar = x0r + t1r, ai = x0i + t1i;
+    VEC br = x0r - t1r, bi = x0i - t1i;
+    VEC sr = t2r + t3r, si = t2i + t3i;
+    // -i (forward) or +i (inverse) times the difference
+    VEC dr = sign * (t2i - t3i), di = sign * (t3r - t2r);
+
+    VEC y0r = ar + sr, y0i = ai + si, y2r = ar - sr, y2i = ai - si;
+    VEC y1r = br + dr, y1i = bi + di, y3r = br - dr, y3i = bi - di;
+    memcpy(re, &y0r, sizeof(VEC));
+    memcpy(im, &y0i, sizeof(VEC));
+    memcpy(re + q, &y1r, sizeof(VEC));
+    memcpy(im + q, &y1i, sizeof(VEC));
+    memcpy(re + 2*q, &y2r, sizeof(VEC));
+    memcpy(im + 2*q, &y2i, sizeof(VEC));
+    memcpy(re + 3*q, &y3r, sizeof(VEC));
+    memcpy(im + 3*q, &y3i, sizeof(VEC));
+}
+
+// Radix-4 pass of quarter-span h >= LANES on split data, the twiddles loaded from the stage tables
+static inline __attribute__((always_inline))
+void PASS(split_radix4)(const struct PREFIX(plan_s) *p, REAL *re, REAL *im, int h, REAL sign) {
+    int N = p->N;
+    const REAL *w1r = p->stage_twiddles_re + 2*h, *w1i = p->stage_twiddles_im + 2*h;
+    const REAL *w2r = p->stage_twiddles_re + h, *w2i = p->stage_twiddles_im + h;
+    const REAL *w3r = p->stage_twiddles3_re + h, *w3i = p->stage_twiddles3_im + h;
+    for(int start = 0; start < N; start += 4*h) {
+        for(int k = 0; k < h; k += LANES) {
+            VEC a1r, a1i, a2r, a2i, a3r, a3i;
+            memcpy(&a1r, w1r + k, sizeof(VEC));
+            memcpy(&a1i, w1i + k, sizeof(VEC));
+            memcpy(&a2r, w2r + k, sizeof(VEC));
+            memcpy(&a2i, w2i + k, sizeof(VEC));
+            memcpy(&a3r, w3r + k, sizeof(VEC));
+            memcpy(&a3i, w3i + k, sizeof(VEC));
+            VEC w[6] = {a1r, sign * a1i, a2r, sign * a2i, a3r, sign * a3i};
+            PASS(radix4)(re + start + k, im + start + k, h, w, sign, 0);
+        }
+    }
+}
+
+// Radix-4 pass of quarter-span h in batch layout, FFT_PANEL_WIDTH / LANES vectors per row; the
+// twiddles of each k are broadcast once for all the lanes, and the butterflies of k = 0 skip them
+static inline __attribute__((always_inline))
+void PASS(batch_radix4)(const struct PREFIX(plan_s) *p, REAL *re, REAL *im, int h, REAL sign) {
+    int N = p->N;
+    long q = (long)h * FFT_PANEL_WIDTH;
+    const VEC zero = {0};
+    for(int start = 0; start < N; start += 4*h) {
+        for(int k = 0; k < h; k++) {
+            VEC w[6] = {zero + p->stage_twiddles_re[2*h + k], zero + sign * p->stage_twiddles_im[2*h + k],
+                        zero + p->stage_twiddles_re[h + k], zero + sign * p->stage_twiddles_im[h + k],
+                        zero + p->stage_twiddles3_re[h + k], zero + sign * p->stage_twiddles3_im[h + k]};
+            long row = (long)(start + k) * FFT_PANEL_WIDTH;
+            for(int j = 0; j < FFT_PANEL_WIDTH; j += LANES) {
+                PASS(radix4)(re + row + j, im + row + j, q, w, sign, k == 0);
+            }
+        }
+    }
+}
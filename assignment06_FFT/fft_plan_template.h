@@ -0,0 +1,71 @@
+// Plan structure and internal entry points of one precision of the engine, included with
+//   REAL          the scalar type
+//   COMPLEX       its interleaved (real, imag) pair
+//   PREFIX(name)  the prefix of every function and type of the precision: fft_ (double, by
+//                 fft_internal.h), fftf_ (float) and fftl_ (long double, by fft_precision.c)
+// The code is fft_engine_template.h. No include guard: every inclusion defines a new precision.
+
+struct PREFIX(plan_s) {
+    enum fft_kind kind;
+    int rank;                   // number of dimensions
+    int direction;
+    unsigned flags;
+    int work_size;              // COMPLEX entries of scratch needed by one execution (per thread)
+    int nthreads;               // threads used by the execution (batched and 2D plans)
+    COMPLEX *work;              // scratch owned by the plan, nthreads * work_size entries
+    int work_busy;              // 1 while an execution holds work (atomic, see acquire_work)
+
+    // 1D
+    int N;
+    enum fft_algorithm algorithm;
+    int *bitrev;                // radix-2: bit-reversal permutation of 0..N-1
+    COMPLEX *twiddles;          // mixed-radix: exp(-2*pi*i*k/N), N entries
+    fft_simd_level simd;        // radix-2: vector kernels used on the split-format copy of the data
+    REAL *stage_twiddles_re;    // radix-2: W^k = exp(-2*pi*i*k/2h) for the stage of half-span h at [h, 2h),
+    REAL *stage_twiddles_im;    // contiguous so the butterflies load them with unit stride
+    REAL *stage_twiddles3_re;   // radix-2: W^3k = exp(-2*pi*i*3k/4h) for the radix-4 pass of quarter-span h
+    REAL *stage_twiddles3_im;   // at [h, 2h); with the two tables above a pass reads W^k, W^2k and W^3k
+    int factors[2*MAX_FACTORS]; // mixed-radix: (radix p, remaining length m) pairs, the last one the leaf (m = 1)
+    PREFIX(codelet) codelet;    // codelet: the transform; mixed-radix: the leaf transforms
+    int M;                      // Bluestein: power-of-two convolution length >= 2N-1
+    COMPLEX *chirp;             // Bluestein: exp(-pi*i*k^2/N), N entries
+    COMPLEX *chirp_spectrum;    // Bluestein: FFT of the conjugate chirp, M entries
+    PREFIX(plan) sub;           // Bluestein: plan of the size-M transform
+
+    // 1D real transforms of even N: complex transform of N/2 points on the packed
+    // z[k] = x[2k] + i x[2k+1]; odd N uses a full complex transform of N points
+    PREFIX(plan) half_plan;     // size N/2 (even N) or N (odd N)
+    COMPLEX *real_twiddles;     // exp(-2*pi*i*k/N), k <= N/4
+
+    // Batched 1D (howmany > 0): signal b, element k at in[b*idist + k*istride], out[b*odist + k*ostride],
+    // for each of n_blocks blocks starting iblock_dist (input) and oblock_dist (output) elements apart
+    int howmany;
+    int istride, idist, ostride, odist;
+    int n_blocks;
+    long iblock_dist, oblock_dist;
+    PREFIX(plan) signal_plan;   // transform of one signal (c2c, r2c or c2r depending on kind)
+
+    // Multidimensional (rank >= 2): row-major shape[0] x ... x shape[rank-1]
+    int *shape;
+    PREFIX(plan) *axis_plans;   // batched transforms along each axis
+
+    PREFIX(plan) next_cached;   // plan-less interface cache (double only)
+};
+
+// 1D complex transform of plan p; work holds at least p->work_size entries
+void PREFIX(execute_1d)(const struct PREFIX(plan_s) *p, const COMPLEX *in, COMPLEX *out, int is_inverse,
+                        COMPLEX *work);
+
+// Scratch of one execution of p: the plan's own work when no other execution holds it, a new
+// buffer of the same size otherwise. Every acquire is paired with one release.
+COMPLEX *PREFIX(acquire_work)(const struct PREFIX(plan_s) *p);
+void PREFIX(release_work)(const struct PREFIX(plan_s) *p, COMPLEX *work);
+
+// Butterfly passes of a radix-2 plan on bit-reversed split data, with p->simd kernels: one pass
+// of radix 2, 4 or 8 without twiddles, then radix-4 passes
+void PREFIX(split_stages)(const struct PREFIX(plan_s) *p, REAL *re, REAL *im, int is_inverse);
+
+// Butterfly passes of a radix-2 plan on FFT_PANEL_WIDTH signals in batch layout: element k of
+// signal j at re[k*FFT_PANEL_WIDTH + j], rows in bit-reversed order; radix-4 passes, after one
+// radix-2 pass when log2(N) is odd
+void PREFIX(batch_stages)(const struct PREFIX(plan_s) *p, REAL *re, REAL *im, int is_inverse);
@@ -0,0 +1,84 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "fft_poisson.h"
+#include "fft_internal.h"
+
+struct fft_poisson_s {
+    int n0, n1;
+    long half;                 // n0 x (n1/2+1)
+    fft_plan r2c, c2r;
+    double *k2;                // |k|^2 of every half-spectrum entry
+    double *poisson;           // -1/|k|^2 (0 for k = 0), divided by n0*n1
+    double *diffusion;         // exp(-D |k|^2 dt), divided by n0*n1
+    Complex *spectrum;         // half spectrum, overwritten by the c2r
+};
+
+fft_poisson fft_poisson_create(int n0, int n1, double l0, double l1, unsigned flags) {
+    if(n0 < 1 || n1 < 1 || !(l0 > 0) || !(l1 > 0)) return NULL;
+
+    struct fft_poisson_s *s = (struct fft_poisson_s*)checked_malloc(sizeof(struct fft_poisson_s));
+    int h1 = n1/2 + 1;
+    s->n0 = n0;
+    s->n1 = n1;
+    s->half = (long)n0 * h1;
+    s->r2c = fft_plan_create_r2c_2d(n0, n1, flags);
+    s->c2r = fft_plan_create_c2r_2d(n0, n1, flags);
+    s->k2 = (double*)checked_malloc(s->half * sizeof(double));
+    s->poisson = (double*)checked_malloc(s->half * sizeof(double));
+    s->diffusion = (double*)checked_malloc(s->half * sizeof(double));
+    s->spectrum = (Complex*)checked_malloc(s->half * sizeof(Complex));
+
+    // Row i holds the wavenumber i (i <= n0/2) or i - n0 along axis 0; column j the wavenumber j
+    const double pi = acos(-1.0);
+    double scale = 1.0 / ((double)n0 * n1);
+    for(int i = 0; i < n0; i++) {
+        double k0 = 2.0 * pi / l0 * (i <= n0/2 ? i : i - n0);
+        for(int j = 0; j < h1; j++) {
+            double k1 = 2.0 * pi / l1 * j;
+            long idx = (long)i * h1 + j;
+            s->k2[idx] = k0 * k0 + k1 * k1;
+            s->poisson[idx] = idx == 0 ? 0.0 : -scale / s->k2[idx];
+        }
+    }
+    fft_poisson_set_diffusion(s, 0.0, 0.0);
+    return s;
+}
+
+void fft_poisson_set_diffusion(fft_poisson solver, double diffusivity, double dt) {
+    double scale = 1.0 / ((double)solver->n0 * solver->n1);
+    for(long idx = 0; idx < solver->half; idx++) {
+        solver->diffusion[idx] = scale * exp(-diffusivity * solver->k2[idx] * dt);
+    }
+}
+
+// r2c, product of every entry by a real multiplier, c2r
+static void apply_multiplier(const struct fft_poisson_s *s, const double *multiplier, const double *in, double *out) {
+    fft_execute_r2c(s->r2c, in, s->spectrum);
+    Complex *spectrum = s->spectrum;
+    for(long idx = 0; idx < s->half; idx++) {
+        spectrum[idx].real *= multiplier[idx];
+        spectrum[idx].imag *= multiplier[idx];
+    }
+    fft_execute_c2r(s->c2r, s->spectrum, out);
+}
+
+void fft_poisson_solve(const fft_poisson solver, const double *rho, double *phi) {
+    apply_multiplier(solver, solver->poisson, rho, phi);
+}
+
+void fft_poisson_step(const fft_poisson solver, double *u) {
+    apply_multiplier(solver, solver->diffusion, u, u);
+}
+
+void fft_poisson_destroy(fft_poisson solver) {
+    if(!solver) return;
+    fft_plan_destroy(solver->r2c);
+    fft_plan_destroy(solver->c2r);
+    free(solver->k2);
+    free(solver->poisson);
+    free(solver->diffusion);
+    free(solver->spectrum);
+    free(solver);
+}
@@ -0,0 +1,27 @@
+#ifndef FFT_POISSON_H
+#define FFT_POISSON_H
+
+// Spectral solvers on a periodic n0 x n1 grid (row-major) of physical size l0 x l1: the point
+// (i, j) is at (i l0/n0, j l1/n1). Solving Poisson's equation lap(phi) = rho and a time step of the
+// diffusion equation du/dt = D lap(u) are each a real transform, a product of the n0 x (n1/2+1)
+// half spectrum by a precomputed real multiplier, and the inverse transform. The plans, the
+// multipliers and the spectrum buffer are allocated by fft_poisson_create, so solving and
+// stepping never allocate.
+
+#include "fft_engine.h"
+
+typedef struct fft_poisson_s *fft_poisson;
+
+// Returns NULL for invalid sizes (n0 or n1 < 1, l0 or l1 <= 0)
+fft_poisson fft_poisson_create(int n0, int n1, double l0, double l1, unsigned flags);
+// lap(phi) = rho with the spectral Laplacian. A periodic solution needs a zero mean of rho, so the
+// mean is dropped; phi has zero mean. rho and phi may be the same array.
+void fft_poisson_solve(const fft_poisson solver, const double *rho, double *phi);
+// Sets the step of fft_poisson_step: the spectrum is multiplied by exp(-D |k|^2 dt), which is the
+// exact solution over dt for every mode, so any dt is stable
+void fft_poisson_set_diffusion(fft_poisson solver, double diffusivity, double dt);
+// One diffusion step of u, in place
+void fft_poisson_step(const fft_poisson solver, double *u);
+void fft_poisson_destroy(fft_poisson solver);
+
+#endif
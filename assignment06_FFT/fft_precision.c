@@ -0,0 +1,49 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include "fft_internal.h"
+#include "fft_transpose.h"
+#include "fft_precision.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define FFT_HAVE_X86 1
+#endif
+
+static int is_power_of_two(int N) {
+    return N > 0 && (N & (N - 1)) == 0;
+}
+
+// float: twiddles computed in double and rounded once, radix-4 passes on 4 to 16 floats
+#define REAL float
+#define COMPLEX ComplexF
+#define PREFIX(name) fftf_##name
+#define TRIG double
+#define VECTORIZE 1
+#define TRANSPOSE transpose_complexf
+#include "fft_plan_template.h"
+#include "fft_engine_template.h"
+#undef REAL
+#undef COMPLEX
+#undef PREFIX
+#undef TRIG
+#undef VECTORIZE
+#undef TRANSPOSE
+
+// long double: twiddles from cosl / sinl; x87 long double has no vector registers, so the
+// radix-4 passes are scalar
+#define REAL long double
+#define COMPLEX ComplexL
+#define PREFIX(name) fftl_##name
+#define TRIG long double
+#define VECTORIZE 0
+#define TRANSPOSE transpose_complexl
+#include "fft_plan_template.h"
+#include "fft_engine_template.h"
+#undef REAL
+#undef COMPLEX
+#undef PREFIX
+#undef TRIG
+#undef VECTORIZE
+#undef TRANSPOSE
@@ -0,0 +1,67 @@
+#ifndef FFT_PRECISION_H
+#define FFT_PRECISION_H
+
+// Single and long double precision FFTs (modelled on FFTW's fftwf_ / fftwl_ families). They are
+// the engine of fft_engine.h, whose code (fft_engine_template.h) is compiled once per scalar type:
+//   fft_*   double       Complex (fft_engine.h)
+//   fftf_*  float        ComplexF
+//   fftl_*  long double  ComplexL
+// Every function below behaves as the fft_ function of the same name: same planner (codelets,
+// radix-4, mixed radix, Bluestein), same flags, batched / N-dimensional / real plans, threads of
+// fft_plan_with_nthreads. The codelets are generated for each type, and the radix-4 passes run
+// on vectors of 16 to 64 bytes (up to 16 floats per AVX-512 register); long double is scalar.
+
+#include "fft_engine.h"
+
+typedef struct {
+    float real;
+    float imag;
+} ComplexF;
+
+typedef struct {
+    long double real;
+    long double imag;
+} ComplexL;
+
+typedef struct fftf_plan_s *fftf_plan;
+typedef struct fftl_plan_s *fftl_plan;
+
+fftf_plan fftf_plan_create(int N, int direction, unsigned flags);
+fftf_plan fftf_plan_create_2d(int n0, int n1, int direction, unsigned flags);
+fftf_plan fftf_plan_create_3d(int n0, int n1, int n2, int direction, unsigned flags);
+fftf_plan fftf_plan_create_nd(int rank, const int *n, int direction, unsigned flags);
+fftf_plan fftf_plan_create_many(int N, int howmany, int istride, int idist, int ostride, int odist,
+                                int direction, unsigned flags);
+fftf_plan fftf_plan_create_r2c(int N, unsigned flags);
+fftf_plan fftf_plan_create_c2r(int N, unsigned flags);
+fftf_plan fftf_plan_create_r2c_2d(int n0, int n1, unsigned flags);
+fftf_plan fftf_plan_create_c2r_2d(int n0, int n1, unsigned flags);
+fftf_plan fftf_plan_create_r2c_3d(int n0, int n1, int n2, unsigned flags);
+fftf_plan fftf_plan_create_c2r_3d(int n0, int n1, int n2, unsigned flags);
+fftf_plan fftf_plan_create_r2c_nd(int rank, const int *n, unsigned flags);
+fftf_plan fftf_plan_create_c2r_nd(int rank, const int *n, unsigned flags);
+void fftf_execute(const fftf_plan plan, const ComplexF *in, ComplexF *out);
+void fftf_execute_r2c(const fftf_plan plan, const float *in, ComplexF *out);
+void fftf_execute_c2r(const fftf_plan plan, ComplexF *in, float *out);
+void fftf_plan_destroy(fftf_plan plan);
+
+fftl_plan fftl_plan_create(int N, int direction, unsigned flags);
+fftl_plan fftl_plan_create_2d(int n0, int n1, int direction, unsigned flags);
+fftl_plan fftl_plan_create_3d(int n0, int n1, int n2, int direction, unsigned flags);
+fftl_plan fftl_plan_create_nd(int rank, const int *n, int direction, unsigned flags);
+fftl_plan fftl_plan_create_many(int N, int howmany, int istride, int idist, int ostride, int odist,
+                                int direction, unsigned flags);
+fftl_plan fftl_plan_create_r2c(int N, unsigned flags);
+fftl_plan fftl_plan_create_c2r(int N, unsigned flags);
+fftl_plan fftl_plan_create_r2c_2d(int n0, int n1, unsigned flags);
+fftl_plan fftl_plan_create_c2r_2d(int n0, int n1, unsigned flags);
+fftl_plan fftl_plan_create_r2c_3d(int n0, int n1, int n2, unsigned flags);
+fftl_plan fftl_plan_create_c2r_3d(int n0, int n1, int n2, unsigned flags);
+fftl_plan fftl_plan_create_r2c_nd(int rank, const int *n, unsigned flags);
+fftl_plan fftl_plan_create_c2r_nd(int rank, const int *n, unsigned flags);
+void fftl_execute(const fftl_plan plan, const ComplexL *in, ComplexL *out);
+void fftl_execute_r2c(const fftl_plan plan, const long double *in, ComplexL *out);
+void fftl_execute_c2r(const fftl_plan plan, ComplexL *in, long double *out);
+void fftl_plan_destroy(fftl_plan plan);
+
+#endif
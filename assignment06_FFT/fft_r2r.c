@@ -0,0 +1,333 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "fft_r2r.h"
+#include "fft_transpose.h"
+#include "fft_internal.h"
+
+// Columns of a 2D transform moved at once into a contiguous panel
+#define R2R_PANEL_WIDTH 16
+
+// Transform actually computed; the sine transforms of types II to IV reuse the cosine ones
+enum base { BASE_DCT1, BASE_DCT2, BASE_DCT3, BASE_DCT4, BASE_DST1 };
+
+struct fft_r2r_s {
+    int rank;
+    int n;                      // rank 1: length
+    enum fft_r2r_kind kind;
+    enum base base;
+    // DST-II = reversed DCT-II of (-1)^j X[j]; DST-III and DST-IV = (-1)^k times the DCT of the reversed X
+    int alternate_in, reverse_in, alternate_out, reverse_out;
+    fft_plan fft;               // r2c of 2(n-1) (DCT-I), 2(n+1) (DST-I) or n (DCT-II) points, c2r of n (DCT-III),
+                                // c2c of n/2 (DCT-IV, n even) or 2n (DCT-IV, n odd)
+    Complex *pre, *post;        // twiddles applied before and after the FFT
+    double *input;              // copy of the input when it is reversed or sign-alternated
+    double *buffer;             // real FFT input or output
+    Complex *spectrum;
+
+    // rank 2: n0 x n1, rows transformed by row_plan, columns by column_plan in panels
+    int n0, n1;
+    fft_r2r row_plan, column_plan;
+    double *panel;              // R2R_PANEL_WIDTH x n0
+};
+
+static Complex *twiddle_table(int count, double scale) {
+    Complex *t = (Complex*)checked_malloc(count * sizeof(Complex));
+    for(int k = 0; k < count; k++) {
+        t[k].real = cos(scale * k);
+        t[k].imag = -sin(scale * k);
+    }
+    return t;
+}
+
+static Complex complex_mul(Complex a, Complex b) {
+    Complex c = {a.real * b.real - a.imag * b.imag, a.real * b.imag + a.imag * b.real};
+    return c;
+}
+
+enum fft_r2r_kind fft_r2r_inverse_kind(enum fft_r2r_kind kind) {
+    switch(kind) {
+        case FFT_REDFT10: return FFT_REDFT01;
+        case FFT_REDFT01: return FFT_REDFT10;
+        case FFT_RODFT10: return FFT_RODFT01;
+        case FFT_RODFT01: return FFT_RODFT10;
+        default: return kind;
+    }
+}
+
+const char *fft_r2r_kind_name(enum fft_r2r_kind kind) {
+    static const char *names[] = {"DCT-I", "DCT-II", "DCT-III", "DCT-IV", "DST-I", "DST-II", "DST-III", "DST-IV"};
+    return kind >= 0 && kind < FFT_R2R_KINDS ? names[kind] : "?";
+}
+
+const char *fft_r2r_fftw_name(enum fft_r2r_kind kind) {
+    static const char *names[] = {"REDFT00", "REDFT10", "REDFT01", "REDFT11", "RODFT00", "RODFT10", "RODFT01", "RODFT11"};
+    return kind >= 0 && kind < FFT_R2R_KINDS ? names[kind] : "?";
+}
+
+static double logical_size(int n, enum fft_r2r_kind kind) {
+    if(kind == FFT_REDFT00) return 2.0 * (n - 1);
+    if(kind == FFT_RODFT00) return 2.0 * (n + 1);
+    return 2.0 * n;
+}
+
+fft_r2r fft_r2r_create(int n, enum fft_r2r_kind kind, unsigned flags) {
+    if(n < 1 || kind < 0 || kind >= FFT_R2R_KINDS || (kind == FFT_REDFT00 && n < 2)) return NULL;
+
+    struct fft_r2r_s *p = (struct fft_r2r_s*)checked_malloc(sizeof(struct fft_r2r_s));
+    memset(p, 0, sizeof(struct fft_r2r_s));
+    p->rank = 1;
+    p->n = n;
+    p->kind = kind;
+    switch(kind) {
+        case FFT_REDFT00: p->base = BASE_DCT1; break;
+        case FFT_REDFT10: p->base = BASE_DCT2; break;
+        case FFT_REDFT01: p->base = BASE_DCT3; break;
+        case FFT_REDFT11: p->base = BASE_DCT4; break;
+        case FFT_RODFT00: p->base = BASE_DST1; break;
+        case FFT_RODFT10: p->base = BASE_DCT2; p->alternate_in = p->reverse_out = 1; break;
+        case FFT_RODFT01: p->base = BASE_DCT3; p->reverse_in = p->alternate_out = 1; break;
+        case FFT_RODFT11: p->base = BASE_DCT4; p->reverse_in = p->alternate_out = 1; break;
+    }
+    if(p->alternate_in || p->reverse_in) {
+        p->input = (double*)checked_malloc(n * sizeof(double));
+    }
+
+    const double pi = acos(-1.0);
+    switch(p->base) {
+        case BASE_DCT1:
+        case BASE_DST1: {
+            int m = p->base == BASE_DCT1 ? n - 1 : n + 1;
+            p->fft = fft_plan_create_r2c(2*m, flags);
+            p->buffer = (double*)checked_malloc(2 * m * sizeof(double));
+            p->spectrum = (Complex*)checked_malloc((m + 1) * sizeof(Complex));
+            break;
+        }
+        case BASE_DCT2:
+        case BASE_DCT3:
+            p->fft = p->base == BASE_DCT2 ? fft_plan_create_r2c(n, flags) : fft_plan_create_c2r(n, flags);
+            p->post = twiddle_table(n/2 + 1, pi / (2.0 * n)); // exp(-i pi k/2n)
+            p->buffer = (double*)checked_malloc(n * sizeof(double));
+            p->spectrum = (Complex*)checked_malloc((n/2 + 1) * sizeof(Complex));
+            break;
+        case BASE_DCT4:
+            if(n % 2 == 0) {
+                int h = n / 2;
+                p->fft = fft_plan_create(h, FFT_FORWARD, flags);
+                p->pre = twiddle_table(h, pi / n); // exp(-i pi j/n)
+                p->post = (Complex*)checked_malloc(h * sizeof(Complex));
+                for(int k = 0; k < h; k++) {
+                    double angle = pi * (4*k + 1) / (4.0 * n);
+                    p->post[k].real = cos(angle);
+                    p->post[k].imag = -sin(angle);
+                }
+                p->spectrum = (Complex*)checked_malloc(h * sizeof(Complex));
+            } else {
+                p->fft = fft_plan_create(2*n, FFT_FORWARD, flags);
+                p->pre = twiddle_table(n, pi / (2.0 * n)); // exp(-i pi j/2n)
+                p->post = (Complex*)checked_malloc(n * sizeof(Complex));
+                for(int k = 0; k < n; k++) {
+                    double angle = pi * (2*k + 1) / (4.0 * n);
+                    p->post[k].real = cos(angle);
+                    p->post[k].imag = -sin(angle);
+                }
+                p->spectrum = (Complex*)checked_malloc(2 * n * sizeof(Complex));
+            }
+            break;
+    }
+    return p;
+}
+
+fft_r2r fft_r2r_create_2d(int n0, int n1, enum fft_r2r_kind kind0, enum fft_r2r_kind kind1, unsigned flags) {
+    fft_r2r rows = fft_r2r_create(n1, kind1, flags);
+    fft_r2r columns = fft_r2r_create(n0, kind0, flags);
+    if(!rows || !columns) {
+        fft_r2r_destroy(rows);
+        fft_r2r_destroy(columns);
+        return NULL;
+    }
+
+    struct fft_r2r_s *p = (struct fft_r2r_s*)checked_malloc(sizeof(struct fft_r2r_s));
+    memset(p, 0, sizeof(struct fft_r2r_s));
+    p->rank = 2;
+    p->n0 = n0;
+    p->n1 = n1;
+    p->row_plan = rows;
+    p->column_plan = columns;
+    p->panel = (double*)checked_malloc((size_t)R2R_PANEL_WIDTH * n0 * sizeof(double));
+    return p;
+}
+
+void fft_r2r_destroy(fft_r2r plan) {
+    if(!plan) return;
+    fft_r2r_destroy(plan->row_plan);
+    fft_r2r_destroy(plan->column_plan);
+    fft_plan_destroy(plan->fft);
+    free(plan->pre);
+    free(plan->post);
+    free(plan->input);
+    free(plan->buffer);
+    free(plan->spectrum);
+    free(plan->panel);
+    free(plan);
+}
+
+double fft_r2r_normalization(const fft_r2r plan) {
+    if(plan->rank == 2) {
+        return fft_r2r_normalization(plan->row_plan) * fft_r2r_normalization(plan->column_plan);
+    }
+    return logical_size(plan->n, plan->kind);
+}
+
+// DCT-I with m = n-1: the real FFT of the 2m points of the even extension x[0] ... x[m], x[m-1] ... x[1],
+// whose spectrum is real and equal to Y[0] ... Y[m]
+static void dct1(const struct fft_r2r_s *p, const double *x, double *y) {
+    int m = p->n - 1;
+    double *e = p->buffer;
+    for(int j = 0; j <= m; j++) e[j] = x[j];
+    for(int j = 1; j < m; j++) e[2*m - j] = x[j];
+    fft_execute_r2c(p->fft, e, p->spectrum);
+
+    for(int k = 0; k <= m; k++) y[k] = p->spectrum[k].real;
+}
+
+// DST-I with m = n+1: the real FFT of the 2m points of the odd extension 0, x[0] ... x[n-1], 0,
+// -x[n-1] ... -x[0], whose spectrum is imaginary with Im E[k] = -Y[k-1]
+static void dst1(const struct fft_r2r_s *p, const double *x, double *y) {
+    int n = p->n, m = n + 1;
+    double *e = p->buffer;
+    e[0] = e[m] = 0.0;
+    for(int j = 1; j < m; j++) {
+        e[j] = x[j - 1];
+        e[2*m - j] = -x[j - 1];
+    }
+    fft_execute_r2c(p->fft, e, p->spectrum);
+
+    for(int k = 0; k < n; k++) y[k] = -p->spectrum[k + 1].imag;
+}
+
+// DCT-II through a real FFT of n points (Makhoul): v holds the even points in order, then the odd
+// ones backwards; with a = exp(-i pi k/2n) V[k], Y[k] = 2 Re a and Y[n-k] = -2 Im a
+static void dct2(const struct fft_r2r_s *p, const double *x, double *y) {
+    int n = p->n;
+    double *v = p->buffer;
+    for(int j = 0; 2*j < n; j++) v[j] = x[2*j];
+    for(int j = 0; 2*j + 1 < n; j++) v[n - 1 - j] = x[2*j + 1];
+    fft_execute_r2c(p->fft, v, p->spectrum);
+
+    y[0] = 2.0 * p->spectrum[0].real;
+    for(int k = 1; 2*k <= n; k++) {
+        Complex a = complex_mul(p->post[k], p->spectrum[k]);
+        y[k] = 2.0 * a.real;
+        y[n - k] = -2.0 * a.imag;
+    }
+}
+
+// DCT-III, the inverse steps of dct2: V[k] = exp(i pi k/2n) (x[k] - i x[n-k]) for k <= n/2 (x[n] = 0),
+// an unnormalized c2r of n points, then the points are put back in place
+static void dct3(const struct fft_r2r_s *p, const double *x, double *y) {
+    int n = p->n;
+    Complex *V = p->spectrum;
+    for(int k = 0; 2*k <= n; k++) {
+        Complex w = {p->post[k].real, -p->post[k].imag};
+        Complex c = {x[k], k > 0 ? -x[n - k] : 0.0};
+        V[k] = complex_mul(w, c);
+    }
+    fft_execute_c2r(p->fft, V, p->buffer);
+
+    const double *v = p->buffer;
+    for(int j = 0; 2*j < n; j++) y[2*j] = v[j];
+    for(int j = 0; 2*j + 1 < n; j++) y[2*j + 1] = v[n - 1 - j];
+}
+
+// DCT-IV. Even n: z[j] = (x[2j] + i x[n-1-2j]) exp(-i pi j/n), a complex FFT of n/2 points and
+// W[k] = Z[k] exp(-i pi (4k+1)/4n) give Y[2k] = 2 Re W[k] and Y[n-1-2k] = -2 Im W[k].
+// Odd n: Y[k] = 2 Re(exp(-i pi (2k+1)/4n) B[k]), B the FFT of 2n points of x[j] exp(-i pi j/2n)
+// padded with zeros.
+static void dct4(const struct fft_r2r_s *p, const double *x, double *y) {
+    int n = p->n;
+    Complex *z = p->spectrum;
+    if(n % 2 == 0) {
+        int h = n / 2;
+        for(int j = 0; j < h; j++) {
+            Complex c = {x[2*j], x[n - 1 - 2*j]};
+            z[j] = complex_mul(c, p->pre[j]);
+        }
+        fft_execute(p->fft, z, z);
+        for(int k = 0; k < h; k++) {
+            Complex w = complex_mul(z[k], p->post[k]);
+            y[2*k] = 2.0 * w.real;
+            y[n - 1 - 2*k] = -2.0 * w.imag;
+        }
+        return;
+    }
+
+    for(int j = 0; j < n; j++) {
+        z[j].real = x[j] * p->pre[j].real;
+        z[j].imag = x[j] * p->pre[j].imag;
+    }
+    for(int j = n; j < 2*n; j++) {
+        z[j].real = z[j].imag = 0.0;
+    }
+    fft_execute(p->fft, z, z);
+    for(int k = 0; k < n; k++) {
+        y[k] = 2.0 * (p->post[k].real * z[k].real - p->post[k].imag * z[k].imag);
+    }
+}
+
+static void execute_1d(const struct fft_r2r_s *p, const double *in, double *out) {
+    int n = p->n;
+    if(p->input) {
+        for(int j = 0; j < n; j++) {
+            double v = p->reverse_in ? in[n - 1 - j] : in[j];
+            p->input[j] = p->alternate_in && j % 2 ? -v : v;
+        }
+        in = p->input;
+    }
+
+    // Every base transform reads all of in before writing out, so in == out is allowed
+    switch(p->base) {
+        case BASE_DCT1: dct1(p, in, out); break;
+        case BASE_DCT2: dct2(p, in, out); break;
+        case BASE_DCT3: dct3(p, in, out); break;
+        case BASE_DCT4: dct4(p, in, out); break;
+        case BASE_DST1: dst1(p, in, out); break;
+    }
+
+    if(p->reverse_out) {
+        for(int j = 0; j < n / 2; j++) {
+            double t = out[j];
+            out[j] = out[n - 1 - j];
+            out[n - 1 - j] = t;
+        }
+    }
+    if(p->alternate_out) {
+        for(int k = 1; k < n; k += 2) out[k] = -out[k];
+    }
+}
+
+// Rows in place, then the columns R2R_PANEL_WIDTH at a time through a transposed panel
+static void execute_2d(const struct fft_r2r_s *p, const double *in, double *out) {
+    int n0 = p->n0, n1 = p->n1;
+    for(int i = 0; i < n0; i++) {
+        execute_1d(p->row_plan, in + (long)i * n1, out + (long)i * n1);
+    }
+    for(int c0 = 0; c0 < n1; c0 += R2R_PANEL_WIDTH) {
+        int width = c0 + R2R_PANEL_WIDTH < n1 ? R2R_PANEL_WIDTH : n1 - c0;
+        transpose_real(out + c0, n1, p->panel, n0, n0, width);
+        for(int c = 0; c < width; c++) {
+            execute_1d(p->column_plan, p->panel + (long)c * n0, p->panel + (long)c * n0);
+        }
+        transpose_real(p->panel, n0, out + c0, n1, width, n0);
+    }
+}
+
+void fft_r2r_execute(const fft_r2r plan, const double *in, double *out) {
+    if(plan->rank == 2) {
+        execute_2d(plan, in, out);
+    } else {
+        execute_1d(plan, in, out);
+    }
+}
@@ -0,0 +1,45 @@
+#ifndef FFT_R2R_H
+#define FFT_R2R_H
+
+// Real-to-real transforms: the discrete cosine and sine transforms of types I to IV, in 1D and on
+// row-major 2D arrays (one kind per axis), on top of the plans of fft_engine.h. The kinds have
+// FFTW's names and definitions, scaling included, so results can be compared with fftw_plan_r2r_*
+// directly. They are unnormalized: a transform followed by its inverse kind multiplies the data by
+// fft_r2r_normalization (FFTW's logical size N, 2(n-1) for DCT-I, 2(n+1) for DST-I and 2n for the
+// others; the product over the axes in 2D). Every transform costs one real FFT of about n points
+// (2n for DCT-I and DST-I) plus O(n) twiddles, instead of the complex FFT of the 2n points of the
+// mirrored sequence.
+
+#include "fft_engine.h"
+
+enum fft_r2r_kind {
+    FFT_REDFT00, // DCT-I:   Y[k] = X[0] + (-1)^k X[n-1] + 2 sum_{j=1}^{n-2} X[j] cos(pi j k / (n-1)), n >= 2
+    FFT_REDFT10, // DCT-II:  Y[k] = 2 sum_{j=0}^{n-1} X[j] cos(pi (j+1/2) k / n)
+    FFT_REDFT01, // DCT-III: Y[k] = X[0] + 2 sum_{j=1}^{n-1} X[j] cos(pi j (k+1/2) / n)
+    FFT_REDFT11, // DCT-IV:  Y[k] = 2 sum_{j=0}^{n-1} X[j] cos(pi (j+1/2) (k+1/2) / n)
+    FFT_RODFT00, // DST-I:   Y[k] = 2 sum_{j=0}^{n-1} X[j] sin(pi (j+1) (k+1) / (n+1))
+    FFT_RODFT10, // DST-II:  Y[k] = 2 sum_{j=0}^{n-1} X[j] sin(pi (j+1/2) (k+1) / n)
+    FFT_RODFT01, // DST-III: Y[k] = (-1)^k X[n-1] + 2 sum_{j=0}^{n-2} X[j] sin(pi (j+1) (k+1/2) / n)
+    FFT_RODFT11  // DST-IV:  Y[k] = 2 sum_{j=0}^{n-1} X[j] sin(pi (j+1/2) (k+1/2) / n)
+};
+
+#define FFT_R2R_KINDS 8
+
+typedef struct fft_r2r_s *fft_r2r;
+
+// Plans for n values (n0 x n1 row-major, kind0 along the columns, kind1 along the rows); flags are
+// those of fft_plan_create. Return NULL for invalid sizes (n < 1, or n < 2 for DCT-I).
+fft_r2r fft_r2r_create(int n, enum fft_r2r_kind kind, unsigned flags);
+fft_r2r fft_r2r_create_2d(int n0, int n1, enum fft_r2r_kind kind0, enum fft_r2r_kind kind1, unsigned flags);
+// in and out hold n (n0 x n1) values and may be the same array
+void fft_r2r_execute(const fft_r2r plan, const double *in, double *out);
+double fft_r2r_normalization(const fft_r2r plan);
+void fft_r2r_destroy(fft_r2r plan);
+
+// DCT-II <-> DCT-III and DST-II <-> DST-III; the other kinds are their own inverse
+enum fft_r2r_kind fft_r2r_inverse_kind(enum fft_r2r_kind kind);
+// "DCT-I" ... "DST-IV", and FFTW's "REDFT00" ... "RODFT11"
+const char *fft_r2r_kind_name(enum fft_r2r_kind kind);
+const char *fft_r2r_fftw_name(enum fft_r2r_kind kind);
+
+#endif
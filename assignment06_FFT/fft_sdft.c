@@ -0,0 +1,180 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "fft_sdft.h"
+#include "fft_simd.h"
+#include "fft_internal.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define FFT_HAVE_X86 1
+#endif
+
+typedef double sdft_vec __attribute__((vector_size(32)));
+#define SDFT_LANES 4
+
+struct fft_sdft_s {
+    int N, count, resync;
+    int *bins;                 // count bin indices
+    double *re, *im;           // the bins, split so that the update vectorizes
+    double *twiddle_re, *twiddle_im; // exp(2 pi i k/N) of every bin
+    double *window;            // ring buffer of the last N samples
+    int oldest;                // ring index of the oldest sample
+    int since_resync;          // updates since the bins were last computed by the FFT
+    int use_avx2;
+    fft_plan r2c;
+    double *linear;            // the window in order, input of the r2c
+    Complex *spectrum;         // N/2+1 values
+};
+
+fft_sdft fft_sdft_create(int N, const int *bins, int count, int resync, unsigned flags) {
+    if(N < 1 || resync < 0) return NULL;
+    if(!bins) count = N/2 + 1;
+    if(count < 1) return NULL;
+    for(int b = 0; bins && b < count; b++) {
+        if(bins[b] < 0 || bins[b] >= N) return NULL;
+    }
+
+    struct fft_sdft_s *s = (struct fft_sdft_s*)checked_malloc(sizeof(struct fft_sdft_s));
+    s->N = N;
+    s->count = count;
+    s->resync = resync;
+    s->bins = (int*)checked_malloc(count * sizeof(int));
+    s->re = (double*)checked_malloc(count * sizeof(double));
+    s->im = (double*)checked_malloc(count * sizeof(double));
+    s->twiddle_re = (double*)checked_malloc(count * sizeof(double));
+    s->twiddle_im = (double*)checked_malloc(count * sizeof(double));
+    s->window = (double*)checked_malloc(N * sizeof(double));
+    s->linear = (double*)checked_malloc(N * sizeof(double));
+    s->spectrum = (Complex*)checked_malloc((N/2 + 1) * sizeof(Complex));
+    s->r2c = fft_plan_create_r2c(N, flags);
+#ifdef FFT_HAVE_X86
+    s->use_avx2 = !(flags & FFT_NO_SIMD) && fft_simd_level_detect() >= FFT_SIMD_AVX2;
+#else
+    s->use_avx2 = 0;
+#endif
+
+    const double pi = acos(-1.0);
+    for(int b = 0; b < count; b++) {
+        int k = bins ? bins[b] : b;
+        s->bins[b] = k;
+        s->twiddle_re[b] = cos(2.0 * pi * k / N);
+        s->twiddle_im[b] = sin(2.0 * pi * k / N);
+        s->re[b] = s->im[b] = 0.0;
+    }
+    memset(s->window, 0, N * sizeof(double));
+    s->oldest = 0;
+    s->since_resync = 0;
+    return s;
+}
+
+void fft_sdft_resync(fft_sdft sdft) {
+    int N = sdft->N, tail = N - sdft->oldest;
+    memcpy(sdft->linear, sdft->window + sdft->oldest, tail * sizeof(double));
+    memcpy(sdft->linear + tail, sdft->window, sdft->oldest * sizeof(double));
+    fft_execute_r2c(sdft->r2c, sdft->linear, sdft->spectrum);
+
+    // Bins above N/2 are the conjugates of the stored half
+    for(int b = 0; b < sdft->count; b++) {
+        int k = sdft->bins[b];
+        if(2*k <= N) {
+            sdft->re[b] = sdft->spectrum[k].real;
+            sdft->im[b] = sdft->spectrum[k].imag;
+        } else {
+            sdft->re[b] = sdft->spectrum[N - k].real;
+            sdft->im[b] = -sdft->spectrum[N - k].imag;
+        }
+    }
+    sdft->since_resync = 0;
+}
+
+// X[k] <- w[k] (X[k] + delta) for every bin, SDFT_LANES bins at a time
+static inline __attribute__((always_inline))
+void rotate_body(double *re, double *im, const double *wr, const double *wi, int count, double delta) {
+    int b = 0;
+    for(; b + SDFT_LANES <= count; b += SDFT_LANES) {
+        sdft_vec xr, xi, tr, ti;
+        memcpy(&xr, re + b, sizeof(xr));
+        memcpy(&xi, im + b, sizeof(xi));
+        memcpy(&tr, wr + b, sizeof(tr));
+        memcpy(&ti, wi + b, sizeof(ti));
+        xr += delta;
+        sdft_vec yr = xr * tr - xi * ti;
+        sdft_vec yi = xr * ti + xi * tr;
+        memcpy(re + b, &yr, sizeof(yr));
+        memcpy(im + b, &yi, sizeof(yi));
+    }
+    for(; b < count; b++) {
+        double a = re[b] + delta, c = im[b];
+        re[b] = a * wr[b] - c * wi[b];
+        im[b] = a * wi[b] + c * wr[b];
+    }
+}
+
+static void rotate_default(double *re, double *im, const double *wr, const double *wi, int count, double delta) {
+    rotate_body(re, im, wr, wi, count, delta);
+}
+
+#ifdef FFT_HAVE_X86
+__attribute__((target("avx2,fma")))
+static void rotate_avx2(double *re, double *im, const double *wr, const double *wi, int count, double delta) {
+    rotate_body(re, im, wr, wi, count, delta);
+}
+#endif
+
+static void update(struct fft_sdft_s *s, double sample) {
+    double delta = sample - s->window[s->oldest];
+    s->window[s->oldest] = sample;
+    if(++s->oldest == s->N) s->oldest = 0;
+
+#ifdef FFT_HAVE_X86
+    if(s->use_avx2) {
+        rotate_avx2(s->re, s->im, s->twiddle_re, s->twiddle_im, s->count, delta);
+    } else
+#endif
+    rotate_default(s->re, s->im, s->twiddle_re, s->twiddle_im, s->count, delta);
+
+    if(s->resync > 0 && ++s->since_resync >= s->resync) {
+        fft_sdft_resync(s);
+    }
+}
+
+void fft_sdft_push(fft_sdft sdft, const double *samples, int count) {
+    int N = sdft->N;
+    // Only the last N samples matter: one FFT instead of count updates of every bin
+    if(count >= N && (double)count * sdft->count > N * (log2(N) + 1.0)) {
+        memcpy(sdft->window, samples + (count - N), N * sizeof(double));
+        sdft->oldest = 0;
+        fft_sdft_resync(sdft);
+        return;
+    }
+    for(int i = 0; i < count; i++) {
+        update(sdft, samples[i]);
+    }
+}
+
+void fft_sdft_spectrum(const fft_sdft sdft, Complex *out) {
+    for(int b = 0; b < sdft->count; b++) {
+        out[b].real = sdft->re[b];
+        out[b].imag = sdft->im[b];
+    }
+}
+
+int fft_sdft_count(const fft_sdft sdft) {
+    return sdft->count;
+}
+
+void fft_sdft_destroy(fft_sdft sdft) {
+    if(!sdft) return;
+    fft_plan_destroy(sdft->r2c);
+    free(sdft->bins);
+    free(sdft->re);
+    free(sdft->im);
+    free(sdft->twiddle_re);
+    free(sdft->twiddle_im);
+    free(sdft->window);
+    free(sdft->linear);
+    free(sdft->spectrum);
+    free(sdft);
+}
@@ -0,0 +1,28 @@
+#ifndef FFT_SDFT_H
+#define FFT_SDFT_H
+
+// Sliding DFT of a real stream: the DFT of the last N samples, updated after every new sample in
+// O(K) for K bins with the recurrence X[k] <- exp(2 pi i k/N) (X[k] + x_new - x_old), instead of an
+// O(N log N) FFT per sample. The recurrence adds the rounding error of every update, so every
+// `resync` samples the bins are recomputed from the window with one real FFT. The window starts
+// as N zeros, and every buffer is allocated by fft_sdft_create, so pushing samples never allocates.
+
+#include "fft_engine.h"
+
+typedef struct fft_sdft_s *fft_sdft;
+
+// Tracks the count bins listed in bins (indices 0 ... N-1; bins = NULL tracks 0 ... N/2, count is
+// ignored). resync = 0 never resynchronizes; resync = N costs one FFT per window, O(log N) per
+// sample. flags are the planner flags of fft_engine.h. Returns NULL for invalid sizes or bins.
+fft_sdft fft_sdft_create(int N, const int *bins, int count, int resync, unsigned flags);
+// Slides the window over count samples. Long pieces whose updates would cost more than one FFT go
+// straight to the FFT of their last N samples.
+void fft_sdft_push(fft_sdft sdft, const double *samples, int count);
+// Recomputes the bins from the window now
+void fft_sdft_resync(fft_sdft sdft);
+// The bins in the order given to fft_sdft_create, fft_sdft_count(sdft) values
+void fft_sdft_spectrum(const fft_sdft sdft, Complex *out);
+int fft_sdft_count(const fft_sdft sdft);
+void fft_sdft_destroy(fft_sdft sdft);
+
+#endif
@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fft_internal.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define FFT_HAVE_X86 1
+#endif
+
+static fft_simd_level max_level = FFT_SIMD_AVX512;
+
+fft_simd_level fft_simd_level_detect(void) {
+    fft_simd_level level = FFT_SIMD_NONE;
+#ifdef FFT_HAVE_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f")) {
+        level = FFT_SIMD_AVX512;
+    } else if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        level = FFT_SIMD_AVX2;
+    }
+#endif
+    return level < max_level ? level : max_level;
+}
+
+void fft_simd_set_max_level(fft_simd_level level) {
+    max_level = level;
+}
+
+const char *fft_simd_level_name(fft_simd_level level) {
+    switch(level) {
+        case FFT_SIMD_AVX2: return "AVX2";
+        case FFT_SIMD_AVX512: return "AVX-512";
+        default: return "scalar";
+    }
+}
+
+void interleaved_to_split(const double *in, double *re, double *im, int n) {
+    for(int i = 0; i < n; i++) {
+        re[i] = in[2*i];
+        im[i] = in[2*i + 1];
+    }
+}
+
+void split_to_interleaved(const double *re, const double *im, double *out, int n) {
+    for(int i = 0; i < n; i++) {
+        out[2*i] = re[i];
+        out[2*i + 1] = im[i];
+    }
+}
+
+void fft_execute_split(const fft_plan plan, double *re, double *im) {
+    if(plan->kind != FFT_KIND_DFT || plan->rank != 1 || plan->howmany > 0) {
+        printf("fft_execute_split: plan is not a 1D complex-to-complex plan\n");
+        return;
+    }
+
+    int N = plan->N;
+    int is_inverse = plan->direction == FFT_BACKWARD;
+    if(N == 1) return;
+
+    // The codelets take split data as it is; the inverse swaps real and imaginary parts
+    if(plan->algorithm == FFT_CODELET) {
+        if(is_inverse) {
+            plan->codelet(im, re, im, re, 1, 1);
+        } else {
+            plan->codelet(re, im, re, im, 1, 1);
+        }
+        return;
+    }
+
+    if(plan->algorithm == FFT_RADIX2) {
+        for(int i = 0; i < N; i++) {
+            int j = plan->bitrev[i];
+            if(i < j) {
+                double tmp = re[i]; re[i] = re[j]; re[j] = tmp;
+                tmp = im[i]; im[i] = im[j]; im[j] = tmp;
+            }
+        }
+        fft_split_stages(plan, re, im, is_inverse);
+        return;
+    }
+
+    Complex *data = (Complex*)calloc(N, sizeof(Complex));
+    if (!data) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    split_to_interleaved(re, im, (double*)data, N);
+    Complex *work = fft_acquire_work(plan);
+    fft_execute_1d(plan, data, data, is_inverse, work);
+    fft_release_work(plan, work);
+    interleaved_to_split((double*)data, re, im, N);
+    free(data);
+}
@@ -0,0 +1,28 @@
+#ifndef FFT_SIMD_H
+#define FFT_SIMD_H
+
+#include "fft_engine.h"
+
+// Vector instruction sets used by the radix-2 butterflies, chosen at run time from the CPU features
+typedef enum {
+    FFT_SIMD_NONE,   // scalar code
+    FFT_SIMD_AVX2,   // 4 doubles or 8 floats per register, with FMA
+    FFT_SIMD_AVX512  // 8 doubles or 16 floats per register
+} fft_simd_level;
+
+// Best level supported by the CPU, capped by fft_simd_set_max_level (used by plans created afterwards)
+fft_simd_level fft_simd_level_detect(void);
+void fft_simd_set_max_level(fft_simd_level level);
+const char *fft_simd_level_name(fft_simd_level level);
+
+// Split (structure of arrays) complex storage: real parts in re[], imaginary parts in im[].
+// The interleaved side is (re, im) pairs, the memory layout of both Complex and fftw_complex,
+// so a Complex* or fftw_complex* can be passed as (double*).
+void interleaved_to_split(const double *in, double *re, double *im, int n);
+void split_to_interleaved(const double *re, const double *im, double *out, int n);
+
+// In-place 1D transform of split data with a plan from fft_plan_create. Radix-2 plans run
+// directly on the split arrays; other sizes go through a temporary interleaved copy.
+void fft_execute_split(const fft_plan plan, double *re, double *im);
+
+#endif
@@ -0,0 +1,134 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "fft_stft.h"
+#include "fft_internal.h"
+
+struct fft_stft_s {
+    int frame_size, hop;
+    double *window;
+    double *buffer;     // samples of the current frame, filled from the start
+    int filled;
+    int fresh;          // samples pushed since the last frame
+    long skip;          // samples still to drop when hop > frame_size
+    long frame;         // index of the next frame
+    double *windowed;
+    Complex *spectrum;  // frame_size/2+1 values
+    fft_plan plan;
+};
+
+// Periodic windows (denominator N rather than N - 1), so that Hann frames with hop N/2 sum to
+// a constant
+static void fill_window(double *w, int N, int window) {
+    const double pi = acos(-1.0);
+    for(int i = 0; i < N; i++) {
+        double x = 2.0 * pi * i / N;
+        switch(window) {
+            case FFT_WINDOW_HANN:
+                w[i] = 0.5 - 0.5 * cos(x);
+                break;
+            case FFT_WINDOW_HAMMING:
+                w[i] = 0.54 - 0.46 * cos(x);
+                break;
+            case FFT_WINDOW_BLACKMAN:
+                w[i] = 0.42 - 0.5 * cos(x) + 0.08 * cos(2.0 * x);
+                break;
+            default:
+                w[i] = 1.0;
+                break;
+        }
+    }
+}
+
+fft_stft fft_stft_create(int frame_size, int hop, int window, unsigned flags) {
+    if(frame_size < 1 || hop < 1 || window < FFT_WINDOW_RECTANGULAR || window > FFT_WINDOW_BLACKMAN) return NULL;
+
+    struct fft_stft_s *s = (struct fft_stft_s*)checked_malloc(sizeof(struct fft_stft_s));
+    memset(s, 0, sizeof(struct fft_stft_s));
+    s->frame_size = frame_size;
+    s->hop = hop;
+    s->window = (double*)checked_malloc(frame_size * sizeof(double));
+    s->buffer = (double*)checked_malloc(frame_size * sizeof(double));
+    s->windowed = (double*)checked_malloc(frame_size * sizeof(double));
+    s->spectrum = (Complex*)checked_malloc((frame_size/2 + 1) * sizeof(Complex));
+    s->plan = fft_plan_create_r2c(frame_size, flags);
+    fill_window(s->window, frame_size, window);
+    return s;
+}
+
+const double *fft_stft_window(const fft_stft stft) {
+    return stft->window;
+}
+
+// Transforms the full buffer, then keeps its last frame_size - hop samples for the next frame
+static void emit_frame(struct fft_stft_s *s, fft_stft_callback callback, void *user_data) {
+    int N = s->frame_size;
+    for(int i = 0; i < N; i++) {
+        s->windowed[i] = s->buffer[i] * s->window[i];
+    }
+    fft_execute_r2c(s->plan, s->windowed, s->spectrum);
+    callback(s->spectrum, s->frame, user_data);
+    s->frame++;
+    s->fresh = 0;
+
+    if(s->hop < N) {
+        memmove(s->buffer, s->buffer + s->hop, (N - s->hop) * sizeof(double));
+        s->filled = N - s->hop;
+    } else {
+        s->filled = 0;
+        s->skip = s->hop - N;
+    }
+}
+
+int fft_stft_push(fft_stft stft, const double *samples, int count, fft_stft_callback callback, void *user_data) {
+    struct fft_stft_s *s = stft;
+    int frames = 0;
+    while(count > 0) {
+        if(s->skip > 0) {
+            int drop = s->skip < count ? (int)s->skip : count;
+            s->skip -= drop;
+            samples += drop;
+            count -= drop;
+            continue;
+        }
+        int take = s->frame_size - s->filled < count ? s->frame_size - s->filled : count;
+        memcpy(s->buffer + s->filled, samples, take * sizeof(double));
+        s->filled += take;
+        s->fresh += take;
+        samples += take;
+        count -= take;
+        if(s->filled == s->frame_size) {
+            emit_frame(s, callback, user_data);
+            frames++;
+        }
+    }
+    return frames;
+}
+
+int fft_stft_flush(fft_stft stft, fft_stft_callback callback, void *user_data) {
+    struct fft_stft_s *s = stft;
+    int frames = 0;
+    if(s->fresh > 0) {
+        memset(s->buffer + s->filled, 0, (s->frame_size - s->filled) * sizeof(double));
+        s->filled = s->frame_size;
+        emit_frame(s, callback, user_data);
+        frames = 1;
+    }
+    s->filled = 0;
+    s->fresh = 0;
+    s->skip = 0;
+    s->frame = 0;
+    return frames;
+}
+
+void fft_stft_destroy(fft_stft stft) {
+    if(!stft) return;
+    fft_plan_destroy(stft->plan);
+    free(stft->window);
+    free(stft->buffer);
+    free(stft->windowed);
+    free(stft->spectrum);
+    free(stft);
+}
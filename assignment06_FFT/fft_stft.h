@@ -0,0 +1,35 @@
+#ifndef FFT_STFT_H
+#define FFT_STFT_H
+
+// Streaming short-time Fourier transform: samples are pushed in pieces of any size, and each time
+// frame_size of them are available, they are windowed and transformed with one real plan of
+// fft_engine.h, and the frame_size/2+1 spectrum is handed to a callback. The next frame starts
+// hop samples later (hop > frame_size skips samples). Only the current frame is kept, and every
+// buffer is allocated by fft_stft_create, so pushing samples never allocates.
+
+#include "fft_engine.h"
+
+// Windows
+#define FFT_WINDOW_RECTANGULAR 0
+#define FFT_WINDOW_HANN 1
+#define FFT_WINDOW_HAMMING 2
+#define FFT_WINDOW_BLACKMAN 3
+
+typedef struct fft_stft_s *fft_stft;
+
+// Called once per frame; the spectrum is only valid during the call. frame is the frame index,
+// the frame starts at sample frame * hop.
+typedef void (*fft_stft_callback)(const Complex *spectrum, long frame, void *user_data);
+
+// flags are the planner flags of fft_engine.h. Returns NULL for invalid sizes or window.
+fft_stft fft_stft_create(int frame_size, int hop, int window, unsigned flags);
+// Returns the number of frames emitted by this call
+int fft_stft_push(fft_stft stft, const double *samples, int count, fft_stft_callback callback, void *user_data);
+// Emits a last, zero-padded frame if samples were pushed since the last frame, and makes the
+// STFT ready for a new signal. Returns the number of frames emitted (0 or 1).
+int fft_stft_flush(fft_stft stft, fft_stft_callback callback, void *user_data);
+// The window, frame_size values (e.g. to normalize the spectrum by their sum)
+const double *fft_stft_window(const fft_stft stft);
+void fft_stft_destroy(fft_stft stft);
+
+#endif
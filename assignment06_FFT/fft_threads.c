@@ -0,0 +1,133 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "fft_internal.h"
+
+// Thread count given to the plans created from now on
+static int planner_nthreads = 1;
+
+// Persistent pool of worker threads. The thread calling fft_parallel_run takes part as
+// thread 0, the workers are threads 1..n_workers. Workers sleep on start_cond between jobs.
+static struct {
+    int n_workers;
+    pthread_t *threads;
+    pthread_mutex_t lock;
+    pthread_cond_t start_cond;
+    pthread_cond_t done_cond;
+    unsigned generation;        // incremented for every job
+    int pending;                // workers that have not finished the current job
+    int shutdown;
+    fft_parallel_job job;
+    void *job_arg;
+    int job_nthreads;
+} pool = {0, NULL, PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER,
+          0, 0, 0, NULL, NULL, 0};
+
+// Only one parallel execution at a time can use the pool
+static pthread_mutex_t run_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void *worker_main(void *arg) {
+    int thread_id = (int)(long)arg;
+    unsigned seen = 0;
+
+    pthread_mutex_lock(&pool.lock);
+    for(;;) {
+        while(pool.generation == seen && !pool.shutdown) {
+            pthread_cond_wait(&pool.start_cond, &pool.lock);
+        }
+        if(pool.shutdown) break;
+        seen = pool.generation;
+        fft_parallel_job job = pool.job;
+        void *job_arg = pool.job_arg;
+        int nthreads = pool.job_nthreads;
+        pthread_mutex_unlock(&pool.lock);
+
+        if(thread_id < nthreads) {
+            job(job_arg, thread_id, nthreads);
+        }
+
+        pthread_mutex_lock(&pool.lock);
+        if(--pool.pending == 0) {
+            pthread_cond_signal(&pool.done_cond);
+        }
+    }
+    pthread_mutex_unlock(&pool.lock);
+    return NULL;
+}
+
+static void stop_workers(void) {
+    pthread_mutex_lock(&pool.lock);
+    pool.shutdown = 1;
+    pthread_cond_broadcast(&pool.start_cond);
+    pthread_mutex_unlock(&pool.lock);
+
+    for(int t = 0; t < pool.n_workers; t++) {
+        pthread_join(pool.threads[t], NULL);
+    }
+    free(pool.threads);
+    pool.threads = NULL;
+    pool.n_workers = 0;
+    pool.shutdown = 0;
+    pool.generation = 0;
+}
+
+static void start_workers(int n_workers) {
+    pool.threads = (pthread_t*)malloc(n_workers * sizeof(pthread_t));
+    if (!pool.threads) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    for(int t = 0; t < n_workers; t++) {
+        if(pthread_create(&pool.threads[t], NULL, worker_main, (void*)(long)(t + 1)) != 0) {
+            printf("Thread creation failed!\n");
+            exit(1);
+        }
+    }
+    pool.n_workers = n_workers;
+}
+
+void fft_parallel_run(fft_parallel_job job, void *arg, int nthreads) {
+    if(nthreads <= 1) {
+        job(arg, 0, 1);
+        return;
+    }
+
+    pthread_mutex_lock(&run_lock);
+    if(pool.n_workers < nthreads - 1) {
+        if(pool.n_workers > 0) stop_workers();
+        start_workers(nthreads - 1);
+    }
+
+    pthread_mutex_lock(&pool.lock);
+    pool.job = job;
+    pool.job_arg = arg;
+    pool.job_nthreads = nthreads;
+    pool.pending = pool.n_workers;
+    pool.generation++;
+    pthread_cond_broadcast(&pool.start_cond);
+    pthread_mutex_unlock(&pool.lock);
+
+    job(arg, 0, nthreads);
+
+    pthread_mutex_lock(&pool.lock);
+    while(pool.pending > 0) {
+        pthread_cond_wait(&pool.done_cond, &pool.lock);
+    }
+    pthread_mutex_unlock(&pool.lock);
+    pthread_mutex_unlock(&run_lock);
+}
+
+void fft_plan_with_nthreads(int nthreads) {
+    planner_nthreads = nthreads > 1 ? nthreads : 1;
+}
+
+int fft_planner_nthreads(void) {
+    return planner_nthreads;
+}
+
+void fft_cleanup_threads(void) {
+    pthread_mutex_lock(&run_lock);
+    if(pool.n_workers > 0) stop_workers();
+    pthread_mutex_unlock(&run_lock);
+}
@@ -0,0 +1,15 @@
+#include "fft_transpose.h"
+
+void transpose_real(const double *in, int ld_in, double *out, int ld_out, int rows, int cols) {
+    for(int i0 = 0; i0 < rows; i0 += TRANSPOSE_BLOCK) {
+        int i_end = i0 + TRANSPOSE_BLOCK < rows ? i0 + TRANSPOSE_BLOCK : rows;
+        for(int j0 = 0; j0 < cols; j0 += TRANSPOSE_BLOCK) {
+            int j_end = j0 + TRANSPOSE_BLOCK < cols ? j0 + TRANSPOSE_BLOCK : cols;
+            for(int i = i0; i < i_end; i++) {
+                for(int j = j0; j < j_end; j++) {
+                    out[(long)j*ld_out + i] = in[(long)i*ld_in + j];
+                }
+            }
+        }
+    }
+}
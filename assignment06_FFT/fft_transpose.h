@@ -0,0 +1,20 @@
+#ifndef FFT_TRANSPOSE_H
+#define FFT_TRANSPOSE_H
+
+#include "fft_engine.h"
+#include "fft_precision.h"
+
+// Side of the square tiles moved by the blocked transposes: two 32x32 tiles of Complex
+// (16 KB each) fit together in L1
+#define TRANSPOSE_BLOCK 32
+
+// out = transpose of in, where in is rows x cols with leading dimension ld_in and out
+// is cols x rows with leading dimension ld_out. The leading dimensions let the same routine
+// work on a panel of a larger matrix, e.g. a few columns of an N x (N/2+1) half spectrum.
+// The complex transposes are compiled with the engine of their precision (fft_engine_template.h).
+void transpose_complex(const Complex *in, int ld_in, Complex *out, int ld_out, int rows, int cols);
+void transpose_real(const double *in, int ld_in, double *out, int ld_out, int rows, int cols);
+void transpose_complexf(const ComplexF *in, int ld_in, ComplexF *out, int ld_out, int rows, int cols);
+void transpose_complexl(const ComplexL *in, int ld_in, ComplexL *out, int ld_out, int rows, int cols);
+
+#endif
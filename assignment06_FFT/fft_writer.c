@@ -0,0 +1,364 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include <sys/stat.h>
+#ifdef HAVE_HDF5
+#include <hdf5.h>
+#endif
+
+#include "fft_writer.h"
+#include "fft_internal.h"
+
+// Text
+
+// Bytes formatted before each fwrite
+#define TEXT_BUFFER (1 << 16)
+// Longest value: "-d.dddddde-ddd + i-d.dddddde-ddd "
+#define TEXT_MAX_VALUE 40
+
+struct text_state {
+    FILE *fp;
+    long cols;
+    int type;
+    size_t used;
+    char buffer[TEXT_BUFFER];
+};
+
+// 10^k for k = 0 ... POW10_MAX in long double, exact up to 10^27
+#define POW10_MAX 340
+static long double pow10_table[POW10_MAX + 1];
+static int pow10_ready = 0;
+
+// x * 10^k
+static long double scale10(double x, int k) {
+    return k >= 0 ? x * pow10_table[k] : x / pow10_table[-k];
+}
+
+// x as printf("%e") prints it, returns the number of characters. The 7 digits are x * 10^(6-e)
+// rounded to nearest, ties to even, in long double: a decimal tie needs |6-e| <= 22, where the
+// power of ten is exact and so is the product, and otherwise the result can only differ from
+// printf for values within about 1e-12 of a tie.
+static int format_e(char *s, double x) {
+    if(!isfinite(x)) return sprintf(s, "%e", x);
+    if(!pow10_ready) {
+        for(int k = 0; k <= POW10_MAX; k++) {
+            pow10_table[k] = powl(10.0L, k);
+        }
+        pow10_ready = 1;
+    }
+    char *p = s;
+    if(signbit(x)) {
+        *p++ = '-';
+        x = -x;
+    }
+    int e = 0;
+    long digits = 0;
+    if(x > 0.0) {
+        // Decimal exponent from the binary one (x in [2^(b-1), 2^b)), one off at most
+        int b;
+        frexp(x, &b);
+        e = (int)floor((b - 1) * 0.30102999566398120);
+        long double r = scale10(x, 6 - e);
+        if(r >= 1e7L) {
+            e++;
+            r = scale10(x, 6 - e);
+        }
+        digits = (long)r;
+        long double fraction = r - digits;
+        if(fraction > 0.5L || (fraction == 0.5L && digits % 2 == 1)) digits++;
+        if(digits == 10000000) {
+            digits = 1000000;
+            e++;
+        }
+    }
+    char mantissa[7];
+    for(int i = 6; i >= 0; i--) {
+        mantissa[i] = (char)('0' + digits % 10);
+        digits /= 10;
+    }
+    *p++ = mantissa[0];
+    *p++ = '.';
+    memcpy(p, mantissa + 1, 6);
+    p += 6;
+    *p++ = 'e';
+    *p++ = e < 0 ? '-' : '+';
+    if(e < 0) e = -e;
+    if(e >= 100) *p++ = (char)('0' + e / 100);
+    *p++ = (char)('0' + e / 10 % 10);
+    *p++ = (char)('0' + e % 10);
+    return (int)(p - s);
+}
+
+static int text_flush(struct text_state *t) {
+    if(t->used > 0 && fwrite(t->buffer, 1, t->used, t->fp) != t->used) return -1;
+    t->used = 0;
+    return 0;
+}
+
+static void *text_open(const char *path, long rows, long cols, int type) {
+    (void)rows;
+    FILE *fp = fopen(path, "w");
+    if (!fp) return NULL;
+    struct text_state *t = (struct text_state*)checked_malloc(sizeof(struct text_state));
+    t->fp = fp;
+    t->cols = cols;
+    t->type = type;
+    t->used = 0;
+    return t;
+}
+
+static int text_write_row(void *state, const double *row) {
+    struct text_state *t = (struct text_state*)state;
+    for(long j = 0; j < t->cols; j++) {
+        if(t->used > TEXT_BUFFER - TEXT_MAX_VALUE && text_flush(t) != 0) return -1;
+        char *p = t->buffer + t->used;
+        if(t->type == FFT_WRITER_COMPLEX) {
+            p += format_e(p, row[2*j]);
+            memcpy(p, " + i", 4);
+            p += 4;
+            p += format_e(p, row[2*j + 1]);
+        } else {
+            p += format_e(p, row[j]);
+        }
+        *p++ = ' ';
+        t->used = p - t->buffer;
+    }
+    if(t->used > TEXT_BUFFER - 1 && text_flush(t) != 0) return -1;
+    t->buffer[t->used++] = '\n';
+    return 0;
+}
+
+static int text_close(void *state) {
+    struct text_state *t = (struct text_state*)state;
+    int status = text_flush(t);
+    if(fclose(t->fp) != 0) status = -1;
+    free(t);
+    return status;
+}
+
+const fft_writer fft_writer_text = {"text", ".txt", text_open, text_write_row, text_close};
+
+// Binary
+
+struct binary_state {
+    FILE *fp;
+    size_t row_doubles;
+    int swap;           // big-endian host: bytes are reversed into scratch before writing
+    uint64_t *scratch;
+};
+
+static void put_le(unsigned char *out, uint64_t value, int bytes) {
+    for(int i = 0; i < bytes; i++) {
+        out[i] = (unsigned char)(value >> (8 * i));
+    }
+}
+
+static int host_is_big_endian(void) {
+    uint16_t one = 1;
+    unsigned char first;
+    memcpy(&first, &one, 1);
+    return first == 0;
+}
+
+static void *binary_open(const char *path, long rows, long cols, int type) {
+    FILE *fp = fopen(path, "wb");
+    if (!fp) return NULL;
+    unsigned char header[32];
+    memcpy(header, "FFTM", 4);
+    put_le(header + 4, 1, 4);
+    put_le(header + 8, (uint64_t)type, 4);
+    put_le(header + 12, 2, 4);
+    put_le(header + 16, (uint64_t)rows, 8);
+    put_le(header + 24, (uint64_t)cols, 8);
+    if(fwrite(header, 1, sizeof(header), fp) != sizeof(header)) {
+        fclose(fp);
+        return NULL;
+    }
+    struct binary_state *b = (struct binary_state*)checked_malloc(sizeof(struct binary_state));
+    b->fp = fp;
+    b->row_doubles = (size_t)cols * (type == FFT_WRITER_COMPLEX ? 2 : 1);
+    b->swap = host_is_big_endian();
+    b->scratch = b->swap ? (uint64_t*)checked_malloc(b->row_doubles * sizeof(uint64_t)) : NULL;
+    return b;
+}
+
+static int binary_write_row(void *state, const double *row) {
+    struct binary_state *b = (struct binary_state*)state;
+    const void *out = row;
+    if(b->swap) {
+        memcpy(b->scratch, row, b->row_doubles * sizeof(double));
+        for(size_t j = 0; j < b->row_doubles; j++) {
+            unsigned char bytes[8];
+            put_le(bytes, b->scratch[j], 8);
+            memcpy(&b->scratch[j], bytes, 8);
+        }
+        out = b->scratch;
+    }
+    return fwrite(out, sizeof(double), b->row_doubles, b->fp) == b->row_doubles ? 0 : -1;
+}
+
+static int binary_close(void *state) {
+    struct binary_state *b = (struct binary_state*)state;
+    int status = fclose(b->fp) == 0 ? 0 : -1;
+    free(b->scratch);
+    free(b);
+    return status;
+}
+
+const fft_writer fft_writer_binary = {"binary", ".bin", binary_open, binary_write_row, binary_close};
+
+// HDF5
+
+#ifdef HAVE_HDF5
+// Rows are collected into blocks of about this many bytes, each written as one hyperslab
+#define HDF5_BLOCK_BYTES (1 << 20)
+
+struct hdf5_state {
+    hid_t file, dataset, filespace, type;
+    long cols;
+    size_t row_doubles;
+    long block_rows;    // rows per block
+    long buffered;      // rows in buffer
+    long written;       // rows already in the file
+    double *buffer;
+};
+
+static void *hdf5_open(const char *path, long rows, long cols, int type) {
+    hid_t file = H5Fcreate(path, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    if (file < 0) return NULL;
+    hid_t element = H5T_NATIVE_DOUBLE;
+    if(type == FFT_WRITER_COMPLEX) {
+        element = H5Tcreate(H5T_COMPOUND, 2 * sizeof(double));
+        H5Tinsert(element, "r", 0, H5T_NATIVE_DOUBLE);
+        H5Tinsert(element, "i", sizeof(double), H5T_NATIVE_DOUBLE);
+    }
+    hsize_t dims[2] = {(hsize_t)rows, (hsize_t)cols};
+    hid_t filespace = H5Screate_simple(2, dims, NULL);
+    hid_t dataset = H5Dcreate2(file, "data", element, filespace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    if (dataset < 0) {
+        if(type == FFT_WRITER_COMPLEX) H5Tclose(element);
+        H5Sclose(filespace);
+        H5Fclose(file);
+        return NULL;
+    }
+    struct hdf5_state *h = (struct hdf5_state*)checked_malloc(sizeof(struct hdf5_state));
+    h->file = file;
+    h->dataset = dataset;
+    h->filespace = filespace;
+    h->type = element;
+    h->cols = cols;
+    h->row_doubles = (size_t)cols * (type == FFT_WRITER_COMPLEX ? 2 : 1);
+    h->block_rows = HDF5_BLOCK_BYTES / (h->row_doubles * sizeof(double) + 1);
+    if(h->block_rows > rows) h->block_rows = rows;
+    if(h->block_rows < 1) h->block_rows = 1;
+    h->buffered = 0;
+    h->written = 0;
+    h->buffer = (double*)checked_malloc(h->block_rows * h->row_doubles * sizeof(double));
+    return h;
+}
+
+static int hdf5_flush(struct hdf5_state *h) {
+    if(h->buffered == 0) return 0;
+    hsize_t start[2] = {(hsize_t)h->written, 0};
+    hsize_t count[2] = {(hsize_t)h->buffered, (hsize_t)h->cols};
+    hid_t memspace = H5Screate_simple(2, count, NULL);
+    H5Sselect_hyperslab(h->filespace, H5S_SELECT_SET, start, NULL, count, NULL);
+    herr_t status = H5Dwrite(h->dataset, h->type, memspace, h->filespace, H5P_DEFAULT, h->buffer);
+    H5Sclose(memspace);
+    h->written += h->buffered;
+    h->buffered = 0;
+    return status < 0 ? -1 : 0;
+}
+
+static int hdf5_write_row(void *state, const double *row) {
+    struct hdf5_state *h = (struct hdf5_state*)state;
+    memcpy(h->buffer + h->buffered * h->row_doubles, row, h->row_doubles * sizeof(double));
+    if(++h->buffered == h->block_rows) return hdf5_flush(h);
+    return 0;
+}
+
+static int hdf5_close(void *state) {
+    struct hdf5_state *h = (struct hdf5_state*)state;
+    int status = hdf5_flush(h);
+    if(h->type != H5T_NATIVE_DOUBLE) H5Tclose(h->type);
+    H5Dclose(h->dataset);
+    H5Sclose(h->filespace);
+    if(H5Fclose(h->file) < 0) status = -1;
+    free(h->buffer);
+    free(h);
+    return status;
+}
+
+const fft_writer fft_writer_hdf5 = {"hdf5", ".h5", hdf5_open, hdf5_write_row, hdf5_close};
+#endif
+
+const fft_writer *const fft_writers[] = {
+    &fft_writer_text,
+    &fft_writer_binary,
+#ifdef HAVE_HDF5
+    &fft_writer_hdf5,
+#endif
+    NULL
+};
+
+const fft_writer *fft_writer_find(const char *name) {
+    for(int i = 0; fft_writers[i]; i++) {
+        if(strcmp(fft_writers[i]->name, name) == 0) return fft_writers[i];
+    }
+    return NULL;
+}
+
+// Common driver: row(i) gives the doubles of row i
+static int write_all(const fft_writer *w, const char *path, long rows, long cols, int type,
+                     const double *(*row)(const void *matrix, long i), const void *matrix,
+                     fft_write_stats *stats) {
+    double start = wall_time();
+    void *state = w->open(path, rows, cols, type);
+    if (!state) {
+        printf("Error opening file %s\n", path);
+        return -1;
+    }
+    int status = 0;
+    for(long i = 0; i < rows && status == 0; i++) {
+        status = w->write_row(state, row(matrix, i));
+    }
+    if(w->close(state) != 0) status = -1;
+    if(status != 0) {
+        printf("Error writing file %s\n", path);
+        return -1;
+    }
+    if(stats) {
+        struct stat st;
+        stats->seconds = wall_time() - start;
+        stats->bytes = stat(path, &st) == 0 ? (long)st.st_size : 0;
+    }
+    return 0;
+}
+
+static const double *pointer_row(const void *matrix, long i) {
+    return ((double *const *)matrix)[i];
+}
+
+struct contiguous {
+    const double *data;
+    size_t row_doubles;
+};
+
+static const double *contiguous_row(const void *matrix, long i) {
+    const struct contiguous *c = (const struct contiguous*)matrix;
+    return c->data + i * c->row_doubles;
+}
+
+int fft_write_rows(const fft_writer *w, const char *path, double *const *rows, long nrows, long cols,
+                   fft_write_stats *stats) {
+    return write_all(w, path, nrows, cols, FFT_WRITER_REAL, pointer_row, rows, stats);
+}
+
+int fft_write_matrix(const fft_writer *w, const char *path, const double *data, long rows, long cols, int type,
+                     fft_write_stats *stats) {
+    struct contiguous c = {data, (size_t)cols * (type == FFT_WRITER_COMPLEX ? 2 : 1)};
+    return write_all(w, path, rows, cols, type, contiguous_row, &c, stats);
+}
@@ -0,0 +1,52 @@
+#ifndef FFT_WRITER_H
+#define FFT_WRITER_H
+
+// Matrix output with interchangeable back ends. A writer is a table of three functions that
+// receive the matrix one row at a time, so row-pointer matrices (double **) and contiguous
+// arrays go through the same code:
+//   text    .txt  "%e " per value ("%e + i%e " for complex), one line per row, for debugging;
+//                 the numbers are formatted by hand, about 4 times faster than fprintf
+//   binary  .bin  32-byte header, then the values as little-endian doubles, row-major
+//   hdf5    .h5   dataset "data" of rows x cols doubles, or of compounds {r, i} (h5py's complex
+//                 layout) for complex values; only when compiled with -DHAVE_HDF5
+// Binary header, all fields little-endian: "FFTM", uint32 version (1), uint32 type (below),
+// uint32 rank (2), uint64 rows, uint64 cols.
+
+// Element types
+#define FFT_WRITER_REAL 1    // double
+#define FFT_WRITER_COMPLEX 2 // (real, imag) pairs of doubles, the layout of Complex and fftw_complex
+
+typedef struct {
+    const char *name;
+    const char *extension;
+    // Creates path for a rows x cols matrix; returns the state of the writer, or NULL on error
+    void *(*open)(const char *path, long rows, long cols, int type);
+    // Appends the next row (cols values, or 2 * cols doubles for complex); returns 0, or -1 on error
+    int (*write_row)(void *state, const double *row);
+    // Finishes the file and frees the state; returns 0, or -1 on error
+    int (*close)(void *state);
+} fft_writer;
+
+extern const fft_writer fft_writer_text;
+extern const fft_writer fft_writer_binary;
+#ifdef HAVE_HDF5
+extern const fft_writer fft_writer_hdf5;
+#endif
+
+// Writer called name ("text", "binary" or "hdf5"), NULL if unknown or not compiled in
+const fft_writer *fft_writer_find(const char *name);
+// The compiled-in writers, terminated by NULL
+extern const fft_writer *const fft_writers[];
+
+typedef struct {
+    long bytes;         // size of the file
+    double seconds;     // wall-clock time from open to close (writes go to the page cache)
+} fft_write_stats;
+
+// Write a matrix to path with writer w; stats may be NULL. Return 0, or -1 on error (with a message).
+int fft_write_rows(const fft_writer *w, const char *path, double *const *rows, long nrows, long cols,
+                   fft_write_stats *stats);
+int fft_write_matrix(const fft_writer *w, const char *path, const double *data, long rows, long cols, int type,
+                     fft_write_stats *stats);
+
+#endif
@@ -0,0 +1,108 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <sys/stat.h>
+
+#include "fftw_planner.h"
+#include "fft_internal.h"
+
+#define DUPPRINT(fp, fmt...) do {printf(fmt);fprintf(fp,fmt);} while(0)
+
+static const char *effort_names[] = {"estimate", "measure", "patient", "exhaustive"};
+static const unsigned effort_flags[] = {FFTW_ESTIMATE, FFTW_MEASURE, FFTW_PATIENT, FFTW_EXHAUSTIVE};
+
+int parse_effort(const char *name, unsigned *effort) {
+    for(int e = 0; e < 4; e++) {
+        if(strcmp(name, effort_names[e]) == 0) {
+            *effort = effort_flags[e];
+            return 0;
+        }
+    }
+    return -1;
+}
+
+const char *effort_name(unsigned effort) {
+    for(int e = 0; e < 4; e++) {
+        if(effort == effort_flags[e]) return effort_names[e];
+    }
+    return "unknown";
+}
+
+int planner_options_from_args(planner_options *options, const char *effort, const char *wisdom_dir,
+                              const char *threads) {
+    if(!effort) effort = getenv("FFTW_PLANNER_EFFORT");
+    if(!wisdom_dir) wisdom_dir = getenv("FFTW_WISDOM_DIR");
+    if(!threads) threads = getenv("FFTW_NUM_THREADS");
+
+    if(parse_effort(effort ? effort : "measure", &options->effort) != 0) {
+        printf("Unknown planner effort %s (use estimate, measure, patient or exhaustive)\n", effort);
+        return -1;
+    }
+    options->wisdom_dir = wisdom_dir ? wisdom_dir : "fftw_wisdom";
+    if(strcmp(options->wisdom_dir, "none") == 0) options->wisdom_dir = NULL;
+    options->threads = threads ? atoi(threads) : 1;
+    if(options->threads < 1) {
+        printf("Invalid thread count %s\n", threads);
+        return -1;
+    }
+    return 0;
+}
+
+static fftw_plan create_plan(enum plan_kind kind, int n0, int n1, void *in, void *out, unsigned flags) {
+    switch(kind) {
+        case PLAN_C2C_FORWARD:
+            return fftw_plan_dft_2d(n0, n1, (fftw_complex*)in, (fftw_complex*)out, FFTW_FORWARD, flags);
+        case PLAN_C2C_BACKWARD:
+            return fftw_plan_dft_2d(n0, n1, (fftw_complex*)in, (fftw_complex*)out, FFTW_BACKWARD, flags);
+        case PLAN_R2C:
+            return fftw_plan_dft_r2c_2d(n0, n1, (double*)in, (fftw_complex*)out, flags);
+        case PLAN_C2R:
+            return fftw_plan_dft_c2r_2d(n0, n1, (fftw_complex*)in, (double*)out, flags);
+    }
+    return NULL;
+}
+
+// Each key has its own file: the global wisdom is cleared and that file imported before planning,
+// and after a new plan the wisdom (which now holds this problem and its sub-problems) is written
+// back. A plan found in the file (FFTW_WISDOM_ONLY) costs no measurement; if the file was made
+// with a lower effort, FFTW plans again and the file is upgraded. FFTW_ESTIMATE plans are cheap
+// and not stored.
+fftw_plan plan_with_wisdom(enum plan_kind kind, int n0, int n1, void *in, void *out,
+                           const planner_options *options, FILE *file) {
+    static const char *kind_names[] = {"c2c_forward", "c2c_backward", "r2c", "c2r"};
+    int use_store = options->wisdom_dir != NULL && options->effort != FFTW_ESTIMATE;
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s_%dx%d_t%d.wisdom", options->wisdom_dir ? options->wisdom_dir : ".",
+             kind_names[kind], n0, n1, options->threads);
+
+    double start = wall_time();
+    fftw_plan_with_nthreads(options->threads);
+    fftw_plan plan = NULL;
+    if(use_store) {
+        fftw_forget_wisdom();
+        if(fftw_import_wisdom_from_filename(path)) {
+            plan = create_plan(kind, n0, n1, in, out, options->effort | FFTW_WISDOM_ONLY);
+        }
+    }
+    int from_wisdom = plan != NULL;
+    if(!plan) plan = create_plan(kind, n0, n1, in, out, options->effort);
+
+    const char *status = from_wisdom ? "from wisdom" : "planned";
+    if(plan && use_store && !from_wisdom) {
+        if(mkdir(options->wisdom_dir, 0755) != 0 && errno != EEXIST) {
+            status = "planned, wisdom directory not writable";
+        } else if(!fftw_export_wisdom_to_filename(path)) {
+            status = "planned, wisdom not saved";
+        } else {
+            status = "planned, wisdom saved";
+        }
+    }
+    double seconds = wall_time() - start;
+    if(file) {
+        DUPPRINT(file, "  %-12s %4dx%-4d %-10s threads %2d %9.4f s  %s\n", kind_names[kind], n0, n1,
+                 effort_name(options->effort), options->threads, seconds, status);
+    }
+    return plan;
+}
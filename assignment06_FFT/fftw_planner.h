@@ -0,0 +1,36 @@
+#ifndef FFTW_PLANNER_H
+#define FFTW_PLANNER_H
+
+// FFTW planning shared by FFT_fftw and FFT_fftw_scaling: planner effort, thread count and a
+// persistent wisdom store with one file per transform kind, size and thread count.
+
+#include <stdio.h>
+#include <fftw3.h>
+
+// effort is FFTW_ESTIMATE ... FFTW_EXHAUSTIVE; wisdom_dir is NULL when there is no store
+typedef struct {
+    unsigned effort;
+    const char *wisdom_dir;
+    int threads;
+} planner_options;
+
+// 2D transforms that can be planned through the wisdom store
+enum plan_kind { PLAN_C2C_FORWARD, PLAN_C2C_BACKWARD, PLAN_R2C, PLAN_C2R };
+
+// "estimate", "measure", "patient" or "exhaustive"; returns -1 for anything else
+int parse_effort(const char *name, unsigned *effort);
+const char *effort_name(unsigned effort);
+
+// Fills options from the arguments, falling back to the environment variables FFTW_PLANNER_EFFORT,
+// FFTW_WISDOM_DIR and FFTW_NUM_THREADS for the NULL ones (defaults: measure, fftw_wisdom, 1 thread;
+// the directory "none" disables the store). Prints the problem and returns -1 on a bad value.
+int planner_options_from_args(planner_options *options, const char *effort, const char *wisdom_dir,
+                              const char *threads);
+
+// Plans an n0 x n1 transform of the given kind with options->threads threads (fftw_init_threads
+// must have been called). Except with FFTW_ESTIMATE, the planner overwrites in and out.
+// If file is not NULL, one line with the planning time and the wisdom status is written to it.
+fftw_plan plan_with_wisdom(enum plan_kind kind, int n0, int n1, void *in, void *out,
+                           const planner_options *options, FILE *file);
+
+#endif
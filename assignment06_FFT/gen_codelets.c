@@ -0,0 +1,461 @@
+// Generator of the straight-line FFT codelets of fft_codelets.c / fft_codelets.h.
+// Usage: ./gen_codelets fft_codelets.c fft_codelets.h (run by the Makefile when this file changes)
+//
+// Each DFT is expanded at generation time into a graph of real additions, subtractions, negations
+// and multiplications by constants: split-radix for powers of two, the conjugate-pair formula for
+// the odd primes, Cooley-Tukey with constant twiddles for the other sizes. Building the graph
+// folds the trivial constants (0, 1, -1, i, (1 - i)/sqrt(2)), merges identical operations and
+// moves negations into additions, and only the operations that reach an output are printed.
+// The graph is printed once per scalar type (double, float, long double), with the constants
+// kept in long double and rounded once to the type.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <float.h>
+
+#define MAX_NODES 65536
+#define HASH_SIZE (1 << 17)
+
+// Sizes of the codelets
+static const int sizes[] = {2, 3, 4, 5, 6, 7, 8, 16, 32, 64};
+#define N_SIZES (int)(sizeof(sizes) / sizeof(sizes[0]))
+
+enum op { OP_ZERO, OP_IN_RE, OP_IN_IM, OP_ADD, OP_SUB, OP_NEG, OP_MUL };
+
+static long double round_double(long double c) { return (double)c; }
+static long double round_float(long double c) { return (float)c; }
+static long double round_long_double(long double c) { return c; }
+
+// Scalar type of a family of codelets: fft_codelet_N (double), fftf_codelet_N, fftl_codelet_N
+typedef struct {
+    const char *type;
+    const char *prefix;
+    long double (*round)(long double c); // constant rounded to the type
+    int digits;         // significant digits that print the rounded constant exactly
+    const char *suffix; // of the constants
+} family;
+
+static const family families[] = {
+    {"double", "fft", round_double, 17, ""},
+    {"float", "fftf", round_float, 9, "f"},
+    {"long double", "fftl", round_long_double, 21, "L"},
+};
+#define N_FAMILIES (int)(sizeof(families) / sizeof(families[0]))
+
+typedef struct {
+    enum op op;
+    int a, b;       // operands (OP_IN_*: a is the input index)
+    long double c;  // OP_MUL: constant
+    int used;
+    int name;       // number of the temporary, -1 if not printed yet
+} node;
+
+static node nodes[MAX_NODES];
+static int n_nodes;
+static int hash_table[HASH_SIZE];
+
+typedef struct {
+    int r, i;
+} cx;
+
+static void reset(void) {
+    n_nodes = 1;                    // node 0 is the constant 0
+    nodes[0].op = OP_ZERO;
+    for(int h = 0; h < HASH_SIZE; h++) hash_table[h] = -1;
+}
+
+// The constant is hashed through its double rounding: the padding bytes of a long double are undefined
+static unsigned hash_node(enum op op, int a, int b, long double c) {
+    double rounded = (double)c;
+    unsigned long long bits = 0;
+    for(size_t k = 0; k < sizeof(double); k++) bits = bits * 131 + ((unsigned char*)&rounded)[k];
+    return (unsigned)((op * 1000003ULL + a * 9176ULL + b * 31ULL + bits) % HASH_SIZE);
+}
+
+// Node with these fields, created if it does not exist yet
+static int lookup(enum op op, int a, int b, long double c) {
+    unsigned h = hash_node(op, a, b, c);
+    while(hash_table[h] >= 0) {
+        node *n = &nodes[hash_table[h]];
+        if(n->op == op && n->a == a && n->b == b && n->c == c) return hash_table[h];
+        h = (h + 1) % HASH_SIZE;
+    }
+    if(n_nodes == MAX_NODES) {
+        printf("gen_codelets: too many nodes\n");
+        exit(1);
+    }
+    node *n = &nodes[n_nodes];
+    n->op = op;
+    n->a = a;
+    n->b = b;
+    n->c = c;
+    n->used = 0;
+    n->name = -1;
+    hash_table[h] = n_nodes;
+    return n_nodes++;
+}
+
+static int make_sub(int a, int b);
+
+static int make_neg(int a) {
+    if(a == 0) return 0;
+    if(nodes[a].op == OP_NEG) return nodes[a].a;
+    if(nodes[a].op == OP_SUB) return make_sub(nodes[a].b, nodes[a].a);
+    return lookup(OP_NEG, a, 0, 0.0L);
+}
+
+static int make_add(int a, int b) {
+    if(a == 0) return b;
+    if(b == 0) return a;
+    if(nodes[b].op == OP_NEG) return make_sub(a, nodes[b].a);
+    if(nodes[a].op == OP_NEG) return make_sub(b, nodes[a].a);
+    if(a > b) {
+        int t = a; a = b; b = t;
+    }
+    return lookup(OP_ADD, a, b, 0.0L);
+}
+
+static int make_sub(int a, int b) {
+    if(b == 0) return a;
+    if(a == 0) return make_neg(b);
+    if(a == b) return 0;
+    if(nodes[b].op == OP_NEG) return make_add(a, nodes[b].a);
+    if(nodes[a].op == OP_NEG) return make_neg(make_add(nodes[a].a, b));
+    return lookup(OP_SUB, a, b, 0.0L);
+}
+
+// Constants are kept positive so that c*x and -c*x share the product
+static int make_mul(long double c, int a) {
+    if(c == 0.0L || a == 0) return 0;
+    if(c == 1.0L) return a;
+    if(c == -1.0L) return make_neg(a);
+    if(c < 0.0L) return make_neg(make_mul(-c, a));
+    if(nodes[a].op == OP_NEG) return make_neg(make_mul(c, nodes[a].a));
+    if(nodes[a].op == OP_MUL) return make_mul(c * nodes[a].c, nodes[a].a);
+    return lookup(OP_MUL, a, 0, c);
+}
+
+static cx cx_add(cx x, cx y) {
+    cx z = {make_add(x.r, y.r), make_add(x.i, y.i)};
+    return z;
+}
+
+static cx cx_sub(cx x, cx y) {
+    cx z = {make_sub(x.r, y.r), make_sub(x.i, y.i)};
+    return z;
+}
+
+// -i x
+static cx cx_mul_minus_i(cx x) {
+    cx z = {x.i, make_neg(x.r)};
+    return z;
+}
+
+// Value rounded to 0, +-1/2, +-1 or +-sqrt(1/2) when within a few long double roundings of them
+// (cosl / sinl of a rounded angle), so that the trivial twiddles fold away and the long double
+// codelets get the exact constants. The values are at most 1 in magnitude, so the tolerance is
+// relative to 1.
+static long double snap(long double v) {
+    static const long double exact[] = {0.0L, 0.5L, -0.5L, 1.0L, -1.0L, 0.70710678118654752440084436210484903L,
+                                        -0.70710678118654752440084436210484903L};
+    for(int k = 0; k < 7; k++) {
+        if(fabsl(v - exact[k]) <= 16 * LDBL_EPSILON) return exact[k];
+    }
+    return v;
+}
+
+// x times exp(-2*pi*i*k/n)
+static cx cx_twiddle(cx x, int k, int n) {
+    const long double pi = 3.141592653589793238462643383279502884L;
+    k %= n;
+    long double wr = snap(cosl(2.0L * pi * k / n));
+    long double wi = snap(-sinl(2.0L * pi * k / n));
+    cx z;
+    if(wi == 0.0L) {
+        z.r = make_mul(wr, x.r);
+        z.i = make_mul(wr, x.i);
+    } else if(wr == 0.0L) {
+        z.r = make_mul(-wi, x.i);
+        z.i = make_mul(wi, x.r);
+    } else if(fabsl(wr) == fabsl(wi)) {
+        // (wr + i wi) x = wr (x + i (wi/wr) x): 2 multiplies
+        if(wi == wr) {
+            z.r = make_mul(wr, make_sub(x.r, x.i));
+            z.i = make_mul(wr, make_add(x.i, x.r));
+        } else {
+            z.r = make_mul(wr, make_add(x.r, x.i));
+            z.i = make_mul(wr, make_sub(x.i, x.r));
+        }
+    } else {
+        z.r = make_sub(make_mul(wr, x.r), make_mul(wi, x.i));
+        z.i = make_add(make_mul(wr, x.i), make_mul(wi, x.r));
+    }
+    return z;
+}
+
+static int smallest_factor(int n) {
+    for(int p = 2; p * p <= n; p++) {
+        if(n % p == 0) return p;
+    }
+    return n;
+}
+
+// out[k] = sum_j in[j] exp(-2*pi*i*j*k/n)
+static void dft(int n, const cx *in, cx *out) {
+    if(n == 1) {
+        out[0] = in[0];
+        return;
+    }
+    if(n == 2) {
+        out[0] = cx_add(in[0], in[1]);
+        out[1] = cx_sub(in[0], in[1]);
+        return;
+    }
+
+    if((n & (n - 1)) == 0) {
+        // Split-radix: even points (n/2), points 1 mod 4 and 3 mod 4 (n/4 each)
+        int q = n / 4;
+        cx even[32], odd1[16] = {{0, 0}}, odd3[16] = {{0, 0}}, u[32], z1[16], z3[16];
+        for(int j = 0; j < 2*q; j++) even[j] = in[2*j];
+        for(int j = 0; j < q; j++) {
+            odd1[j] = in[4*j + 1];
+            odd3[j] = in[4*j + 3];
+        }
+        dft(2*q, even, u);
+        dft(q, odd1, z1);
+        dft(q, odd3, z3);
+        for(int k = 0; k < q; k++) {
+            cx t1 = cx_twiddle(z1[k], k, n);
+            cx t3 = cx_twiddle(z3[k], 3*k, n);
+            cx s = cx_add(t1, t3);
+            cx d = cx_mul_minus_i(cx_sub(t1, t3));
+            out[k] = cx_add(u[k], s);
+            out[k + 2*q] = cx_sub(u[k], s);
+            out[k + q] = cx_add(u[k + q], d);
+            out[k + 3*q] = cx_sub(u[k + q], d);
+        }
+        return;
+    }
+
+    int p = smallest_factor(n);
+    if(p == n) {
+        // Odd prime: with s_j = x_j + x_{n-j} and d_j = x_j - x_{n-j}, A_k = x_0 + sum_j cos(2 pi jk/n) s_j
+        // and B_k = sum_j sin(2 pi jk/n) d_j give X_k = A_k - i B_k and X_{n-k} = A_k + i B_k
+        const long double pi = 3.141592653589793238462643383279502884L;
+        int h = (n - 1) / 2;
+        cx s[8], d[8];
+        for(int j = 1; j <= h; j++) {
+            s[j] = cx_add(in[j], in[n - j]);
+            d[j] = cx_sub(in[j], in[n - j]);
+        }
+        out[0] = in[0];
+        for(int j = 1; j <= h; j++) out[0] = cx_add(out[0], s[j]);
+        for(int k = 1; k <= h; k++) {
+            cx a = in[0], b = {0, 0};
+            for(int j = 1; j <= h; j++) {
+                long double c = snap(cosl(2.0L * pi * (j * k % n) / n));
+                long double sn = snap(sinl(2.0L * pi * (j * k % n) / n));
+                cx cs = {make_mul(c, s[j].r), make_mul(c, s[j].i)};
+                cx sd = {make_mul(sn, d[j].r), make_mul(sn, d[j].i)};
+                a = cx_add(a, cs);
+                b = cx_add(b, sd);
+            }
+            cx ib = cx_mul_minus_i(b);
+            out[k] = cx_add(a, ib);
+            out[n - k] = cx_sub(a, ib);
+        }
+        return;
+    }
+
+    // Cooley-Tukey n = p m: p transforms of m points, twiddles, m transforms of p points
+    int m = n / p;
+    cx sub[64], col[8], res[8];
+    for(int q = 0; q < p; q++) {
+        cx seq[64];
+        for(int t = 0; t < m; t++) seq[t] = in[q + p*t];
+        dft(m, seq, sub + q*m);
+    }
+    for(int k = 0; k < m; k++) {
+        for(int q = 0; q < p; q++) col[q] = cx_twiddle(sub[q*m + k], q*k, n);
+        dft(p, col, res);
+        for(int r = 0; r < p; r++) out[k + r*m] = res[r];
+    }
+}
+
+static void mark(int a) {
+    if(a == 0 || nodes[a].used) return;
+    nodes[a].used = 1;
+    if(nodes[a].op == OP_ADD || nodes[a].op == OP_SUB) {
+        mark(nodes[a].a);
+        mark(nodes[a].b);
+    } else if(nodes[a].op == OP_NEG || nodes[a].op == OP_MUL) {
+        mark(nodes[a].a);
+    }
+}
+
+static int n_temps;
+
+// Constant c of the family, with a decimal point so that the suffix makes it a floating literal
+static void print_constant(FILE *f, long double c, const family *fam) {
+    char text[64];
+    snprintf(text, sizeof(text), "%.*Lg", fam->digits, fam->round(c));
+    int has_point = 0;
+    for(const char *t = text; *t; t++) {
+        if(*t == '.' || *t == 'e') has_point = 1;
+    }
+    fprintf(f, "%s%s%s", text, has_point ? "" : ".0", fam->suffix);
+}
+
+static void print_operand(FILE *f, int a, const family *fam) {
+    if(a == 0) {
+        print_constant(f, 0.0L, fam);
+    } else if(nodes[a].op == OP_IN_RE) {
+        fprintf(f, "x%dr", nodes[a].a);
+    } else if(nodes[a].op == OP_IN_IM) {
+        fprintf(f, "x%di", nodes[a].a);
+    } else {
+        fprintf(f, "t%d", nodes[a].name);
+    }
+}
+
+static void print_stride(FILE *f, int k, const char *stride) {
+    if(k == 0) fprintf(f, "0");
+    else if(k == 1) fprintf(f, "%s", stride);
+    else fprintf(f, "%d * %s", k, stride);
+}
+
+// Counts of the printed operations, for the comment of each codelet
+static int count_add, count_mul;
+
+static void print_codelet(FILE *f, int n, const family *fam) {
+    reset();
+    cx in[64] = {{0, 0}}, out[64];
+    for(int j = 0; j < n; j++) {
+        in[j].r = lookup(OP_IN_RE, j, 0, 0.0L);
+        in[j].i = lookup(OP_IN_IM, j, 0, 0.0L);
+    }
+    dft(n, in, out);
+    for(int k = 0; k < n; k++) {
+        mark(out[k].r);
+        mark(out[k].i);
+    }
+
+    count_add = count_mul = 0;
+    for(int a = 1; a < n_nodes; a++) {
+        if(!nodes[a].used) continue;
+        if(nodes[a].op == OP_ADD || nodes[a].op == OP_SUB) count_add++;
+        if(nodes[a].op == OP_MUL) count_mul++;
+    }
+
+    fprintf(f, "\n// %d points: %d additions, %d multiplications\n", n, count_add, count_mul);
+    fprintf(f, "void %s_codelet_%d(const %s *ri, const %s *ii, %s *ro, %s *io, long is, long os) {\n",
+            fam->prefix, n, fam->type, fam->type, fam->type, fam->type);
+    for(int j = 0; j < n; j++) {
+        fprintf(f, "    const %s x%dr = ri[", fam->type, j);
+        print_stride(f, j, "is");
+        fprintf(f, "], x%di = ii[", j);
+        print_stride(f, j, "is");
+        fprintf(f, "];\n");
+    }
+
+    n_temps = 0;
+    for(int a = 1; a < n_nodes; a++) {
+        node *nd = &nodes[a];
+        if(!nd->used || nd->op == OP_IN_RE || nd->op == OP_IN_IM) continue;
+        nd->name = n_temps++;
+        fprintf(f, "    const %s t%d = ", fam->type, nd->name);
+        switch(nd->op) {
+            case OP_ADD:
+                print_operand(f, nd->a, fam);
+                fprintf(f, " + ");
+                print_operand(f, nd->b, fam);
+                break;
+            case OP_SUB:
+                print_operand(f, nd->a, fam);
+                fprintf(f, " - ");
+                print_operand(f, nd->b, fam);
+                break;
+            case OP_NEG:
+                fprintf(f, "-");
+                print_operand(f, nd->a, fam);
+                break;
+            case OP_MUL:
+                print_constant(f, nd->c, fam);
+                fprintf(f, " * ");
+                print_operand(f, nd->a, fam);
+                break;
+            default:
+                break;
+        }
+        fprintf(f, ";\n");
+    }
+
+    for(int k = 0; k < n; k++) {
+        fprintf(f, "    ro[");
+        print_stride(f, k, "os");
+        fprintf(f, "] = ");
+        print_operand(f, out[k].r, fam);
+        fprintf(f, ";\n    io[");
+        print_stride(f, k, "os");
+        fprintf(f, "] = ");
+        print_operand(f, out[k].i, fam);
+        fprintf(f, ";\n");
+    }
+    fprintf(f, "}\n");
+}
+
+int main(int argc, char **argv) {
+    if(argc != 3) {
+        printf("Usage: %s fft_codelets.c fft_codelets.h\n", argv[0]);
+        return 1;
+    }
+
+    FILE *c = fopen(argv[1], "w");
+    FILE *h = fopen(argv[2], "w");
+    if(!c || !h) {
+        printf("gen_codelets: cannot create the output files\n");
+        return 1;
+    }
+
+    fprintf(h, "#ifndef FFT_CODELETS_H\n#define FFT_CODELETS_H\n\n");
+    fprintf(h, "// Generated by gen_codelets.c, do not edit.\n");
+    fprintf(h, "// Straight-line DFTs of fixed sizes. A codelet reads the n points (ri[j*is], ii[j*is]), real and\n");
+    fprintf(h, "// imaginary parts through separate pointers and strides in scalars, and writes the forward\n");
+    fprintf(h, "// transform, sum_j x_j exp(-2*pi*i*j*k/n), to (ro[k*os], io[k*os]). All the inputs are loaded\n");
+    fprintf(h, "// before the first store, so the transform may be done in place. For interleaved complex data\n");
+    fprintf(h, "// (Complex, fftw_complex) pass ri = (double*)x, ii = ri + 1 and twice the stride in elements;\n");
+    fprintf(h, "// for split data pass the two arrays. The backward transform is the forward one with the real\n");
+    fprintf(h, "// and imaginary pointers swapped, on input and output.\n");
+    fprintf(h, "// fft_codelet_N works on doubles, fftf_codelet_N on floats and fftl_codelet_N on long doubles.\n\n");
+    fprintf(h, "#define FFT_CODELET_MAX %d\n", sizes[N_SIZES - 1]);
+    for(int m = 0; m < N_FAMILIES; m++) {
+        const family *fam = &families[m];
+        fprintf(h, "\ntypedef void (*%s_codelet)(const %s *ri, const %s *ii, %s *ro, %s *io, long is, long os);\n",
+                fam->prefix, fam->type, fam->type, fam->type, fam->type);
+        for(int s = 0; s < N_SIZES; s++) {
+            fprintf(h, "void %s_codelet_%d(const %s *ri, const %s *ii, %s *ro, %s *io, long is, long os);\n",
+                    fam->prefix, sizes[s], fam->type, fam->type, fam->type, fam->type);
+        }
+        fprintf(h, "// Codelet of n points, NULL if there is none\n%s_codelet %s_codelet_find(int n);\n",
+                fam->prefix, fam->prefix);
+    }
+    fprintf(h, "\n#endif\n");
+
+    fprintf(c, "// Generated by gen_codelets.c, do not edit.\n\n#include \"fft_codelets.h\"\n");
+    for(int m = 0; m < N_FAMILIES; m++) {
+        const family *fam = &families[m];
+        for(int s = 0; s < N_SIZES; s++) {
+            print_codelet(c, sizes[s], fam);
+        }
+        fprintf(c, "\n%s_codelet %s_codelet_find(int n) {\n    switch(n) {\n", fam->prefix, fam->prefix);
+        for(int s = 0; s < N_SIZES; s++) {
+            fprintf(c, "        case %d: return %s_codelet_%d;\n", sizes[s], fam->prefix, sizes[s]);
+        }
+        fprintf(c, "        default: return 0;\n    }\n}\n");
+    }
+
+    fclose(c);
+    fclose(h);
+    return 0;
+}
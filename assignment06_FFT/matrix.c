@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "matrix.h"
+
+#define MATRIX_ALIGNMENT 64
+
+// Header in front of the row pointers; block is the aligned data allocation, NULL for a view
+typedef struct {
+    matrix_layout layout;
+    double *block;
+} matrix_header;
+
+static matrix_header *header_of(double *const *m) {
+    return (matrix_header *)((char *)m - sizeof(matrix_header));
+}
+
+// Header and row pointers in one allocation, rows set from layout
+static double **make_rows(const matrix_layout *layout, double *block) {
+    matrix_header *header = (matrix_header *)malloc(sizeof(matrix_header) + layout->rows * sizeof(double *));
+    if (!header) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    header->layout = *layout;
+    header->block = block;
+
+    double **m = (double **)(header + 1);
+    for (long i = 0; i < layout->rows; i++) {
+        m[i] = layout->data + i * layout->stride;
+    }
+    return m;
+}
+
+static double **create(int rows, int cols, long stride) {
+    void *block = NULL;
+    // posix_memalign rejects a size of 0 on some systems; allocate at least one double
+    size_t size = (size_t)rows * stride * sizeof(double);
+    if (posix_memalign(&block, MATRIX_ALIGNMENT, size > 0 ? size : sizeof(double)) != 0) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    matrix_layout layout = {(double *)block, rows, cols, stride};
+    return make_rows(&layout, (double *)block);
+}
+
+double **matrix_create(int rows, int cols) {
+    return create(rows, cols, cols);
+}
+
+double **matrix_create_padded(int rows, int cols) {
+    const long per_line = MATRIX_ALIGNMENT / sizeof(double);
+    return create(rows, cols, (cols + per_line - 1) / per_line * per_line);
+}
+
+double **matrix_view(double **m, int row0, int col0, int rows, int cols) {
+    const matrix_layout *parent = matrix_layout_of(m);
+    if (row0 < 0 || col0 < 0 || rows < 0 || cols < 0 || row0 + rows > parent->rows || col0 + cols > parent->cols) {
+        printf("Matrix view out of range!\n");
+        exit(1);
+    }
+    matrix_layout layout = {parent->data + row0 * parent->stride + col0, rows, cols, parent->stride};
+    return make_rows(&layout, NULL);
+}
+
+void matrix_destroy(double **m) {
+    if (!m) return;
+    matrix_header *header = header_of(m);
+    free(header->block);
+    free(header);
+}
+
+const matrix_layout *matrix_layout_of(double *const *m) {
+    return &header_of(m)->layout;
+}
+
+double *matrix_data(double *const *m) {
+    return header_of(m)->layout.data;
+}
+
+long matrix_rows(double *const *m) {
+    return header_of(m)->layout.rows;
+}
+
+long matrix_cols(double *const *m) {
+    return header_of(m)->layout.cols;
+}
+
+long matrix_stride(double *const *m) {
+    return header_of(m)->layout.stride;
+}
+
+int matrix_is_contiguous(double *const *m) {
+    const matrix_layout *layout = matrix_layout_of(m);
+    return layout->stride == layout->cols || layout->rows <= 1;
+}
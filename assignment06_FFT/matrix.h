@@ -0,0 +1,36 @@
+#ifndef MATRIX_H
+#define MATRIX_H
+
+// Dense matrices of doubles in one 64-byte-aligned block, handed out as arrays of row pointers:
+// m[i][j] works as with a malloc per row, and a matrix can be passed to any function taking a
+// double **. Row i starts at matrix_data(m) + i * matrix_stride(m), so the whole matrix can also
+// be given to code expecting one row-major array (the FFT plans, FFTW, writers) without a copy.
+// The row pointers and the sizes are kept in a hidden header just before m[0], so the functions
+// below only accept matrices created by this module, not arbitrary double **.
+// 64 bytes is a cache line and an AVX-512 vector, more than FFTW asks of fftw_malloc'ed arrays.
+
+typedef struct {
+    double *data;       // first element, m[0][0]
+    long rows, cols;
+    long stride;        // doubles from the start of one row to the start of the next (leading dimension)
+} matrix_layout;
+
+// rows x cols matrix with stride cols, one contiguous row-major array; the elements are not set
+double **matrix_create(int rows, int cols);
+// Same, with the stride rounded up to 8 doubles so that every row starts on a 64-byte boundary
+double **matrix_create_padded(int rows, int cols);
+// rows x cols sub-matrix of m starting at (row0, col0): new row pointers into the data of m, with the
+// stride of m. Destroy it before m.
+double **matrix_view(double **m, int row0, int col0, int rows, int cols);
+// Frees a matrix or a view (a view leaves the data alone); NULL is ignored
+void matrix_destroy(double **m);
+
+const matrix_layout *matrix_layout_of(double *const *m);
+double *matrix_data(double *const *m);
+long matrix_rows(double *const *m);
+long matrix_cols(double *const *m);
+long matrix_stride(double *const *m);
+// 1 if the rows follow each other without padding (stride == cols), as FFT input/output must
+int matrix_is_contiguous(double *const *m);
+
+#endif